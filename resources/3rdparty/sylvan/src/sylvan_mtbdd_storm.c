@@ -982,3 +982,110 @@ TASK_IMPL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, dd, mtbdd_uapply_op, op, size_t,
     // Caching would be done here, but is omitted (as this is the purpose of this function).
     return result;
 }
+
+TASK_IMPL_5(MTBDD, mtbdd_permute_block, MTBDD, dd, const uint32_t*, permutation, uint32_t, first, uint32_t, last, uint64_t, permutation_id)
+{
+    /* Check terminal case */
+    if (mtbdd_isleaf(dd)) return dd;
+    
+    /* The variables below the permuted block keep their positions, so the whole sub-MTBDD can be reused */
+    mtbddnode_t ndd = MTBDD_GETNODE(dd);
+    uint32_t var = mtbddnode_getvariable(ndd);
+    if (var > last) return dd;
+    
+    /* Maybe perform garbage collection */
+    sylvan_gc_test();
+    
+    /* Check cache */
+    MTBDD result;
+    if (cache_get3(CACHE_MTBDD_PERMUTE_BLOCK, dd, permutation_id, 0, &result)) {
+        return result;
+    }
+    
+    /* Recursive */
+    mtbdd_refs_spawn(SPAWN(mtbdd_permute_block, node_gethigh(dd, ndd), permutation, first, last, permutation_id));
+    MTBDD low = mtbdd_refs_push(CALL(mtbdd_permute_block, node_getlow(dd, ndd), permutation, first, last, permutation_id));
+    MTBDD high = mtbdd_refs_sync(SYNC(mtbdd_permute_block));
+    mtbdd_refs_pop(1);
+    
+    if (var < first) {
+        // The variables of the results are all below var, so we can directly create the node.
+        result = mtbdd_makenode(var, low, high);
+    } else {
+        // The variables of the results may lie above the new variable, so we need to restore the order.
+        mtbdd_refs_push(low);
+        mtbdd_refs_push(high);
+        MTBDD new_var = mtbdd_ithvar(permutation[var]);
+        mtbdd_refs_push(new_var);
+        result = CALL(mtbdd_ite, new_var, high, low);
+        mtbdd_refs_pop(3);
+    }
+    
+    /* Store in cache */
+    cache_put3(CACHE_MTBDD_PERMUTE_BLOCK, dd, permutation_id, 0, result);
+    return result;
+}
+
+VOID_TASK_IMPL_3(mtbdd_protected_permute_block, const uint32_t*, permutation, uint32_t, first, uint32_t, last)
+{
+    // Every permutation gets a fresh identifier, because the callers typically reuse the permutation array.
+    static uint64_t next_permutation_id = 0;
+    uint64_t permutation_id = next_permutation_id++;
+    
+    uint64_t *it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *root = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (*root != mtbdd_invalid) {
+            *root = CALL(mtbdd_permute_block, *root, permutation, first, last, permutation_id);
+        }
+    }
+}
+
+size_t
+mtbdd_protected_nodecount(void)
+{
+    size_t result = 0;
+    uint64_t *it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *root = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (*root != mtbdd_invalid) result += mtbdd_nodecount_mark(*root);
+    }
+    it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *root = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (*root != mtbdd_invalid) mtbdd_unmark_rec(*root);
+    }
+    return result;
+}
+
+static void
+mtbdd_level_counts_mark(MTBDD mtbdd, size_t *counts, uint32_t num_vars)
+{
+    if (mtbdd == mtbdd_true || mtbdd == mtbdd_false) return;
+    mtbddnode_t n = MTBDD_GETNODE(mtbdd);
+    if (mtbddnode_getmark(n)) return;
+    mtbddnode_setmark(n, 1);
+    if (mtbddnode_isleaf(n)) return;
+    uint32_t var = mtbddnode_getvariable(n);
+    if (var < num_vars) counts[var]++;
+    mtbdd_level_counts_mark(mtbddnode_getlow(n), counts, num_vars);
+    mtbdd_level_counts_mark(mtbddnode_gethigh(n), counts, num_vars);
+}
+
+void
+mtbdd_protected_level_counts(size_t *counts, uint32_t num_vars)
+{
+    uint32_t var;
+    for (var = 0; var < num_vars; var++) counts[var] = 0;
+    
+    uint64_t *it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *root = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (*root != mtbdd_invalid) mtbdd_level_counts_mark(*root, counts, num_vars);
+    }
+    it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *root = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (*root != mtbdd_invalid) mtbdd_unmark_rec(*root);
+    }
+}
@@ -148,3 +148,29 @@ TASK_DECL_3(BDD, mtbdd_max_abstract_representative, MTBDD, MTBDD, uint32_t);
 
 TASK_DECL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, mtbdd_uapply_op, size_t);
 #define mtbdd_uapply_nocache(dd, op, param) CALL(mtbdd_uapply_nocache, dd, op, param)
+
+/**
+ * Renames the variables of the given MTBDD, i.e. replaces every variable var in [first, last] by permutation[var].
+ * The permutation must map the block [first, last] onto itself; all other variables are left untouched. Results are
+ * cached under the given identifier, so it must be unique for each permutation.
+ */
+TASK_DECL_5(MTBDD, mtbdd_permute_block, MTBDD, const uint32_t*, uint32_t, uint32_t, uint64_t);
+#define mtbdd_permute_block(dd, permutation, first, last, permutation_id) CALL(mtbdd_permute_block, dd, permutation, first, last, permutation_id)
+
+/**
+ * Renames the variables of all protected MTBDDs (and thereby of all C++ Bdd/Mtbdd objects) according to the given
+ * permutation of the block [first, last]. This must not be called while other operations are running.
+ */
+VOID_TASK_DECL_3(mtbdd_protected_permute_block, const uint32_t*, uint32_t, uint32_t);
+#define mtbdd_protected_permute_block(permutation, first, last) CALL(mtbdd_protected_permute_block, permutation, first, last)
+
+/**
+ * Counts the number of distinct nodes of all protected MTBDDs.
+ */
+size_t mtbdd_protected_nodecount(void);
+
+/**
+ * Counts the number of distinct inner nodes of all protected MTBDDs per variable. The array must have space for
+ * num_vars entries.
+ */
+void mtbdd_protected_level_counts(size_t *counts, uint32_t num_vars);
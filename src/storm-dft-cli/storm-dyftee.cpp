@@ -13,6 +13,9 @@
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/TopologicalEquationSolverSettings.h"
+#include "storm/settings/modules/StreamingEquationSolverSettings.h"
+#include "storm/settings/modules/TimeBoundedSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 
 #include "storm-dft/parser/DFTGalileoParser.h"
@@ -117,6 +120,9 @@ void initializeSettings() {
     //storm::settings::addModule<storm::settings::modules::TopologicalValueIterationEquationSolverSettings>();
     //storm::settings::addModule<storm::settings::modules::ParametricSettings>();
     storm::settings::addModule<storm::settings::modules::EliminationSettings>();
+    storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::StreamingEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::TimeBoundedSolverSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
     
     // For translation into JANI via GSPN.
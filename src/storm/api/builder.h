@@ -2,6 +2,7 @@
 
 #include "storm/parser/AutoParser.h"
 #include "storm/parser/DirectEncodingParser.h"
+#include "storm/parser/BinaryEncodingParser.h"
 #include "storm/parser/ImcaMarkovAutomatonParser.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -25,6 +26,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/IOSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/JitBuilderSettings.h"
 
 #include "storm/utility/macros.h"
@@ -38,6 +40,7 @@ namespace storm {
             if (model.isPrismProgram()) {
                 typename storm::builder::DdPrismModelBuilder<LibraryType, ValueType>::Options options;
                 options = typename storm::builder::DdPrismModelBuilder<LibraryType, ValueType>::Options(formulas);
+                options.variableOrder = storm::settings::getModule<storm::settings::modules::CoreSettings>().getDdVariableOrder();
                 
                 storm::builder::DdPrismModelBuilder<LibraryType, ValueType> builder;
                 return builder.build(model.asPrismProgram(), options);
@@ -45,6 +48,7 @@ namespace storm {
                 STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Building symbolic model from this model description is unsupported.");
                 typename storm::builder::DdJaniModelBuilder<LibraryType, ValueType>::Options options;
                 options = typename storm::builder::DdJaniModelBuilder<LibraryType, ValueType>::Options(formulas);
+                options.variableOrder = storm::settings::getModule<storm::settings::modules::CoreSettings>().getDdVariableOrder();
                 
                 storm::builder::DdJaniModelBuilder<LibraryType, ValueType> builder;
                 return builder.build(model.asJaniModel(), options);
@@ -137,6 +141,16 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
         }
         
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Only floating point models can be loaded from the binary format.");
+        }
+        
+        template<>
+        inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitBinaryModel(std::string const& binaryFile) {
+            return storm::parser::BinaryEncodingParser<double>::parseModel(binaryFile);
+        }
+        
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
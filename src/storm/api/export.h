@@ -2,14 +2,21 @@
 
 #include "storm/storage/jani/JSONExporter.h"
 
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/JaniExportSettings.h"
 
 #include "storm/utility/DirectEncodingExporter.h"
+#include "storm/utility/BinaryEncodingExporter.h"
 #include "storm/utility/file.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
     namespace api {
         
@@ -25,6 +32,46 @@ namespace storm {
             storm::utility::closeFile(stream);
         }
         
+        template <typename ValueType>
+        void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Only floating point models can be exported in the binary format.");
+        }
+        
+        template <>
+        inline void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            STORM_PRINT_AND_LOG("Write to file " << filename << "." << std::endl);
+            storm::exporter::binaryExportSparseModel(stream, model);
+            storm::utility::closeFile(stream);
+        }
+        
+        /*!
+         * Writes the results of a time series (see verifyTimeSeriesWithSparseEngine) as a comma-separated table with
+         * one row per time bound and one column per given state.
+         */
+        template <typename ValueType>
+        void exportTimeSeries(std::vector<double> const& timeBounds, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> const& results, storm::storage::BitVector const& states, std::string const& filename) {
+            STORM_LOG_THROW(timeBounds.size() == results.size(), storm::exceptions::InvalidArgumentException, "The number of results does not match the number of time bounds.");
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            stream << "time";
+            for (auto state : states) {
+                stream << ",state" << state;
+            }
+            stream << std::endl;
+            for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                STORM_LOG_THROW(results[boundIndex] && results[boundIndex]->isExplicitQuantitativeCheckResult(), storm::exceptions::InvalidArgumentException, "Missing quantitative result for time bound " << timeBounds[boundIndex] << ".");
+                storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& result = results[boundIndex]->template asExplicitQuantitativeCheckResult<ValueType>();
+                stream << timeBounds[boundIndex];
+                for (auto state : states) {
+                    stream << "," << result[state];
+                }
+                stream << std::endl;
+            }
+            storm::utility::closeFile(stream);
+        }
+        
         template <typename ValueType>
         void exportSparseModelAsDot(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
             std::ofstream stream;
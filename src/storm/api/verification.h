@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
@@ -13,12 +15,18 @@
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
+#include "storm/logic/Formulas.h"
+
+#include "storm/storage/expressions/ExpressionManager.h"
+
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
 
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Mdp.h"
 
 #include "storm/settings/modules/CoreSettings.h"
@@ -27,6 +35,8 @@
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
 
 namespace storm {
     namespace api {
@@ -86,6 +96,30 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exploration engine does not support data type.");
         }
         
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            STORM_LOG_THROW(model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC || model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::CTMC, storm::exceptions::NotSupportedException, "Currently statistical model checking is only available for DTMCs and CTMCs.");
+            
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+                storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model);
+                if (checker.canHandle(task)) {
+                    result = checker.check(task);
+                }
+            } else {
+                storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(model);
+                if (checker.canHandle(task)) {
+                    result = checker.check(task);
+                }
+            }
+            return result;
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+        }
+        
         template<typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -167,6 +201,142 @@ namespace storm {
             return result;
         }
         
+        /*!
+         * Checks all given tasks with the given model checker such that it can share precomputations among them. The
+         * results of tasks the model checker cannot handle are null.
+         */
+        template<typename ModelCheckerType, typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> checkAllWithModelChecker(ModelCheckerType& modelchecker, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> handledTasks;
+            std::vector<uint64_t> handledTaskIndices;
+            for (uint64_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+                if (modelchecker.canHandle(tasks[taskIndex])) {
+                    handledTasks.push_back(tasks[taskIndex]);
+                    handledTaskIndices.push_back(taskIndex);
+                }
+            }
+            
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> handledResults = modelchecker.checkAll(handledTasks);
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(tasks.size());
+            for (uint64_t index = 0; index < handledTaskIndices.size(); ++index) {
+                results[handledTaskIndices[index]] = std::move(handledResults[index]);
+            }
+            return results;
+        }
+        
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
+                storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+                return checkAllWithModelChecker(modelchecker, tasks);
+            } else {
+                storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+                return checkAllWithModelChecker(modelchecker, tasks);
+            }
+        }
+        
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            return checkAllWithModelChecker(modelchecker, tasks);
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            return checkAllWithModelChecker(modelchecker, tasks);
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const&, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MDPs with this data type.");
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& ma, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            // Close the MA, if it is not already closed.
+            if (!ma->isClosed()) {
+                STORM_LOG_WARN("Closing Markov automaton. Consider closing the MA before verification.");
+                ma->close();
+            }
+            
+            storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<ValueType>> modelchecker(*ma);
+            return checkAllWithModelChecker(modelchecker, tasks);
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const&, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MAs with this data type.");
+        }
+        
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            if (model->getType() == storm::models::ModelType::Dtmc) {
+                return verifyWithSparseEngine(model->template as<storm::models::sparse::Dtmc<ValueType>>(), tasks);
+            } else if (model->getType() == storm::models::ModelType::Ctmc) {
+                return verifyWithSparseEngine(model->template as<storm::models::sparse::Ctmc<ValueType>>(), tasks);
+            } else if (model->getType() == storm::models::ModelType::Mdp) {
+                return verifyWithSparseEngine(model->template as<storm::models::sparse::Mdp<ValueType>>(), tasks);
+            } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
+                return verifyWithSparseEngine(model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), tasks);
+            }
+            
+            // For all other model types, the tasks are checked one after another.
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+            for (auto const& task : tasks) {
+                results.push_back(verifyWithSparseEngine(model, task));
+            }
+            return results;
+        }
+        
+        /*!
+         * Computes the probabilities of the given reachability property within [0, t] for each of the given time
+         * bounds t on a CTMC or Markov automaton. All time bounds are handled by one pass of the transient analysis
+         * (CTMCs) or of the digitized value iteration (Markov automata).
+         *
+         * @param task The task for a formula of the form P=? [phi U psi] or P=? [F psi] (Pmin/Pmax for Markov
+         * automata). If the path formula is time-bounded, its time bound is replaced by the given ones.
+         * @param timeBounds The time bounds in ascending order.
+         * @return One explicit quantitative check result per time bound.
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyTimeSeriesWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timeBounds) {
+            STORM_LOG_THROW(model->getType() == storm::models::ModelType::Ctmc || model->getType() == storm::models::ModelType::MarkovAutomaton, storm::exceptions::NotSupportedException, "Time series can only be computed for CTMCs and Markov automata.");
+            STORM_LOG_THROW(std::is_sorted(timeBounds.begin(), timeBounds.end()), storm::exceptions::InvalidArgumentException, "The time bounds of a time series need to be sorted.");
+            
+            storm::logic::Formula const& formula = task.getFormula();
+            STORM_LOG_THROW(formula.isProbabilityOperatorFormula(), storm::exceptions::InvalidPropertyException, "Time series can only be computed for probability operator formulas, but got '" << formula << "'.");
+            storm::logic::ProbabilityOperatorFormula const& probabilityOperatorFormula = formula.asProbabilityOperatorFormula();
+            storm::logic::Formula const& pathFormula = probabilityOperatorFormula.getSubformula();
+            std::shared_ptr<storm::logic::Formula const> leftSubformula;
+            std::shared_ptr<storm::logic::Formula const> rightSubformula;
+            if (pathFormula.isEventuallyFormula()) {
+                leftSubformula = storm::logic::Formula::getTrueFormula();
+                rightSubformula = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+            } else if (pathFormula.isUntilFormula()) {
+                leftSubformula = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+                rightSubformula = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+            } else if (pathFormula.isBoundedUntilFormula() && !pathFormula.asBoundedUntilFormula().isMultiDimensional()) {
+                leftSubformula = pathFormula.asBoundedUntilFormula().getLeftSubformula().asSharedPointer();
+                rightSubformula = pathFormula.asBoundedUntilFormula().getRightSubformula().asSharedPointer();
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "Time series can only be computed for until and eventually formulas, but got '" << pathFormula << "'.");
+            }
+            
+            // Create one task per time bound. The model checkers then handle the tasks together.
+            std::shared_ptr<storm::expressions::ExpressionManager> expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+            std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> tasks;
+            formulas.reserve(timeBounds.size());
+            tasks.reserve(timeBounds.size());
+            for (auto const& timeBound : timeBounds) {
+                std::shared_ptr<storm::logic::Formula const> boundedUntilFormula = std::make_shared<storm::logic::BoundedUntilFormula const>(leftSubformula, rightSubformula, boost::none, storm::logic::TimeBound(false, expressionManager->rational(timeBound)), storm::logic::TimeBoundReference(storm::logic::TimeBoundType::Time));
+                formulas.push_back(std::make_shared<storm::logic::ProbabilityOperatorFormula const>(boundedUntilFormula, probabilityOperatorFormula.getOperatorInformation()));
+                tasks.push_back(task.substituteFormula(*formulas.back()));
+            }
+            return verifyWithSparseEngine(model, tasks);
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(std::shared_ptr<storm::models::symbolic::Dtmc<DdType, ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -35,7 +35,7 @@ namespace storm {
             return boost::get<storm::expressions::Expression>(labelOrExpression);
         }
         
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), explorationChecks(false), explorationShowProgress(false), explorationShowProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), explorationChecks(false), explorationShowProgress(false), explorationShowProgressDelay(0), expressionEvaluatorType(ExpressionEvaluatorType::Exprtk) {
             // Intentionally left empty.
         }
         
@@ -57,6 +57,7 @@ namespace storm {
             explorationChecks = storm::settings::getModule<storm::settings::modules::IOSettings>().isExplorationChecksSet();
             explorationShowProgress = storm::settings::getModule<storm::settings::modules::IOSettings>().isExplorationShowProgressSet();
             explorationShowProgressDelay = storm::settings::getModule<storm::settings::modules::IOSettings>().getExplorationShowProgressDelay();
+            expressionEvaluatorType = storm::settings::getModule<storm::settings::modules::IOSettings>().getExpressionEvaluatorType();
         }
         
         void BuilderOptions::preserveFormula(storm::logic::Formula const& formula) {
@@ -179,6 +180,15 @@ namespace storm {
             return *this;
         }
         
+        ExpressionEvaluatorType BuilderOptions::getExpressionEvaluatorType() const {
+            return expressionEvaluatorType;
+        }
+        
+        BuilderOptions& BuilderOptions::setExpressionEvaluatorType(ExpressionEvaluatorType newValue) {
+            expressionEvaluatorType = newValue;
+            return *this;
+        }
+        
         BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
             STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
             rewardModelNames.emplace_back(rewardModelName);
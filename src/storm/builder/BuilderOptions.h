@@ -8,6 +8,7 @@
 #include <boost/optional.hpp>
 
 #include "storm/storage/expressions/Expression.h"
+#include "storm/builder/ExpressionEvaluatorType.h"
 
 namespace storm {
     namespace expressions {
@@ -96,6 +97,7 @@ namespace storm {
             bool isExplorationChecksSet() const;
             bool isExplorationShowProgressSet() const;
             uint64_t getExplorationShowProgressDelay() const;
+            ExpressionEvaluatorType getExpressionEvaluatorType() const;
             
             BuilderOptions& setBuildAllRewardModels();
             BuilderOptions& addRewardModel(std::string const& rewardModelName);
@@ -108,6 +110,7 @@ namespace storm {
             BuilderOptions& setBuildStateValuations(bool newValue);
             BuilderOptions& setBuildChoiceOrigins(bool newValue);
             BuilderOptions& setExplorationChecks(bool newValue);
+            BuilderOptions& setExpressionEvaluatorType(ExpressionEvaluatorType newValue);
             
         private:
             /// A flag that indicates whether all reward models are to be built. In this case, the reward model names are
@@ -147,6 +150,9 @@ namespace storm {
             
             /// The delay for printing progress information.
             uint64_t explorationShowProgressDelay;
+            
+            /// The backend that is used to evaluate expressions during exploration.
+            ExpressionEvaluatorType expressionEvaluatorType;
         };
         
     }
@@ -46,18 +46,18 @@ namespace storm {
     namespace builder {
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrder(DdVariableOrder::Declaration) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrder(DdVariableOrder::Declaration) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrder(DdVariableOrder::Declaration) {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -258,13 +258,16 @@ namespace storm {
             
             // The parameters that appear in the model.
             std::set<storm::RationalFunctionVariable> parameters;
+            
+            // The (non-transient) model variables in the order in which their meta variables were created.
+            std::vector<storm::expressions::Variable> orderedVariables;
         };
         
         // A class responsible for creating the necessary variables for a subsequent composition of automata.
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, DdVariableOrder const& variableOrder = DdVariableOrder::Declaration) : model(model), automata(), actionInformation(actionInformation), variableOrder(variableOrder) {
                 // Intentionally left empty.
             }
             
@@ -272,6 +275,7 @@ namespace storm {
                 // First, check whether every automaton appears exactly once in the system composition. Simultaneously,
                 // we determine the set of non-silent actions used by the composition.
                 automata.clear();
+                variableToMetaVariablesMap.clear();
                 this->model.getSystemComposition().accept(*this, boost::none);
                 STORM_LOG_THROW(automata.size() == this->model.getNumberOfAutomata(), storm::exceptions::InvalidArgumentException, "Cannot build symbolic model from JANI model whose system composition refers to a subset of automata.");
                 
@@ -330,12 +334,16 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.markovNondeterminismVariable);
                 }
                 
+                // Create the meta variables for the locations and the non-transient variables in the order determined
+                // by the heuristic. The order of creation determines the order of the DD variables.
+                createMetaVariables(result);
+                
                 for (auto const& automatonName : this->automata) {
                     storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
                     
-                    // Start by creating a meta variable for the location of the automaton.
+                    // Start by retrieving the meta variable for the location of the automaton.
                     storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(locationExpressionVariable);
                     result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
                     result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -400,6 +408,51 @@ namespace storm {
                 return result;
             }
             
+            void createMetaVariables(CompositionVariables<Type, ValueType>& result) {
+                std::vector<storm::expressions::Variable> declaredVariables;
+                std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> variableToBoundsMap;
+                std::map<storm::expressions::Variable, std::string> variableToNameMap;
+                for (auto const& automatonName : this->automata) {
+                    storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
+                    storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+                    declaredVariables.push_back(locationExpressionVariable);
+                    variableToBoundsMap.emplace(locationExpressionVariable, std::make_pair(0, automaton.getNumberOfLocations() - 1));
+                    variableToNameMap.emplace(locationExpressionVariable, "l_" + automaton.getName());
+                }
+                
+                auto declareVariable = [&] (storm::jani::Variable const& variable) {
+                    // Only create the variable if it's non-transient.
+                    if (variable.isTransient()) {
+                        return;
+                    }
+                    
+                    STORM_LOG_THROW(variable.isBooleanVariable() || variable.isBoundedIntegerVariable(), storm::exceptions::InvalidArgumentException, "Invalid type of variable in JANI model.");
+                    declaredVariables.push_back(variable.getExpressionVariable());
+                    if (variable.isBoundedIntegerVariable()) {
+                        variableToBoundsMap.emplace(variable.getExpressionVariable(), std::make_pair(variable.asBoundedIntegerVariable().getLowerBound().evaluateAsInt(), variable.asBoundedIntegerVariable().getUpperBound().evaluateAsInt()));
+                    }
+                    variableToNameMap.emplace(variable.getExpressionVariable(), variable.getExpressionVariable().getName());
+                };
+                for (auto const& variable : this->model.getGlobalVariables()) {
+                    declareVariable(variable);
+                }
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& variable : automaton.getVariables()) {
+                        declareVariable(variable);
+                    }
+                }
+                
+                result.orderedVariables = computeDdVariableOrder(this->model, declaredVariables, variableOrder);
+                for (auto const& variable : result.orderedVariables) {
+                    auto boundsIt = variableToBoundsMap.find(variable);
+                    if (boundsIt != variableToBoundsMap.end()) {
+                        variableToMetaVariablesMap.emplace(variable, result.manager->addMetaVariable(variableToNameMap.at(variable), boundsIt->second.first, boundsIt->second.second));
+                    } else {
+                        variableToMetaVariablesMap.emplace(variable, result.manager->addMetaVariable(variableToNameMap.at(variable)));
+                    }
+                }
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -411,9 +464,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BoundedIntegerVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                int_fast64_t low = variable.getLowerBound().evaluateAsInt();
-                int_fast64_t high = variable.getUpperBound().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -433,7 +484,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BooleanVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = variableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -456,6 +507,10 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            DdVariableOrder variableOrder;
+            
+            // The meta variables created for the locations and the non-transient variables of the model.
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1951,7 +2006,7 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options.variableOrder);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -2000,6 +2055,19 @@ namespace storm {
             // Build the label to expressions mapping.
             modelComponents.labelToExpressionMap = buildLabelExpressions(preparedModel, variables, options);
             
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                std::vector<std::string> variableNames;
+                for (auto const& variable : variables.orderedVariables) {
+                    variableNames.push_back(variable.getName());
+                }
+                std::cout << std::endl;
+                std::cout << "Statistics:" << std::endl;
+                std::cout << "    * variable order (" << options.variableOrder << "): " << boost::algorithm::join(variableNames, ", ") << std::endl;
+                std::cout << "    * nodes (transition matrix): " << modelComponents.transitionMatrix.getNodeCount() << std::endl;
+                std::cout << "    * nodes (reachable states): " << modelComponents.reachableStates.getNodeCount() << std::endl;
+                std::cout << std::endl;
+            }
+            
             // Finally, create the model.
             return createModel(preparedModel.getModelType(), variables, modelComponents);
         }
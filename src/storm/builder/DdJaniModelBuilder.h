@@ -6,6 +6,8 @@
 
 #include "storm/logic/Formula.h"
 
+#include "storm/builder/DdVariableOrder.h"
+
 
 namespace storm {
     namespace models {
@@ -103,6 +105,9 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<storm::expressions::Expression> negatedTerminalStates;
+                
+                // The heuristic used to determine the order of the DD variables of the model variables.
+                DdVariableOrder variableOrder;
             };
                         
             /*!
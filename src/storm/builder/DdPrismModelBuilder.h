@@ -8,6 +8,7 @@
 
 #include "storm/logic/Formulas.h"
 #include "storm/adapters/AddExpressionAdapter.h"
+#include "storm/builder/DdVariableOrder.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -87,6 +88,9 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<boost::variant<storm::expressions::Expression, std::string>> negatedTerminalStates;
+                
+                // The heuristic used to determine the order of the DD variables of the program variables.
+                DdVariableOrder variableOrder;
             };
             
             /*!
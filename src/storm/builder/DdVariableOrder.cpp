@@ -0,0 +1,198 @@
+#include "storm/builder/DdVariableOrder.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace builder {
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrder const& order) {
+            switch (order) {
+                case DdVariableOrder::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrder::Force:
+                    out << "force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+        
+        namespace {
+            // The maximal number of iterations of the FORCE heuristic.
+            uint64_t const maximalNumberOfForceIterations = 100;
+            
+            /*!
+             * Orders the given variables using the FORCE heuristic (Aloul, Markov, Sakallah). Every hyperedge is a set
+             * of variables that should be close to each other. In each iteration, the variables are moved to the
+             * average center of gravity of their hyperedges. The order with the smallest total span of the
+             * hyperedges is returned.
+             */
+            std::vector<storm::expressions::Variable> computeForceOrder(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& hyperedges) {
+                std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+                for (uint64_t index = 0; index < variables.size(); ++index) {
+                    variableToIndexMap[variables[index]] = index;
+                }
+                
+                // Translate the hyperedges to the indices of the variables. Hyperedges with fewer than two variables
+                // are irrelevant for the order.
+                std::vector<std::vector<uint64_t>> edges;
+                std::vector<std::vector<uint64_t>> variableToEdgesMap(variables.size());
+                for (auto const& hyperedge : hyperedges) {
+                    std::vector<uint64_t> edge;
+                    for (auto const& variable : hyperedge) {
+                        auto it = variableToIndexMap.find(variable);
+                        if (it != variableToIndexMap.end()) {
+                            edge.push_back(it->second);
+                        }
+                    }
+                    if (edge.size() > 1) {
+                        for (auto const& index : edge) {
+                            variableToEdgesMap[index].push_back(edges.size());
+                        }
+                        edges.push_back(std::move(edge));
+                    }
+                }
+                
+                // The current order and the position of each variable in it.
+                std::vector<uint64_t> order(variables.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::vector<uint64_t> positions(order);
+                
+                auto computeSpan = [&] () {
+                    uint64_t span = 0;
+                    for (auto const& edge : edges) {
+                        auto minMax = std::minmax_element(edge.begin(), edge.end(), [&positions] (uint64_t const& a, uint64_t const& b) { return positions[a] < positions[b]; });
+                        span += positions[*minMax.second] - positions[*minMax.first];
+                    }
+                    return span;
+                };
+                
+                uint64_t bestSpan = computeSpan();
+                std::vector<uint64_t> bestOrder = order;
+                std::vector<double> centersOfGravity(edges.size());
+                std::vector<double> newPositions(variables.size());
+                for (uint64_t iteration = 0; iteration < maximalNumberOfForceIterations; ++iteration) {
+                    for (uint64_t edgeIndex = 0; edgeIndex < edges.size(); ++edgeIndex) {
+                        double sum = 0;
+                        for (auto const& index : edges[edgeIndex]) {
+                            sum += positions[index];
+                        }
+                        centersOfGravity[edgeIndex] = sum / edges[edgeIndex].size();
+                    }
+                    for (uint64_t index = 0; index < variables.size(); ++index) {
+                        if (variableToEdgesMap[index].empty()) {
+                            newPositions[index] = positions[index];
+                        } else {
+                            double sum = 0;
+                            for (auto const& edgeIndex : variableToEdgesMap[index]) {
+                                sum += centersOfGravity[edgeIndex];
+                            }
+                            newPositions[index] = sum / variableToEdgesMap[index].size();
+                        }
+                    }
+                    
+                    // Ties are broken by the old positions to keep the heuristic deterministic.
+                    std::stable_sort(order.begin(), order.end(), [&newPositions] (uint64_t const& a, uint64_t const& b) { return newPositions[a] < newPositions[b]; });
+                    for (uint64_t position = 0; position < order.size(); ++position) {
+                        positions[order[position]] = position;
+                    }
+                    
+                    uint64_t span = computeSpan();
+                    if (span < bestSpan) {
+                        bestSpan = span;
+                        bestOrder = order;
+                    } else {
+                        break;
+                    }
+                }
+                STORM_LOG_TRACE("FORCE heuristic reduced the total span of the variable groups to " << bestSpan << ".");
+                
+                std::vector<storm::expressions::Variable> result;
+                result.reserve(variables.size());
+                for (auto const& index : bestOrder) {
+                    result.push_back(variables[index]);
+                }
+                return result;
+            }
+        }
+        
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, std::vector<storm::expressions::Variable> const& variables, DdVariableOrder const& order) {
+            if (order == DdVariableOrder::Declaration) {
+                return variables;
+            }
+            
+            std::vector<std::set<storm::expressions::Variable>> hyperedges;
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariablesMap;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+                    for (auto const& update : command.getUpdates()) {
+                        std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                        commandVariables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                        for (auto const& assignment : update.getAssignments()) {
+                            commandVariables.insert(assignment.getVariable());
+                            std::set<storm::expressions::Variable> expressionVariables = assignment.getExpression().getVariables();
+                            commandVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                        }
+                    }
+                    
+                    if (command.isLabeled()) {
+                        actionToVariablesMap[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+                    }
+                    hyperedges.push_back(std::move(commandVariables));
+                }
+            }
+            for (auto& actionVariablesPair : actionToVariablesMap) {
+                hyperedges.push_back(std::move(actionVariablesPair.second));
+            }
+            
+            return computeForceOrder(variables, hyperedges);
+        }
+        
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables, DdVariableOrder const& order) {
+            if (order == DdVariableOrder::Declaration) {
+                return variables;
+            }
+            
+            std::vector<std::set<storm::expressions::Variable>> hyperedges;
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariablesMap;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> edgeVariables = edge.getGuard().getVariables();
+                    edgeVariables.insert(automaton.getLocationExpressionVariable());
+                    for (auto const& destination : edge.getDestinations()) {
+                        std::set<storm::expressions::Variable> probabilityVariables = destination.getProbability().getVariables();
+                        edgeVariables.insert(probabilityVariables.begin(), probabilityVariables.end());
+                        for (auto const& assignment : destination.getOrderedAssignments()) {
+                            edgeVariables.insert(assignment.getExpressionVariable());
+                            std::set<storm::expressions::Variable> expressionVariables = assignment.getAssignedExpression().getVariables();
+                            edgeVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                        }
+                    }
+                    
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionToVariablesMap[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+                    }
+                    hyperedges.push_back(std::move(edgeVariables));
+                }
+            }
+            for (auto& actionVariablesPair : actionToVariablesMap) {
+                hyperedges.push_back(std::move(actionVariablesPair.second));
+            }
+            
+            return computeForceOrder(variables, hyperedges);
+        }
+        
+    }
+}
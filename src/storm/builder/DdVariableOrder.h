@@ -0,0 +1,52 @@
+#ifndef STORM_BUILDER_DDVARIABLEORDER_H_
+#define STORM_BUILDER_DDVARIABLEORDER_H_
+
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+    
+    namespace jani {
+        class Model;
+    }
+    
+    namespace builder {
+        
+        // An enum that contains all currently supported heuristics for the order of the DD variables.
+        enum class DdVariableOrder { Declaration, Force };
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrder const& order);
+        
+        /*!
+         * Computes an order of the variables of the given program in which the DD variables are to be created. For
+         * the FORCE heuristic, variables that appear together in the guards and updates of commands (or that are
+         * connected via synchronization) are moved close to each other.
+         *
+         * @param program The program whose variables to order.
+         * @param variables The variables to order in the order in which they are declared.
+         * @param order The heuristic to use.
+         * @return The ordered variables.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, std::vector<storm::expressions::Variable> const& variables, DdVariableOrder const& order);
+        
+        /*!
+         * Computes an order of the variables of the given JANI model in which the DD variables are to be created. For
+         * the FORCE heuristic, variables (including the location variables) that appear together on edges (or that
+         * are connected via synchronization) are moved close to each other.
+         *
+         * @param model The model whose variables to order.
+         * @param variables The variables to order in the order in which they are declared.
+         * @param order The heuristic to use.
+         * @return The ordered variables.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables, DdVariableOrder const& order);
+        
+    }
+}
+
+#endif /* STORM_BUILDER_DDVARIABLEORDER_H_ */
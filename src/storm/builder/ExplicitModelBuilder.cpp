@@ -1,6 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include <map>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <limits>
+#include <unordered_map>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -43,7 +48,7 @@ namespace storm {
     namespace builder {
                         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::IOSettings>().getExplorationOrder()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::IOSettings>().getExplorationOrder()), numberOfThreads(storm::settings::getModule<storm::settings::modules::IOSettings>().getExplorationThreadCount()) {
             // Intentionally left empty.
         }
         
@@ -54,12 +59,16 @@ namespace storm {
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (this->options.numberOfThreads > 1) {
+                generatorFactory = [program, generatorOptions] () { return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions); };
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (this->options.numberOfThreads > 1) {
+                generatorFactory = [model, generatorOptions] () { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); };
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -136,124 +145,131 @@ namespace storm {
             uint64_t numberOfExploredStates = 0;
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
             
+            auto reportProgress = [&] () {
+                if (generator->getOptions().isExplorationShowProgressSet()) {
+                    ++numberOfExploredStatesSinceLastMessage;
+                    ++numberOfExploredStates;
+                    
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getExplorationShowProgressDelay()) {
+                        auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                        numberOfExploredStatesSinceLastMessage = 0;
+                    }
+                }
+            };
+            
+            // Determine whether states can be expanded in parallel. This requires one generator per thread and the
+            // exploration order to be breadth-first, because we can then expand a number of states from the front of
+            // the queue independently of each other.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+            if (options.numberOfThreads > 1) {
+                if (!generatorFactory) {
+                    STORM_LOG_WARN("Unable to expand states in parallel, because the builder was not created from a model description. Falling back to sequential exploration.");
+                } else if (options.explorationOrder != ExplorationOrder::Bfs) {
+                    STORM_LOG_WARN("Parallel state expansion requires breadth-first exploration. Falling back to sequential exploration.");
+                } else {
+                    STORM_LOG_DEBUG("Expanding states with " << options.numberOfThreads << " threads.");
+                    for (uint64_t thread = 0; thread < options.numberOfThreads; ++thread) {
+                        workerGenerators.push_back(generatorFactory());
+                    }
+                }
+            }
+            
             // Perform a search through the model.
-            while (!statesToExplore.empty()) {
-                // Get the first state in the queue.
-                CompressedState currentState = statesToExplore.front();
-                StateType currentIndex = stateStorage.stateToId.getValue(currentState);
-                statesToExplore.pop_front();
-                
-                // If the exploration order differs from breadth-first, we remember that this row group was actually
-                // filled with the transitions of a different state.
-                if (options.explorationOrder != ExplorationOrder::Bfs) {
-                    stateRemapping.get()[currentIndex] = currentRowGroup;
+            if (workerGenerators.empty()) {
+                while (!statesToExplore.empty()) {
+                    // Get the first state in the queue.
+                    CompressedState currentState = statesToExplore.front();
+                    StateType currentIndex = stateStorage.stateToId.getValue(currentState);
+                    statesToExplore.pop_front();
+                    
+                    STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+                    
+                    generator->load(currentState);
+                    storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+                    addStateBehavior(currentIndex, currentState, behavior, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRowGroup, currentRow);
+                    reportProgress();
                 }
+            } else {
+                // The states are stored in a concurrent map, such that the worker threads can look up and insert the
+                // successors of the states they expand without synchronizing with the calling thread.
+                storm::storage::ConcurrentBitVectorHashMap<StateType> concurrentStateToId(stateStorage.bitsPerState, 10000000);
+                for (auto const& stateIndexPair : stateStorage.stateToId) {
+                    concurrentStateToId.setOrAdd(stateIndexPair.first, stateIndexPair.second);
+                }
+                uint64_t numberOfStates = stateStorage.getNumberOfStates();
                 
-                STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
-                
-                generator->load(currentState);
-                storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+                // The number of states that are taken from the queue and expanded in parallel in one round.
+                uint64_t const statesPerRound = 1024 * workerGenerators.size();
+                StateType const unassignedIndex = std::numeric_limits<StateType>::max();
                 
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-                        
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
+                std::vector<CompressedState> currentStates;
+                std::vector<CompressedState> discoveredStates;
+                std::vector<StateType> provisionalToGlobalIndex;
+                while (!statesToExplore.empty()) {
+                    // Take the states to expand in this round from the front of the queue. States discovered in this
+                    // round are appended to the back of the queue and are therefore not part of the current round.
+                    currentStates.clear();
+                    while (!statesToExplore.empty() && currentStates.size() < statesPerRound) {
+                        currentStates.push_back(std::move(statesToExplore.front()));
+                        statesToExplore.pop_front();
                     }
                     
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    // States that are discovered in this round get provisional indices starting at the current number of
+                    // states.
+                    StateType firstProvisionalIndex = static_cast<StateType>(numberOfStates);
+                    std::vector<ExpandedState> expandedStates = expandStatesInParallel(workerGenerators, currentStates, concurrentStateToId, firstProvisionalIndex);
+                    
+                    // Collect the discovered states by their provisional indices.
+                    uint64_t numberOfDiscoveredStates = 0;
+                    for (auto const& expandedState : expandedStates) {
+                        numberOfDiscoveredStates += expandedState.discoveredStates.size();
                     }
+                    discoveredStates.resize(numberOfDiscoveredStates);
+                    for (auto& expandedState : expandedStates) {
+                        for (auto& indexStatePair : expandedState.discoveredStates) {
+                            discoveredStates[indexStatePair.first - firstProvisionalIndex] = std::move(indexStatePair.second);
+                        }
+                    }
+                    provisionalToGlobalIndex.assign(numberOfDiscoveredStates, unassignedIndex);
                     
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
+                    // Now assign the global indices in the order in which the sequential exploration would have
+                    // encountered the states. This guarantees that the state indices (and thus the built model)
+                    // coincide with the ones obtained from a sequential exploration.
+                    for (uint64_t stateIndex = 0; stateIndex < currentStates.size(); ++stateIndex) {
+                        CompressedState const& currentState = currentStates[stateIndex];
+                        StateType currentIndex = concurrentStateToId.getValue(currentState);
                         
-                        // add the generated choice information
-                        if (choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                choiceInformationBuilder.addLabel(label, currentRow);
-                            }
-                        }
-                        if (choice.hasOriginData()) {
-                            choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
-                        }
+                        STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
                         
-                        // If we keep track of the Markovian choices, store whether the current one is Markovian.
-                        if (markovianStates && choice.isMarkovian()) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
+                        ExpandedState& expandedState = expandedStates[stateIndex];
+                        for (auto const& provisionalIndex : expandedState.provisionalSuccessors) {
+                            StateType& globalIndex = provisionalToGlobalIndex[provisionalIndex - firstProvisionalIndex];
+                            if (globalIndex == unassignedIndex) {
+                                globalIndex = static_cast<StateType>(numberOfStates++);
+                                statesToExplore.push_back(discoveredStates[provisionalIndex - firstProvisionalIndex]);
+                            }
                         }
                         
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
+                        addStateBehavior(currentIndex, currentState, remapBehavior(expandedState.behavior, firstProvisionalIndex, provisionalToGlobalIndex), transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRowGroup, currentRow);
+                        reportProgress();
                         
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
+                        // Free the memory of the expanded state as early as possible.
+                        expandedState = ExpandedState();
                     }
-                    ++currentRowGroup;
-                }
-                
-                if (generator->getOptions().isExplorationShowProgressSet()) {
-                    ++numberOfExploredStatesSinceLastMessage;
-                    ++numberOfExploredStates;
                     
-                    auto now = std::chrono::high_resolution_clock::now();
-                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getExplorationShowProgressDelay()) {
-                        auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
-                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
-                        std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
-                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
-                        numberOfExploredStatesSinceLastMessage = 0;
+                    // Finally, replace the provisional indices in the map by the global ones.
+                    for (uint64_t discoveredState = 0; discoveredState < numberOfDiscoveredStates; ++discoveredState) {
+                        concurrentStateToId.setOrAdd(discoveredStates[discoveredState], provisionalToGlobalIndex[discoveredState]);
                     }
                 }
+                
+                // Hand the explored states to the state storage, which is used to build the remaining components.
+                stateStorage.stateToId = concurrentStateToId.toBitVectorHashMap();
             }
             
             if (markovianStates) {
@@ -286,6 +302,194 @@ namespace storm {
             }
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(StateType currentIndex, CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow) {
+            
+            // If the exploration order differs from breadth-first, we remember that this row group was actually
+            // filled with the transitions of a different state.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                stateRemapping.get()[currentIndex] = currentRowGroup;
+            }
+            
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    }
+                    
+                    if (markovianStates) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+                    
+                    transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                    
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+                        
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+                
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                // Now add all choices.
+                for (auto const& choice : behavior) {
+                    
+                    // add the generated choice information
+                    if (choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            choiceInformationBuilder.addLabel(label, currentRow);
+                        }
+                    }
+                    if (choice.hasOriginData()) {
+                        choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
+                    }
+                    
+                    // If we keep track of the Markovian choices, store whether the current one is Markovian.
+                    if (markovianStates && choice.isMarkovian()) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    // Add the probabilistic behavior to the matrix.
+                    for (auto const& stateProbabilityPair : choice) {
+                        transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                    
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                }
+                ++currentRowGroup;
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        std::vector<typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExpandedState> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandStatesInParallel(std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& workerGenerators, std::vector<CompressedState> const& states, storm::storage::ConcurrentBitVectorHashMap<StateType>& stateToId, StateType firstProvisionalIndex) {
+            std::vector<ExpandedState> result(states.size());
+            
+            // The threads repeatedly grab a small batch of states to balance the work between them.
+            uint64_t const batchSize = 64;
+            std::atomic<uint64_t> nextState(0);
+            std::atomic<uint64_t> nextProvisionalIndex(firstProvisionalIndex);
+            std::vector<std::exception_ptr> exceptions(workerGenerators.size());
+            
+            auto worker = [&] (uint64_t threadIndex) {
+                try {
+                    storm::generator::NextStateGenerator<ValueType, StateType>& workerGenerator = *workerGenerators[threadIndex];
+                    
+                    // Unknown successors are inserted into the map with a fresh provisional index. The index is only
+                    // generated if the state is actually inserted, so every provisional index is used exactly once.
+                    ExpandedState* currentExpandedState = nullptr;
+                    std::function<StateType ()> provisionalIndexGenerator = [&nextProvisionalIndex] () { return static_cast<StateType>(nextProvisionalIndex++); };
+                    std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) {
+                        std::pair<StateType, bool> indexInsertedPair = stateToId.findOrAdd(state, provisionalIndexGenerator);
+                        if (indexInsertedPair.second) {
+                            currentExpandedState->discoveredStates.emplace_back(indexInsertedPair.first, state);
+                        }
+                        if (indexInsertedPair.first >= firstProvisionalIndex) {
+                            currentExpandedState->provisionalSuccessors.push_back(indexInsertedPair.first);
+                        }
+                        return indexInsertedPair.first;
+                    };
+                    
+                    uint64_t batchStart = nextState.fetch_add(batchSize);
+                    while (batchStart < states.size()) {
+                        uint64_t batchEnd = std::min<uint64_t>(batchStart + batchSize, states.size());
+                        for (uint64_t stateIndex = batchStart; stateIndex < batchEnd; ++stateIndex) {
+                            currentExpandedState = &result[stateIndex];
+                            
+                            workerGenerator.load(states[stateIndex]);
+                            result[stateIndex].behavior = workerGenerator.expand(stateToIdCallback);
+                        }
+                        batchStart = nextState.fetch_add(batchSize);
+                    }
+                } catch (...) {
+                    exceptions[threadIndex] = std::current_exception();
+                }
+            };
+            
+            std::vector<std::thread> threads;
+            for (uint64_t threadIndex = 1; threadIndex < workerGenerators.size(); ++threadIndex) {
+                threads.emplace_back(worker, threadIndex);
+            }
+            // The calling thread participates in the expansion.
+            worker(0);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            
+            // Propagate the first error (if any) to the caller.
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+            
+            return result;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        storm::generator::StateBehavior<ValueType, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::remapBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, StateType firstProvisionalIndex, std::vector<StateType> const& provisionalToGlobalIndex) {
+            storm::generator::StateBehavior<ValueType, StateType> result;
+            result.setExpanded(behavior.wasExpanded());
+            result.addStateRewards(std::vector<ValueType>(behavior.getStateRewards()));
+            
+            for (auto const& choice : behavior) {
+                storm::generator::Choice<ValueType, StateType> remappedChoice(choice.getActionIndex(), choice.isMarkovian());
+                
+                // Since distinct successors have distinct global indices, no two entries of the distribution are merged.
+                for (auto const& stateProbabilityPair : choice) {
+                    StateType target = stateProbabilityPair.first < firstProvisionalIndex ? stateProbabilityPair.first : provisionalToGlobalIndex[stateProbabilityPair.first - firstProvisionalIndex];
+                    remappedChoice.addProbability(target, stateProbabilityPair.second);
+                }
+                remappedChoice.addRewards(std::vector<ValueType>(choice.getRewards()));
+                if (choice.hasLabels()) {
+                    remappedChoice.addLabels(choice.getLabels());
+                }
+                if (choice.hasOriginData()) {
+                    remappedChoice.addOriginData(choice.getOriginData());
+                }
+                result.addChoice(std::move(remappedChoice));
+            }
+            
+            return result;
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
             
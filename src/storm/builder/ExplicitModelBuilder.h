@@ -6,6 +6,7 @@
 #include <vector>
 #include <deque>
 #include <cstdint>
+#include <functional>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/container/flat_map.hpp>
@@ -15,6 +16,7 @@
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/logic/Formulas.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StateLabeling.h"
@@ -58,6 +60,10 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The number of threads used to expand states. Note that states are only expanded in parallel if the
+                // exploration order is breadth-first and the builder knows how to create additional generators.
+                uint64_t numberOfThreads;
             };
             
             /*!
@@ -91,6 +97,22 @@ namespace storm {
             std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
             
         private:
+            /*!
+             * The result of expanding a single state on a worker thread. Successors that were already known before the
+             * states were expanded are given in terms of their global indices. All other successors are given in terms
+             * of provisional indices, which are replaced by global indices afterwards.
+             */
+            struct ExpandedState {
+                // The behavior of the expanded state.
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                
+                // The provisional indices of the successors in the order in which they were reached by the generator.
+                std::vector<StateType> provisionalSuccessors;
+                
+                // The states that were discovered while expanding the state together with their provisional indices.
+                std::vector<std::pair<StateType, CompressedState>> discoveredStates;
+            };
+            
             /*!
              * Retrieves the state id of the given state. If the state has not been encountered yet, it will be added to
              * the lists of all states with a new id. If the state was already known, the object that is pointed to by
@@ -112,6 +134,42 @@ namespace storm {
              */
             void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
             
+            /*!
+             * Adds the given behavior of the given state to the matrix, reward model and choice information builders.
+             *
+             * @param currentIndex The index of the state whose behavior is added.
+             * @param currentState The state whose behavior is added.
+             * @param behavior The behavior of the state. All target states must be given in terms of their global indices.
+             * @param currentRowGroup The current row group. This is increased by one.
+             * @param currentRow The current row. This is increased by the number of added rows.
+             */
+            void addStateBehavior(StateType currentIndex, CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow);
+            
+            /*!
+             * Expands the given states using the given generators, one thread per generator. The threads look up the
+             * successors in the given map and insert the unknown ones with provisional indices (starting at the given
+             * index). This allows for the global indices to be assigned afterwards in exactly the order in which a
+             * sequential exploration would assign them.
+             *
+             * @param workerGenerators The generators to use. Each generator is used by exactly one thread.
+             * @param states The states to expand.
+             * @param stateToId The map from the known states to their indices.
+             * @param firstProvisionalIndex The first index that is not a global index of a known state.
+             * @return The expanded states in the order of the given states.
+             */
+            std::vector<ExpandedState> expandStatesInParallel(std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& workerGenerators, std::vector<CompressedState> const& states, storm::storage::ConcurrentBitVectorHashMap<StateType>& stateToId, StateType firstProvisionalIndex);
+            
+            /*!
+             * Replaces the provisional successor indices in the given behavior by global state indices.
+             *
+             * @param behavior The behavior whose target states are given as global or provisional indices.
+             * @param firstProvisionalIndex The smallest provisional index.
+             * @param provisionalToGlobalIndex The mapping from provisional indices (shifted by the first provisional
+             * index) to global state indices.
+             * @return The behavior whose target states are given as global indices.
+             */
+            static storm::generator::StateBehavior<ValueType, StateType> remapBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, StateType firstProvisionalIndex, std::vector<StateType> const& provisionalToGlobalIndex);
+            
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
              *
@@ -129,6 +187,10 @@ namespace storm {
             /// The generator to use for the building process.
             std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
             
+            /// A function that creates fresh generators for the model. This is only available if the builder was
+            /// constructed from a model description and is required to expand states in parallel.
+            std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+            
             /// The options to be used for the building process.
             Options options;
 
@@ -0,0 +1,22 @@
+#include "storm/builder/ExpressionEvaluatorType.h"
+
+namespace storm {
+    namespace builder {
+        
+        std::ostream& operator<<(std::ostream& out, ExpressionEvaluatorType const& type) {
+            switch (type) {
+                case ExpressionEvaluatorType::Exprtk:
+                    out << "exprtk";
+                    break;
+                case ExpressionEvaluatorType::Bytecode:
+                    out << "bytecode";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+        
+    }
+}
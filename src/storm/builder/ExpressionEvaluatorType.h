@@ -0,0 +1,17 @@
+#ifndef STORM_BUILDER_EXPRESSIONEVALUATORTYPE_H_
+#define STORM_BUILDER_EXPRESSIONEVALUATORTYPE_H_
+
+#include <ostream>
+
+namespace storm {
+    namespace builder {
+        
+        // An enum that contains all currently supported backends for evaluating expressions during model exploration.
+        enum class ExpressionEvaluatorType { Exprtk, Bytecode };
+        
+        std::ostream& operator<<(std::ostream& out, ExpressionEvaluatorType const& type);
+        
+    }
+}
+
+#endif /* STORM_BUILDER_EXPRESSIONEVALUATORTYPE_H_ */
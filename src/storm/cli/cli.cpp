@@ -15,8 +15,10 @@
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/ExplicitConversionCache.h"
 
 #include "storm/utility/resources.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/file.h"
 #include "storm/utility/storm-version.h"
 #include "storm/utility/cli.h"
@@ -199,6 +201,9 @@ namespace storm {
             if (resources.isTimeoutSet()) {
                 storm::utility::resources::setCPULimit(resources.getTimeoutInSeconds());
             }
+            
+            // Set the number of threads used for parallel numerical operations.
+            storm::utility::parallel::setNumberOfThreads(resources.getNumberOfThreads());
         }
         
         void setLogLevel() {
@@ -380,6 +385,8 @@ namespace storm {
                 result = storm::api::buildExplicitModel<ValueType>(ioSettings.getTransitionFilename(), ioSettings.getLabelingFilename(), ioSettings.isStateRewardsSet() ? boost::optional<std::string>(ioSettings.getStateRewardsFilename()) : boost::none, ioSettings.isTransitionRewardsSet() ? boost::optional<std::string>(ioSettings.getTransitionRewardsFilename()) : boost::none, ioSettings.isChoiceLabelingSet() ? boost::optional<std::string>(ioSettings.getChoiceLabelingFilename()) : boost::none);
             } else if (ioSettings.isExplicitDRNSet()) {
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename());
+            } else if (ioSettings.isExplicitBinarySet()) {
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -398,7 +405,7 @@ namespace storm {
                 } else if (engine == storm::settings::modules::CoreSettings::Engine::Sparse) {
                     result = buildModelSparse<ValueType>(input, ioSettings);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(engine == storm::settings::modules::CoreSettings::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings);
             }
@@ -427,9 +434,13 @@ namespace storm {
             if (bisimulationSettings.isWeakBisimulationSet()) {
                 bisimType = storm::storage::BisimulationType::Weak;
             }
+            storm::storage::BisimulationRefinementMethod refinementMethod = storm::storage::BisimulationRefinementMethod::SplitterQueue;
+            if (bisimulationSettings.isSignatureRefinementSet()) {
+                refinementMethod = storm::storage::BisimulationRefinementMethod::Signature;
+            }
             
             STORM_LOG_INFO("Performing bisimulation minimization...");
-            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, refinementMethod);
         }
         
         template <typename ValueType>
@@ -461,6 +472,10 @@ namespace storm {
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>());
             }
             
+            if (ioSettings.isExportBinarySet()) {
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
+            }
+            
             if (ioSettings.isExportDotSet()) {
                 storm::api::exportSparseModelAsDot(model, ioSettings.getExportDotFilename());
             }
@@ -482,7 +497,23 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename ValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, SymbolicInput const& input) {
-            return std::make_pair(model, false);
+            auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
+            auto bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+            
+            std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
+            
+            if (generalSettings.isBisimulationSet()) {
+                storm::storage::BisimulationType bisimType = storm::storage::BisimulationType::Strong;
+                if (bisimulationSettings.isWeakBisimulationSet()) {
+                    bisimType = storm::storage::BisimulationType::Weak;
+                }
+                
+                STORM_LOG_INFO("Performing symbolic bisimulation minimization...");
+                result.first = storm::api::performBisimulationMinimization<DdType, ValueType>(model, createFormulasToRespect(input.properties), bisimType, bisimulationSettings.getQuotientFormat());
+                result.second = true;
+            }
+            
+            return result;
         }
 
         template <storm::dd::DdType DdType, typename ValueType>
@@ -666,9 +697,55 @@ namespace storm {
             });
         }
         
+        template <typename ValueType>
+        void verifyWithStatisticalEngine(SymbolicInput const& input) {
+            STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+            STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException, "Statistical model checking does not support other data-types than floating points.");
+            verifyProperties<ValueType>(input.properties, [&input] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+                return storm::api::verifyWithStatisticalEngine<ValueType>(input.model.get(), storm::api::createTask<ValueType>(formula, true));
+            });
+        }
+        
+        template <typename ValueType>
+        void verifyPropertiesInBatch(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, std::vector<storm::jani::Property> const& properties) {
+            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> tasks;
+            for (auto const& property : properties) {
+                tasks.push_back(storm::api::createTask<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula()->isInitialFormula()));
+            }
+            
+            STORM_PRINT_AND_LOG(std::endl << "Model checking " << properties.size() << " properties together ..." << std::endl);
+            storm::utility::Stopwatch watch(true);
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, tasks);
+            watch.stop();
+            
+            for (uint64_t propertyIndex = 0; propertyIndex < properties.size(); ++propertyIndex) {
+                storm::jani::Property const& property = properties[propertyIndex];
+                std::unique_ptr<storm::modelchecker::CheckResult>& result = results[propertyIndex];
+                printModelCheckingProperty(property);
+                if (result) {
+                    std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                    if (property.getFilter().getStatesFormula()->isInitialFormula()) {
+                        filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                    } else {
+                        filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(property.getFilter().getStatesFormula(), false));
+                    }
+                    if (filter) {
+                        result->filter(filter->asQualitativeCheckResult());
+                    }
+                }
+                printResult<ValueType>(result, property);
+            }
+            STORM_PRINT_AND_LOG("Time for model checking all properties: " << watch << "." << std::endl);
+        }
+        
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isBatchCheckingSet()) {
+                verifyPropertiesInBatch<ValueType>(sparseModel, input.properties);
+                return;
+            }
             verifyProperties<ValueType>(input.properties,
                                         [&sparseModel] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
@@ -690,6 +767,10 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isBatchCheckingSet()) {
+                // Keep the explicit matrices obtained from the model, such that the properties can share them.
+                model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getExplicitConversionCache().setMaximalNumberOfTranslations(4);
+            }
             verifyProperties<ValueType>(input.properties, [&model] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                 bool filterForInitialStates = states->isInitialFormula();
                 auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
@@ -767,6 +848,8 @@ namespace storm {
                 verifyWithAbstractionRefinementEngine<DdType, ValueType>(input);
             } else if (engine == storm::settings::modules::CoreSettings::Engine::Exploration) {
                 verifyWithExplorationEngine<ValueType>(input);
+            } else if (engine == storm::settings::modules::CoreSettings::Engine::Statistical) {
+                verifyWithStatisticalEngine<ValueType>(input);
             } else {
                 auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
                 
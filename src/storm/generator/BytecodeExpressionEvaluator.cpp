@@ -0,0 +1,368 @@
+#include "storm/generator/BytecodeExpressionEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            typedef BytecodeExpressionEvaluator::Instruction Instruction;
+            typedef BytecodeExpressionEvaluator::OpCode OpCode;
+
+            /*!
+             * A visitor that translates an expression into a sequence of instructions. The data passed to the visitor
+             * is the register into which the value of the visited expression is to be written. The visitor only uses
+             * registers with higher indices to compute intermediate results.
+             */
+            class BytecodeCompiler : public storm::expressions::ExpressionVisitor {
+            public:
+                BytecodeCompiler(std::vector<Instruction>& instructions, std::unordered_map<storm::expressions::Variable, Instruction> const& stateVariableLoads) : instructions(instructions), stateVariableLoads(stateVariableLoads), numberOfRegisters(0) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Compiles the given expression such that its value is written to the first register.
+                 *
+                 * @return The number of registers required by the instructions.
+                 */
+                uint_fast64_t compile(storm::expressions::Expression const& expression) {
+                    numberOfRegisters = 0;
+                    compile(expression.getBaseExpression(), 0);
+                    return numberOfRegisters;
+                }
+
+                virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    compile(*expression.getCondition(), target);
+                    uint_fast64_t jumpToElse = emit(Instruction(OpCode::JumpIfFalse, target));
+                    compile(*expression.getThenExpression(), target);
+                    uint_fast64_t jumpToEnd = emit(Instruction(OpCode::Jump, target));
+                    instructions[jumpToElse].bitOffset = instructions.size();
+                    compile(*expression.getElseExpression(), target);
+                    instructions[jumpToEnd].bitOffset = instructions.size();
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    switch (expression.getOperatorType()) {
+                        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                            compileShortCircuit(expression, target, OpCode::JumpIfFalse, false);
+                            break;
+                        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                            compileShortCircuit(expression, target, OpCode::JumpIfTrue, false);
+                            break;
+                        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+                            compileShortCircuit(expression, target, OpCode::JumpIfTrue, true);
+                            break;
+                        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                            compileBinary(expression, target, OpCode::NotEqual);
+                            break;
+                        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                            compileBinary(expression, target, OpCode::Equal);
+                            break;
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    switch (expression.getOperatorType()) {
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: compileBinary(expression, target, OpCode::Plus); break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: compileBinary(expression, target, OpCode::Minus); break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: compileBinary(expression, target, OpCode::Times); break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: compileBinary(expression, target, OpCode::Divide); break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: compileBinary(expression, target, OpCode::Min); break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: compileBinary(expression, target, OpCode::Max); break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: compileBinary(expression, target, OpCode::Power); break;
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    switch (expression.getRelationType()) {
+                        case storm::expressions::BinaryRelationExpression::RelationType::Equal: compileBinary(expression, target, OpCode::Equal); break;
+                        case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: compileBinary(expression, target, OpCode::NotEqual); break;
+                        case storm::expressions::BinaryRelationExpression::RelationType::Less: compileBinary(expression, target, OpCode::Less); break;
+                        case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: compileBinary(expression, target, OpCode::LessOrEqual); break;
+                        case storm::expressions::BinaryRelationExpression::RelationType::Greater: compileBinary(expression, target, OpCode::Greater); break;
+                        case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: compileBinary(expression, target, OpCode::GreaterOrEqual); break;
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    storm::expressions::Variable const& variable = expression.getVariable();
+                    auto loadIt = stateVariableLoads.find(variable);
+                    if (loadIt != stateVariableLoads.end()) {
+                        Instruction instruction = loadIt->second;
+                        instruction.target = target;
+                        emit(instruction);
+                    } else if (variable.hasBooleanType()) {
+                        emit(Instruction(OpCode::LoadBoolean, target, variable.getOffset()));
+                    } else if (variable.hasIntegerType()) {
+                        emit(Instruction(OpCode::LoadInteger, target, variable.getOffset()));
+                    } else if (variable.hasRationalType()) {
+                        emit(Instruction(OpCode::LoadRational, target, variable.getOffset()));
+                    } else {
+                        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot compile expressions over variable '" << variable.getName() << "' of type '" << variable.getType() << "'.");
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    compile(*expression.getOperand(), target);
+                    switch (expression.getOperatorType()) {
+                        case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not: emit(Instruction(OpCode::Not, target, target)); break;
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                    uint_fast64_t target = boost::any_cast<uint_fast64_t>(data);
+                    compile(*expression.getOperand(), target);
+                    switch (expression.getOperatorType()) {
+                        case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: emit(Instruction(OpCode::Negate, target, target)); break;
+                        case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: emit(Instruction(OpCode::Floor, target, target)); break;
+                        case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: emit(Instruction(OpCode::Ceil, target, target)); break;
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override {
+                    emitConstant(boost::any_cast<uint_fast64_t>(data), expression.getValue() ? 1.0 : 0.0);
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override {
+                    emitConstant(boost::any_cast<uint_fast64_t>(data), static_cast<double>(expression.getValue()));
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override {
+                    emitConstant(boost::any_cast<uint_fast64_t>(data), expression.getValueAsDouble());
+                    return boost::any();
+                }
+
+            private:
+                void compile(storm::expressions::BaseExpression const& expression, uint_fast64_t target) {
+                    numberOfRegisters = std::max(numberOfRegisters, target + 1);
+                    expression.accept(*this, target);
+                }
+
+                void compileBinary(storm::expressions::BinaryExpression const& expression, uint_fast64_t target, OpCode opCode) {
+                    compile(*expression.getFirstOperand(), target);
+                    compile(*expression.getSecondOperand(), target + 1);
+                    emit(Instruction(opCode, target, target, target + 1));
+                }
+
+                /*!
+                 * Compiles a conjunction or disjunction such that the second operand is only evaluated if the value of
+                 * the first operand does not already determine the result.
+                 */
+                void compileShortCircuit(storm::expressions::BinaryExpression const& expression, uint_fast64_t target, OpCode jump, bool negateFirstOperand) {
+                    compile(*expression.getFirstOperand(), target);
+                    if (negateFirstOperand) {
+                        emit(Instruction(OpCode::Not, target, target));
+                    }
+                    uint_fast64_t jumpToEnd = emit(Instruction(jump, target));
+                    compile(*expression.getSecondOperand(), target);
+                    instructions[jumpToEnd].bitOffset = instructions.size();
+                }
+
+                void emitConstant(uint_fast64_t target, double value) {
+                    Instruction instruction(OpCode::LoadConstant, target);
+                    instruction.constant = value;
+                    emit(instruction);
+                }
+
+                uint_fast64_t emit(Instruction const& instruction) {
+                    instructions.push_back(instruction);
+                    return instructions.size() - 1;
+                }
+
+                // The instructions to which the compiled expressions are appended.
+                std::vector<Instruction>& instructions;
+
+                // The instructions that load the variables that are part of the compressed states.
+                std::unordered_map<storm::expressions::Variable, Instruction> const& stateVariableLoads;
+
+                // The number of registers required by the expression that is currently compiled.
+                uint_fast64_t numberOfRegisters;
+            };
+        }
+
+        BytecodeExpressionEvaluator::Instruction::Instruction(OpCode opCode, uint_fast64_t target, uint_fast64_t firstOperand, uint_fast64_t secondOperand) : opCode(opCode), target(target), firstOperand(firstOperand), secondOperand(secondOperand), bitOffset(0), bitWidth(0), constant(0.0) {
+            // Intentionally left empty.
+        }
+
+        BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation) : ExpressionEvaluatorBase<double>(manager), state(nullptr), booleanValues(manager.getNumberOfBooleanVariables()), integerValues(manager.getNumberOfIntegerVariables()), rationalValues(manager.getNumberOfRationalVariables()) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                Instruction instruction(OpCode::LoadIntegerFromState, 0, locationVariable.variable.getOffset());
+                instruction.bitOffset = locationVariable.bitOffset;
+                instruction.bitWidth = locationVariable.bitWidth;
+                stateVariableLoads.emplace(locationVariable.variable, instruction);
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                Instruction instruction(OpCode::LoadBooleanFromState, 0, booleanVariable.variable.getOffset());
+                instruction.bitOffset = booleanVariable.bitOffset;
+                stateVariableLoads.emplace(booleanVariable.variable, instruction);
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                Instruction instruction(OpCode::LoadIntegerFromState, 0, integerVariable.variable.getOffset());
+                instruction.bitOffset = integerVariable.bitOffset;
+                instruction.bitWidth = integerVariable.bitWidth;
+                instruction.constant = static_cast<double>(integerVariable.lowerBound);
+                stateVariableLoads.emplace(integerVariable.variable, instruction);
+            }
+        }
+
+        bool BytecodeExpressionEvaluator::asBool(storm::expressions::Expression const& expression) const {
+            return execute(programs[getProgram(expression)]) == 1.0;
+        }
+
+        int_fast64_t BytecodeExpressionEvaluator::asInt(storm::expressions::Expression const& expression) const {
+            return static_cast<int_fast64_t>(execute(programs[getProgram(expression)]));
+        }
+
+        double BytecodeExpressionEvaluator::asRational(storm::expressions::Expression const& expression) const {
+            return execute(programs[getProgram(expression)]);
+        }
+
+        void BytecodeExpressionEvaluator::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+            booleanValues[variable.getOffset()] = value ? 1.0 : 0.0;
+            if (stateVariableLoads.find(variable) != stateVariableLoads.end()) {
+                state = nullptr;
+            }
+        }
+
+        void BytecodeExpressionEvaluator::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+            integerValues[variable.getOffset()] = static_cast<double>(value);
+            if (stateVariableLoads.find(variable) != stateVariableLoads.end()) {
+                state = nullptr;
+            }
+        }
+
+        void BytecodeExpressionEvaluator::setRationalValue(storm::expressions::Variable const& variable, double value) {
+            rationalValues[variable.getOffset()] = value;
+        }
+
+        void BytecodeExpressionEvaluator::setState(CompressedState const& state) {
+            this->state = &state;
+        }
+
+        uint_fast64_t BytecodeExpressionEvaluator::addBatch(std::vector<storm::expressions::Expression> const& expressions) {
+            std::vector<uint_fast64_t> batch;
+            batch.reserve(expressions.size());
+            for (auto const& expression : expressions) {
+                STORM_LOG_THROW(expression.hasBooleanType(), storm::exceptions::InvalidArgumentException, "Batches may only contain boolean expressions, but '" << expression << "' is not boolean.");
+                batch.push_back(getProgram(expression));
+            }
+            batches.push_back(std::move(batch));
+            return batches.size() - 1;
+        }
+
+        void BytecodeExpressionEvaluator::evaluateBatch(uint_fast64_t batch, storm::storage::BitVector& result) const {
+            std::vector<uint_fast64_t> const& programIndices = batches[batch];
+            if (result.size() != programIndices.size()) {
+                result = storm::storage::BitVector(programIndices.size());
+            }
+            for (uint_fast64_t index = 0; index < programIndices.size(); ++index) {
+                result.set(index, execute(programs[programIndices[index]]) == 1.0);
+            }
+        }
+
+        uint_fast64_t BytecodeExpressionEvaluator::getProgram(storm::expressions::Expression const& expression) const {
+            auto programIt = expressionToProgram.find(expression.getBaseExpressionPointer());
+            if (programIt != expressionToProgram.end()) {
+                return programIt->second;
+            }
+
+            Program program;
+            program.begin = instructions.size();
+            BytecodeCompiler compiler(instructions, stateVariableLoads);
+            uint_fast64_t numberOfRegisters = compiler.compile(expression);
+            program.end = instructions.size();
+            if (registers.size() < numberOfRegisters) {
+                registers.resize(numberOfRegisters);
+            }
+
+            programs.push_back(program);
+            expressionToProgram.emplace(expression.getBaseExpressionPointer(), programs.size() - 1);
+            return programs.size() - 1;
+        }
+
+        double BytecodeExpressionEvaluator::execute(Program const& program) const {
+            double* reg = registers.data();
+            uint_fast64_t pc = program.begin;
+            while (pc < program.end) {
+                Instruction const& instruction = instructions[pc];
+                ++pc;
+                switch (instruction.opCode) {
+                    case OpCode::LoadConstant: reg[instruction.target] = instruction.constant; break;
+                    case OpCode::LoadBooleanFromState:
+                        if (state) {
+                            reg[instruction.target] = state->get(instruction.bitOffset) ? 1.0 : 0.0;
+                        } else {
+                            reg[instruction.target] = booleanValues[instruction.firstOperand];
+                        }
+                        break;
+                    case OpCode::LoadIntegerFromState:
+                        if (state) {
+                            // Location variables that can only take a single value do not occupy any bits.
+                            int_fast64_t value = instruction.bitWidth == 0 ? 0 : static_cast<int_fast64_t>(state->getAsInt(instruction.bitOffset, instruction.bitWidth));
+                            reg[instruction.target] = static_cast<double>(value) + instruction.constant;
+                        } else {
+                            reg[instruction.target] = integerValues[instruction.firstOperand];
+                        }
+                        break;
+                    case OpCode::LoadBoolean: reg[instruction.target] = booleanValues[instruction.firstOperand]; break;
+                    case OpCode::LoadInteger: reg[instruction.target] = integerValues[instruction.firstOperand]; break;
+                    case OpCode::LoadRational: reg[instruction.target] = rationalValues[instruction.firstOperand]; break;
+                    case OpCode::Not: reg[instruction.target] = reg[instruction.firstOperand] == 1.0 ? 0.0 : 1.0; break;
+                    case OpCode::Equal: reg[instruction.target] = reg[instruction.firstOperand] == reg[instruction.secondOperand] ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: reg[instruction.target] = reg[instruction.firstOperand] != reg[instruction.secondOperand] ? 1.0 : 0.0; break;
+                    case OpCode::Negate: reg[instruction.target] = -reg[instruction.firstOperand]; break;
+                    case OpCode::Floor: reg[instruction.target] = std::floor(reg[instruction.firstOperand]); break;
+                    case OpCode::Ceil: reg[instruction.target] = std::ceil(reg[instruction.firstOperand]); break;
+                    case OpCode::Plus: reg[instruction.target] = reg[instruction.firstOperand] + reg[instruction.secondOperand]; break;
+                    case OpCode::Minus: reg[instruction.target] = reg[instruction.firstOperand] - reg[instruction.secondOperand]; break;
+                    case OpCode::Times: reg[instruction.target] = reg[instruction.firstOperand] * reg[instruction.secondOperand]; break;
+                    case OpCode::Divide: reg[instruction.target] = reg[instruction.firstOperand] / reg[instruction.secondOperand]; break;
+                    case OpCode::Min: reg[instruction.target] = std::min(reg[instruction.firstOperand], reg[instruction.secondOperand]); break;
+                    case OpCode::Max: reg[instruction.target] = std::max(reg[instruction.firstOperand], reg[instruction.secondOperand]); break;
+                    case OpCode::Power: reg[instruction.target] = std::pow(reg[instruction.firstOperand], reg[instruction.secondOperand]); break;
+                    case OpCode::Less: reg[instruction.target] = reg[instruction.firstOperand] < reg[instruction.secondOperand] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: reg[instruction.target] = reg[instruction.firstOperand] <= reg[instruction.secondOperand] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: reg[instruction.target] = reg[instruction.firstOperand] > reg[instruction.secondOperand] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: reg[instruction.target] = reg[instruction.firstOperand] >= reg[instruction.secondOperand] ? 1.0 : 0.0; break;
+                    case OpCode::Jump: pc = instruction.bitOffset; break;
+                    case OpCode::JumpIfFalse:
+                        if (reg[instruction.target] != 1.0) {
+                            pc = instruction.bitOffset;
+                        }
+                        break;
+                    case OpCode::JumpIfTrue:
+                        if (reg[instruction.target] == 1.0) {
+                            pc = instruction.bitOffset;
+                        }
+                        break;
+                }
+            }
+            return reg[0];
+        }
+
+    }
+}
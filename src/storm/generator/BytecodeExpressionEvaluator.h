@@ -0,0 +1,165 @@
+#ifndef STORM_GENERATOR_BYTECODEEXPRESSIONEVALUATOR_H_
+#define STORM_GENERATOR_BYTECODEEXPRESSIONEVALUATOR_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * An expression evaluator that compiles the expressions into a simple register-based bytecode. Instead of
+         * requiring the values of all variables to be set before an evaluation, the variables that are part of the
+         * compressed states are read directly from the bits of the currently loaded state. The values of all other
+         * variables can be set as usual.
+         *
+         * All computations are carried out on double values, which makes the results agree with the ones of the
+         * exprtk-based evaluator.
+         */
+        class BytecodeExpressionEvaluator : public storm::expressions::ExpressionEvaluatorBase<double> {
+        public:
+            /*!
+             * Creates an evaluator for expressions over the given variables.
+             *
+             * @param manager The manager responsible for the expressions.
+             * @param variableInformation The information about how the variables are packed within the compressed
+             * states.
+             */
+            BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation);
+
+            virtual bool asBool(storm::expressions::Expression const& expression) const override;
+            virtual int_fast64_t asInt(storm::expressions::Expression const& expression) const override;
+            virtual double asRational(storm::expressions::Expression const& expression) const override;
+
+            /*!
+             * Sets the value of the given variable. Note that setting the value of a variable that is part of the
+             * compressed states detaches the evaluator from the currently loaded state (if any), i.e. all subsequent
+             * evaluations take the values of the variables from the ones that were set explicitly until the next state
+             * is loaded.
+             */
+            virtual void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+            virtual void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+            virtual void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+            /*!
+             * Loads the given state, i.e. the values of all variables that are part of the compressed states are taken
+             * from the given state in all subsequent evaluations. Note that the state is not copied, so it needs to be
+             * kept alive as long as expressions are evaluated with respect to it.
+             *
+             * @param state The state to load.
+             */
+            void setState(CompressedState const& state);
+
+            /*!
+             * Compiles the given boolean expressions into a batch that can be evaluated at once.
+             *
+             * @param expressions The expressions that form the batch.
+             * @return The index of the batch.
+             */
+            uint_fast64_t addBatch(std::vector<storm::expressions::Expression> const& expressions);
+
+            /*!
+             * Evaluates all expressions of the given batch.
+             *
+             * @param batch The index of the batch.
+             * @param result A bit vector that is resized to the number of expressions in the batch and whose bits are
+             * set iff the corresponding expression evaluates to true.
+             */
+            void evaluateBatch(uint_fast64_t batch, storm::storage::BitVector& result) const;
+
+            enum class OpCode {
+                // Loading values into registers.
+                LoadConstant, LoadBooleanFromState, LoadIntegerFromState, LoadBoolean, LoadInteger, LoadRational,
+                // Boolean operations.
+                Not, Equal, NotEqual,
+                // Numerical operations.
+                Negate, Floor, Ceil, Plus, Minus, Times, Divide, Min, Max, Power,
+                // Comparisons.
+                Less, LessOrEqual, Greater, GreaterOrEqual,
+                // Control flow.
+                Jump, JumpIfFalse, JumpIfTrue
+            };
+
+            struct Instruction {
+                Instruction(OpCode opCode, uint_fast64_t target, uint_fast64_t firstOperand = 0, uint_fast64_t secondOperand = 0);
+
+                // The operation to perform.
+                OpCode opCode;
+
+                // The register into which the result is written. For conditional jumps, this is the register that
+                // holds the condition.
+                uint_fast64_t target;
+
+                // The registers holding the operands. For loads of variables, the first operand is the offset of the
+                // variable within the variables of its type.
+                uint_fast64_t firstOperand;
+                uint_fast64_t secondOperand;
+
+                // For loads from the state, the position of the value within the compressed state. For jumps, the
+                // index of the instruction with which to continue.
+                uint_fast64_t bitOffset;
+                uint_fast64_t bitWidth;
+
+                // For constants, the value to load. For loads of integer variables from the state, the lower bound of
+                // the variable's range.
+                double constant;
+            };
+
+        private:
+            // A program is the contiguous range of instructions that computes the value of one expression. The value
+            // is held in the first register once the program terminates.
+            struct Program {
+                uint_fast64_t begin;
+                uint_fast64_t end;
+            };
+
+            /*!
+             * Retrieves the index of the program that computes the value of the given expression. If the expression
+             * was not yet compiled, it is compiled now.
+             */
+            uint_fast64_t getProgram(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Executes the given program and returns the resulting value.
+             */
+            double execute(Program const& program) const;
+
+            // The instructions of all compiled programs.
+            mutable std::vector<Instruction> instructions;
+
+            // The compiled programs.
+            mutable std::vector<Program> programs;
+
+            // A mapping of expressions to the index of the program that computes their values.
+            mutable std::unordered_map<std::shared_ptr<storm::expressions::BaseExpression const>, uint_fast64_t> expressionToProgram;
+
+            // The batches of programs that can be evaluated at once.
+            std::vector<std::vector<uint_fast64_t>> batches;
+
+            // The registers used during the execution of a program.
+            mutable std::vector<double> registers;
+
+            // For each variable that is part of the compressed states, the instruction that loads its value from
+            // the state.
+            std::unordered_map<storm::expressions::Variable, Instruction> stateVariableLoads;
+
+            // The currently loaded state (if any).
+            CompressedState const* state;
+
+            // The values of the variables that were set explicitly.
+            std::vector<double> booleanValues;
+            std::vector<double> integerValues;
+            std::vector<double> rationalValues;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_BYTECODEEXPRESSIONEVALUATOR_H_ */
@@ -52,7 +52,7 @@ namespace storm {
             this->variableInformation = VariableInformation(model, this->parallelAutomata);
             
             // Create a proper evalator.
-            this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(model.getManager());
+            this->initializeEvaluator();
             
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& variable : model.getGlobalVariables()) {
@@ -5,6 +5,7 @@
 #include "storm/logic/Formulas.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 
 #include "storm/models/sparse/StateLabeling.h"
@@ -14,14 +15,34 @@
 
 namespace storm {
     namespace generator {
-                    
+        
+        namespace {
+            template<typename ValueType>
+            std::unique_ptr<storm::expressions::ExpressionEvaluatorBase<ValueType>> createEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const&, storm::builder::ExpressionEvaluatorType const& type, BytecodeExpressionEvaluator*& bytecodeEvaluator) {
+                STORM_LOG_WARN_COND(type != storm::builder::ExpressionEvaluatorType::Bytecode, "The bytecode expression evaluator is only available for floating point models. Falling back to the default evaluator.");
+                bytecodeEvaluator = nullptr;
+                return std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(manager);
+            }
+            
+            template<>
+            std::unique_ptr<storm::expressions::ExpressionEvaluatorBase<double>> createEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation, storm::builder::ExpressionEvaluatorType const& type, BytecodeExpressionEvaluator*& bytecodeEvaluator) {
+                if (type == storm::builder::ExpressionEvaluatorType::Bytecode) {
+                    std::unique_ptr<BytecodeExpressionEvaluator> result = std::make_unique<BytecodeExpressionEvaluator>(manager, variableInformation);
+                    bytecodeEvaluator = result.get();
+                    return std::move(result);
+                }
+                bytecodeEvaluator = nullptr;
+                return std::make_unique<storm::expressions::ExpressionEvaluator<double>>(manager);
+            }
+        }
+        
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), bytecodeEvaluator(nullptr), state(nullptr) {
             // Intentionally left empty.
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), bytecodeEvaluator(nullptr), state(nullptr) {
             // Intentionally left empty.
         }
         
@@ -35,10 +56,25 @@ namespace storm {
             return variableInformation.getTotalBitOffset(true);
         }
         
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::initializeEvaluator() {
+            evaluator = createEvaluator<ValueType>(*expressionManager, variableInformation, options.getExpressionEvaluatorType(), bytecodeEvaluator);
+        }
+        
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::loadStateIntoEvaluator(CompressedState const& state) {
+            if (bytecodeEvaluator) {
+                // The bytecode evaluator reads the values of the variables directly from the state.
+                bytecodeEvaluator->setState(state);
+            } else {
+                unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
             // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            loadStateIntoEvaluator(state);
             
             // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
@@ -74,7 +110,7 @@ namespace storm {
                 result.addLabel(label.first);
             }
             for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+                loadStateIntoEvaluator(stateIndexPair.first);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
@@ -8,7 +8,7 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/BitVectorHashMap.h"
-#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
 
 #include "storm/builder/BuilderOptions.h"
@@ -17,6 +17,7 @@
 #include "storm/generator/VariableInformation.h"
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/StateBehavior.h"
+#include "storm/generator/BytecodeExpressionEvaluator.h"
 
 #include "storm/utility/ConstantsComparator.h"
 
@@ -68,6 +69,17 @@ namespace storm {
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
             
         protected:
+            /*!
+             * Creates the evaluator that is used for evaluating expressions as specified by the options. Note that this
+             * requires the variable information to be initialized.
+             */
+            void initializeEvaluator();
+            
+            /*!
+             * Loads the given state into the evaluator.
+             */
+            void loadStateIntoEvaluator(CompressedState const& state);
+            
             /*!
              * Creates the state labeling for the given states using the provided labels and expressions.
              */
@@ -88,7 +100,10 @@ namespace storm {
             VariableInformation variableInformation;
             
             /// An evaluator used to evaluate expressions.
-            std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
+            std::unique_ptr<storm::expressions::ExpressionEvaluatorBase<ValueType>> evaluator;
+            
+            /// If the bytecode evaluator is used, this points to the evaluator (which is owned by the member above).
+            BytecodeExpressionEvaluator* bytecodeEvaluator;
             
             /// The currently loaded state.
             CompressedState const* state;
@@ -34,7 +34,21 @@ namespace storm {
             this->variableInformation = VariableInformation(program);
             
             // Create a proper evalator.
-            this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
+            this->initializeEvaluator();
+            
+            // If the bytecode evaluator is used, we compile the guards of each module such that they can be evaluated
+            // at once.
+            if (this->bytecodeEvaluator) {
+                for (auto const& module : this->program.getModules()) {
+                    std::vector<storm::expressions::Expression> guards;
+                    guards.reserve(module.getNumberOfCommands());
+                    for (auto const& command : module.getCommands()) {
+                        guards.push_back(command.getGuardExpression());
+                    }
+                    moduleGuardBatches.push_back(this->bytecodeEvaluator->addBatch(guards));
+                }
+                enabledCommands.resize(moduleGuardBatches.size());
+            }
             
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
@@ -209,6 +223,13 @@ namespace storm {
                 }
             }
 
+            // If the bytecode evaluator is used, we evaluate the guards of all commands now.
+            if (this->bytecodeEvaluator) {
+                for (uint_fast64_t moduleIndex = 0; moduleIndex < moduleGuardBatches.size(); ++moduleIndex) {
+                    this->bytecodeEvaluator->evaluateBatch(moduleGuardBatches[moduleIndex], enabledCommands[moduleIndex]);
+                }
+            }
+            
             // Get all choices for the state.
             result.setExpanded();
             std::vector<Choice<ValueType>> allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
@@ -356,9 +377,8 @@ namespace storm {
                 
                 // Look up commands by their indices and add them if the guard evaluates to true in the given state.
                 for (uint_fast64_t commandIndex : commandIndices) {
-                    storm::prism::Command const& command = module.getCommand(commandIndex);
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
-                        commands.push_back(command);
+                    if (isCommandEnabled(i, commandIndex)) {
+                        commands.push_back(module.getCommand(commandIndex));
                     }
                 }
                 
@@ -375,6 +395,14 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(uint_fast64_t moduleIndex, uint_fast64_t commandIndex) const {
+            if (this->bytecodeEvaluator) {
+                return enabledCommands[moduleIndex].get(commandIndex);
+            }
+            return this->evaluator->asBool(program.getModule(moduleIndex).getCommand(commandIndex).getGuardExpression());
+        }
+        
         template<typename ValueType, typename StateType>
         std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getUnlabeledChoices(CompressedState const& state, StateToIdCallback stateToIdCallback) {
             std::vector<Choice<ValueType>> result;
@@ -391,7 +419,7 @@ namespace storm {
                     if (command.isLabeled()) continue;
                     
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isCommandEnabled(i, j)) {
                         continue;
                     }
                                         
@@ -69,6 +69,15 @@ namespace storm {
              */
             boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>> getActiveCommandsByActionIndex(uint_fast64_t const& actionIndex);
             
+            /*!
+             * Retrieves whether the given command is enabled in the currently loaded state.
+             *
+             * @param moduleIndex The index of the module to which the command belongs.
+             * @param commandIndex The index of the command within its module.
+             * @return True iff the guard of the command is satisfied.
+             */
+            bool isCommandEnabled(uint_fast64_t moduleIndex, uint_fast64_t commandIndex) const;
+            
             /*!
              * Retrieves all unlabeled choices possible from the given state.
              *
@@ -93,6 +102,14 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // If the bytecode evaluator is used, the guards of each module are compiled into a batch that is evaluated
+            // once per state. These are the indices of the batches.
+            std::vector<uint_fast64_t> moduleGuardBatches;
+            
+            // For each module, the commands that are enabled in the current state (only used with the bytecode
+            // evaluator).
+            std::vector<storm::storage::BitVector> enabledCommands;
         };
         
     }
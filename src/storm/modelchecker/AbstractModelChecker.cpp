@@ -36,6 +36,16 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given formula '" << formula << "' is invalid.");
         }
 
+        template<typename ModelType>
+        std::vector<std::unique_ptr<CheckResult>> AbstractModelChecker<ModelType>::checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+            std::vector<std::unique_ptr<CheckResult>> results;
+            results.reserve(checkTasks.size());
+            for (auto const& checkTask : checkTasks) {
+                results.push_back(this->check(checkTask));
+            }
+            return results;
+        }
+
         template<typename ModelType>
         std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::computeProbabilities(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
             storm::logic::Formula const& formula = checkTask.getFormula();
@@ -1,6 +1,9 @@
 #ifndef STORM_MODELCHECKER_ABSTRACTMODELCHECKER_H_
 #define STORM_MODELCHECKER_ABSTRACTMODELCHECKER_H_
 
+#include <memory>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include "storm/modelchecker/CheckTask.h"
@@ -38,6 +41,15 @@ namespace storm {
              * @return The verification result.
              */
             virtual std::unique_ptr<CheckResult> check(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            
+            /*!
+             * Checks the provided formulas. As all tasks refer to the same model, model checkers may share
+             * computations among them. Each of the tasks must be supported by the model checker.
+             *
+             * @param checkTasks The verification tasks to pursue.
+             * @return The verification results in the order of the tasks.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks);
                         
             // The methods to compute probabilities for path formulas.
             virtual std::unique_ptr<CheckResult> computeProbabilities(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
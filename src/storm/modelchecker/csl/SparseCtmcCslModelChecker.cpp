@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 
+#include <map>
+
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
@@ -18,6 +20,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotImplementedException.h"
 
@@ -52,6 +55,73 @@ namespace storm {
             return formula.isInFragment(storm::logic::prctl().setGloballyFormulasAllowed(false).setLongRunAverageRewardFormulasAllowed(true).setLongRunAverageProbabilitiesAllowed(true).setTimeAllowed(true));
         }
         
+        template <typename SparseCtmcModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+            std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+            
+            // Time-bounded reachability probabilities that only differ in their time bound are computed with a single
+            // transient analysis, so we group them by their phi and psi states. All other tasks are checked one by one.
+            std::map<std::pair<storm::storage::BitVector, storm::storage::BitVector>, std::vector<uint64_t>> phiPsiStatesToTaskIndices;
+            for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+                CheckTask<storm::logic::Formula, ValueType> const& checkTask = checkTasks[taskIndex];
+                STORM_LOG_THROW(this->canHandle(checkTask), storm::exceptions::InvalidArgumentException, "The model checker is not able to check the formula '" << checkTask.getFormula() << "'.");
+                boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> phiPsiStates = getTimeBoundedUntilStatesForBatch(checkTask);
+                if (phiPsiStates) {
+                    phiPsiStatesToTaskIndices[std::move(phiPsiStates.get())].push_back(taskIndex);
+                }
+            }
+            
+            for (auto const& phiPsiStatesTaskIndicesPair : phiPsiStatesToTaskIndices) {
+                std::vector<uint64_t> const& taskIndices = phiPsiStatesTaskIndicesPair.second;
+                if (taskIndices.size() == 1) {
+                    continue;
+                }
+                STORM_LOG_INFO("Checking " << taskIndices.size() << " time-bounded reachability probabilities with a shared transient analysis.");
+                std::vector<double> upperBounds;
+                bool onlyInitialStatesRelevant = true;
+                for (auto const& taskIndex : taskIndices) {
+                    upperBounds.push_back(checkTasks[taskIndex].getFormula().asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula().template getNonStrictUpperBound<double>());
+                    onlyInitialStatesRelevant &= checkTasks[taskIndex].isOnlyInitialStatesRelevantSet();
+                }
+                std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), phiPsiStatesTaskIndicesPair.first.first, phiPsiStatesTaskIndicesPair.first.second, this->getModel().getExitRateVector(), upperBounds, *linearEquationSolverFactory, onlyInitialStatesRelevant ? &this->getModel().getInitialStates() : nullptr);
+                
+                for (uint64_t groupIndex = 0; groupIndex < taskIndices.size(); ++groupIndex) {
+                    CheckTask<storm::logic::Formula, ValueType> const& checkTask = checkTasks[taskIndices[groupIndex]];
+                    std::unique_ptr<CheckResult> result = std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResults[groupIndex])));
+                    if (checkTask.isBoundSet()) {
+                        result = result->asQuantitativeCheckResult<ValueType>().compareAgainstBound(checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+                    }
+                    results[taskIndices[groupIndex]] = std::move(result);
+                }
+            }
+            
+            for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+                if (!results[taskIndex]) {
+                    results[taskIndex] = this->check(checkTasks[taskIndex]);
+                }
+            }
+            return results;
+        }
+        
+        template <typename SparseCtmcModelType>
+        boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> SparseCtmcCslModelChecker<SparseCtmcModelType>::getTimeBoundedUntilStatesForBatch(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            if (!storm::NumberTraits<ValueType>::SupportsExponential || !formula.isProbabilityOperatorFormula() || checkTask.isQualitativeSet()) {
+                return boost::none;
+            }
+            storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+            if (!pathFormula.isBoundedUntilFormula()) {
+                return boost::none;
+            }
+            storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+            if (boundedUntilFormula.isMultiDimensional() || boundedUntilFormula.getTimeBoundReference().isStepBound() || boundedUntilFormula.hasLowerBound() || !boundedUntilFormula.hasUpperBound()) {
+                return boost::none;
+            }
+            std::unique_ptr<CheckResult> leftResultPointer = this->check(boundedUntilFormula.getLeftSubformula());
+            std::unique_ptr<CheckResult> rightResultPointer = this->check(boundedUntilFormula.getRightSubformula());
+            return std::make_pair(leftResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector(), rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector());
+        }
+        
         template <typename SparseCtmcModelType>
         std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
             storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
@@ -72,7 +142,7 @@ namespace storm {
                 upperBound = storm::utility::infinity<double>();
             }
 
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), this->getModel().getExitRateVector(), checkTask.isQualitativeSet(), lowerBound, upperBound, *linearEquationSolverFactory);
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), this->getModel().getExitRateVector(), checkTask.isQualitativeSet(), lowerBound, upperBound, *linearEquationSolverFactory, checkTask.isOnlyInitialStatesRelevantSet() ? &this->getModel().getInitialStates() : nullptr);
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
@@ -23,6 +23,7 @@ namespace storm {
             
             // The implemented methods of the AbstractModelChecker interface.
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+            virtual std::vector<std::unique_ptr<CheckResult>> checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) override;
             virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeNextProbabilities(CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
@@ -35,6 +36,12 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
 
         private:
+            /*!
+             * Retrieves the phi and psi states of the given task if it asks for the probabilities of phi U[0, t] psi
+             * (or F[0, t] psi) and can therefore be checked together with other such tasks in checkAll.
+             */
+            boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> getTimeBoundedUntilStatesForBatch(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            
             template<typename CValueType = ValueType, typename std::enable_if<storm::NumberTraits<CValueType>::SupportsExponential, int>::type = 0>
             bool canHandleImplementation(CheckTask<storm::logic::Formula, CValueType> const& checkTask) const;
 
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 
+#include <map>
+
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
@@ -16,6 +18,7 @@
 
 #include "storm/logic/FragmentSpecification.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotImplementedException.h"
 
@@ -45,6 +48,71 @@ namespace storm {
             }
         }
         
+        template<typename SparseMarkovAutomatonModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+            std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+            
+            // Time-bounded reachability probabilities that only differ in their time bound are computed with a single
+            // pass of the digitized value iteration, so we group them by their optimization direction and psi states.
+            // All other tasks are checked one by one.
+            std::map<std::pair<OptimizationDirection, storm::storage::BitVector>, std::vector<uint64_t>> directionPsiStatesToTaskIndices;
+            for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+                CheckTask<storm::logic::Formula, ValueType> const& checkTask = checkTasks[taskIndex];
+                STORM_LOG_THROW(this->canHandle(checkTask), storm::exceptions::InvalidArgumentException, "The model checker is not able to check the formula '" << checkTask.getFormula() << "'.");
+                boost::optional<std::pair<OptimizationDirection, storm::storage::BitVector>> directionPsiStates = getTimeBoundedReachabilityStatesForBatch(checkTask);
+                if (directionPsiStates) {
+                    directionPsiStatesToTaskIndices[std::move(directionPsiStates.get())].push_back(taskIndex);
+                }
+            }
+            
+            for (auto const& directionPsiStatesTaskIndicesPair : directionPsiStatesToTaskIndices) {
+                std::vector<uint64_t> const& taskIndices = directionPsiStatesTaskIndicesPair.second;
+                if (taskIndices.size() == 1) {
+                    continue;
+                }
+                STORM_LOG_INFO("Checking " << taskIndices.size() << " time-bounded reachability probabilities with a shared value iteration.");
+                std::vector<double> upperBounds;
+                for (auto const& taskIndex : taskIndices) {
+                    upperBounds.push_back(checkTasks[taskIndex].getFormula().asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula().template getNonStrictUpperBound<double>());
+                }
+                std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(directionPsiStatesTaskIndicesPair.first.first, this->getModel().getTransitionMatrix(), this->getModel().getExitRates(), this->getModel().getMarkovianStates(), directionPsiStatesTaskIndicesPair.first.second, upperBounds, *minMaxLinearEquationSolverFactory);
+                
+                for (uint64_t groupIndex = 0; groupIndex < taskIndices.size(); ++groupIndex) {
+                    CheckTask<storm::logic::Formula, ValueType> const& checkTask = checkTasks[taskIndices[groupIndex]];
+                    std::unique_ptr<CheckResult> result = std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResults[groupIndex])));
+                    if (checkTask.isBoundSet()) {
+                        result = result->asQuantitativeCheckResult<ValueType>().compareAgainstBound(checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+                    }
+                    results[taskIndices[groupIndex]] = std::move(result);
+                }
+            }
+            
+            for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+                if (!results[taskIndex]) {
+                    results[taskIndex] = this->check(checkTasks[taskIndex]);
+                }
+            }
+            return results;
+        }
+        
+        template<typename SparseMarkovAutomatonModelType>
+        boost::optional<std::pair<OptimizationDirection, storm::storage::BitVector>> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::getTimeBoundedReachabilityStatesForBatch(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            if (!storm::NumberTraits<ValueType>::SupportsExponential || !formula.isProbabilityOperatorFormula() || !checkTask.isOptimizationDirectionSet() || checkTask.isQualitativeSet() || !this->getModel().isClosed()) {
+                return boost::none;
+            }
+            storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+            if (!pathFormula.isBoundedUntilFormula()) {
+                return boost::none;
+            }
+            storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+            if (boundedUntilFormula.isMultiDimensional() || boundedUntilFormula.getTimeBoundReference().isStepBound() || boundedUntilFormula.hasLowerBound() || !boundedUntilFormula.hasUpperBound() || !boundedUntilFormula.getLeftSubformula().isTrueFormula()) {
+                return boost::none;
+            }
+            std::unique_ptr<CheckResult> rightResultPointer = this->check(boundedUntilFormula.getRightSubformula());
+            return std::make_pair(checkTask.getOptimizationDirection(), rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector());
+        }
+        
         template<typename SparseMarkovAutomatonModelType>
         std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
             storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
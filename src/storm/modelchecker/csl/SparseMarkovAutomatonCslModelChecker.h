@@ -21,6 +21,7 @@ namespace storm {
             
             // The implemented methods of the AbstractModelChecker interface.
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+            virtual std::vector<std::unique_ptr<CheckResult>> checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) override;
             virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
@@ -30,6 +31,12 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
             
         private:
+            /*!
+             * Retrieves the optimization direction and the psi states of the given task if it asks for the optimal
+             * probabilities of F[0, t] psi and can therefore be checked together with other such tasks in checkAll.
+             */
+            boost::optional<std::pair<OptimizationDirection, storm::storage::BitVector>> getTimeBoundedReachabilityStatesForBatch(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            
             // An object that is used for retrieving solvers for systems of linear equations that are the result of nondeterministic choices.
             std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ValueType>> minMaxLinearEquationSolverFactory;
         };
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <deque>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -7,6 +9,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/TimeBoundedSolverSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 
@@ -20,6 +23,7 @@
 #include "storm/utility/numerical.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 
@@ -27,7 +31,7 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates) {
                 
                 uint_fast64_t numberOfStates = rateMatrix.getRowCount();
                 
@@ -58,31 +62,7 @@ namespace storm {
                         if (storm::utility::isZero(lowerBound)) {
                             // In this case, the interval is of the form [0, t].
                             // Note that this excludes [0, inf] since this is untimed reachability and we considered this case earlier.
-                            
-                            // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
-                            ValueType uniformizationRate = 0;
-                            for (auto const& state : statesWithProbabilityGreater0NonPsi) {
-                                uniformizationRate = std::max(uniformizationRate, exitRates[state]);
-                            }
-                            uniformizationRate *= 1.02;
-                            STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-                            
-                            // Compute the uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
-                            
-                            // Compute the vector that is to be added as a compensation for removing the absorbing states.
-                            std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
-                            for (auto& element : b) {
-                                element /= uniformizationRate;
-                            }
-                            
-                            // Finally compute the transient probabilities.
-                            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
-                            std::vector<ValueType> subresult = computeTransientProbabilities(uniformizedMatrix, &b, upperBound, uniformizationRate, values, linearEquationSolverFactory);
-                            result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
-                            
-                            storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresult);
-                            storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                            result = std::move(computeTimeBoundedReachabilityProbabilities(rateMatrix, statesWithProbabilityGreater0NonPsi, psiStates, exitRates, {upperBound}, linearEquationSolverFactory, relevantStates).front());
                         } else if (upperBound == storm::utility::infinity<ValueType>()) {
                             // In this case, the interval is of the form [t, inf] with t != 0.
                             
@@ -194,9 +174,229 @@ namespace storm {
             }
             
             template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, double, double, storm::solver::LinearEquationSolverFactory<ValueType> const&) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, double, double, storm::solver::LinearEquationSolverFactory<ValueType> const&, storm::storage::BitVector const*) {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
+            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates) {
+                for (auto const& upperBound : upperBounds) {
+                    STORM_LOG_THROW(upperBound >= 0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidArgumentException, "Illegal time bound " << upperBound << ".");
+                }
+                
+                // Only the states that have a positive probability to reach a psi state need to be considered.
+                storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates) & ~psiStates;
+                STORM_LOG_INFO("Found " << maybeStates.getNumberOfSetBits() << " 'maybe' states.");
+                
+                if (maybeStates.empty()) {
+                    std::vector<ValueType> result(rateMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                    return std::vector<std::vector<ValueType>>(upperBounds.size(), result);
+                }
+                return computeTimeBoundedReachabilityProbabilities(rateMatrix, maybeStates, psiStates, exitRates, upperBounds, linearEquationSolverFactory, relevantStates);
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&, storm::solver::LinearEquationSolverFactory<ValueType> const&, storm::storage::BitVector const*) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTimeBoundedReachabilityProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timeBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates) {
+                std::vector<std::vector<ValueType>> results(timeBounds.size(), std::vector<ValueType>(rateMatrix.getRowCount(), storm::utility::zero<ValueType>()));
+                for (auto& result : results) {
+                    storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                }
+                
+                bool useAdaptiveUniformization = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>().getCtmcMethod() == storm::settings::modules::TimeBoundedSolverSettings::CtmcMethod::AdaptiveUniformization;
+                STORM_LOG_WARN_COND(!useAdaptiveUniformization || relevantStates, "Adaptive uniformization requires the values of only some states to be relevant. Falling back to standard uniformization.");
+                if (useAdaptiveUniformization && relevantStates) {
+                    // Analyze each relevant state separately.
+                    for (auto const& state : *relevantStates & maybeStates) {
+                        std::vector<ValueType> stateResults = computeTimeBoundedReachabilityProbabilitiesAdaptively(rateMatrix, maybeStates, psiStates, exitRates, timeBounds, state);
+                        for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                            results[index][state] = stateResults[index];
+                        }
+                    }
+                    return results;
+                }
+                
+                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                for (auto const& state : maybeStates) {
+                    uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                // Compute the uniformized matrix.
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, maybeStates, uniformizationRate, exitRates);
+                
+                // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(maybeStates, psiStates);
+                for (auto& element : b) {
+                    element /= uniformizationRate;
+                }
+                
+                // Finally compute the transient probabilities.
+                std::vector<ValueType> values(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                std::vector<ValueType> timeBoundValues;
+                for (auto const& timeBound : timeBounds) {
+                    timeBoundValues.push_back(storm::utility::convertNumber<ValueType>(timeBound));
+                }
+                std::vector<std::vector<ValueType>> subresults = computeTransientProbabilities(uniformizedMatrix, &b, timeBoundValues, uniformizationRate, values, linearEquationSolverFactory);
+                for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                    storm::utility::vector::setVectorValues(results[index], maybeStates, subresults[index]);
+                }
+                return results;
+            }
+            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseCtmcCslHelper::computeTimeBoundedReachabilityProbabilitiesAdaptively(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timeBounds, uint64_t initialState) {
+                ValueType epsilon = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                
+                // The birth process is uniformized with the maximal rate of all 'maybe' states, as this bounds the rates
+                // of all steps.
+                ValueType maximalRate = storm::utility::zero<ValueType>();
+                for (auto const& state : maybeStates) {
+                    maximalRate = std::max(maximalRate, exitRates[state]);
+                }
+                STORM_LOG_THROW(maximalRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                // The uniformization rates of the steps and the probabilities of having reached a psi state after the
+                // respective number of steps.
+                std::vector<ValueType> stepRates;
+                std::vector<ValueType> stepPsiProbabilities;
+                
+                // The current distribution over the 'maybe' states and the states having positive probability in it.
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                std::vector<ValueType> distribution(numberOfStates, storm::utility::zero<ValueType>());
+                std::vector<ValueType> nextDistribution(numberOfStates, storm::utility::zero<ValueType>());
+                storm::storage::BitVector activeStates(numberOfStates);
+                storm::storage::BitVector nextActiveStates(numberOfStates);
+                distribution[initialState] = storm::utility::one<ValueType>();
+                activeStates.set(initialState);
+                ValueType psiProbability = storm::utility::zero<ValueType>();
+                
+                // Records the data of the current step and moves the distribution one step forward. Probability mass
+                // that leaves the 'maybe' states towards non-psi states is dropped, as it can no longer reach psi.
+                auto performStep = [&] () {
+                    stepPsiProbabilities.push_back(psiProbability);
+                    ValueType rate = storm::utility::zero<ValueType>();
+                    for (auto const& state : activeStates) {
+                        rate = std::max(rate, exitRates[state]);
+                    }
+                    stepRates.push_back(rate);
+                    if (storm::utility::isZero(rate)) {
+                        return;
+                    }
+                    
+                    nextActiveStates.clear();
+                    for (auto const& state : activeStates) {
+                        ValueType probability = distribution[state];
+                        ValueType stayingProbability = probability * (storm::utility::one<ValueType>() - exitRates[state] / rate);
+                        if (!storm::utility::isZero(stayingProbability)) {
+                            nextDistribution[state] += stayingProbability;
+                            nextActiveStates.set(state);
+                        }
+                        for (auto const& entry : rateMatrix.getRow(state)) {
+                            if (psiStates.get(entry.getColumn())) {
+                                psiProbability += probability * entry.getValue() / rate;
+                            } else if (maybeStates.get(entry.getColumn())) {
+                                nextDistribution[entry.getColumn()] += probability * entry.getValue() / rate;
+                                nextActiveStates.set(entry.getColumn());
+                            }
+                        }
+                        distribution[state] = storm::utility::zero<ValueType>();
+                    }
+                    std::swap(distribution, nextDistribution);
+                    std::swap(activeStates, nextActiveStates);
+                };
+                performStep();
+                
+                // For each time bound, compute the Poisson weights of the iterations of the birth process.
+                std::vector<uint_fast64_t> leftTruncationPoints(timeBounds.size());
+                std::vector<std::vector<ValueType>> weights(timeBounds.size());
+                uint_fast64_t maximalRightTruncationPoint = 0;
+                for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                    ValueType lambda = storm::utility::convertNumber<ValueType>(timeBounds[index]) * maximalRate;
+                    if (storm::utility::isZero(lambda)) {
+                        weights[index].push_back(storm::utility::one<ValueType>());
+                        continue;
+                    }
+                    std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, epsilon);
+                    leftTruncationPoints[index] = std::get<0>(foxGlynnResult);
+                    weights[index] = std::move(std::get<3>(foxGlynnResult));
+                    for (auto& element : weights[index]) {
+                        element /= std::get<2>(foxGlynnResult);
+                    }
+                    maximalRightTruncationPoint = std::max(maximalRightTruncationPoint, leftTruncationPoints[index] + weights[index].size() - 1);
+                }
+                
+                // The distribution of the birth process over the number of steps, starting from the lowest step that
+                // still has a relevant probability. Steps with negligible probability are cut off from the bottom,
+                // which keeps the distribution small. The total error of this is bounded by epsilon.
+                std::deque<ValueType> stepProbabilities = { storm::utility::one<ValueType>() };
+                uint_fast64_t lowestStep = 0;
+                ValueType cutoffThreshold = epsilon / (maximalRightTruncationPoint + 1);
+                
+                std::vector<ValueType> results(timeBounds.size(), storm::utility::zero<ValueType>());
+                for (uint_fast64_t iteration = 0; iteration <= maximalRightTruncationPoint; ++iteration) {
+                    if (iteration > 0) {
+                        // Extend the distribution by one step if the highest step can be left.
+                        uint_fast64_t highestStep = lowestStep + stepProbabilities.size() - 1;
+                        if (!storm::utility::isZero(stepRates[highestStep])) {
+                            if (stepRates.size() == highestStep + 1) {
+                                performStep();
+                            }
+                            stepProbabilities.push_back(storm::utility::zero<ValueType>());
+                        }
+                        
+                        // Perform one step of the uniformized birth process. Going through the steps in descending order
+                        // makes sure that the probability of the preceding step is not yet updated.
+                        for (uint_fast64_t offset = stepProbabilities.size(); offset > 0; --offset) {
+                            uint_fast64_t step = lowestStep + offset - 1;
+                            ValueType& probability = stepProbabilities[offset - 1];
+                            probability -= probability * stepRates[step] / maximalRate;
+                            if (offset > 1) {
+                                probability += stepProbabilities[offset - 2] * stepRates[step - 1] / maximalRate;
+                            }
+                        }
+                        
+                        while (stepProbabilities.size() > 1 && stepProbabilities.front() < cutoffThreshold) {
+                            stepProbabilities.pop_front();
+                            ++lowestStep;
+                        }
+                    }
+                    
+                    // Compute the probability of having reached a psi state after the current iteration.
+                    ValueType iterationPsiProbability = storm::utility::zero<ValueType>();
+                    for (uint_fast64_t offset = 0; offset < stepProbabilities.size(); ++offset) {
+                        iterationPsiProbability += stepProbabilities[offset] * stepPsiProbabilities[lowestStep + offset];
+                    }
+                    
+                    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                        if (iteration >= leftTruncationPoints[index] && iteration < leftTruncationPoints[index] + weights[index].size()) {
+                            results[index] += weights[index][iteration - leftTruncationPoints[index]] * iterationPsiProbability;
+                        }
+                    }
+                    
+                    // If all probability mass is in a step that cannot be left, the further iterations do not change
+                    // anything, so we can add their weights at once.
+                    if (stepProbabilities.size() == 1 && storm::utility::isZero(stepRates[lowestStep])) {
+                        STORM_LOG_DEBUG("Birth process became absorbing after " << iteration << " iterations.");
+                        for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                            for (uint_fast64_t weightIndex = iteration + 1 > leftTruncationPoints[index] ? iteration + 1 - leftTruncationPoints[index] : 0; weightIndex < weights[index].size(); ++weightIndex) {
+                                results[index] += weights[index][weightIndex] * iterationPsiProbability;
+                            }
+                        }
+                        break;
+                    }
+                }
+                
+                STORM_LOG_INFO("Adaptive uniformization of state " << initialState << " took " << stepRates.size() << " steps instead of " << maximalRightTruncationPoint << ".");
+                return results;
+            }
 
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
@@ -614,79 +814,105 @@ namespace storm {
             template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 
-                ValueType lambda = timeBound * uniformizationRate;
-                
                 // If no time can pass, the current values are the result.
-                if (storm::utility::isZero(lambda)) {
+                if (storm::utility::isZero(timeBound * uniformizationRate)) {
                     return values;
                 }
                 
-                // Use Fox-Glynn to get the truncation points and the weights.
-                std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0);
-                STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << std::get<0>(foxGlynnResult) << ", right=" << std::get<1>(foxGlynnResult));
+                std::vector<ValueType> timeBounds = { timeBound };
+                return std::move(computeTransientProbabilities<ValueType, useMixedPoissonProbabilities>(uniformizedMatrix, addVector, timeBounds, uniformizationRate, std::move(values), linearEquationSolverFactory).front());
+            }
+            
+            template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 
-                // Scale the weights so they add up to one.
-                for (auto& element : std::get<3>(foxGlynnResult)) {
-                    element /= std::get<2>(foxGlynnResult);
-                }
+                ValueType epsilon = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
                 
-                // If the cumulative reward is to be computed, we need to adjust the weights.
-                if (useMixedPoissonProbabilities) {
-                    ValueType sum = storm::utility::zero<ValueType>();
+                // For each time bound, determine the weights of the iterations, starting from the left truncation point.
+                // The iterations before that point have weight zero.
+                std::vector<uint_fast64_t> leftTruncationPoints(timeBounds.size());
+                std::vector<std::vector<ValueType>> weights(timeBounds.size());
+                uint_fast64_t maximalRightTruncationPoint = 0;
+                for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                    ValueType lambda = timeBounds[index] * uniformizationRate;
+                    
+                    // If no time can pass, the current values are the result (and no reward is accumulated).
+                    if (storm::utility::isZero(lambda)) {
+                        weights[index].push_back(useMixedPoissonProbabilities ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+                        continue;
+                    }
                     
+                    // Use Fox-Glynn to get the truncation points and the weights.
+                    std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, epsilon);
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << std::get<0>(foxGlynnResult) << ", right=" << std::get<1>(foxGlynnResult));
+                    
+                    // Scale the weights so they add up to one.
                     for (auto& element : std::get<3>(foxGlynnResult)) {
-                        sum += element;
-                        element = (1 - sum) / uniformizationRate;
+                        element /= std::get<2>(foxGlynnResult);
                     }
-                }
-                
-                STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
-                
-                // Initialize result.
-                std::vector<ValueType> result;
-                uint_fast64_t startingIteration = std::get<0>(foxGlynnResult);
-                if (startingIteration == 0) {
-                    result = values;
-                    storm::utility::vector::scaleVectorInPlace(result, std::get<3>(foxGlynnResult)[0]);
-                    ++startingIteration;
-                } else {
+                    
+                    // If the cumulative reward is to be computed, we need to adjust the weights. As the mixed poisson
+                    // probabilities of the iterations below the left truncation point are not zero, they are included.
                     if (useMixedPoissonProbabilities) {
-                        result = std::vector<ValueType>(values.size());
-                        std::function<ValueType (ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate] (ValueType const& a) -> ValueType { return a / uniformizationRate; };
-                        storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
+                        weights[index] = std::vector<ValueType>(std::get<0>(foxGlynnResult), storm::utility::one<ValueType>() / uniformizationRate);
+                        ValueType sum = storm::utility::zero<ValueType>();
+                        for (auto const& element : std::get<3>(foxGlynnResult)) {
+                            sum += element;
+                            weights[index].push_back((1 - sum) / uniformizationRate);
+                        }
                     } else {
-                        result = std::vector<ValueType>(values.size());
+                        leftTruncationPoints[index] = std::get<0>(foxGlynnResult);
+                        weights[index] = std::move(std::get<3>(foxGlynnResult));
                     }
+                    maximalRightTruncationPoint = std::max(maximalRightTruncationPoint, leftTruncationPoints[index] + weights[index].size() - 1);
                 }
                 
+                STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
                 std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(uniformizedMatrix));
                 solver->setCachingEnabled(true);
                 
-                if (!useMixedPoissonProbabilities && std::get<0>(foxGlynnResult) > 1) {
-                    // Perform the matrix-vector multiplications (without adding).
-                    solver->repeatedMultiply(values, addVector, std::get<0>(foxGlynnResult) - 1);
-                } else if (useMixedPoissonProbabilities) {
-                    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
-                    
-                    // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-                    for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-                        solver->repeatedMultiply(values, nullptr, 1);
-                        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
-                    }
-                }
+                bool detectSteadyState = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>().isSteadyStateDetectionSet();
+                std::vector<std::vector<ValueType>> results(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+                std::vector<ValueType> previousValues(values.size());
                 
-                // For the indices that fall in between the truncation points, we need to perform the matrix-vector
-                // multiplication, scale and add the result.
+                // Perform the matrix-vector multiplications and add the scaled values to the result of every time bound
+                // for which the current iteration lies between the truncation points.
                 ValueType weight = 0;
                 std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
-                for (uint_fast64_t index = startingIteration; index <= std::get<1>(foxGlynnResult); ++index) {
-                    solver->repeatedMultiply(values, addVector, 1);
+                for (uint_fast64_t iteration = 0; iteration <= maximalRightTruncationPoint; ++iteration) {
+                    if (iteration > 0) {
+                        solver->multiply(values, addVector, previousValues);
+                        std::swap(values, previousValues);
+                    }
+                    
+                    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                        if (iteration >= leftTruncationPoints[index] && iteration < leftTruncationPoints[index] + weights[index].size()) {
+                            weight = weights[index][iteration - leftTruncationPoints[index]];
+                            storm::utility::vector::applyPointwise(results[index], values, results[index], addAndScale);
+                        }
+                    }
                     
-                    weight = std::get<3>(foxGlynnResult)[index - std::get<0>(foxGlynnResult)];
-                    storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                    // If the values did not change, we assume that the remaining iterations yield the same values and
+                    // add them with their total weight at once. Note that this is only a heuristic (and thus has to be
+                    // enabled explicitly): values that change only slowly may still drift far over the remaining
+                    // iterations.
+                    if (detectSteadyState && iteration > 0 && iteration < maximalRightTruncationPoint && storm::utility::vector::equalModuloPrecision(values, previousValues, epsilon, false)) {
+                        STORM_LOG_INFO("Detected steady state after " << iteration << " of " << maximalRightTruncationPoint << " iterations.");
+                        for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                            weight = storm::utility::zero<ValueType>();
+                            for (uint_fast64_t weightIndex = iteration + 1 > leftTruncationPoints[index] ? iteration + 1 - leftTruncationPoints[index] : 0; weightIndex < weights[index].size(); ++weightIndex) {
+                                weight += weights[index][weightIndex];
+                            }
+                            if (!storm::utility::isZero(weight)) {
+                                storm::utility::vector::applyPointwise(results[index], values, results[index], addAndScale);
+                            }
+                        }
+                        break;
+                    }
                 }
                 
-                return result;
+                return results;
             }
             
             template <typename ValueType>
@@ -718,7 +944,8 @@ namespace storm {
             }
             
             
-            template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
+            template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
             
             template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
 
@@ -739,10 +966,15 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
+            template std::vector<double> SparseCtmcCslHelper::computeTimeBoundedReachabilityProbabilitiesAdaptively(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& timeBounds, uint64_t initialState);
+            
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
 
 #ifdef STORM_HAVE_CARL
-            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
-            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
+            template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
+            template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
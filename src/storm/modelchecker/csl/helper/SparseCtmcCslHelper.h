@@ -14,11 +14,32 @@ namespace storm {
         namespace helper {
             class SparseCtmcCslHelper {
             public:
+                /*!
+                 * Computes the probabilities of satisfying phi U[lowerBound, upperBound] psi.
+                 *
+                 * @param relevantStates If given, only the values of these states are needed. This allows to use
+                 * methods that consider one state at a time (see TimeBoundedSolverSettings). The values of all other
+                 * states are then unspecified.
+                 */
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
-                static std::vector<ValueType> computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
+                static std::vector<ValueType> computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates = nullptr);
 
                 template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
-                static std::vector<ValueType> computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
+                static std::vector<ValueType> computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates = nullptr);
+                
+                /*!
+                 * Computes the probabilities of satisfying phi U[0, t] psi for several time bounds t. All time bounds
+                 * are handled by the same pass of the transient analysis.
+                 *
+                 * @param upperBounds The time bounds.
+                 * @param relevantStates If given, only the values of these states are needed.
+                 * @return For each time bound, the probabilities to satisfy the formula.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates = nullptr);
+                
+                template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates = nullptr);
                 
                 template <typename ValueType>
                 static std::vector<ValueType> computeUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
@@ -82,6 +103,34 @@ namespace storm {
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
                 
+                /*!
+                 * Computes the transient probabilities for several time bounds. The matrix-vector multiplications are
+                 * performed only once (up to the right truncation point of the largest time bound) and the results for
+                 * all time bounds are accumulated on the way. Unless disabled in the settings, the iteration stops
+                 * early once the values no longer change.
+                 *
+                 * @param timeBounds The time bounds to use.
+                 * @return For each time bound, the vector of transient probabilities.
+                 */
+                template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
+                
+                /*!
+                 * Computes the probabilities of reaching a psi state within each of the time bounds from the given
+                 * (maybe) state using adaptive uniformization. Starting from the initial state, the probability
+                 * distribution is propagated forward and each step is uniformized with the maximal exit rate of the
+                 * states that currently have positive probability (rather than the maximal rate of all states). The
+                 * number of steps taken until a time bound is then given by a birth process whose rates are the rates
+                 * of the individual steps. This birth process is analyzed by standard uniformization, which is cheap
+                 * as it only operates on a single vector over the steps.
+                 *
+                 * @param maybeStates The states with positive probability that are not psi states.
+                 * @param initialState The (maybe) state whose probabilities are to be computed.
+                 * @return For each time bound, the probability to reach a psi state within it.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<ValueType> computeTimeBoundedReachabilityProbabilitiesAdaptively(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timeBounds, uint64_t initialState);
+                
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
                  *
@@ -103,6 +152,13 @@ namespace storm {
                 static storm::storage::SparseMatrix<ValueType> computeGeneratorMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates);
                 
             private:
+                /*!
+                 * Computes the probabilities of reaching a psi state within each of the time bounds, where only the
+                 * maybe states (the states with positive probability that are not psi states) need to be considered.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeTimeBoundedReachabilityProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timeBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, storm::storage::BitVector const* relevantStates);
+                
                 template <typename ValueType>
                 static std::vector<ValueType> computeLongRunAverages(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, std::function<ValueType (storm::storage::sparse::state_type const& state)> const& valueGetter, std::vector<ValueType> const* exitRateVector, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
             };
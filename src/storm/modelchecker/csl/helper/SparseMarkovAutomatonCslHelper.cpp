@@ -10,6 +10,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/modules/TimeBoundedSolverSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -33,7 +34,7 @@ namespace storm {
         namespace helper {
 
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+            void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, std::function<void (uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const&)> const& stepCallback) {
                 
                 // Start by computing four sparse matrices:
                 // * a matrix aMarkovian with all (discretized) transitions from Markovian non-goal states to all Markovian non-goal states.
@@ -96,8 +97,9 @@ namespace storm {
                 // *    perform value iteration using A_PSwG, v_PS and the vector b where b = (A * 1_G)|PS + A_PStoMS * v_MS
                 //      and 1_G being the characteristic vector for all goal states.
                 // *    perform one timed-step using v_MS := A_MSwG * v_MS + A_MStoPS * v_PS + (A * 1_G)|MS
+                // After the last timed step, we perform one more step of the value iteration for PS states.
                 std::vector<ValueType> markovianNonGoalValuesSwap(markovianNonGoalValues);
-                for (uint64_t currentStep = 0; currentStep < numberOfSteps; ++currentStep) {
+                for (uint64_t currentStep = 0; ; ++currentStep) {
                     // Start by (re-)computing bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
                     aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
                     storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
@@ -105,6 +107,14 @@ namespace storm {
                     // Now perform the inner value iteration for probabilistic states.
                     solver->solveEquations(dir, probabilisticNonGoalValues, bProbabilistic);
                     
+                    // At this point, the values of all states correspond to a time bound of currentStep * delta.
+                    if (stepCallback) {
+                        stepCallback(currentStep, markovianNonGoalValues, probabilisticNonGoalValues);
+                    }
+                    if (currentStep == numberOfSteps) {
+                        break;
+                    }
+                    
                     // (Re-)compute bMarkovian = bMarkovianFixed + aMarkovianToProbabilistic * vProbabilistic.
                     aMarkovianToProbabilistic.multiplyWithVector(probabilisticNonGoalValues, bMarkovian);
                     storm::utility::vector::addVectors(bMarkovian, bMarkovianFixed, bMarkovian);
@@ -112,15 +122,10 @@ namespace storm {
                     std::swap(markovianNonGoalValues, markovianNonGoalValuesSwap);
                     storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovian, markovianNonGoalValues);
                 }
-                
-                // After the loop, perform one more step of the value iteration for PS states.
-                aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
-                storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
-                solver->solveEquations(dir, probabilisticNonGoalValues, bProbabilistic);
             }
              
             template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+            void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, std::function<void (uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const&)> const& stepCallback) {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded reachability probabilities is unsupported for this value type.");
             }
                 
@@ -132,6 +137,13 @@ namespace storm {
                 // 'Unpack' the bounds to make them more easily accessible.
                 double lowerBound = boundsPair.first;
                 double upperBound = boundsPair.second;
+                
+                if (storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>().getMaMethod() == storm::settings::modules::TimeBoundedSolverSettings::MaMethod::UnifPlus) {
+                    if (lowerBound == 0) {
+                        return computeBoundedReachabilityProbabilitiesUnifPlus(dir, transitionMatrix, exitRateVector, markovianStates, psiStates, upperBound, minMaxLinearEquationSolverFactory);
+                    }
+                    STORM_LOG_WARN("Unif+ does not support lower time bounds, using digitization instead.");
+                }
 
                 // (1) Compute the accuracy we need to achieve the required error bound.
                 ValueType maxExitRate = 0;
@@ -194,6 +206,238 @@ namespace storm {
             }
 
            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                std::vector<std::vector<ValueType>> result(upperBounds.size());
+                if (upperBounds.empty()) {
+                    return result;
+                }
+                for (auto const& upperBound : upperBounds) {
+                    STORM_LOG_THROW(upperBound >= 0 && !storm::utility::isInfinity(upperBound), storm::exceptions::InvalidPropertyException, "Illegal time bound " << upperBound << ".");
+                }
+                
+                if (storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>().getMaMethod() == storm::settings::modules::TimeBoundedSolverSettings::MaMethod::UnifPlus) {
+                    // The uniformization rate of Unif+ depends on the time bound, so we handle the time bounds separately.
+                    for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+                        result[boundIndex] = computeBoundedReachabilityProbabilitiesUnifPlus(dir, transitionMatrix, exitRateVector, markovianStates, psiStates, upperBounds[boundIndex], minMaxLinearEquationSolverFactory);
+                    }
+                    return result;
+                }
+                
+                // The error of the digitization grows linearly with the time bound, so the step size that is precise
+                // enough for the largest time bound is also precise enough for all other time bounds.
+                double maxUpperBound = *std::max_element(upperBounds.begin(), upperBounds.end());
+                ValueType maxExitRate = 0;
+                for (auto value : exitRateVector) {
+                    maxExitRate = std::max(maxExitRate, value);
+                }
+                ValueType delta = (2 * storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()) / (maxUpperBound * maxExitRate * maxExitRate);
+                
+                // Sort the time bounds by the number of steps that are needed to reach them.
+                std::vector<uint64_t> stepsPerBound;
+                stepsPerBound.reserve(upperBounds.size());
+                for (auto const& upperBound : upperBounds) {
+                    stepsPerBound.push_back(maxUpperBound == 0 ? 0 : static_cast<uint64_t>(std::ceil(upperBound / delta)));
+                }
+                std::vector<uint_fast64_t> boundIndices = storm::utility::vector::buildVectorForRange(0, upperBounds.size());
+                std::sort(boundIndices.begin(), boundIndices.end(), [&stepsPerBound] (uint_fast64_t const& first, uint_fast64_t const& second) { return stepsPerBound[first] < stepsPerBound[second]; });
+                uint64_t numberOfSteps = stepsPerBound[boundIndices.back()];
+                STORM_LOG_INFO("Performing " << numberOfSteps << " iterations (delta=" << delta << ") for " << upperBounds.size() << " time bounds up to " << maxUpperBound << "." << std::endl);
+                
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                storm::storage::BitVector const& markovianNonGoalStates = markovianStates & ~psiStates;
+                storm::storage::BitVector const& probabilisticNonGoalStates = ~markovianStates & ~psiStates;
+                std::vector<ValueType> vProbabilistic(probabilisticNonGoalStates.getNumberOfSetBits());
+                std::vector<ValueType> vMarkovian(markovianNonGoalStates.getNumberOfSetBits());
+                
+                // Whenever the values correspond to one of the time bounds, we create the result for this bound.
+                auto boundIndexIt = boundIndices.begin();
+                std::function<void (uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const&)> storeResults = [&] (uint64_t currentStep, std::vector<ValueType> const& markovianNonGoalValues, std::vector<ValueType> const& probabilisticNonGoalValues) {
+                    for (; boundIndexIt != boundIndices.end() && stepsPerBound[*boundIndexIt] == currentStep; ++boundIndexIt) {
+                        std::vector<ValueType>& boundResult = result[*boundIndexIt];
+                        boundResult.resize(numberOfStates);
+                        storm::utility::vector::setVectorValues<ValueType>(boundResult, psiStates, storm::utility::one<ValueType>());
+                        storm::utility::vector::setVectorValues(boundResult, probabilisticNonGoalStates, probabilisticNonGoalValues);
+                        storm::utility::vector::setVectorValues(boundResult, markovianNonGoalStates, markovianNonGoalValues);
+                    }
+                };
+                computeBoundedReachabilityProbabilities(dir, transitionMatrix, exitRateVector, psiStates, markovianNonGoalStates, probabilisticNonGoalStates, vMarkovian, vProbabilistic, delta, numberOfSteps, minMaxLinearEquationSolverFactory, storeResults);
+                STORM_LOG_ASSERT(boundIndexIt == boundIndices.end(), "Not all time bounds were handled.");
+                
+                return result;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double upperBound, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                STORM_LOG_THROW(upperBound >= 0 && !storm::utility::isInfinity(upperBound), storm::exceptions::InvalidPropertyException, "Illegal time bound " << upperBound << ".");
+                ValueType precision = storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+                
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                storm::storage::BitVector markovianNonGoalStates = markovianStates & ~psiStates;
+                storm::storage::BitVector probabilisticNonGoalStates = ~markovianStates & ~psiStates;
+                
+                // Start by computing the transitions between the non-goal states and the one-step probabilities to reach
+                // a goal state. In contrast to digitization, the transitions of Markovian states are uniformized below.
+                typename storm::storage::SparseMatrix<ValueType> aMarkovian = transitionMatrix.getSubmatrix(true, markovianNonGoalStates, markovianNonGoalStates, true);
+                typename storm::storage::SparseMatrix<ValueType> aMarkovianToProbabilistic = transitionMatrix.getSubmatrix(true, markovianNonGoalStates, probabilisticNonGoalStates);
+                typename storm::storage::SparseMatrix<ValueType> aProbabilistic = transitionMatrix.getSubmatrix(true, probabilisticNonGoalStates, probabilisticNonGoalStates);
+                typename storm::storage::SparseMatrix<ValueType> aProbabilisticToMarkovian = transitionMatrix.getSubmatrix(true, probabilisticNonGoalStates, markovianNonGoalStates);
+                std::vector<ValueType> bMarkovianFixed = transitionMatrix.getConstrainedRowGroupSumVector(markovianNonGoalStates, psiStates);
+                std::vector<ValueType> bProbabilisticFixed = transitionMatrix.getConstrainedRowGroupSumVector(probabilisticNonGoalStates, psiStates);
+                
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = minMaxLinearEquationSolverFactory.create(aProbabilistic);
+                solver->setCachingEnabled(true);
+                
+                // Computes the values of the probabilistic states given the values of the Markovian states, where reaching
+                // a goal state is worth the given value.
+                std::vector<ValueType> bProbabilistic(aProbabilistic.getRowCount());
+                auto solveProbabilisticStates = [&] (ValueType const& goalValue, std::vector<ValueType> const& markovianValues, std::vector<ValueType>& probabilisticValues) {
+                    aProbabilisticToMarkovian.multiplyWithVector(markovianValues, bProbabilistic);
+                    storm::utility::vector::addScaledVector(bProbabilistic, bProbabilisticFixed, goalValue);
+                    solver->solveEquations(dir, probabilisticValues, bProbabilistic);
+                };
+                
+                std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+                
+                ValueType maxExitRate = storm::utility::zero<ValueType>();
+                for (auto state : markovianNonGoalStates) {
+                    maxExitRate = std::max(maxExitRate, exitRateVector[state]);
+                }
+                if (upperBound == 0 || maxExitRate == storm::utility::zero<ValueType>()) {
+                    // No Markovian transition can be taken, so only the probabilistic states can reach a goal state.
+                    std::vector<ValueType> markovianValues(markovianNonGoalStates.getNumberOfSetBits());
+                    std::vector<ValueType> probabilisticValues(probabilisticNonGoalStates.getNumberOfSetBits());
+                    solveProbabilisticStates(storm::utility::one<ValueType>(), markovianValues, probabilisticValues);
+                    storm::utility::vector::setVectorValues(result, probabilisticNonGoalStates, probabilisticValues);
+                    return result;
+                }
+                
+                ValueType truncationError = precision / 8;
+                ValueType lambda = maxExitRate;
+                ValueType previousDifference = storm::utility::infinity<ValueType>();
+                // The number of jumps grows linearly with the uniformization rate, so we stop increasing the rate once
+                // the jumps become too many to be considered in reasonable time.
+                uint64_t const maximalNumberOfJumps = 1000000;
+                while (true) {
+                    // Uniformize the Markovian states with rate lambda, i.e. the difference to their exit rate becomes a self-loop.
+                    typename storm::storage::SparseMatrix<ValueType> uniformizedMarkovian = aMarkovian;
+                    typename storm::storage::SparseMatrix<ValueType> uniformizedMarkovianToProbabilistic = aMarkovianToProbabilistic;
+                    std::vector<ValueType> uniformizedBMarkovianFixed = bMarkovianFixed;
+                    uint64_t rowIndex = 0;
+                    for (auto state : markovianNonGoalStates) {
+                        ValueType exitProbability = exitRateVector[state] / lambda;
+                        for (auto& element : uniformizedMarkovian.getRow(rowIndex)) {
+                            if (element.getColumn() == rowIndex) {
+                                element.setValue(exitProbability * element.getValue() + storm::utility::one<ValueType>() - exitProbability);
+                            } else {
+                                element.setValue(exitProbability * element.getValue());
+                            }
+                        }
+                        for (auto& element : uniformizedMarkovianToProbabilistic.getRow(rowIndex)) {
+                            element.setValue(exitProbability * element.getValue());
+                        }
+                        uniformizedBMarkovianFixed[rowIndex] *= exitProbability;
+                        ++rowIndex;
+                    }
+                    
+                    // Compute the probabilities for the number of Markovian jumps until the time bound. We only consider
+                    // the jumps [0, numberOfJumps) and neglect the rest, which is bounded by the truncation error.
+                    std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda * upperBound, 1e+300, truncationError);
+                    uint64_t leftTruncationPoint = std::get<0>(foxGlynnResult);
+                    std::vector<ValueType>& weights = std::get<3>(foxGlynnResult);
+                    for (auto& element : weights) {
+                        element /= std::get<2>(foxGlynnResult);
+                    }
+                    uint64_t numberOfJumps = leftTruncationPoint + weights.size();
+                    auto jumpProbability = [&] (uint64_t jumps) {
+                        return jumps < leftTruncationPoint ? storm::utility::zero<ValueType>() : weights[jumps - leftTruncationPoint];
+                    };
+                    
+                    std::vector<ValueType> bMarkovian(markovianNonGoalStates.getNumberOfSetBits());
+                    std::vector<ValueType> markovianValuesSwap(markovianNonGoalStates.getNumberOfSetBits());
+                    
+                    // (1) Compute the values of the optimal scheduler that may only observe the number of Markovian jumps.
+                    // Reaching a goal state after k jumps is rewarded with the probability of at least k jumps until the
+                    // time bound, so we proceed backwards from the last jump.
+                    std::vector<ValueType> countingMarkovianValues(markovianNonGoalStates.getNumberOfSetBits());
+                    std::vector<ValueType> countingProbabilisticValues(probabilisticNonGoalStates.getNumberOfSetBits());
+                    ValueType atLeastJumpsProbability = storm::utility::zero<ValueType>();
+                    for (uint64_t jumps = numberOfJumps; jumps > 0; --jumps) {
+                        // The Markovian states perform the jump from jumps - 1 to jumps.
+                        uniformizedMarkovianToProbabilistic.multiplyWithVector(countingProbabilisticValues, bMarkovian);
+                        storm::utility::vector::addScaledVector(bMarkovian, uniformizedBMarkovianFixed, atLeastJumpsProbability);
+                        uniformizedMarkovian.multiplyWithVector(countingMarkovianValues, markovianValuesSwap);
+                        std::swap(countingMarkovianValues, markovianValuesSwap);
+                        storm::utility::vector::addVectors(countingMarkovianValues, bMarkovian, countingMarkovianValues);
+                        
+                        atLeastJumpsProbability += jumpProbability(jumps - 1);
+                        solveProbabilisticStates(atLeastJumpsProbability, countingMarkovianValues, countingProbabilisticValues);
+                    }
+                    
+                    // (2) Compute the values of the optimal scheduler that knows the number n of Markovian jumps until the
+                    // time bound, i.e. the probabilities to reach a goal state within n jumps weighted by the probability
+                    // of n jumps.
+                    std::vector<ValueType> stepBoundedMarkovianValues(markovianNonGoalStates.getNumberOfSetBits());
+                    std::vector<ValueType> stepBoundedProbabilisticValues(probabilisticNonGoalStates.getNumberOfSetBits());
+                    std::vector<ValueType> clairvoyantMarkovianValues(markovianNonGoalStates.getNumberOfSetBits());
+                    std::vector<ValueType> clairvoyantProbabilisticValues(probabilisticNonGoalStates.getNumberOfSetBits());
+                    for (uint64_t jumps = 0; jumps < numberOfJumps; ++jumps) {
+                        if (jumps > 0) {
+                            uniformizedMarkovianToProbabilistic.multiplyWithVector(stepBoundedProbabilisticValues, bMarkovian);
+                            storm::utility::vector::addVectors(bMarkovian, uniformizedBMarkovianFixed, bMarkovian);
+                            uniformizedMarkovian.multiplyWithVector(stepBoundedMarkovianValues, markovianValuesSwap);
+                            std::swap(stepBoundedMarkovianValues, markovianValuesSwap);
+                            storm::utility::vector::addVectors(stepBoundedMarkovianValues, bMarkovian, stepBoundedMarkovianValues);
+                        }
+                        solveProbabilisticStates(storm::utility::one<ValueType>(), stepBoundedMarkovianValues, stepBoundedProbabilisticValues);
+                        storm::utility::vector::addScaledVector(clairvoyantMarkovianValues, stepBoundedMarkovianValues, jumpProbability(jumps));
+                        storm::utility::vector::addScaledVector(clairvoyantProbabilisticValues, stepBoundedProbabilisticValues, jumpProbability(jumps));
+                    }
+                    
+                    // The scheduler observing the jumps is realizable and the other one can not be beaten. Hence, the
+                    // actual probabilities lie between the two values (up to the truncation of the jumps).
+                    ValueType difference = storm::utility::zero<ValueType>();
+                    for (uint64_t index = 0; index < countingMarkovianValues.size(); ++index) {
+                        difference = std::max(difference, storm::utility::abs<ValueType>(clairvoyantMarkovianValues[index] - countingMarkovianValues[index]));
+                    }
+                    for (uint64_t index = 0; index < countingProbabilisticValues.size(); ++index) {
+                        difference = std::max(difference, storm::utility::abs<ValueType>(clairvoyantProbabilisticValues[index] - countingProbabilisticValues[index]));
+                    }
+                    STORM_LOG_INFO("Unif+ with uniformization rate " << lambda << " (" << numberOfJumps << " jumps) yields bounds that differ by at most " << difference << ".");
+                    
+                    bool precise = difference + 2 * truncationError <= precision;
+                    bool improved = difference < previousDifference;
+                    bool exhausted = numberOfJumps >= maximalNumberOfJumps;
+                    STORM_LOG_WARN_COND(precise || improved, "The bounds computed by Unif+ did not get closer when increasing the uniformization rate, the result may be imprecise.");
+                    STORM_LOG_WARN_COND(precise || !improved || !exhausted, "Unif+ stopped at uniformization rate " << lambda << " (" << numberOfJumps << " jumps) where the bounds still differ by " << difference << ", the result may be imprecise.");
+                    if (precise || !improved || exhausted) {
+                        // Take the center of the bounds as the result.
+                        storm::utility::vector::addVectors(countingMarkovianValues, clairvoyantMarkovianValues, countingMarkovianValues);
+                        storm::utility::vector::scaleVectorInPlace(countingMarkovianValues, storm::utility::convertNumber<ValueType>(0.5));
+                        storm::utility::vector::addVectors(countingProbabilisticValues, clairvoyantProbabilisticValues, countingProbabilisticValues);
+                        storm::utility::vector::scaleVectorInPlace(countingProbabilisticValues, storm::utility::convertNumber<ValueType>(0.5));
+                        storm::utility::vector::setVectorValues(result, markovianNonGoalStates, countingMarkovianValues);
+                        storm::utility::vector::setVectorValues(result, probabilisticNonGoalStates, countingProbabilisticValues);
+                        return result;
+                    }
+                    
+                    // Otherwise, a higher uniformization rate lets the scheduler observe the progress of time more precisely.
+                    previousDifference = difference;
+                    lambda *= 2;
+                }
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double upperBound, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded reachability probabilities is unsupported for this value type.");
+            }
+            
             template<typename ValueType>
             std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
                 return std::move(storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(dir, transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, false, minMaxLinearEquationSolverFactory).values);
@@ -610,6 +854,10 @@ namespace storm {
             }
             
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
+
+            template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
+
+            template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double upperBound, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
@@ -621,7 +869,7 @@ namespace storm {
             
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeReachabilityTimes(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
-            template void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<double>& markovianNonGoalValues, std::vector<double>& probabilisticNonGoalValues, double delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
+            template void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<double>& markovianNonGoalValues, std::vector<double>& probabilisticNonGoalValues, double delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory, std::function<void (uint64_t, std::vector<double> const&, std::vector<double> const&)> const& stepCallback);
                 
             template double SparseMarkovAutomatonCslHelper::computeLraForMaximalEndComponent(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
@@ -630,6 +878,10 @@ namespace storm {
             template double SparseMarkovAutomatonCslHelper::computeLraForMaximalEndComponentVI(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
             
             template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
+
+            template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
+
+            template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double upperBound, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
                 
             template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
                 
@@ -641,7 +893,7 @@ namespace storm {
             
             template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeReachabilityTimes(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
                 
-            template void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<storm::RationalNumber>& markovianNonGoalValues, std::vector<storm::RationalNumber>& probabilisticNonGoalValues, storm::RationalNumber delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
+            template void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<storm::RationalNumber>& markovianNonGoalValues, std::vector<storm::RationalNumber>& probabilisticNonGoalValues, storm::RationalNumber delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory, std::function<void (uint64_t, std::vector<storm::RationalNumber> const&, std::vector<storm::RationalNumber> const&)> const& stepCallback);
                 
             template storm::RationalNumber SparseMarkovAutomatonCslHelper::computeLraForMaximalEndComponent(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
             
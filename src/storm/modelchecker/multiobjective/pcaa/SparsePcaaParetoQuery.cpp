@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -55,34 +57,48 @@ namespace storm {
             void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchievablePoints() {
             
                 //First consider the objectives individually
-                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed(); ++objIndex) {
-                    WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-                    direction[objIndex] = storm::utility::one<GeometryValueType>();
-                    this->performRefinementStep(std::move(direction));
+                uint_fast64_t objIndex = 0;
+                while(objIndex<this->objectives.size() && !this->maxStepsPerformed()) {
+                    std::vector<WeightVector> directions;
+                    uint_fast64_t maxNumberOfDirections = this->getMaxNumberOfConcurrentRefinementSteps();
+                    for(; objIndex<this->objectives.size() && directions.size() < maxNumberOfDirections; ++objIndex) {
+                        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+                        direction[objIndex] = storm::utility::one<GeometryValueType>();
+                        directions.push_back(std::move(direction));
+                    }
+                    this->performRefinementSteps(std::move(directions));
                 }
                 
                 while(!this->maxStepsPerformed()) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation.
+                    // The normal vectors of the farthest ones are the direction vectors that are checked next (concurrently).
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<GeometryValueType> halfspaceDistances(underApproxHalfspaces.size(), storm::utility::zero<GeometryValueType>());
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
                         for(auto const& vertex : overApproxVertices) {
-                            GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                            if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
-                                farestDistance = distance;
-                            }
+                            halfspaceDistances[halfspaceIndex] = std::max(halfspaceDistances[halfspaceIndex], underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
                         }
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getPrecision())) {
+                    std::vector<uint_fast64_t> halfspaceIndices(underApproxHalfspaces.size());
+                    std::iota(halfspaceIndices.begin(), halfspaceIndices.end(), 0);
+                    std::sort(halfspaceIndices.begin(), halfspaceIndices.end(), [&] (uint_fast64_t const& lhs, uint_fast64_t const& rhs) { return halfspaceDistances[lhs] > halfspaceDistances[rhs]; });
+                    
+                    GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getPrecision());
+                    if(halfspaceIndices.empty() || halfspaceDistances[halfspaceIndices.front()] < precision) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(std::move(direction));
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances[halfspaceIndices.front()]));
+                    std::vector<WeightVector> directions;
+                    uint_fast64_t maxNumberOfDirections = this->getMaxNumberOfConcurrentRefinementSteps();
+                    for (auto halfspaceIndex : halfspaceIndices) {
+                        if (directions.size() == maxNumberOfDirections || halfspaceDistances[halfspaceIndex] < precision) {
+                            break;
+                        }
+                        directions.push_back(underApproxHalfspaces[halfspaceIndex].normalVector());
+                    }
+                    this->performRefinementSteps(std::move(directions));
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Exceeded maximum number of refinement steps");
             }
@@ -13,6 +13,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/export.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -26,30 +27,40 @@ namespace storm {
                 originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula),
                 preprocessedModel(std::move(*preprocessorResult.preprocessedModel)), objectives(std::move(preprocessorResult.objectives)) {
                 
-                initializeWeightVectorChecker(preprocessedModel, objectives, preprocessorResult.possibleECChoices, preprocessorResult.possibleBottomStates);
+                weightVectorChecker = createWeightVectorChecker(preprocessedModel, objectives, preprocessorResult.possibleECChoices, preprocessorResult.possibleBottomStates);
+                
+                // All weight vector checkers share the results of the unbounded phase so that each check can start from the most similar weight vector.
+                auto unboundedPhaseCache = std::make_shared<SparsePcaaUnboundedPhaseCache<typename SparseModelType::ValueType>>();
+                weightVectorChecker->setUnboundedPhaseCache(unboundedPhaseCache);
+                if (storm::utility::parallel::SupportsParallelExecution<typename SparseModelType::ValueType>::value) {
+                    for (uint_fast64_t checkerIndex = 1; checkerIndex < storm::utility::parallel::getNumberOfThreads(); ++checkerIndex) {
+                        concurrentWeightVectorCheckers.push_back(createWeightVectorChecker(preprocessedModel, objectives, preprocessorResult.possibleECChoices, preprocessorResult.possibleBottomStates));
+                        concurrentWeightVectorCheckers.back()->setUnboundedPhaseCache(unboundedPhaseCache);
+                    }
+                }
                 this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
                 this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
                 this->underApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createEmptyPolytope();
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::Mdp<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>> SparsePcaaQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>::createWeightVectorChecker(storm::models::sparse::Mdp<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>(model, objectives, possibleECActions, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::Mdp<storm::RationalNumber>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::Mdp<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>> SparsePcaaQuery<storm::models::sparse::Mdp<storm::RationalNumber>, storm::RationalNumber>::createWeightVectorChecker(storm::models::sparse::Mdp<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::MarkovAutomaton<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>> SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>::createWeightVectorChecker(storm::models::sparse::MarkovAutomaton<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>(model, objectives, possibleECActions, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::MarkovAutomaton<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>> SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>, storm::RationalNumber>::createWeightVectorChecker(storm::models::sparse::MarkovAutomaton<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
             }
             
             
@@ -97,27 +108,68 @@ namespace storm {
             
             template <class SparseModelType, typename GeometryValueType>
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(WeightVector&& direction) {
-                // Normalize the direction vector so that the entries sum up to one
-                storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-                weightVectorChecker->check(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-                RefinementStep step;
-                step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-                // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-                for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-                    if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-                        step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-                        step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                std::vector<WeightVector> directions;
+                directions.push_back(std::move(direction));
+                performRefinementSteps(std::move(directions));
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(std::vector<WeightVector>&& directions) {
+                STORM_LOG_ASSERT(!directions.empty() && directions.size() <= concurrentWeightVectorCheckers.size() + 1, "Invalid number of direction vectors.");
+                
+                // Each direction vector is checked with its own weight vector checker.
+                std::vector<SparsePcaaWeightVectorChecker<SparseModelType>*> checkers;
+                checkers.push_back(weightVectorChecker.get());
+                for (uint_fast64_t directionIndex = 1; directionIndex < directions.size(); ++directionIndex) {
+                    checkers.push_back(concurrentWeightVectorCheckers[directionIndex - 1].get());
+                    checkers.back()->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+                }
+                
+                std::vector<RefinementStep> steps(directions.size());
+                auto checkDirections = [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t directionIndex = begin; directionIndex < end; ++directionIndex) {
+                        WeightVector& direction = directions[directionIndex];
+                        // Normalize the direction vector so that the entries sum up to one
+                        storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
+                        checkers[directionIndex]->check(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+                        STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checkers[directionIndex]->getUnderApproximationOfInitialStateResults())));
+                        RefinementStep& step = steps[directionIndex];
+                        step.weightVector = direction;
+                        step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checkers[directionIndex]->getUnderApproximationOfInitialStateResults());
+                        step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checkers[directionIndex]->getOverApproximationOfInitialStateResults());
+                        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+                        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+                            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                            }
+                        }
                     }
+                };
+                if (directions.size() > 1) {
+                    STORM_LOG_INFO("Checking " << directions.size() << " weight vectors concurrently.");
+                    storm::utility::parallel::parallelFor(0, directions.size(), 1, checkDirections);
+                } else {
+                    checkDirections(0, directions.size());
                 }
-                refinementSteps.push_back(std::move(step));
                 
-                updateOverApproximation();
+                for (auto& step : steps) {
+                    refinementSteps.push_back(std::move(step));
+                    updateOverApproximation();
+                }
                 updateUnderApproximation();
             }
             
+            template <class SparseModelType, typename GeometryValueType>
+            uint_fast64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getMaxNumberOfConcurrentRefinementSteps() const {
+                uint_fast64_t result = concurrentWeightVectorCheckers.size() + 1;
+                if (storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().isMaxStepsSet()) {
+                    uint_fast64_t maxSteps = storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getMaxSteps();
+                    result = std::min(result, maxSteps > this->refinementSteps.size() ? maxSteps - this->refinementSteps.size() : 0);
+                }
+                return result;
+            }
+            
             template <class SparseModelType, typename GeometryValueType>
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
                 storm::storage::geometry::Halfspace<GeometryValueType> h(refinementSteps.back().weightVector, storm::utility::vector::dotProduct(refinementSteps.back().weightVector, refinementSteps.back().upperBoundPoint));
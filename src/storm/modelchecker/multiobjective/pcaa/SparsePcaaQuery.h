@@ -40,12 +40,12 @@ namespace storm {
             protected:
                 
                 /*
-                 * Initializes the weight vector checker with the provided data from preprocessing
+                 * Creates a weight vector checker with the provided data from preprocessing
                  */
-                void initializeWeightVectorChecker(SparseModelType const& model,
-                                                   std::vector<Objective<typename SparseModelType::ValueType>> const& objectives,
-                                                   storm::storage::BitVector const& possibleECActions,
-                                                   storm::storage::BitVector const& possibleBottomStates);
+                std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>> createWeightVectorChecker(SparseModelType const& model,
+                                                                                                         std::vector<Objective<typename SparseModelType::ValueType>> const& objectives,
+                                                                                                         storm::storage::BitVector const& possibleECActions,
+                                                                                                         storm::storage::BitVector const& possibleBottomStates) const;
                 
                 /*
                  * Represents the information obtained in a single iteration of the algorithm
@@ -75,6 +75,17 @@ namespace storm {
                  */
                 void performRefinementStep(WeightVector&& direction);
                 
+                /*
+                 * Refines the current result w.r.t. all of the given direction vectors.
+                 * The direction vectors are checked concurrently, so at most getMaxNumberOfConcurrentRefinementSteps() many vectors may be given.
+                 */
+                void performRefinementSteps(std::vector<WeightVector>&& directions);
+                
+                /*
+                 * Returns the number of direction vectors that can be checked concurrently, taking into account the maximum number of refinement steps.
+                 */
+                uint_fast64_t getMaxNumberOfConcurrentRefinementSteps() const;
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
@@ -109,6 +120,9 @@ namespace storm {
                 
                 // The corresponding weight vector checker
                 std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+                // Further weight vector checkers for the same model that are used to check several direction vectors concurrently.
+                // Their precision is taken from the weightVectorChecker.
+                std::vector<std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>>> concurrentWeightVectorCheckers;
 
                 //The results in each iteration of the algorithm
                 std::vector<RefinementStep> refinementSteps;
@@ -0,0 +1,51 @@
+#include "storm/modelchecker/multiobjective/pcaa/SparsePcaaUnboundedPhaseCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace multiobjective {
+
+            template <typename ValueType>
+            void SparsePcaaUnboundedPhaseCache<ValueType>::insert(std::vector<ValueType> const& weightVector, std::vector<ValueType> const& weightedResult, std::vector<uint_fast64_t> const& chosenRows) {
+                std::lock_guard<std::mutex> lock(mutex);
+                entries.push_back(Entry{weightVector, weightedResult, chosenRows});
+            }
+
+            template <typename ValueType>
+            bool SparsePcaaUnboundedPhaseCache<ValueType>::findNearest(std::vector<ValueType> const& weightVector, std::vector<ValueType>& weightedResult, std::vector<uint_fast64_t>& chosenRows) const {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (entries.empty()) {
+                    return false;
+                }
+
+                // As we only compare distances, there is no need to take the square root.
+                Entry const* nearestEntry = nullptr;
+                ValueType nearestDistance = storm::utility::zero<ValueType>();
+                for (auto const& entry : entries) {
+                    STORM_LOG_ASSERT(entry.weightVector.size() == weightVector.size(), "Weight vectors have different dimensions.");
+                    ValueType distance = storm::utility::zero<ValueType>();
+                    for (uint_fast64_t index = 0; index < weightVector.size(); ++index) {
+                        ValueType difference = entry.weightVector[index] - weightVector[index];
+                        distance += difference * difference;
+                    }
+                    if (nearestEntry == nullptr || distance < nearestDistance) {
+                        nearestEntry = &entry;
+                        nearestDistance = distance;
+                    }
+                }
+                weightedResult = nearestEntry->weightedResult;
+                chosenRows = nearestEntry->chosenRows;
+                return true;
+            }
+
+            template class SparsePcaaUnboundedPhaseCache<double>;
+#ifdef STORM_HAVE_CARL
+            template class SparsePcaaUnboundedPhaseCache<storm::RationalNumber>;
+#endif
+
+        }
+    }
+}
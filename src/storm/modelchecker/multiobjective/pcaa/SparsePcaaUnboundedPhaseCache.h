@@ -0,0 +1,60 @@
+#ifndef STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAUNBOUNDEDPHASECACHE_H_
+#define STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAUNBOUNDEDPHASECACHE_H_
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace storm {
+    namespace modelchecker {
+        namespace multiobjective {
+
+            /*!
+             * Stores the results of the unbounded weighted phase for the weight vectors that have been checked so far.
+             * A subsequent check can then start from the results of the most similar weight vector instead of starting
+             * from scratch. The cache may be shared among several weight vector checkers (for the same model) that run
+             * concurrently.
+             */
+            template <typename ValueType>
+            class SparsePcaaUnboundedPhaseCache {
+            public:
+
+                /*!
+                 * Stores the results of the unbounded weighted phase for the given weight vector.
+                 *
+                 * @param weightVector The weight vector for which the results were obtained.
+                 * @param weightedResult The weighted result for each state of the model.
+                 * @param chosenRows For each state of the model, the row of the transition matrix that was chosen by the
+                 * computed scheduler (or an invalid index if the state was not considered).
+                 */
+                void insert(std::vector<ValueType> const& weightVector, std::vector<ValueType> const& weightedResult, std::vector<uint_fast64_t> const& chosenRows);
+
+                /*!
+                 * Retrieves the results stored for the weight vector that is closest (w.r.t. the Euclidean distance) to
+                 * the given one.
+                 *
+                 * @param weightVector The weight vector for which results are requested.
+                 * @param weightedResult If results are found, they are written to this vector.
+                 * @param chosenRows If results are found, the chosen rows are written to this vector.
+                 * @return True iff the cache contains any results.
+                 */
+                bool findNearest(std::vector<ValueType> const& weightVector, std::vector<ValueType>& weightedResult, std::vector<uint_fast64_t>& chosenRows) const;
+
+            private:
+                struct Entry {
+                    std::vector<ValueType> weightVector;
+                    std::vector<ValueType> weightedResult;
+                    std::vector<uint_fast64_t> chosenRows;
+                };
+
+                // Guards the entries against concurrent accesses.
+                mutable std::mutex mutex;
+                // The results obtained so far.
+                std::vector<Entry> entries;
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAUNBOUNDEDPHASECACHE_H_ */
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaWeightVectorChecker.h"
 
+#include <limits>
 #include <map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -89,7 +90,7 @@ namespace storm {
                     }
                 }
                 
-                unboundedWeightedPhase(weightedRewardVector, weightedLowerResultBound, weightedUpperResultBound);
+                unboundedWeightedPhase(weightVector, weightedRewardVector, weightedLowerResultBound, weightedUpperResultBound);
                 
                 unboundedIndividualPhase(weightVector);
                 // Only invoke boundedPhase if necessarry, i.e., if there is at least one objective with a time bound
@@ -116,6 +117,11 @@ namespace storm {
                 return this->weightedPrecision;
             }
             
+            template <class SparseModelType>
+            void SparsePcaaWeightVectorChecker<SparseModelType>::setUnboundedPhaseCache(std::shared_ptr<SparsePcaaUnboundedPhaseCache<ValueType>> const& cache) {
+                this->unboundedPhaseCache = cache;
+            }
+            
             template <class SparseModelType>
             std::vector<typename SparsePcaaWeightVectorChecker<SparseModelType>::ValueType> SparsePcaaWeightVectorChecker<SparseModelType>::getUnderApproximationOfInitialStateResults() const {
                 STORM_LOG_THROW(checkHasBeenCalled, storm::exceptions::IllegalFunctionCallException, "Tried to retrieve results but check(..) has not been called before.");
@@ -157,7 +163,7 @@ namespace storm {
             }
             
             template <class SparseModelType>
-            void SparsePcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(std::vector<ValueType> const& weightedRewardVector, boost::optional<ValueType> const& lowerResultBound, boost::optional<ValueType> const& upperResultBound) {
+            void SparsePcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(std::vector<ValueType> const& weightVector, std::vector<ValueType> const& weightedRewardVector, boost::optional<ValueType> const& lowerResultBound, boost::optional<ValueType> const& upperResultBound) {
                 
                 if (this->objectivesWithNoUpperTimeBound.empty() || !storm::utility::vector::hasNonZeroEntry(weightedRewardVector)) {
                     this->weightedResult = std::vector<ValueType>(model.getNumberOfStates(), storm::utility::zero<ValueType>());
@@ -193,11 +199,65 @@ namespace storm {
                 if (upperResultBound) {
                     solver->setUpperBound(*upperResultBound);
                 }
+                
+                // Start from the results of the most similar weight vector that has been checked before (if any).
+                std::vector<ValueType> cachedResult;
+                std::vector<uint_fast64_t> cachedChosenRows;
+                if (this->unboundedPhaseCache && this->unboundedPhaseCache->findNearest(weightVector, cachedResult, cachedChosenRows)) {
+                    storm::storage::SparseMatrix<ValueType> const& reducedMatrix = ecEliminatorResult.matrix;
+                    std::vector<uint_fast64_t> oldToNewRowMapping(model.getTransitionMatrix().getRowCount(), std::numeric_limits<uint_fast64_t>::max());
+                    for (uint_fast64_t newRow = 0; newRow < ecEliminatorResult.newToOldRowMapping.size(); ++newRow) {
+                        oldToNewRowMapping[ecEliminatorResult.newToOldRowMapping[newRow]] = newRow;
+                    }
+                    
+                    std::vector<uint_fast64_t> hintChoices(reducedMatrix.getRowGroupCount(), std::numeric_limits<uint_fast64_t>::max());
+                    for (auto state : subsystemStates) {
+                        uint_fast64_t reducedState = ecEliminatorResult.oldToNewStateMapping[state];
+                        subResult[reducedState] = cachedResult[state];
+                        uint_fast64_t cachedRow = cachedChosenRows[state];
+                        if (hintChoices[reducedState] == std::numeric_limits<uint_fast64_t>::max() && cachedRow < oldToNewRowMapping.size()) {
+                            uint_fast64_t newRow = oldToNewRowMapping[cachedRow];
+                            if (newRow >= reducedMatrix.getRowGroupIndices()[reducedState] && newRow < reducedMatrix.getRowGroupIndices()[reducedState + 1]) {
+                                hintChoices[reducedState] = newRow - reducedMatrix.getRowGroupIndices()[reducedState];
+                            }
+                        }
+                    }
+                    storm::utility::vector::clip(subResult, lowerResultBound, upperResultBound);
+                    
+                    // The scheduler hint is only applicable if it induces no BSCC, i.e., if all states almost surely reach
+                    // a choice that leaves the reduced model with positive probability.
+                    storm::storage::BitVector leavingStates(reducedMatrix.getRowGroupCount(), false);
+                    for (uint_fast64_t reducedState = 0; reducedState < reducedMatrix.getRowGroupCount(); ++reducedState) {
+                        if (hintChoices[reducedState] == std::numeric_limits<uint_fast64_t>::max()) {
+                            hintChoices[reducedState] = 0;
+                        }
+                        uint_fast64_t newRow = reducedMatrix.getRowGroupIndices()[reducedState] + hintChoices[reducedState];
+                        bool rowLeavesReducedModel = reducedMatrix.getRow(newRow).getNumberOfEntries() == 0;
+                        for (auto const& entry : model.getTransitionMatrix().getRow(ecEliminatorResult.newToOldRowMapping[newRow])) {
+                            rowLeavesReducedModel |= !subsystemStates.get(entry.getColumn());
+                        }
+                        leavingStates.set(reducedState, rowLeavesReducedModel);
+                    }
+                    if (storm::utility::graph::performProb1(reducedMatrix.transposeSelectedRowsFromRowGroups(hintChoices), storm::storage::BitVector(reducedMatrix.getRowGroupCount(), true), leavingStates).full()) {
+                        solver->setSchedulerHint(std::move(hintChoices));
+                    }
+                }
+                
                 solver->solveEquations(subResult, subRewardVector);
 
                 this->weightedResult = std::vector<ValueType>(model.getNumberOfStates());
                 
                 transformReducedSolutionToOriginalModel(ecEliminatorResult.matrix, subResult, solver->getSchedulerChoices(), ecEliminatorResult.newToOldRowMapping, ecEliminatorResult.oldToNewStateMapping, this->weightedResult, this->optimalChoices);
+                
+                if (this->unboundedPhaseCache) {
+                    // For the states of the reduced model, we store the chosen rows w.r.t. the original model.
+                    std::vector<uint_fast64_t> chosenRows(model.getNumberOfStates(), std::numeric_limits<uint_fast64_t>::max());
+                    for (auto state : subsystemStates) {
+                        uint_fast64_t reducedState = ecEliminatorResult.oldToNewStateMapping[state];
+                        chosenRows[state] = ecEliminatorResult.newToOldRowMapping[ecEliminatorResult.matrix.getRowGroupIndices()[reducedState] + solver->getSchedulerChoices()[reducedState]];
+                    }
+                    this->unboundedPhaseCache->insert(weightVector, this->weightedResult, chosenRows);
+                }
             }
             
             template <class SparseModelType>
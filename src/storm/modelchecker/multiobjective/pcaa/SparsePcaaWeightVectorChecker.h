@@ -1,11 +1,13 @@
 #ifndef STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAWEIGHTVECTORCHECKER_H_
 #define STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAWEIGHTVECTORCHECKER_H_
 
+#include <memory>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/modelchecker/multiobjective/Objective.h"
+#include "storm/modelchecker/multiobjective/pcaa/SparsePcaaUnboundedPhaseCache.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -79,15 +81,23 @@ namespace storm {
                  */
                 storm::storage::Scheduler<ValueType> computeScheduler() const;
                 
+                /*!
+                 * Sets the cache in which the results of the unbounded weighted phase are stored. Subsequent calls of
+                 * check(..) start from the stored results of the most similar weight vector.
+                 * The same cache may be used by several weight vector checkers for the same model.
+                 */
+                void setUnboundedPhaseCache(std::shared_ptr<SparsePcaaUnboundedPhaseCache<ValueType>> const& cache);
+                
                 
             protected:
                 
                 /*!
                  * Determines the scheduler that optimizes the weighted reward vector of the unbounded objectives
                  *
+                 * @param weightVector the weight vector of the current check
                  * @param weightedRewardVector the weighted rewards (only considering the unbounded objectives)
                  */
-                void unboundedWeightedPhase(std::vector<ValueType> const& weightedRewardVector, boost::optional<ValueType> const& lowerResultBound, boost::optional<ValueType> const& upperResultBound);
+                void unboundedWeightedPhase(std::vector<ValueType> const& weightVector, std::vector<ValueType> const& weightedRewardVector, boost::optional<ValueType> const& lowerResultBound, boost::optional<ValueType> const& upperResultBound);
                 
                 /*!
                  * Computes the values of the objectives that do not have a stepBound w.r.t. the scheduler computed in the unboundedWeightedPhase
@@ -150,6 +160,8 @@ namespace storm {
                 std::vector<ValueType> offsetsToOverApproximation;
                 // The scheduler choices that optimize the weighted rewards of undounded objectives.
                 std::vector<uint_fast64_t> optimalChoices;
+                // If set, the results of the unbounded weighted phase are stored in (and retrieved from) this cache.
+                std::shared_ptr<SparsePcaaUnboundedPhaseCache<ValueType>> unboundedPhaseCache;
                 
             };
             
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <map>
 
 #include "storm/utility/macros.h"
 
@@ -18,18 +19,19 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
 namespace storm {
     namespace modelchecker {
         template<typename SparseDtmcModelType>
-        SparseDtmcPrctlModelChecker<SparseDtmcModelType>::SparseDtmcPrctlModelChecker(SparseDtmcModelType const& model, std::unique_ptr<storm::solver::LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory) : SparsePropositionalModelChecker<SparseDtmcModelType>(model), linearEquationSolverFactory(std::move(linearEquationSolverFactory)) {
+        SparseDtmcPrctlModelChecker<SparseDtmcModelType>::SparseDtmcPrctlModelChecker(SparseDtmcModelType const& model, std::unique_ptr<storm::solver::LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory) : SparsePropositionalModelChecker<SparseDtmcModelType>(model), linearEquationSolverFactory(std::move(linearEquationSolverFactory)), precomputationCache(model.getTransitionMatrix()) {
             // Intentionally left empty.
         }
         
         template<typename SparseDtmcModelType>
-        SparseDtmcPrctlModelChecker<SparseDtmcModelType>::SparseDtmcPrctlModelChecker(SparseDtmcModelType const& model) : SparsePropositionalModelChecker<SparseDtmcModelType>(model), linearEquationSolverFactory(std::make_unique<storm::solver::GeneralLinearEquationSolverFactory<ValueType>>()) {
+        SparseDtmcPrctlModelChecker<SparseDtmcModelType>::SparseDtmcPrctlModelChecker(SparseDtmcModelType const& model) : SparsePropositionalModelChecker<SparseDtmcModelType>(model), linearEquationSolverFactory(std::make_unique<storm::solver::GeneralLinearEquationSolverFactory<ValueType>>()), precomputationCache(model.getTransitionMatrix()) {
             // Intentionally left empty.
         }
         
@@ -39,6 +41,81 @@ namespace storm {
             return formula.isInFragment(storm::logic::prctl().setLongRunAverageRewardFormulasAllowed(true).setLongRunAverageProbabilitiesAllowed(true).setConditionalProbabilityFormulasAllowed(true).setConditionalRewardFormulasAllowed(true).setOnlyEventuallyFormuluasInConditionalFormulasAllowed(true));
         }
         
+        template<typename SparseDtmcModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+            std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+            
+            // Reachability probabilities whose equation systems have the same maybe states only differ in the
+            // right-hand side, so we group them accordingly and solve each group with one block solve. Note that this
+            // only applies to (unbounded) until and reachability probabilities without hint whose maybe states are
+            // identical. All other tasks are checked one by one (which still benefits from the precomputations shared
+            // via the cache).
+            std::map<storm::storage::BitVector, std::vector<uint64_t>> maybeStatesToTaskIndices;
+            std::vector<storm::storage::BitVector> statesWithProbability1(checkTasks.size());
+            for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+                CheckTask<storm::logic::Formula, ValueType> const& checkTask = checkTasks[taskIndex];
+                STORM_LOG_THROW(this->canHandle(checkTask), storm::exceptions::InvalidArgumentException, "The model checker is not able to check the formula '" << checkTask.getFormula() << "'.");
+                boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> phiPsiStates = getUntilStatesForBatch(checkTask);
+                if (!phiPsiStates) {
+                    continue;
+                }
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = precomputationCache.getStatesWithProbability01(phiPsiStates->first, phiPsiStates->second);
+                maybeStatesToTaskIndices[~(statesWithProbability01.first | statesWithProbability01.second)].push_back(taskIndex);
+                statesWithProbability1[taskIndex] = std::move(statesWithProbability01.second);
+            }
+            
+            for (auto const& maybeStatesTaskIndicesPair : maybeStatesToTaskIndices) {
+                std::vector<uint64_t> const& taskIndices = maybeStatesTaskIndicesPair.second;
+                if (taskIndices.size() == 1) {
+                    continue;
+                }
+                STORM_LOG_INFO("Checking " << taskIndices.size() << " reachability probabilities with a shared equation system.");
+                std::vector<storm::storage::BitVector> groupStatesWithProbability1;
+                for (auto const& taskIndex : taskIndices) {
+                    groupStatesWithProbability1.push_back(std::move(statesWithProbability1[taskIndex]));
+                }
+                std::vector<boost::optional<ValueType>> errorBounds;
+                std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilitiesForSharedMaybeStates(this->getModel().getTransitionMatrix(), maybeStatesTaskIndicesPair.first, groupStatesWithProbability1, *linearEquationSolverFactory, &errorBounds);
+                
+                for (uint64_t groupIndex = 0; groupIndex < taskIndices.size(); ++groupIndex) {
+                    CheckTask<storm::logic::Formula, ValueType> const& checkTask = checkTasks[taskIndices[groupIndex]];
+                    std::unique_ptr<CheckResult> result = std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResults[groupIndex])));
+                    if (errorBounds[groupIndex]) {
+                        result->asExplicitQuantitativeCheckResult<ValueType>().setErrorBound(errorBounds[groupIndex].get());
+                    }
+                    if (checkTask.isBoundSet()) {
+                        result = result->asQuantitativeCheckResult<ValueType>().compareAgainstBound(checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+                    }
+                    results[taskIndices[groupIndex]] = std::move(result);
+                }
+            }
+            
+            for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+                if (!results[taskIndex]) {
+                    results[taskIndex] = this->check(checkTasks[taskIndex]);
+                }
+            }
+            return results;
+        }
+        
+        template<typename SparseDtmcModelType>
+        boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::getUntilStatesForBatch(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            if (!formula.isProbabilityOperatorFormula() || checkTask.isQualitativeSet() || !checkTask.getHint().isEmpty()) {
+                return boost::none;
+            }
+            storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+            if (pathFormula.isUntilFormula()) {
+                std::unique_ptr<CheckResult> leftResultPointer = this->check(pathFormula.asUntilFormula().getLeftSubformula());
+                std::unique_ptr<CheckResult> rightResultPointer = this->check(pathFormula.asUntilFormula().getRightSubformula());
+                return std::make_pair(leftResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector(), rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector());
+            } else if (pathFormula.isReachabilityProbabilityFormula()) {
+                std::unique_ptr<CheckResult> subResultPointer = this->check(pathFormula.asReachabilityProbabilityFormula().getSubformula());
+                return std::make_pair(storm::storage::BitVector(this->getModel().getNumberOfStates(), true), subResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector());
+            }
+            return boost::none;
+        }
+        
         template<typename SparseDtmcModelType>
         std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
             storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
@@ -48,7 +125,7 @@ namespace storm {
             std::unique_ptr<CheckResult> rightResultPointer = this->check(pathFormula.getRightSubformula());
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeBoundedUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), pathFormula.getNonStrictUpperBound<uint64_t>(), *linearEquationSolverFactory, checkTask.getHint());
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeBoundedUntilProbabilities(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), pathFormula.getNonStrictUpperBound<uint64_t>(), *linearEquationSolverFactory, checkTask.getHint());
             std::unique_ptr<CheckResult> result = std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
             return result;
         }
@@ -69,8 +146,20 @@ namespace storm {
             std::unique_ptr<CheckResult> rightResultPointer = this->check(pathFormula.getRightSubformula());
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory, checkTask.getHint());
-            return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+            boost::optional<ValueType> errorBound;
+            std::vector<ValueType> numericResult;
+            if (checkTask.getHint().isEmpty()) {
+                // Reuse the qualitative analysis of previously checked formulas (if possible).
+                ExplicitModelCheckerHint<ValueType> hint = precomputationCache.getUntilProbabilitiesHint(leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
+                numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory, hint, &errorBound);
+            } else {
+                numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory, checkTask.getHint(), &errorBound);
+            }
+            std::unique_ptr<CheckResult> result = std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+            if (errorBound) {
+                result->asExplicitQuantitativeCheckResult<ValueType>().setErrorBound(errorBound.get());
+            }
+            return result;
         }
         
         template<typename SparseDtmcModelType>
@@ -78,7 +167,7 @@ namespace storm {
             storm::logic::GloballyFormula const& pathFormula = checkTask.getFormula();
             std::unique_ptr<CheckResult> subResultPointer = this->check(pathFormula.getSubformula());
             ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeGloballyProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory);
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeGloballyProbabilities(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory);
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
@@ -103,8 +192,13 @@ namespace storm {
             storm::logic::EventuallyFormula const& eventuallyFormula = checkTask.getFormula();
             std::unique_ptr<CheckResult> subResultPointer = this->check(eventuallyFormula.getSubformula());
             ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getRewardModel(""), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory, checkTask.getHint());
-            return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+            boost::optional<ValueType> errorBound;
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getRewardModel(""), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory, checkTask.getHint(), &errorBound);
+            std::unique_ptr<CheckResult> result = std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+            if (errorBound) {
+                result->asExplicitQuantitativeCheckResult<ValueType>().setErrorBound(errorBound.get());
+            }
+            return result;
         }
 
         template<typename SparseDtmcModelType>
@@ -134,7 +228,7 @@ namespace storm {
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
 
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeConditionalProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory);
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeConditionalProbabilities(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory);
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
@@ -149,7 +243,7 @@ namespace storm {
             ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
             ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
             
-            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeConditionalRewards(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getRewardModel(""), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory);
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeConditionalRewards(this->getModel().getTransitionMatrix(), precomputationCache.getBackwardTransitions(), checkTask.isRewardModelSet() ? this->getModel().getRewardModel(checkTask.getRewardModel()) : this->getModel().getRewardModel(""), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), *linearEquationSolverFactory);
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
@@ -6,6 +6,7 @@
 #include "storm/utility/solver.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/storage/StronglyConnectedComponent.h"
+#include "storm/modelchecker/prctl/helper/SparsePrecomputationCache.h"
 
 namespace storm {
     namespace modelchecker {
@@ -20,6 +21,7 @@ namespace storm {
             
             // The implemented methods of the AbstractModelChecker interface.
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+            virtual std::vector<std::unique_ptr<CheckResult>> checkAll(std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) override;
             virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeNextProbabilities(CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
@@ -34,8 +36,17 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
 
         private:
+            /*!
+             * Retrieves the phi and psi states of the given task if it asks for the probabilities of phi U psi (or
+             * F psi) and can therefore be checked together with other such tasks in checkAll.
+             */
+            boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> getUntilStatesForBatch(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            
             // An object that is used for retrieving linear equation solvers.
             std::unique_ptr<storm::solver::LinearEquationSolverFactory<ValueType>> linearEquationSolverFactory;
+            
+            // The results of precomputations that are shared among the checked formulas.
+            helper::SparsePrecomputationCache<ValueType> precomputationCache;
         };
         
     } // namespace modelchecker
@@ -4,6 +4,7 @@
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/modelchecker/prctl/helper/SparsePrecomputationCache.h"
 
 namespace storm {
     namespace modelchecker {
@@ -33,6 +34,9 @@ namespace storm {
         private:
             // An object that is used for retrieving solvers for systems of linear equations that are the result of nondeterministic choices.
             std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ValueType>> minMaxLinearEquationSolverFactory;
+            
+            // The results of precomputations that are shared among the checked formulas.
+            helper::SparsePrecomputationCache<ValueType> precomputationCache;
         };
     } // namespace modelchecker
 } // namespace storm
@@ -0,0 +1,269 @@
+#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+
+#include <limits>
+#include <set>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/storage/BitVector.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            DsMpiUpperRewardBoundsComputer<ValueType>::DsMpiUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards, std::vector<ValueType> const& oneStepTargetProbabilities) : transitionMatrix(transitionMatrix), originalRewards(rewards), originalOneStepTargetProbabilities(oneStepTargetProbabilities), backwardTransitions(transitionMatrix.transpose()), choiceToState(transitionMatrix.getRowCount()) {
+                STORM_LOG_ASSERT(rewards.size() == transitionMatrix.getRowCount(), "Reward vector has wrong size.");
+                STORM_LOG_ASSERT(oneStepTargetProbabilities.size() == transitionMatrix.getRowCount(), "Vector of one-step target probabilities has wrong size.");
+
+                std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                    for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                        choiceToState[choice] = state;
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            boost::optional<std::vector<ValueType>> DsMpiUpperRewardBoundsComputer<ValueType>::computeUpperBounds(OptimizationDirection dir) {
+                // If minimizing, it suffices to bound the expected rewards under one scheduler that reaches the target
+                // almost surely, so we fix the choices of such a scheduler. Otherwise, the bounds need to hold for all
+                // choices.
+                if (dir == OptimizationDirection::Minimize) {
+                    if (!computeAttractorChoices()) {
+                        STORM_LOG_DEBUG("Could not find a scheduler that reaches the target almost surely.");
+                        return boost::none;
+                    }
+                } else {
+                    computeGreedyChoices();
+                }
+
+                sweep(dir == OptimizationDirection::Maximize);
+
+                boost::optional<ValueType> lambda = computeLambda(dir == OptimizationDirection::Maximize);
+                if (!lambda) {
+                    STORM_LOG_DEBUG("Could not derive upper bounds on the expected rewards.");
+                    return boost::none;
+                }
+
+                std::vector<ValueType> result(transitionMatrix.getRowGroupCount());
+                for (uint64_t state = 0; state < result.size(); ++state) {
+                    result[state] = w[state] + (storm::utility::one<ValueType>() - p[state]) * lambda.get();
+                }
+
+                // Due to numerical imprecisions (in particular for states whose probability p is (close to) one), the
+                // obtained vector may fail to be a fixed point from above, so we explicitly check this. The check does
+                // not tolerate any violation. Instead, for inexact value types, we try to compensate rounding errors by
+                // slightly increasing the bounds and checking them again.
+                bool allChoices = dir == OptimizationDirection::Maximize;
+                if (isFixedPointFromAbove(result, allChoices)) {
+                    return result;
+                }
+                if (!storm::NumberTraits<ValueType>::IsExact) {
+                    ValueType tolerance = storm::utility::convertNumber<ValueType>(1e-9);
+                    for (auto& value : result) {
+                        value += tolerance * std::max(storm::utility::one<ValueType>(), storm::utility::abs(value));
+                    }
+                    if (isFixedPointFromAbove(result, allChoices)) {
+                        return result;
+                    }
+                }
+                STORM_LOG_DEBUG("The derived upper bounds on the expected rewards are not a fixed point from above.");
+                return boost::none;
+            }
+
+            template<typename ValueType>
+            boost::optional<ValueType> DsMpiUpperRewardBoundsComputer<ValueType>::computeUpperBound(OptimizationDirection dir) {
+                boost::optional<std::vector<ValueType>> upperBounds = computeUpperBounds(dir);
+                if (!upperBounds) {
+                    return boost::none;
+                }
+                if (upperBounds->empty()) {
+                    return storm::utility::zero<ValueType>();
+                }
+                ValueType result = storm::utility::vector::max_if(upperBounds.get(), storm::storage::BitVector(upperBounds->size(), true));
+                STORM_LOG_TRACE("Derived upper bound " << result << " on the expected rewards.");
+                return result;
+            }
+
+            template<typename ValueType>
+            bool DsMpiUpperRewardBoundsComputer<ValueType>::computeAttractorChoices() {
+                uint64_t const noChoice = std::numeric_limits<uint64_t>::max();
+                selectedChoices = std::vector<uint64_t>(transitionMatrix.getRowGroupCount(), noChoice);
+
+                // Start with the states that have a choice moving to the target directly.
+                std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                std::vector<uint64_t> stack;
+                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                    for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                        if (originalOneStepTargetProbabilities[choice] > storm::utility::zero<ValueType>()) {
+                            selectedChoices[state] = choice;
+                            stack.push_back(state);
+                            break;
+                        }
+                    }
+                }
+
+                // Then, search backwards and select for each reached state a choice leading to an already found state.
+                uint64_t numberOfFoundStates = stack.size();
+                while (!stack.empty()) {
+                    uint64_t state = stack.back();
+                    stack.pop_back();
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        uint64_t predecessor = choiceToState[entry.getColumn()];
+                        if (selectedChoices[predecessor] == noChoice) {
+                            selectedChoices[predecessor] = entry.getColumn();
+                            stack.push_back(predecessor);
+                            ++numberOfFoundStates;
+                        }
+                    }
+                }
+
+                return numberOfFoundStates == transitionMatrix.getRowGroupCount();
+            }
+
+            template<typename ValueType>
+            void DsMpiUpperRewardBoundsComputer<ValueType>::computeGreedyChoices() {
+                std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                selectedChoices = std::vector<uint64_t>(transitionMatrix.getRowGroupCount());
+                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                    uint64_t bestChoice = rowGroupIndices[state];
+                    for (uint64_t choice = bestChoice + 1; choice < rowGroupIndices[state + 1]; ++choice) {
+                        if (originalOneStepTargetProbabilities[choice] > originalOneStepTargetProbabilities[bestChoice]) {
+                            bestChoice = choice;
+                        }
+                    }
+                    selectedChoices[state] = bestChoice;
+                }
+            }
+
+            template<typename ValueType>
+            void DsMpiUpperRewardBoundsComputer<ValueType>::sweep(bool adaptChoices) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                rewards = originalRewards;
+                targetProbabilities = originalOneStepTargetProbabilities;
+                w = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                p = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+
+                // States with a high probability of reaching the target (via visited states) are visited first. Among
+                // those, states with a low reward are preferred.
+                auto isBetterChoice = [this] (uint64_t const& choice1, uint64_t const& choice2) {
+                    if (targetProbabilities[choice1] != targetProbabilities[choice2]) {
+                        return targetProbabilities[choice1] > targetProbabilities[choice2];
+                    }
+                    return rewards[choice1] < rewards[choice2];
+                };
+                auto comparePriority = [this, &isBetterChoice] (uint64_t const& state1, uint64_t const& state2) {
+                    uint64_t choice1 = selectedChoices[state1];
+                    uint64_t choice2 = selectedChoices[state2];
+                    if (isBetterChoice(choice1, choice2)) {
+                        return true;
+                    } else if (isBetterChoice(choice2, choice1)) {
+                        return false;
+                    }
+                    return state1 < state2;
+                };
+
+                // Note that the priority of a state must not change while it is contained in the queue, so states are
+                // removed from the queue before their values are updated and reinserted afterwards.
+                std::set<uint64_t, decltype(comparePriority)> queue(comparePriority);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    queue.insert(state);
+                }
+
+                storm::storage::BitVector visitedStates(numberOfStates);
+                while (!queue.empty()) {
+                    uint64_t state = *queue.begin();
+                    queue.erase(queue.begin());
+                    visitedStates.set(state);
+
+                    uint64_t choice = selectedChoices[state];
+                    w[state] = rewards[choice];
+                    p[state] = targetProbabilities[choice];
+
+                    // Propagate the values of the state to the choices of its predecessors.
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        uint64_t predecessorChoice = entry.getColumn();
+                        uint64_t predecessor = choiceToState[predecessorChoice];
+                        if (visitedStates.get(predecessor)) {
+                            continue;
+                        }
+
+                        queue.erase(predecessor);
+                        rewards[predecessorChoice] += entry.getValue() * w[state];
+                        targetProbabilities[predecessorChoice] += entry.getValue() * p[state];
+                        if (adaptChoices && isBetterChoice(predecessorChoice, selectedChoices[predecessor])) {
+                            selectedChoices[predecessor] = predecessorChoice;
+                        }
+                        queue.insert(predecessor);
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            boost::optional<ValueType> DsMpiUpperRewardBoundsComputer<ValueType>::computeLambda(bool allChoices) const {
+                // The vector w + (1 - p) * lambda is a fixed point of the Bellman operator from above if for every
+                // considered choice the 'reward excess' of the choice is covered by lambda times its 'probability
+                // excess'. For the selected choices, the latter is non-negative by construction.
+                ValueType lowerLimit = storm::utility::zero<ValueType>();
+                boost::optional<ValueType> upperLimit;
+
+                std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                    uint64_t firstChoice = allChoices ? rowGroupIndices[state] : selectedChoices[state];
+                    uint64_t lastChoice = allChoices ? rowGroupIndices[state + 1] : selectedChoices[state] + 1;
+                    for (uint64_t choice = firstChoice; choice < lastChoice; ++choice) {
+                        ValueType rewardExcess = originalRewards[choice] - w[state];
+                        ValueType probabilityExcess = originalOneStepTargetProbabilities[choice] - p[state];
+                        for (auto const& entry : transitionMatrix.getRow(choice)) {
+                            rewardExcess += entry.getValue() * w[entry.getColumn()];
+                            probabilityExcess += entry.getValue() * p[entry.getColumn()];
+                        }
+
+                        if (probabilityExcess > storm::utility::zero<ValueType>()) {
+                            lowerLimit = std::max(lowerLimit, ValueType(rewardExcess / probabilityExcess));
+                        } else if (choice != selectedChoices[state]) {
+                            if (probabilityExcess < storm::utility::zero<ValueType>()) {
+                                ValueType limit = rewardExcess / probabilityExcess;
+                                upperLimit = upperLimit ? std::min(upperLimit.get(), limit) : limit;
+                            } else if (rewardExcess > storm::utility::zero<ValueType>()) {
+                                return boost::none;
+                            }
+                        }
+                    }
+                }
+
+                if (upperLimit && upperLimit.get() < lowerLimit) {
+                    return boost::none;
+                }
+                return lowerLimit;
+            }
+
+            template<typename ValueType>
+            bool DsMpiUpperRewardBoundsComputer<ValueType>::isFixedPointFromAbove(std::vector<ValueType> const& values, bool allChoices) const {
+                std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                    uint64_t firstChoice = allChoices ? rowGroupIndices[state] : selectedChoices[state];
+                    uint64_t lastChoice = allChoices ? rowGroupIndices[state + 1] : selectedChoices[state] + 1;
+                    for (uint64_t choice = firstChoice; choice < lastChoice; ++choice) {
+                        if (originalRewards[choice] + transitionMatrix.multiplyRowWithVector(choice, values) > values[state]) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+
+            template class DsMpiUpperRewardBoundsComputer<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class DsMpiUpperRewardBoundsComputer<storm::RationalNumber>;
+#endif
+        }
+    }
+}
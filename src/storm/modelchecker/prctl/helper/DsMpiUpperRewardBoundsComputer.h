@@ -0,0 +1,131 @@
+#ifndef STORM_MODELCHECKER_PRCTL_HELPER_DSMPIUPPERREWARDBOUNDSCOMPUTER_H_
+#define STORM_MODELCHECKER_PRCTL_HELPER_DSMPIUPPERREWARDBOUNDSCOMPUTER_H_
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Computes upper bounds on the expected rewards that are accumulated until reaching a set of target states
+             * (in the spirit of the DS-MPI approach by Baier et al.). The states are visited in a single sweep that
+             * processes states with a high probability of reaching the target first. The values obtained in this
+             * way are then corrected by a global factor such that the result is a fixed point of the Bellman operator
+             * from above and therefore an upper bound on the expected rewards.
+             *
+             * The given matrix is assumed to be restricted to the states whose expected reward is to be bounded (the
+             * target states are not part of it). The probability of moving from a choice to the target is given
+             * separately. Moreover, it is assumed that the target is reached almost surely from each state under all
+             * schedulers (if maximizing) or under some scheduler (if minimizing).
+             */
+            template<typename ValueType>
+            class DsMpiUpperRewardBoundsComputer {
+            public:
+                /*!
+                 * Creates an object that can compute upper bounds on the expected rewards.
+                 *
+                 * @param transitionMatrix The transition matrix restricted to the relevant states. Each row group
+                 * corresponds to a state.
+                 * @param rewards The rewards collected by taking the choices (i.e. the rows of the matrix).
+                 * @param oneStepTargetProbabilities For each choice, the probability to move to a target state in one
+                 * step.
+                 */
+                DsMpiUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards, std::vector<ValueType> const& oneStepTargetProbabilities);
+
+                /*!
+                 * Computes upper bounds on the expected rewards of all states.
+                 *
+                 * @param dir The optimization direction. If minimizing, the bounds are valid for the minimal expected
+                 * rewards. If maximizing, they are valid for the expected rewards under all schedulers.
+                 * @return The upper bounds (one per state) or none if no bounds could be derived.
+                 */
+                boost::optional<std::vector<ValueType>> computeUpperBounds(OptimizationDirection dir);
+
+                /*!
+                 * Computes a single upper bound that is valid for the expected rewards of all states.
+                 *
+                 * @param dir The optimization direction.
+                 * @return The upper bound or none if no bound could be derived.
+                 */
+                boost::optional<ValueType> computeUpperBound(OptimizationDirection dir);
+
+            private:
+                /*!
+                 * Chooses for each state a choice such that the target is reached almost surely under the induced
+                 * scheduler. This is done by means of a backward search from the choices that move to the target
+                 * directly.
+                 *
+                 * @return True iff such a choice could be found for all states.
+                 */
+                bool computeAttractorChoices();
+
+                /*!
+                 * Chooses for each state the choice with the highest probability of moving to the target in one step.
+                 */
+                void computeGreedyChoices();
+
+                /*!
+                 * Visits all states in the order of their (current) probability of reaching the target and computes
+                 * the values w and p of the states.
+                 *
+                 * @param adaptChoices If set, the choices of states that are not yet visited may be changed during the
+                 * sweep if another choice has a higher probability to reach the target via visited states.
+                 */
+                void sweep(bool adaptChoices);
+
+                /*!
+                 * Computes the smallest factor lambda such that the vector w + (1 - p) * lambda is a fixed point of the
+                 * Bellman operator from above.
+                 *
+                 * @param allChoices If set, all choices are to be considered. Otherwise, only the selected choices are.
+                 * @return The factor or none if there is none.
+                 */
+                boost::optional<ValueType> computeLambda(bool allChoices) const;
+
+                /*!
+                 * Checks whether applying the Bellman operator to the given values does not increase any of them.
+                 *
+                 * @param values The values to check.
+                 * @param allChoices If set, all choices are to be considered. Otherwise, only the selected choices are.
+                 * @return True iff the values are a fixed point from above.
+                 */
+                bool isFixedPointFromAbove(std::vector<ValueType> const& values, bool allChoices) const;
+
+                // The transition matrix restricted to the relevant states.
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+
+                // The rewards and one-step target probabilities of the choices as given initially.
+                std::vector<ValueType> const& originalRewards;
+                std::vector<ValueType> const& originalOneStepTargetProbabilities;
+
+                // The backward transitions from states to choices.
+                storm::storage::SparseMatrix<ValueType> backwardTransitions;
+
+                // For each choice, the state it belongs to.
+                std::vector<uint64_t> choiceToState;
+
+                // For each state, the currently selected choice.
+                std::vector<uint64_t> selectedChoices;
+
+                // For each choice, the reward and the probability to reach the target that were accumulated via the
+                // states that were already visited during the sweep.
+                std::vector<ValueType> rewards;
+                std::vector<ValueType> targetProbabilities;
+
+                // The values computed in the sweep: the (partial) expected reward w and the probability p of reaching
+                // the target via visited states.
+                std::vector<ValueType> w;
+                std::vector<ValueType> p;
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_PRCTL_HELPER_DSMPIUPPERREWARDBOUNDSCOMPUTER_H_ */
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <boost/optional.hpp>
 #include "storm/storage/Scheduler.h"
 
 namespace storm {
@@ -31,6 +32,9 @@ namespace storm {
                 
                 // A scheduler, if it was computed.
                 std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+                
+                // A bound on the error of the values, if it is known.
+                boost::optional<ValueType> errorBound;
             };
         }
         
@@ -1,6 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -14,6 +15,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace modelchecker {
@@ -58,7 +60,7 @@ namespace storm {
             
             template<typename ValueType, typename RewardModelType>
 
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint, boost::optional<ValueType>* errorBound) {
                 
                 std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
                 
@@ -131,6 +133,9 @@ namespace storm {
                         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                         solver->solveEquations(x, b);
+                        if (errorBound && solver->hasErrorBound()) {
+                            *errorBound = solver->getErrorBound();
+                        }
                         
                         // Set values of resulting vector according to result.
                         storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, x);
@@ -139,6 +144,57 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename RewardModelType>
+            std::vector<std::vector<ValueType>> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilitiesForSharedMaybeStates(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates, std::vector<storm::storage::BitVector> const& statesWithProbability1, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, std::vector<boost::optional<ValueType>>* errorBounds) {
+                std::vector<std::vector<ValueType>> results;
+                results.reserve(statesWithProbability1.size());
+                for (auto const& yesStates : statesWithProbability1) {
+                    results.emplace_back(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues<ValueType>(results.back(), yesStates, storm::utility::one<ValueType>());
+                }
+                if (errorBounds) {
+                    errorBounds->assign(statesWithProbability1.size(), boost::none);
+                }
+                
+                STORM_LOG_INFO("Found " << maybeStates.getNumberOfSetBits() << " 'maybe' states shared by " << statesWithProbability1.size() << " formulas.");
+                if (maybeStates.empty()) {
+                    return results;
+                }
+                
+                // The equation system (I-A)x = b is the same for all formulas, only the right-hand sides differ.
+                storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
+                submatrix.convertToEquationSystem();
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
+                solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                
+                // Solve all systems at once, using the interleaved layout expected by the solver.
+                uint64_t numberOfFormulas = statesWithProbability1.size();
+                uint64_t numberOfMaybeStates = maybeStates.getNumberOfSetBits();
+                std::vector<ValueType> x(numberOfMaybeStates * numberOfFormulas, storm::utility::convertNumber<ValueType>(0.5));
+                std::vector<ValueType> b(numberOfMaybeStates * numberOfFormulas);
+                for (uint64_t formulaIndex = 0; formulaIndex < numberOfFormulas; ++formulaIndex) {
+                    std::vector<ValueType> singleB = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability1[formulaIndex]);
+                    for (uint64_t index = 0; index < numberOfMaybeStates; ++index) {
+                        b[index * numberOfFormulas + formulaIndex] = std::move(singleB[index]);
+                    }
+                }
+                solver->solveEquations(x, b, numberOfFormulas);
+                
+                std::vector<ValueType> singleX(numberOfMaybeStates);
+                for (uint64_t formulaIndex = 0; formulaIndex < numberOfFormulas; ++formulaIndex) {
+                    for (uint64_t index = 0; index < numberOfMaybeStates; ++index) {
+                        singleX[index] = x[index * numberOfFormulas + formulaIndex];
+                    }
+                    storm::utility::vector::setVectorValues<ValueType>(results[formulaIndex], maybeStates, singleX);
+                    
+                    // The solver only provides a bound that holds for all systems.
+                    if (errorBounds && solver->hasErrorBound()) {
+                        (*errorBounds)[formulaIndex] = solver->getErrorBound();
+                    }
+                }
+                return results;
+            }
+            
             template<typename ValueType, typename RewardModelType>
             std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 std::vector<ValueType> result = computeUntilProbabilities(transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative, linearEquationSolverFactory);
@@ -191,12 +247,12 @@ namespace storm {
             }
             
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint) {
-                return computeReachabilityRewards(transitionMatrix, backwardTransitions, [&] (uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) { return rewardModel.getTotalRewardVector(numberOfRows, transitionMatrix, maybeStates); }, targetStates, qualitative, linearEquationSolverFactory, hint);
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint, boost::optional<ValueType>* errorBound) {
+                return computeReachabilityRewards(transitionMatrix, backwardTransitions, [&] (uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) { return rewardModel.getTotalRewardVector(numberOfRows, transitionMatrix, maybeStates); }, targetStates, qualitative, linearEquationSolverFactory, hint, errorBound);
             }
 
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& totalStateRewardVector, storm::storage::BitVector const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& totalStateRewardVector, storm::storage::BitVector const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint, boost::optional<ValueType>* errorBound) {
 
                 return computeReachabilityRewards(transitionMatrix, backwardTransitions,
                                                   [&] (uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const& maybeStates) {
@@ -204,11 +260,11 @@ namespace storm {
                                                       storm::utility::vector::selectVectorValues(result, maybeStates, totalStateRewardVector);
                                                       return result;
                                                   },
-                                                  targetStates, qualitative, linearEquationSolverFactory, hint);
+                                                  targetStates, qualitative, linearEquationSolverFactory, hint, errorBound);
             }
             
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::BitVector const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::BitVector const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, ModelCheckerHint const& hint, boost::optional<ValueType>* errorBound) {
                 
                 std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
                 
@@ -260,7 +316,16 @@ namespace storm {
                         // Now solve the resulting equation system.
                         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
                         solver->setLowerBound(storm::utility::zero<ValueType>());
+                        if (solver->requiresUpperBound()) {
+                            boost::optional<ValueType> upperBound = computeUpperRewardBound(transitionMatrix, maybeStates, b);
+                            if (upperBound) {
+                                solver->setUpperBound(upperBound.get());
+                            }
+                        }
                         solver->solveEquations(x, b);
+                        if (errorBound && solver->hasErrorBound()) {
+                            *errorBound = solver->getErrorBound();
+                        }
                         
                         // Set values of resulting vector according to result.
                         storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, x);
@@ -269,6 +334,20 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename RewardModelType>
+            boost::optional<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUpperRewardBound(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& rewards) {
+                storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates);
+                std::vector<ValueType> oneStepTargetProbabilities = transitionMatrix.getConstrainedRowSumVector(maybeStates, ~maybeStates);
+                return DsMpiUpperRewardBoundsComputer<ValueType>(submatrix, rewards, oneStepTargetProbabilities).computeUpperBound(OptimizationDirection::Maximize);
+            }
+
+#ifdef STORM_HAVE_CARL
+            template<>
+            boost::optional<storm::RationalFunction> SparseDtmcPrctlHelper<storm::RationalFunction>::computeUpperRewardBound(storm::storage::SparseMatrix<storm::RationalFunction> const&, storm::storage::BitVector const&, std::vector<storm::RationalFunction> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper bounds on expected rewards is not supported for parametric models.");
+            }
+#endif
+
             template<typename ValueType, typename RewardModelType>
             std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeLongRunAverageProbabilities(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& psiStates, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 return SparseCtmcCslHelper::computeLongRunAverageProbabilities<ValueType>(transitionMatrix, psiStates, nullptr, linearEquationSolverFactory);
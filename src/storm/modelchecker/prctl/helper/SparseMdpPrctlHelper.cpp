@@ -1,4 +1,5 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
+#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
 #include <boost/container/flat_map.hpp>
 
@@ -18,6 +19,8 @@
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/Scheduler.h"
 
+#include "storm/transformer/EndComponentEliminator.h"
+
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/LpSolver.h"
  
@@ -85,7 +88,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(storm::solver::SolveGoal const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(storm::solver::SolveGoal const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint, std::pair<storm::storage::BitVector, storm::storage::BitVector> const* precomputedStatesWithProbability01) {
                 STORM_LOG_THROW(!(qualitative && produceScheduler), storm::exceptions::InvalidSettingsException, "Cannot produce scheduler when performing qualitative model checking only.");
                      
                 std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
@@ -112,9 +115,12 @@ namespace storm {
                         }
                     }
                 } else {
-                    // Get all states that have probability 0 and 1 of satisfying the until-formula.
+                    // Get all states that have probability 0 and 1 of satisfying the until-formula (unless they were
+                    // already computed).
                      std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-                    if (goal.minimize()) {
+                    if (precomputedStatesWithProbability01) {
+                        statesWithProbability01 = *precomputedStatesWithProbability01;
+                    } else if (goal.minimize()) {
                         statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
                     } else {
                         statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
@@ -137,6 +143,9 @@ namespace storm {
                     scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(transitionMatrix.getRowGroupCount());
                 }
                 
+                // If the values are computed by a solver that provides a bound on the error, we keep it.
+                boost::optional<ValueType> errorBound;
+                
                 // Check whether we need to compute exact probabilities for some states.
                 if (qualitative) {
                     // Set the values for all maybe-states to 0.5 to indicate that their probability values are neither 0 nor 1.
@@ -145,32 +154,55 @@ namespace storm {
                     if (!maybeStates.empty()) {
                         // In this case we have have to compute the probabilities.
                         
-                        // First, we can eliminate the rows and columns from the original transition probability matrix for states
-                        // whose probabilities are already known.
-                        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
-                        
-                        // Prepare the right-hand side of the equation system. For entry i this corresponds to
-                        // the accumulated probability of going from state i to some 'yes' state.
-                        std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, statesWithProbability1);
-                        
-                        // obtain hint information if possible
                         bool skipEcWithinMaybeStatesCheck = goal.minimize() || (hint.isExplicitModelCheckerHint() && hint.asExplicitModelCheckerHint<ValueType>().getNoEndComponentsInMaybeStates());
-                        std::pair<boost::optional<std::vector<ValueType>>, boost::optional<std::vector<uint_fast64_t>>> hintInformation = extractHintInformationForMaybeStates(transitionMatrix, backwardTransitions, maybeStates, boost::none, hint, skipEcWithinMaybeStatesCheck);
                         
-                        // Now compute the results for the maybeStates
-                        std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> resultForMaybeStates = computeValuesOnlyMaybeStates(goal, submatrix, b, produceScheduler, minMaxLinearEquationSolverFactory, std::move(hintInformation.first), std::move(hintInformation.second), storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
-                        
-                        // Set values of resulting vector according to result.
-                        storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, resultForMaybeStates.first);
-
-                        if (produceScheduler) {
-                            std::vector<uint_fast64_t> const& subChoices = resultForMaybeStates.second.get();
-                            auto subChoiceIt = subChoices.begin();
+                        // When maximizing, the upper bounds obtained by interval iteration only converge to the solution
+                        // if there are no end components among the maybe states. As collapsing an end component does not
+                        // change the maximal probabilities, we eliminate them beforehand.
+                        if (!skipEcWithinMaybeStatesCheck && minMaxLinearEquationSolverFactory.getMinMaxMethod() == storm::solver::MinMaxMethod::IntervalIteration) {
+                            auto ecEliminatorResult = storm::transformer::EndComponentEliminator<ValueType>::transform(transitionMatrix, maybeStates, storm::storage::BitVector(transitionMatrix.getRowCount(), true), storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false));
+                            std::vector<ValueType> rowsToYesStates = transitionMatrix.getConstrainedRowSumVector(storm::storage::BitVector(transitionMatrix.getRowCount(), true), statesWithProbability1);
+                            std::vector<ValueType> b;
+                            b.reserve(ecEliminatorResult.newToOldRowMapping.size());
+                            for (auto const& oldRow : ecEliminatorResult.newToOldRowMapping) {
+                                b.push_back(rowsToYesStates[oldRow]);
+                            }
+                            
+                            std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> resultForReducedStates = computeValuesOnlyMaybeStates(goal, ecEliminatorResult.matrix, b, produceScheduler, minMaxLinearEquationSolverFactory, boost::none, boost::none, storm::utility::zero<ValueType>(), storm::utility::one<ValueType>(), &errorBound);
                             for (auto maybeState : maybeStates) {
-                                scheduler->setChoice(*subChoiceIt, maybeState);
-                                ++subChoiceIt;
+                                result[maybeState] = resultForReducedStates.first[ecEliminatorResult.oldToNewStateMapping[maybeState]];
+                            }
+                            
+                            if (produceScheduler) {
+                                computeSchedulerForEliminatedEndComponents(transitionMatrix, backwardTransitions, maybeStates, ecEliminatorResult.matrix.getRowGroupIndices(), ecEliminatorResult.newToOldRowMapping, ecEliminatorResult.oldToNewStateMapping, resultForReducedStates.second.get(), *scheduler);
+                            }
+                        } else {
+                            // First, we can eliminate the rows and columns from the original transition probability matrix for states
+                            // whose probabilities are already known.
+                            storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
+                            
+                            // Prepare the right-hand side of the equation system. For entry i this corresponds to
+                            // the accumulated probability of going from state i to some 'yes' state.
+                            std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, statesWithProbability1);
+                            
+                            // obtain hint information if possible
+                            std::pair<boost::optional<std::vector<ValueType>>, boost::optional<std::vector<uint_fast64_t>>> hintInformation = extractHintInformationForMaybeStates(transitionMatrix, backwardTransitions, maybeStates, boost::none, hint, skipEcWithinMaybeStatesCheck);
+                            
+                            // Now compute the results for the maybeStates
+                            std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> resultForMaybeStates = computeValuesOnlyMaybeStates(goal, submatrix, b, produceScheduler, minMaxLinearEquationSolverFactory, std::move(hintInformation.first), std::move(hintInformation.second), storm::utility::zero<ValueType>(), storm::utility::one<ValueType>(), &errorBound);
+                            
+                            // Set values of resulting vector according to result.
+                            storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, resultForMaybeStates.first);
+
+                            if (produceScheduler) {
+                                std::vector<uint_fast64_t> const& subChoices = resultForMaybeStates.second.get();
+                                auto subChoiceIt = subChoices.begin();
+                                for (auto maybeState : maybeStates) {
+                                    scheduler->setChoice(*subChoiceIt, maybeState);
+                                    ++subChoiceIt;
+                                }
+                                assert(subChoiceIt == subChoices.end());
                             }
-                            assert(subChoiceIt == subChoices.end());
                         }
                     }
                 }
@@ -195,7 +227,60 @@ namespace storm {
                 STORM_LOG_ASSERT((!produceScheduler && !scheduler) || (!scheduler->isPartialScheduler() && scheduler->isDeterministicScheduler() && scheduler->isMemorylessScheduler()), "Unexpected format of obtained scheduler.");
 
                 
-                return MDPSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(scheduler));
+                MDPSparseModelCheckingHelperReturnType<ValueType> returnValue(std::move(result), std::move(scheduler));
+                returnValue.errorBound = errorBound;
+                return returnValue;
+            }
+            
+            template<typename ValueType>
+            void SparseMdpPrctlHelper<ValueType>::computeSchedulerForEliminatedEndComponents(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maybeStates, std::vector<uint_fast64_t> const& reducedRowGroupIndices, std::vector<uint_fast64_t> const& reducedToOriginalRowMapping, std::vector<uint_fast64_t> const& originalToReducedStateMapping, std::vector<uint_fast64_t> const& reducedChoices, storm::storage::Scheduler<ValueType>& scheduler) {
+                std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                
+                // First, every state takes the selected choice if it belongs to this state. This is the case for all
+                // states that are not part of an end component and for exactly one state of each end component.
+                storm::storage::BitVector statesWithChoice(transitionMatrix.getRowGroupCount(), false);
+                std::vector<uint_fast64_t> stack;
+                for (auto state : maybeStates) {
+                    uint_fast64_t reducedState = originalToReducedStateMapping[state];
+                    uint_fast64_t row = reducedToOriginalRowMapping[reducedRowGroupIndices[reducedState] + reducedChoices[reducedState]];
+                    if (rowGroupIndices[state] <= row && row < rowGroupIndices[state + 1]) {
+                        scheduler.setChoice(row - rowGroupIndices[state], state);
+                        statesWithChoice.set(state, true);
+                        stack.push_back(state);
+                    }
+                }
+                
+                // Then, search backwards within the end components and let the remaining states pick a choice that stays
+                // within the end component and may move to a state that already has a choice.
+                while (!stack.empty()) {
+                    uint_fast64_t state = stack.back();
+                    stack.pop_back();
+                    uint_fast64_t reducedState = originalToReducedStateMapping[state];
+                    for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                        uint_fast64_t predecessor = predecessorEntry.getColumn();
+                        if (!maybeStates.get(predecessor) || statesWithChoice.get(predecessor) || originalToReducedStateMapping[predecessor] != reducedState) {
+                            continue;
+                        }
+                        for (uint_fast64_t row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1]; ++row) {
+                            bool staysInEndComponent = true;
+                            bool reachesState = false;
+                            for (auto const& entry : transitionMatrix.getRow(row)) {
+                                if (!maybeStates.get(entry.getColumn()) || originalToReducedStateMapping[entry.getColumn()] != reducedState) {
+                                    staysInEndComponent = false;
+                                    break;
+                                }
+                                reachesState |= entry.getColumn() == state;
+                            }
+                            if (staysInEndComponent && reachesState) {
+                                scheduler.setChoice(row - rowGroupIndices[predecessor], predecessor);
+                                statesWithChoice.set(predecessor, true);
+                                stack.push_back(predecessor);
+                                break;
+                            }
+                        }
+                    }
+                }
+                STORM_LOG_ASSERT(maybeStates.isSubsetOf(statesWithChoice), "Could not find a choice for every state of the collapsed end components.");
             }
             
             template<typename ValueType>
@@ -251,7 +336,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> SparseMdpPrctlHelper<ValueType>::computeValuesOnlyMaybeStates(storm::solver::SolveGoal const& goal, storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& b, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, boost::optional<std::vector<ValueType>>&& hintValues, boost::optional<std::vector<uint_fast64_t>>&& hintChoices, boost::optional<ValueType> const& lowerResultBound, boost::optional<ValueType> const& upperResultBound) {
+            std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> SparseMdpPrctlHelper<ValueType>::computeValuesOnlyMaybeStates(storm::solver::SolveGoal const& goal, storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& b, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, boost::optional<std::vector<ValueType>>&& hintValues, boost::optional<std::vector<uint_fast64_t>>&& hintChoices, boost::optional<ValueType> const& lowerResultBound, boost::optional<ValueType> const& upperResultBound, boost::optional<ValueType>* errorBound) {
                 
                 // Set up the solver
                 std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = storm::solver::configureMinMaxLinearEquationSolver(goal, minMaxLinearEquationSolverFactory, submatrix);
@@ -271,6 +356,9 @@ namespace storm {
                 
                 // Solve the corresponding system of equations.
                 solver->solveEquations(x, b);
+                if (errorBound && solver->hasErrorBound()) {
+                    *errorBound = solver->getErrorBound();
+                }
                 
                 // If requested, a scheduler was produced
                 if (produceScheduler) {
@@ -281,9 +369,9 @@ namespace storm {
             }
 
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint, std::pair<storm::storage::BitVector, storm::storage::BitVector> const* precomputedStatesWithProbability01) {
                 storm::solver::SolveGoal goal(dir);
-                return std::move(computeUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, produceScheduler, minMaxLinearEquationSolverFactory, hint));
+                return std::move(computeUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, produceScheduler, minMaxLinearEquationSolverFactory, hint, precomputedStatesWithProbability01));
             }
            
             template<typename ValueType>
@@ -425,6 +513,9 @@ namespace storm {
                     scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(transitionMatrix.getRowGroupCount());
                 }
                 
+                // If the values are computed by a solver that provides a bound on the error, we keep it.
+                boost::optional<ValueType> errorBound;
+                
                 // Check whether we need to compute exact rewards for some states.
                 if (qualitative) {
                     STORM_LOG_INFO("The rewards for the initial states were determined in a preprocessing step. No exact rewards were computed.");
@@ -455,8 +546,15 @@ namespace storm {
                         bool skipEcWithinMaybeStatesCheck = !goal.minimize() || (hint.isExplicitModelCheckerHint() && hint.asExplicitModelCheckerHint<ValueType>().getNoEndComponentsInMaybeStates());
                         std::pair<boost::optional<std::vector<ValueType>>, boost::optional<std::vector<uint_fast64_t>>> hintInformation = extractHintInformationForMaybeStates(transitionMatrix, backwardTransitions, maybeStates, selectedChoices, hint, skipEcWithinMaybeStatesCheck);
                         
+                        // Interval iteration additionally requires an upper bound on the rewards of the maybe states.
+                        boost::optional<ValueType> upperResultBound;
+                        if (minMaxLinearEquationSolverFactory.getMinMaxMethod() == storm::solver::MinMaxMethod::IntervalIteration) {
+                            std::vector<ValueType> oneStepTargetProbabilities = transitionMatrix.getConstrainedRowSumVector(selectedChoices ? selectedChoices.get() : transitionMatrix.getRowFilter(maybeStates), targetStates);
+                            upperResultBound = DsMpiUpperRewardBoundsComputer<ValueType>(submatrix, b, oneStepTargetProbabilities).computeUpperBound(goal.direction());
+                        }
+                        
                         // Now compute the results for the maybeStates
-                        std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> resultForMaybeStates = computeValuesOnlyMaybeStates(goal, submatrix, b, produceScheduler, minMaxLinearEquationSolverFactory, std::move(hintInformation.first), std::move(hintInformation.second), storm::utility::zero<ValueType>());
+                        std::pair<std::vector<ValueType>, boost::optional<std::vector<uint_fast64_t>>> resultForMaybeStates = computeValuesOnlyMaybeStates(goal, submatrix, b, produceScheduler, minMaxLinearEquationSolverFactory, std::move(hintInformation.first), std::move(hintInformation.second), storm::utility::zero<ValueType>(), upperResultBound, &errorBound);
 
                         // Set values of resulting vector according to result.
                         storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, resultForMaybeStates.first);
@@ -504,11 +602,13 @@ namespace storm {
                 STORM_LOG_ASSERT((!produceScheduler && !scheduler) || (!scheduler->isPartialScheduler() && scheduler->isDeterministicScheduler() && scheduler->isMemorylessScheduler()), "Unexpected format of obtained scheduler.");
 
                 
-                return MDPSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(scheduler));
+                MDPSparseModelCheckingHelperReturnType<ValueType> returnValue(std::move(result), std::move(scheduler));
+                returnValue.errorBound = errorBound;
+                return returnValue;
             }
             
             template<typename ValueType>
-            std::vector<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+            std::vector<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, storm::storage::MaximalEndComponentDecomposition<ValueType> const* precomputedMecDecomposition) {
                 
                 // If there are no goal states, we avoid the computation and directly return zero.
                 if (psiStates.empty()) {
@@ -525,17 +625,21 @@ namespace storm {
                 std::vector<ValueType> stateRewards(psiStates.size(), storm::utility::zero<ValueType>());
                 storm::utility::vector::setVectorValues(stateRewards, psiStates, storm::utility::one<ValueType>());
                 storm::models::sparse::StandardRewardModel<ValueType> rewardModel(std::move(stateRewards));
-                return computeLongRunAverageRewards(dir, transitionMatrix, backwardTransitions, rewardModel, minMaxLinearEquationSolverFactory);
+                return computeLongRunAverageRewards(dir, transitionMatrix, backwardTransitions, rewardModel, minMaxLinearEquationSolverFactory, precomputedMecDecomposition);
             }
             
             template<typename ValueType>
             template<typename RewardModelType>
-            std::vector<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+            std::vector<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, storm::storage::MaximalEndComponentDecomposition<ValueType> const* precomputedMecDecomposition) {
                 
                 uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
 
-                // Start by decomposing the MDP into its MECs.
-                storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions);
+                // Start by decomposing the MDP into its MECs (unless the decomposition was already computed).
+                boost::optional<storm::storage::MaximalEndComponentDecomposition<ValueType>> computedMecDecomposition;
+                if (!precomputedMecDecomposition) {
+                    computedMecDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions);
+                }
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecDecomposition = precomputedMecDecomposition ? *precomputedMecDecomposition : computedMecDecomposition.get();
                 
                 // Get some data members for convenience.
                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -948,7 +1052,7 @@ namespace storm {
             template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewards(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, uint_fast64_t stepBound, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
             template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint);
             template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(storm::solver::SolveGoal const& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint);
-            template std::vector<double> SparseMdpPrctlHelper<double>::computeLongRunAverageRewards(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
+            template std::vector<double> SparseMdpPrctlHelper<double>::computeLongRunAverageRewards(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory, storm::storage::MaximalEndComponentDecomposition<double> const* precomputedMecDecomposition);
             template double SparseMdpPrctlHelper<double>::computeLraForMaximalEndComponent(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
             template double SparseMdpPrctlHelper<double>::computeLraForMaximalEndComponentVI(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
             template double SparseMdpPrctlHelper<double>::computeLraForMaximalEndComponentLP(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec);
@@ -959,7 +1063,7 @@ namespace storm {
             template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeCumulativeRewards(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, uint_fast64_t stepBound, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint);
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(storm::solver::SolveGoal const& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory, ModelCheckerHint const& hint);
-            template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeLongRunAverageRewards(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
+            template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeLongRunAverageRewards(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory, storm::storage::MaximalEndComponentDecomposition<storm::RationalNumber> const* precomputedMecDecomposition);
             template storm::RationalNumber SparseMdpPrctlHelper<storm::RationalNumber>::computeLraForMaximalEndComponent(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
             template storm::RationalNumber SparseMdpPrctlHelper<storm::RationalNumber>::computeLraForMaximalEndComponentVI(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<storm::RationalNumber> const& minMaxLinearEquationSolverFactory);
             template storm::RationalNumber SparseMdpPrctlHelper<storm::RationalNumber>::computeLraForMaximalEndComponentLP(OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec);
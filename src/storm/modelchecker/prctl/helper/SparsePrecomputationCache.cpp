@@ -0,0 +1,113 @@
+#include "storm/modelchecker/prctl/helper/SparsePrecomputationCache.h"
+
+#include <algorithm>
+
+#include "storm/utility/graph.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            SparsePrecomputationCache<ValueType>::SparsePrecomputationCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfQualitativeResults) : transitionMatrix(transitionMatrix), maximalNumberOfQualitativeResults(maximalNumberOfQualitativeResults) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparsePrecomputationCache<ValueType>::getBackwardTransitions() {
+                if (!backwardTransitions) {
+                    backwardTransitions = transitionMatrix.transpose(true);
+                }
+                return backwardTransitions.get();
+            }
+
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> SparsePrecomputationCache<ValueType>::getStatesWithProbability01(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return getQualitativeResult(boost::none, phiStates, psiStates);
+            }
+
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> SparsePrecomputationCache<ValueType>::getStatesWithProbability01(storm::OptimizationDirection const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return getQualitativeResult(dir, phiStates, psiStates);
+            }
+
+            template<typename ValueType>
+            ExplicitModelCheckerHint<ValueType> SparsePrecomputationCache<ValueType>::getUntilProbabilitiesHint(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> const& statesWithProbability01 = getQualitativeResult(boost::none, phiStates, psiStates);
+                storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+
+                // The helper starts the iteration with 0.5 for all maybe states.
+                std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::convertNumber<ValueType>(0.5));
+                storm::utility::vector::setVectorValues<ValueType>(result, statesWithProbability01.second, storm::utility::one<ValueType>());
+
+                ExplicitModelCheckerHint<ValueType> hint;
+                hint.setResultHint(std::move(result));
+                hint.setMaybeStates(std::move(maybeStates));
+                hint.setComputeOnlyMaybeStates(true);
+                hint.setNoEndComponentsInMaybeStates(false);
+                return hint;
+            }
+
+            template<typename ValueType>
+            storm::storage::MaximalEndComponentDecomposition<ValueType> const& SparsePrecomputationCache<ValueType>::getMaximalEndComponentDecomposition() {
+                if (!mecDecomposition) {
+                    mecDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, getBackwardTransitions());
+                }
+                return mecDecomposition.get();
+            }
+
+            template<typename ValueType>
+            void SparsePrecomputationCache<ValueType>::clear() {
+                backwardTransitions = boost::none;
+                qualitativeResults.clear();
+                mecDecomposition = boost::none;
+            }
+
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> const& SparsePrecomputationCache<ValueType>::getQualitativeResult(boost::optional<storm::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                for (auto it = qualitativeResults.begin(), ite = qualitativeResults.end(); it != ite; ++it) {
+                    if (it->dir == dir && it->psiStates == psiStates && it->phiStates == phiStates) {
+                        STORM_LOG_TRACE("Retrieved qualitative result from cache.");
+
+                        // Mark the result as the most recently used one.
+                        if (std::next(it) != ite) {
+                            QualitativeResult qualitativeResult = std::move(*it);
+                            qualitativeResults.erase(it);
+                            qualitativeResults.push_back(std::move(qualitativeResult));
+                        }
+                        return qualitativeResults.back().statesWithProbability01;
+                    }
+                }
+
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+                if (!dir) {
+                    statesWithProbability01 = storm::utility::graph::performProb01(getBackwardTransitions(), phiStates, psiStates);
+                } else if (dir.get() == storm::OptimizationDirection::Minimize) {
+                    statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), phiStates, psiStates);
+                } else {
+                    statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), phiStates, psiStates);
+                }
+
+                // The most recent result is always kept, as we return a reference to it.
+                while (!qualitativeResults.empty() && qualitativeResults.size() >= std::max<uint64_t>(maximalNumberOfQualitativeResults, 1)) {
+                    qualitativeResults.pop_front();
+                }
+                qualitativeResults.push_back(QualitativeResult{dir, phiStates, psiStates, std::move(statesWithProbability01)});
+                return qualitativeResults.back().statesWithProbability01;
+            }
+
+            template class SparsePrecomputationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparsePrecomputationCache<storm::RationalNumber>;
+            template class SparsePrecomputationCache<storm::RationalFunction>;
+#endif
+        }
+    }
+}
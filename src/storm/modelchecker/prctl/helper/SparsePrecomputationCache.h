@@ -0,0 +1,104 @@
+#ifndef STORM_MODELCHECKER_PRCTL_HELPER_SPARSEPRECOMPUTATIONCACHE_H_
+#define STORM_MODELCHECKER_PRCTL_HELPER_SPARSEPRECOMPUTATIONCACHE_H_
+
+#include <deque>
+#include <utility>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Stores the results of precomputations on a sparse model that do not depend on the checked property as a
+             * whole, i.e. the backward transitions, the qualitative solutions of until formulas and the maximal end
+             * component decomposition. This way, several properties of the same model can be checked without redoing
+             * the graph analyses. Only the most recently used qualitative solutions are kept.
+             */
+            template<typename ValueType>
+            class SparsePrecomputationCache {
+            public:
+                /*!
+                 * Creates an empty cache for the model with the given transition matrix.
+                 *
+                 * @param transitionMatrix The transition matrix of the model. It must outlive the cache.
+                 * @param maximalNumberOfQualitativeResults The maximal number of qualitative solutions that are kept (at least
+                 * the most recent one is kept).
+                 */
+                SparsePrecomputationCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfQualitativeResults = 16);
+
+                /*!
+                 * Retrieves the backward transitions of the model.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+
+                /*!
+                 * Retrieves the states that satisfy phi U psi with probability 0 and 1, respectively, in a model
+                 * without nondeterminism.
+                 */
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> getStatesWithProbability01(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the states that satisfy phi U psi with minimal (or maximal) probability 0 and 1,
+                 * respectively, in a model with nondeterminism.
+                 */
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> getStatesWithProbability01(storm::OptimizationDirection const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves a hint for the computation of the probabilities to satisfy phi U psi in a model without
+                 * nondeterminism that makes the helper skip the qualitative analysis. The values of the maybe states are
+                 * set to the initial guess that the helper uses without a hint.
+                 */
+                ExplicitModelCheckerHint<ValueType> getUntilProbabilitiesHint(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the decomposition of the model into its maximal end components.
+                 */
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const& getMaximalEndComponentDecomposition();
+
+                /*!
+                 * Removes all stored results.
+                 */
+                void clear();
+
+            private:
+                struct QualitativeResult {
+                    boost::optional<storm::OptimizationDirection> dir;
+                    storm::storage::BitVector phiStates;
+                    storm::storage::BitVector psiStates;
+                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+                };
+
+                /*!
+                 * Retrieves the qualitative solution of phi U psi for the given direction (if any).
+                 */
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> const& getQualitativeResult(boost::optional<storm::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                // The transition matrix of the model.
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+
+                // The maximal number of qualitative solutions that are kept.
+                uint64_t maximalNumberOfQualitativeResults;
+
+                // The backward transitions of the model (if already computed).
+                boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+
+                // The most recently used qualitative solutions (most recent last).
+                std::deque<QualitativeResult> qualitativeResults;
+
+                // The maximal end component decomposition of the model (if already computed).
+                boost::optional<storm::storage::MaximalEndComponentDecomposition<ValueType>> mecDecomposition;
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_PRCTL_HELPER_SPARSEPRECOMPUTATIONCACHE_H_ */
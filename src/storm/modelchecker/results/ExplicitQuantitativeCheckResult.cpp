@@ -182,6 +182,22 @@ namespace storm {
             return *scheduler.get();
         }
         
+        template<typename ValueType>
+        bool ExplicitQuantitativeCheckResult<ValueType>::hasErrorBound() const {
+            return static_cast<bool>(errorBound);
+        }
+        
+        template<typename ValueType>
+        void ExplicitQuantitativeCheckResult<ValueType>::setErrorBound(ValueType const& errorBound) {
+            this->errorBound = errorBound;
+        }
+        
+        template<typename ValueType>
+        ValueType const& ExplicitQuantitativeCheckResult<ValueType>::getErrorBound() const {
+            STORM_LOG_THROW(this->hasErrorBound(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing error bound.");
+            return errorBound.get();
+        }
+        
         template<typename ValueType>
         void print(std::ostream& out, ValueType const& value) {
             if (value == storm::utility::infinity<ValueType>()) {
@@ -277,6 +293,12 @@ namespace storm {
                 printRange(out, minmax.first, minmax.second);
             }
             
+            if (this->hasErrorBound()) {
+                out << " (error bound: ";
+                print(out, this->getErrorBound());
+                out << ")";
+            }
+            
             return out;
         }
         
@@ -66,12 +66,23 @@ namespace storm {
             storm::storage::Scheduler<ValueType> const& getScheduler() const;
             storm::storage::Scheduler<ValueType>& getScheduler();
             
+            /*!
+             * Retrieves whether the values are accompanied by a bound on their (absolute) error, i.e. whether the exact
+             * values are guaranteed to differ from the stored ones by at most the bound.
+             */
+            bool hasErrorBound() const;
+            void setErrorBound(ValueType const& errorBound);
+            ValueType const& getErrorBound() const;
+            
         private:
             // The values of the quantitative check result.
             boost::variant<vector_type, map_type> values;
             
             // An optional scheduler that accompanies the values.
             boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+            
+            // An optional bound on the error of the values.
+            boost::optional<ValueType> errorBound;
         };
     }
 }
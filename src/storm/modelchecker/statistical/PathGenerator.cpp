@@ -0,0 +1,114 @@
+#include "storm/modelchecker/statistical/PathGenerator.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace statistical_detail {
+            
+            template <typename ValueType, typename StateType>
+            PathGenerator<ValueType, StateType>::PathGenerator(std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>&& generator, std::vector<storm::expressions::Expression> const& stateExpressions) : generator(std::move(generator)), stateExpressions(stateExpressions), currentStateSatisfiesExpression(stateExpressions.size()) {
+                STORM_LOG_THROW(this->generator->isDeterministicModel(), storm::exceptions::NotSupportedException, "The statistical model checking engine currently only supports deterministic models.");
+                
+                // The ids of states only need to be valid until the next state is explored, so there is no need to
+                // store the (potentially very many) reached states.
+                stateToIdCallback = [this] (storm::generator::CompressedState const& state) -> StateType {
+                    successors.push_back(state);
+                    return static_cast<StateType>(successors.size() - 1);
+                };
+                
+                std::vector<StateType> initialStateIds = this->generator->getInitialStates(stateToIdCallback);
+                STORM_LOG_THROW(initialStateIds.size() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the statistical model checking engine.");
+                initialState = successors[initialStateIds.front()];
+                successors.clear();
+            }
+            
+            template <typename ValueType, typename StateType>
+            void PathGenerator<ValueType, StateType>::restart() {
+                explore(initialState);
+            }
+            
+            template <typename ValueType, typename StateType>
+            void PathGenerator<ValueType, StateType>::moveToSuccessor(RandomGenerator& randomGenerator) {
+                STORM_LOG_ASSERT(!isAbsorbing(), "Cannot move to a successor of an absorbing state.");
+                auto const& choice = currentBehavior.getChoices().front();
+                
+                ValueType randomValue = std::uniform_real_distribution<ValueType>(storm::utility::zero<ValueType>(), choice.getTotalMass())(randomGenerator);
+                StateType successorId = choice.begin()->first;
+                for (auto const& successorValuePair : choice) {
+                    successorId = successorValuePair.first;
+                    if (randomValue < successorValuePair.second) {
+                        break;
+                    }
+                    randomValue -= successorValuePair.second;
+                }
+                
+                // The successor needs to be copied, because exploring it overwrites the successors.
+                storm::generator::CompressedState successor = successors[successorId];
+                explore(successor);
+            }
+            
+            template <typename ValueType, typename StateType>
+            ValueType PathGenerator<ValueType, StateType>::sampleSojournTime(RandomGenerator& randomGenerator) const {
+                STORM_LOG_ASSERT(!isAbsorbing(), "The sojourn time of absorbing states is infinite.");
+                if (isDiscreteTimeModel()) {
+                    return storm::utility::one<ValueType>();
+                }
+                return std::exponential_distribution<ValueType>(getExitRate())(randomGenerator);
+            }
+            
+            template <typename ValueType, typename StateType>
+            bool PathGenerator<ValueType, StateType>::satisfies(uint_fast64_t expressionIndex) const {
+                return currentStateSatisfiesExpression[expressionIndex];
+            }
+            
+            template <typename ValueType, typename StateType>
+            bool PathGenerator<ValueType, StateType>::isAbsorbing() const {
+                return currentBehavior.empty();
+            }
+            
+            template <typename ValueType, typename StateType>
+            ValueType PathGenerator<ValueType, StateType>::getExitRate() const {
+                return isAbsorbing() ? storm::utility::zero<ValueType>() : currentBehavior.getChoices().front().getTotalMass();
+            }
+            
+            template <typename ValueType, typename StateType>
+            ValueType PathGenerator<ValueType, StateType>::getStateReward() const {
+                return currentBehavior.getStateRewards().empty() ? storm::utility::zero<ValueType>() : currentBehavior.getStateRewards().front();
+            }
+            
+            template <typename ValueType, typename StateType>
+            ValueType PathGenerator<ValueType, StateType>::getStateActionReward() const {
+                if (isAbsorbing() || currentBehavior.getChoices().front().getRewards().empty()) {
+                    return storm::utility::zero<ValueType>();
+                }
+                return currentBehavior.getChoices().front().getRewards().front();
+            }
+            
+            template <typename ValueType, typename StateType>
+            bool PathGenerator<ValueType, StateType>::isDiscreteTimeModel() const {
+                return generator->isDiscreteTimeModel();
+            }
+            
+            template <typename ValueType, typename StateType>
+            void PathGenerator<ValueType, StateType>::explore(storm::generator::CompressedState const& state) {
+                currentState = state;
+                successors.clear();
+                generator->load(currentState);
+                
+                // Evaluate the expressions before expanding the state, as the expansion may alter the loaded valuation.
+                for (uint_fast64_t expressionIndex = 0; expressionIndex < stateExpressions.size(); ++expressionIndex) {
+                    currentStateSatisfiesExpression[expressionIndex] = generator->satisfies(stateExpressions[expressionIndex]);
+                }
+                
+                currentBehavior = generator->expand(stateToIdCallback);
+                STORM_LOG_ASSERT(currentBehavior.getNumberOfChoices() <= 1, "Expected at most one choice in a deterministic model.");
+            }
+            
+            template class PathGenerator<double, uint32_t>;
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#ifndef STORM_MODELCHECKER_STATISTICAL_PATHGENERATOR_H_
+#define STORM_MODELCHECKER_STATISTICAL_PATHGENERATOR_H_
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/NextStateGenerator.h"
+
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace statistical_detail {
+            
+            /*!
+             * Simulates paths of a deterministic model (DTMC or CTMC) directly on the given next-state generator. Only
+             * the current state and its successors are kept in memory, so the state space is never stored.
+             */
+            template <typename ValueType, typename StateType = uint32_t>
+            class PathGenerator {
+            public:
+                typedef std::mt19937_64 RandomGenerator;
+                
+                /*!
+                 * Creates a path generator.
+                 *
+                 * @param generator The next-state generator of the model. It must be configured to build (at most) the
+                 * reward model that is to be considered.
+                 * @param stateExpressions The expressions that are to be evaluated in the states along the path.
+                 */
+                PathGenerator(std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>&& generator, std::vector<storm::expressions::Expression> const& stateExpressions);
+                
+                PathGenerator(PathGenerator const& other) = delete;
+                PathGenerator& operator=(PathGenerator const& other) = delete;
+                
+                /*!
+                 * Starts a new path in the initial state.
+                 */
+                void restart();
+                
+                /*!
+                 * Moves to a successor of the current state that is chosen randomly according to the probabilities
+                 * (or rates) of the outgoing transitions. The current state must not be absorbing.
+                 */
+                void moveToSuccessor(RandomGenerator& randomGenerator);
+                
+                /*!
+                 * Draws the time that is spent in the current state (which must not be absorbing). For discrete-time
+                 * models, this is always one.
+                 */
+                ValueType sampleSojournTime(RandomGenerator& randomGenerator) const;
+                
+                /*!
+                 * Retrieves whether the state expression with the given index holds in the current state.
+                 */
+                bool satisfies(uint_fast64_t expressionIndex) const;
+                
+                /*!
+                 * Retrieves whether the current state has no outgoing transitions. Such states are treated as if they
+                 * had a self-loop.
+                 */
+                bool isAbsorbing() const;
+                
+                /*!
+                 * Retrieves the exit rate of the current state. For discrete-time models, this is the probability mass
+                 * of the outgoing transitions.
+                 */
+                ValueType getExitRate() const;
+                
+                /*!
+                 * Retrieves the state reward and the state-action reward of the current state. If no reward model is
+                 * built, both are zero.
+                 */
+                ValueType getStateReward() const;
+                ValueType getStateActionReward() const;
+                
+                bool isDiscreteTimeModel() const;
+                
+            private:
+                /*!
+                 * Loads the given state and retrieves its outgoing transitions.
+                 */
+                void explore(storm::generator::CompressedState const& state);
+                
+                // The generator that is used to retrieve the successors of states.
+                std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+                
+                // The callback that registers the successors of the current state.
+                typename storm::generator::NextStateGenerator<ValueType, StateType>::StateToIdCallback stateToIdCallback;
+                
+                // The expressions that are evaluated in the states along the path.
+                std::vector<storm::expressions::Expression> stateExpressions;
+                
+                // The (only) initial state of the model.
+                storm::generator::CompressedState initialState;
+                
+                // The current state and its successors. The ids handed out by the callback refer to this vector.
+                storm::generator::CompressedState currentState;
+                std::vector<storm::generator::CompressedState> successors;
+                
+                // The behavior of the current state and the values of the state expressions in the current state.
+                storm::generator::StateBehavior<ValueType, StateType> currentBehavior;
+                std::vector<bool> currentStateSatisfiesExpression;
+            };
+            
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_STATISTICAL_PATHGENERATOR_H_ */
@@ -0,0 +1,402 @@
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
+
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+#include "storm/modelchecker/statistical/PathGenerator.h"
+
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Ctmc.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalSettings.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace statistical_detail {
+            
+            /*!
+             * Computes the value z such that a standard normally distributed random variable is at most z with the
+             * given probability.
+             */
+            double computeStandardNormalQuantile(double probability) {
+                STORM_LOG_ASSERT(probability > 0.5 && probability < 1.0, "Unexpected probability " << probability << ".");
+                // The quantile is found by a bisection on the cumulative distribution function.
+                double lowerBound = 0.0;
+                double upperBound = 40.0;
+                while (upperBound - lowerBound > 1e-12) {
+                    double middle = (lowerBound + upperBound) / 2.0;
+                    if (0.5 * std::erfc(-middle / std::sqrt(2.0)) < probability) {
+                        lowerBound = middle;
+                    } else {
+                        upperBound = middle;
+                    }
+                }
+                return upperBound;
+            }
+            
+            /*!
+             * Computes the number of paths for which, by the Chernoff-Hoeffding bound, the mean of (0/1-valued) path
+             * values is within the given precision of the actual probability with the given error probability.
+             */
+            uint64_t computeChernoffHoeffdingNumberOfPaths(double precision, double errorProbability) {
+                return static_cast<uint64_t>(std::ceil(std::log(2.0 / errorProbability) / (2.0 * precision * precision)));
+            }
+        }
+        
+        template<typename ModelType>
+        const uint64_t SparseStatisticalModelChecker<ModelType>::PATHS_PER_BATCH;
+        
+        template<typename ModelType>
+        typename SparseStatisticalModelChecker<ModelType>::SampleStatistics& SparseStatisticalModelChecker<ModelType>::SampleStatistics::operator+=(SampleStatistics const& other) {
+            numberOfPaths += other.numberOfPaths;
+            sum += other.sum;
+            sumOfSquares += other.sumOfSquares;
+            return *this;
+        }
+        
+        template<typename ModelType>
+        SparseStatisticalModelChecker<ModelType>::SparseStatisticalModelChecker(storm::storage::SymbolicModelDescription const& model, boost::optional<uint_fast64_t> const& seed) {
+            model.requireNoUndefinedConstants();
+            STORM_LOG_THROW(model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC || model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::CTMC, storm::exceptions::NotSupportedException, "Currently statistical model checking is only available for DTMCs and CTMCs.");
+            
+            if (model.isPrismProgram()) {
+                this->model = model.asPrismProgram().substituteConstants();
+                labelToExpressionMapping = this->model.asPrismProgram().getLabelToExpressionMapping();
+            } else {
+                this->model = model.asJaniModel().substituteConstants();
+                storm::jani::Model const& janiModel = this->model.asJaniModel();
+                for (auto const& variable : janiModel.getGlobalVariables().getBooleanVariables()) {
+                    if (variable.isTransient()) {
+                        labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable.asBooleanVariable());
+                    }
+                }
+            }
+            
+            storm::settings::modules::StatisticalSettings const& settings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+            if (seed) {
+                this->seed = seed.get();
+            } else {
+                this->seed = settings.isSeedSet() ? settings.getSeed() : std::chrono::system_clock::now().time_since_epoch().count();
+            }
+        }
+        
+        template<typename ModelType>
+        bool SparseStatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+            fragment.setProbabilityOperatorsAllowed(true).setRewardOperatorsAllowed(true);
+            fragment.setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true).setTimeBoundedUntilFormulasAllowed(true);
+            fragment.setCumulativeRewardFormulasAllowed(true);
+            fragment.setOperatorAtTopLevelRequired(true).setNestedOperatorsAllowed(false);
+            return formula.isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+        }
+        
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+            storm::logic::Formula const& pathFormula = checkTask.getFormula().getSubformula();
+            if (checkTask.isBoundSet() && pathFormula.isBoundedUntilFormula() && storm::settings::getModule<storm::settings::modules::StatisticalSettings>().getStoppingMethod() == storm::settings::modules::StatisticalSettings::StoppingMethod::Sprt) {
+                // Deciding whether the bound is met usually requires far less paths than estimating the probability.
+                storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+                PathGeneratorFactory createPathGenerator = getPathGeneratorFactory({std::cref(boundedUntilFormula.getLeftSubformula()), std::cref(boundedUntilFormula.getRightSubformula())}, boost::none);
+                bool result = testProbabilityBound(createPathGenerator, getBoundedUntilPathEvaluator(boundedUntilFormula), checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+                return std::make_unique<ExplicitQualitativeCheckResult>(storm::storage::sparse::state_type(0), result);
+            }
+            return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(checkTask);
+        }
+        
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+            storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+            PathGeneratorFactory createPathGenerator = getPathGeneratorFactory({std::cref(pathFormula.getLeftSubformula()), std::cref(pathFormula.getRightSubformula())}, boost::none);
+            ValueType result = estimateProbability(createPathGenerator, getBoundedUntilPathEvaluator(pathFormula));
+            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(storm::storage::sparse::state_type(0), result);
+        }
+        
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<ModelType>::computeCumulativeRewards(storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+            storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+            bool discreteTime = model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC;
+            STORM_LOG_THROW(discreteTime || !rewardPathFormula.isStepBounded(), storm::exceptions::NotSupportedException, "Currently step-bounded properties on CTMCs are not supported.");
+            
+            ValueType bound;
+            if (discreteTime) {
+                STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+                bound = storm::utility::convertNumber<ValueType>(rewardPathFormula.getNonStrictBound<uint64_t>());
+            } else {
+                bound = rewardPathFormula.getBound<double>();
+            }
+            
+            PathEvaluator evaluatePath = [bound] (statistical_detail::PathGenerator<ValueType, uint32_t>& path, RandomGenerator& randomGenerator) -> ValueType {
+                path.restart();
+                ValueType reward = storm::utility::zero<ValueType>();
+                ValueType time = storm::utility::zero<ValueType>();
+                while (time < bound) {
+                    // For CTMCs, the state-action rewards are earned with the rate of the state (cf. the CSL helper).
+                    ValueType rewardRate = path.getStateReward();
+                    if (path.isAbsorbing()) {
+                        return reward + rewardRate * (bound - time);
+                    }
+                    if (path.isDiscreteTimeModel()) {
+                        reward += rewardRate + path.getStateActionReward();
+                        time += storm::utility::one<ValueType>();
+                    } else {
+                        rewardRate += path.getExitRate() * path.getStateActionReward();
+                        ValueType sojournTime = path.sampleSojournTime(randomGenerator);
+                        reward += rewardRate * std::min(sojournTime, bound - time);
+                        time += sojournTime;
+                    }
+                    if (time < bound) {
+                        path.moveToSuccessor(randomGenerator);
+                    }
+                }
+                return reward;
+            };
+            
+            PathGeneratorFactory createPathGenerator = getPathGeneratorFactory({}, checkTask.isRewardModelSet() ? checkTask.getRewardModel() : std::string(""));
+            ValueType result = estimateExpectedValue(createPathGenerator, evaluatePath);
+            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(storm::storage::sparse::state_type(0), result);
+        }
+        
+        template<typename ModelType>
+        typename SparseStatisticalModelChecker<ModelType>::PathGeneratorFactory SparseStatisticalModelChecker<ModelType>::getPathGeneratorFactory(std::vector<std::reference_wrapper<storm::logic::Formula const>> const& stateFormulas, boost::optional<std::string> const& rewardModelName) const {
+            std::vector<storm::expressions::Expression> stateExpressions;
+            for (auto const& stateFormula : stateFormulas) {
+                stateExpressions.push_back(stateFormula.get().toExpression(model.getManager(), labelToExpressionMapping));
+            }
+            
+            storm::generator::NextStateGeneratorOptions options;
+            if (rewardModelName) {
+                options.addRewardModel(rewardModelName.get());
+            }
+            
+            return [this, stateExpressions, options] () {
+                std::unique_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+                if (model.isPrismProgram()) {
+                    generator = std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options);
+                } else {
+                    generator = std::make_unique<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.asJaniModel(), options);
+                }
+                return std::make_unique<statistical_detail::PathGenerator<ValueType, uint32_t>>(std::move(generator), stateExpressions);
+            };
+        }
+        
+        template<typename ModelType>
+        typename SparseStatisticalModelChecker<ModelType>::PathEvaluator SparseStatisticalModelChecker<ModelType>::getBoundedUntilPathEvaluator(storm::logic::BoundedUntilFormula const& pathFormula) const {
+            STORM_LOG_THROW(!pathFormula.isMultiDimensional(), storm::exceptions::NotSupportedException, "Multi-dimensional bounded until formulas are not supported by the statistical model checking engine.");
+            STORM_LOG_THROW(!pathFormula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException, "Reward-bounded until formulas are not supported by the statistical model checking engine.");
+            STORM_LOG_THROW(pathFormula.hasUpperBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have an upper bound.");
+            
+            // For step bounds, each state is occupied for exactly one time unit.
+            bool countSteps = pathFormula.getTimeBoundReference().isStepBound() || model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC;
+            ValueType lowerBound = storm::utility::zero<ValueType>();
+            ValueType upperBound;
+            if (countSteps) {
+                STORM_LOG_THROW(pathFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have discrete upper time bound.");
+                upperBound = storm::utility::convertNumber<ValueType>(pathFormula.getNonStrictUpperBound<uint64_t>());
+                if (pathFormula.hasLowerBound()) {
+                    STORM_LOG_THROW(pathFormula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have discrete lower time bound.");
+                    lowerBound = storm::utility::convertNumber<ValueType>(pathFormula.getLowerBound<uint64_t>() + (pathFormula.isLowerBoundStrict() ? 1 : 0));
+                }
+            } else {
+                upperBound = pathFormula.getUpperBound<double>();
+                if (pathFormula.hasLowerBound()) {
+                    lowerBound = pathFormula.getLowerBound<double>();
+                }
+            }
+            
+            return [countSteps, lowerBound, upperBound] (statistical_detail::PathGenerator<ValueType, uint32_t>& path, RandomGenerator& randomGenerator) -> ValueType {
+                path.restart();
+                ValueType time = storm::utility::zero<ValueType>();
+                while (true) {
+                    ValueType sojournTime;
+                    if (path.isAbsorbing()) {
+                        sojournTime = storm::utility::infinity<ValueType>();
+                    } else if (countSteps) {
+                        sojournTime = storm::utility::one<ValueType>();
+                    } else {
+                        sojournTime = path.sampleSojournTime(randomGenerator);
+                    }
+                    
+                    // The current state is occupied during [time, time + sojournTime). If it satisfies the right
+                    // subformula during the time interval of the formula, the left subformula only has to hold in it if
+                    // the time interval is entered while staying in the state.
+                    if (path.satisfies(1) && time <= upperBound && time + sojournTime > lowerBound && (time >= lowerBound || path.satisfies(0))) {
+                        return storm::utility::one<ValueType>();
+                    }
+                    if (!path.satisfies(0) || time + sojournTime > upperBound) {
+                        return storm::utility::zero<ValueType>();
+                    }
+                    time += sojournTime;
+                    path.moveToSuccessor(randomGenerator);
+                }
+            };
+        }
+        
+        template<typename ModelType>
+        typename SparseStatisticalModelChecker<ModelType>::SampleStatistics SparseStatisticalModelChecker<ModelType>::samplePaths(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath, uint64_t firstBatch, uint64_t numberOfBatches, uint64_t numberOfPaths) const {
+            std::vector<SampleStatistics> batchStatistics(numberOfBatches);
+            
+            // Path generators are created one at a time, as they access the (shared) model description.
+            std::mutex mutex;
+            std::vector<std::unique_ptr<statistical_detail::PathGenerator<ValueType, uint32_t>>> idleGenerators;
+            storm::utility::parallel::parallelFor(0, numberOfBatches, 1, [&] (uint64_t begin, uint64_t end) {
+                std::unique_ptr<statistical_detail::PathGenerator<ValueType, uint32_t>> path;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (idleGenerators.empty()) {
+                        path = createPathGenerator();
+                    } else {
+                        path = std::move(idleGenerators.back());
+                        idleGenerators.pop_back();
+                    }
+                }
+                
+                for (uint64_t batch = begin; batch < end; ++batch) {
+                    uint64_t batchIndex = firstBatch + batch;
+                    std::seed_seq seedSequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(batchIndex), static_cast<uint32_t>(batchIndex >> 32)};
+                    RandomGenerator randomGenerator(seedSequence);
+                    
+                    SampleStatistics& statistics = batchStatistics[batch];
+                    uint64_t numberOfPathsInBatch = std::min(PATHS_PER_BATCH, numberOfPaths - batchIndex * PATHS_PER_BATCH);
+                    for (uint64_t pathIndex = 0; pathIndex < numberOfPathsInBatch; ++pathIndex) {
+                        ValueType value = evaluatePath(*path, randomGenerator);
+                        ++statistics.numberOfPaths;
+                        statistics.sum += value;
+                        statistics.sumOfSquares += value * value;
+                    }
+                }
+                
+                std::lock_guard<std::mutex> lock(mutex);
+                idleGenerators.push_back(std::move(path));
+            });
+            
+            // Sum up the statistics in a fixed order, so the result does not depend on the scheduling of the threads.
+            SampleStatistics result;
+            for (auto const& statistics : batchStatistics) {
+                result += statistics;
+            }
+            return result;
+        }
+        
+        template<typename ModelType>
+        typename SparseStatisticalModelChecker<ModelType>::ValueType SparseStatisticalModelChecker<ModelType>::estimateProbability(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath) const {
+            storm::settings::modules::StatisticalSettings const& settings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+            double precision = settings.getPrecision();
+            
+            // By the Chernoff-Hoeffding bound, the mean of this many paths is precise with the requested probability.
+            uint64_t numberOfPaths = statistical_detail::computeChernoffHoeffdingNumberOfPaths(precision, settings.getErrorProbability());
+            uint64_t numberOfBatches = (numberOfPaths + PATHS_PER_BATCH - 1) / PATHS_PER_BATCH;
+            STORM_LOG_INFO("Sampling " << numberOfPaths << " paths.");
+            
+            SampleStatistics statistics = samplePaths(createPathGenerator, evaluatePath, 0, numberOfBatches, numberOfPaths);
+            return statistics.sum / storm::utility::convertNumber<ValueType>(statistics.numberOfPaths);
+        }
+        
+        template<typename ModelType>
+        typename SparseStatisticalModelChecker<ModelType>::ValueType SparseStatisticalModelChecker<ModelType>::estimateExpectedValue(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath) const {
+            // As the path values are not bounded a priori, the Chernoff-Hoeffding bound does not apply. Instead, paths are
+            // sampled until the confidence interval given by the central limit theorem is small enough (Chow-Robbins).
+            storm::settings::modules::StatisticalSettings const& settings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+            ValueType precision = settings.getPrecision();
+            ValueType quantile = statistical_detail::computeStandardNormalQuantile(1.0 - settings.getErrorProbability() / 2.0);
+            uint64_t batchesPerRound = storm::utility::parallel::getNumberOfThreads();
+            
+            SampleStatistics statistics;
+            uint64_t numberOfBatches = 0;
+            while (true) {
+                statistics += samplePaths(createPathGenerator, evaluatePath, numberOfBatches, batchesPerRound, (numberOfBatches + batchesPerRound) * PATHS_PER_BATCH);
+                numberOfBatches += batchesPerRound;
+                
+                ValueType numberOfPaths = storm::utility::convertNumber<ValueType>(statistics.numberOfPaths);
+                ValueType mean = statistics.sum / numberOfPaths;
+                ValueType variance = std::max(storm::utility::zero<ValueType>(), (statistics.sumOfSquares - numberOfPaths * mean * mean) / (numberOfPaths - storm::utility::one<ValueType>()));
+                ValueType halfWidth = quantile * std::sqrt(variance / numberOfPaths);
+                STORM_LOG_DEBUG("Estimate after " << statistics.numberOfPaths << " paths is " << mean << " +- " << halfWidth << ".");
+                if (halfWidth <= precision) {
+                    STORM_LOG_INFO("Sampled " << statistics.numberOfPaths << " paths.");
+                    return mean;
+                }
+            }
+        }
+        
+        template<typename ModelType>
+        bool SparseStatisticalModelChecker<ModelType>::testProbabilityBound(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath, storm::logic::ComparisonType const& comparisonType, ValueType const& threshold) const {
+            storm::settings::modules::StatisticalSettings const& settings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+            ValueType precision = settings.getPrecision();
+            ValueType error = settings.getErrorProbability();
+            
+            // We test the hypothesis p >= threshold + precision against p <= threshold - precision, where both kinds of
+            // errors have the requested probability. Within the indifference region, any answer is acceptable.
+            ValueType upperProbability = std::min(threshold + precision, storm::utility::one<ValueType>());
+            ValueType lowerProbability = std::max(threshold - precision, storm::utility::zero<ValueType>());
+            ValueType acceptLowerThreshold = std::log((storm::utility::one<ValueType>() - error) / error);
+            ValueType acceptUpperThreshold = std::log(error / (storm::utility::one<ValueType>() - error));
+            
+            // If the indifference region covers all probabilities, observing both a success and a failure makes the
+            // likelihood ratio undefined (as the infinite logarithms of both terms cancel out).
+            STORM_LOG_THROW(!storm::utility::isZero(lowerProbability) || !storm::utility::isOne(upperProbability), storm::exceptions::InvalidSettingsException, "The precision " << precision << " is too large to test the threshold " << threshold << ", as the indifference region covers all probabilities.");
+            
+            // The test stops at the latest when the number of paths given by the Chernoff-Hoeffding bound is reached. The
+            // estimate obtained from these paths is then decided against the threshold, which is correct with the
+            // requested probability as well.
+            uint64_t maximalNumberOfPaths = statistical_detail::computeChernoffHoeffdingNumberOfPaths(precision, error);
+            uint64_t maximalNumberOfBatches = (maximalNumberOfPaths + PATHS_PER_BATCH - 1) / PATHS_PER_BATCH;
+            
+            // The checks are performed after each round, i.e., the paths of one round are sampled concurrently.
+            uint64_t batchesPerRound = storm::utility::parallel::getNumberOfThreads();
+            SampleStatistics statistics;
+            uint64_t numberOfBatches = 0;
+            while (true) {
+                uint64_t batchesInRound = std::min(batchesPerRound, maximalNumberOfBatches - numberOfBatches);
+                statistics += samplePaths(createPathGenerator, evaluatePath, numberOfBatches, batchesInRound, maximalNumberOfPaths);
+                numberOfBatches += batchesInRound;
+                
+                // Compute the logarithm of the likelihood ratio. Terms for which there are no observations are skipped,
+                // as they might involve infinite logarithms.
+                ValueType successes = statistics.sum;
+                ValueType failures = storm::utility::convertNumber<ValueType>(statistics.numberOfPaths) - successes;
+                ValueType logLikelihoodRatio = storm::utility::zero<ValueType>();
+                if (successes > storm::utility::zero<ValueType>()) {
+                    logLikelihoodRatio += successes * std::log(lowerProbability / upperProbability);
+                }
+                if (failures > storm::utility::zero<ValueType>()) {
+                    logLikelihoodRatio += failures * std::log((storm::utility::one<ValueType>() - lowerProbability) / (storm::utility::one<ValueType>() - upperProbability));
+                }
+                STORM_LOG_DEBUG("Log-likelihood ratio after " << statistics.numberOfPaths << " paths is " << logLikelihoodRatio << ".");
+                
+                if (logLikelihoodRatio >= acceptLowerThreshold || logLikelihoodRatio <= acceptUpperThreshold) {
+                    STORM_LOG_INFO("Sampled " << statistics.numberOfPaths << " paths.");
+                    bool probabilityIsAboveThreshold = logLikelihoodRatio <= acceptUpperThreshold;
+                    return storm::logic::isLowerBound(comparisonType) ? probabilityIsAboveThreshold : !probabilityIsAboveThreshold;
+                }
+                if (numberOfBatches == maximalNumberOfBatches) {
+                    STORM_LOG_INFO("Sampled " << statistics.numberOfPaths << " paths without reaching a decision, deciding on the estimate.");
+                    bool probabilityIsAboveThreshold = successes / storm::utility::convertNumber<ValueType>(statistics.numberOfPaths) >= threshold;
+                    return storm::logic::isLowerBound(comparisonType) ? probabilityIsAboveThreshold : !probabilityIsAboveThreshold;
+                }
+            }
+        }
+        
+        template class SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+        template class SparseStatisticalModelChecker<storm::models::sparse::Ctmc<double>>;
+    }
+}
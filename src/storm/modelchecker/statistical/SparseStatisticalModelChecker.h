@@ -0,0 +1,124 @@
+#ifndef STORM_MODELCHECKER_STATISTICAL_SPARSESTATISTICALMODELCHECKER_H_
+#define STORM_MODELCHECKER_STATISTICAL_SPARSESTATISTICALMODELCHECKER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+
+#include "storm/storage/SymbolicModelDescription.h"
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace statistical_detail {
+            template <typename ValueType, typename StateType> class PathGenerator;
+        }
+        
+        /*!
+         * A model checker that estimates the values of properties by simulating paths of the model. The paths are
+         * generated directly from the symbolic model description, so the model is never built. The number of sampled
+         * paths is chosen such that the result is correct with high probability (see StatisticalSettings).
+         *
+         * Currently, only DTMCs and CTMCs are supported and only the values of the initial state are computed.
+         */
+        template<typename ModelType>
+        class SparseStatisticalModelChecker : public AbstractModelChecker<ModelType> {
+        public:
+            typedef typename ModelType::ValueType ValueType;
+            typedef std::mt19937_64 RandomGenerator;
+            
+            /*!
+             * Creates a model checker for the given model description.
+             *
+             * @param model The model description from which paths are generated.
+             * @param seed If given, the random number generators are initialized with this seed instead of the one set
+             * in the settings (or a seed derived from the current time, if none is set there).
+             */
+            SparseStatisticalModelChecker(storm::storage::SymbolicModelDescription const& model, boost::optional<uint_fast64_t> const& seed = boost::none);
+            
+            virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+            
+            virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeCumulativeRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+        
+        private:
+            // The number of paths that are sampled by one thread in a row.
+            static const uint64_t PATHS_PER_BATCH = 1000;
+            
+            // Sums over the values of a number of sampled paths.
+            struct SampleStatistics {
+                SampleStatistics& operator+=(SampleStatistics const& other);
+                
+                uint64_t numberOfPaths = 0;
+                ValueType sum = storm::utility::zero<ValueType>();
+                ValueType sumOfSquares = storm::utility::zero<ValueType>();
+            };
+            
+            // Creates a new path generator for the model.
+            typedef std::function<std::unique_ptr<statistical_detail::PathGenerator<ValueType, uint32_t>>()> PathGeneratorFactory;
+            
+            // Samples a path (starting from the initial state) and returns its value.
+            typedef std::function<ValueType (statistical_detail::PathGenerator<ValueType, uint32_t>&, RandomGenerator&)> PathEvaluator;
+            
+            /*!
+             * Retrieves the factory for path generators that evaluate the given state formulas and (optionally) provide
+             * the rewards of the given reward model.
+             */
+            PathGeneratorFactory getPathGeneratorFactory(std::vector<std::reference_wrapper<storm::logic::Formula const>> const& stateFormulas, boost::optional<std::string> const& rewardModelName) const;
+            
+            /*!
+             * Retrieves a function that samples a path and returns whether it satisfies the given bounded until formula.
+             * The first state expression of the path generator has to correspond to the left subformula and the second
+             * one to the right subformula.
+             */
+            PathEvaluator getBoundedUntilPathEvaluator(storm::logic::BoundedUntilFormula const& pathFormula) const;
+            
+            /*!
+             * Samples the given batches of paths using all available threads. The result does not depend on the number
+             * of threads, as the random number generator of each batch is only initialized with the seed and the index
+             * of the batch.
+             *
+             * @param firstBatch The index of the first batch to sample.
+             * @param numberOfBatches The number of batches to sample.
+             * @param numberOfPaths The total number of paths to sample, which may limit the size of the last batch.
+             */
+            SampleStatistics samplePaths(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath, uint64_t firstBatch, uint64_t numberOfBatches, uint64_t numberOfPaths) const;
+            
+            /*!
+             * Estimates the probability that a path satisfies a property. The number of paths is given by the
+             * Chernoff-Hoeffding bound.
+             */
+            ValueType estimateProbability(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath) const;
+            
+            /*!
+             * Estimates the expected value of (unbounded) path values. Paths are sampled until the confidence interval
+             * of the normal approximation is sufficiently small.
+             */
+            ValueType estimateExpectedValue(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath) const;
+            
+            /*!
+             * Decides whether the probability that a path satisfies a property meets the given bound using Wald's
+             * sequential probability ratio test.
+             */
+            bool testProbabilityBound(PathGeneratorFactory const& createPathGenerator, PathEvaluator const& evaluatePath, storm::logic::ComparisonType const& comparisonType, ValueType const& threshold) const;
+            
+            // The model description from which paths are generated.
+            storm::storage::SymbolicModelDescription model;
+            
+            // A mapping from the labels of the model to the expressions that define them.
+            std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+            
+            // The seed used for the random number generators.
+            uint_fast64_t seed;
+        };
+    }
+}
+
+#endif /* STORM_MODELCHECKER_STATISTICAL_SPARSESTATISTICALMODELCHECKER_H_ */
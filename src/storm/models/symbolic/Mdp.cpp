@@ -29,6 +29,24 @@ namespace storm {
             : NondeterministicModel<Type, ValueType>(storm::models::ModelType::Mdp, manager, reachableStates, initialStates, deadlockStates, transitionMatrix, rowVariables, rowExpressionAdapter, columnVariables, columnExpressionAdapter, rowColumnMetaVariablePairs, nondeterminismVariables, labelToExpressionMap, rewardModels) {
                 // Intentionally left empty.
             }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            Mdp<Type, ValueType>::Mdp(std::shared_ptr<storm::dd::DdManager<Type>> manager,
+                                      storm::dd::Bdd<Type> reachableStates,
+                                      storm::dd::Bdd<Type> initialStates,
+                                      storm::dd::Bdd<Type> deadlockStates,
+                                      storm::dd::Add<Type, ValueType> transitionMatrix,
+                                      std::set<storm::expressions::Variable> const& rowVariables,
+                                      std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> rowExpressionAdapter,
+                                      std::set<storm::expressions::Variable> const& columnVariables,
+                                      std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> columnExpressionAdapter,
+                                      std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                                      std::set<storm::expressions::Variable> const& nondeterminismVariables,
+                                      std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap,
+                                      std::unordered_map<std::string, RewardModelType> const& rewardModels)
+            : NondeterministicModel<Type, ValueType>(storm::models::ModelType::Mdp, manager, reachableStates, initialStates, deadlockStates, transitionMatrix, rowVariables, rowExpressionAdapter, columnVariables, columnExpressionAdapter, rowColumnMetaVariablePairs, nondeterminismVariables, labelToBddMap, rewardModels) {
+                // Intentionally left empty.
+            }
             
             // Explicitly instantiate the template class.
             template class Mdp<storm::dd::DdType::CUDD, double>;
@@ -10,6 +10,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/ExplicitConversionCache.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -35,7 +36,25 @@ namespace storm {
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
                                           std::map<std::string, storm::expressions::Expression> labelToExpressionMap,
                                           std::unordered_map<std::string, RewardModelType> const& rewardModels)
-            : ModelBase(modelType), manager(manager), reachableStates(reachableStates), initialStates(initialStates), deadlockStates(deadlockStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), columnExpressionAdapter(columnExpressionAdapter), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(labelToExpressionMap), rewardModels(rewardModels) {
+            : ModelBase(modelType), manager(manager), reachableStates(reachableStates), initialStates(initialStates), deadlockStates(deadlockStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), columnExpressionAdapter(columnExpressionAdapter), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(labelToExpressionMap), rewardModels(rewardModels), explicitConversionCache(std::make_shared<storm::dd::ExplicitConversionCache<Type, ValueType>>()) {
+                // Intentionally left empty.
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            Model<Type, ValueType>::Model(storm::models::ModelType const& modelType,
+                                          std::shared_ptr<storm::dd::DdManager<Type>> manager,
+                                          storm::dd::Bdd<Type> reachableStates,
+                                          storm::dd::Bdd<Type> initialStates,
+                                          storm::dd::Bdd<Type> deadlockStates,
+                                          storm::dd::Add<Type, ValueType> transitionMatrix,
+                                          std::set<storm::expressions::Variable> const& rowVariables,
+                                          std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> rowExpressionAdapter,
+                                          std::set<storm::expressions::Variable> const& columnVariables,
+                                          std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> columnExpressionAdapter,
+                                          std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                                          std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap,
+                                          std::unordered_map<std::string, RewardModelType> const& rewardModels)
+            : ModelBase(modelType), manager(manager), reachableStates(reachableStates), initialStates(initialStates), deadlockStates(deadlockStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), columnExpressionAdapter(columnExpressionAdapter), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(), labelToBddMap(labelToBddMap), rewardModels(rewardModels), explicitConversionCache(std::make_shared<storm::dd::ExplicitConversionCache<Type, ValueType>>()) {
                 // Intentionally left empty.
             }
             
@@ -81,6 +100,17 @@ namespace storm {
             
             template<storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> Model<Type, ValueType>::getStates(std::string const& label) const {
+                auto bddIt = labelToBddMap.find(label);
+                if (bddIt != labelToBddMap.end()) {
+                    return bddIt->second;
+                }
+                if (labelToExpressionMap.find(label) == labelToExpressionMap.end()) {
+                    if (label == "init") {
+                        return this->getInitialStates();
+                    } else if (label == "deadlock") {
+                        return this->getDeadlockStates();
+                    }
+                }
                 STORM_LOG_THROW(labelToExpressionMap.find(label) != labelToExpressionMap.end(), storm::exceptions::IllegalArgumentException, "The label " << label << " is invalid for the labeling of the model.");
                 return this->getStates(labelToExpressionMap.at(label));
             }
@@ -92,14 +122,18 @@ namespace storm {
                 } else if (expression.isFalse()) {
                     return manager->getBddZero();
                 }
-                STORM_LOG_THROW(rowExpressionAdapter != nullptr, storm::exceptions::InvalidOperationException, "Cannot create BDD for expression without expression adapter.");
+                if (rowExpressionAdapter == nullptr) {
+                    auto bddIt = labelToBddMap.find(expression.toString());
+                    STORM_LOG_THROW(bddIt != labelToBddMap.end(), storm::exceptions::InvalidOperationException, "Cannot create BDD for expression without expression adapter.");
+                    return bddIt->second;
+                }
                 return rowExpressionAdapter->translateExpression(expression).toBdd() && this->reachableStates;
             }
             
             template<storm::dd::DdType Type, typename ValueType>
             bool Model<Type, ValueType>::hasLabel(std::string const& label) const {
                 auto labelIt = labelToExpressionMap.find(label);
-                if (labelIt != labelToExpressionMap.end()) {
+                if (labelIt != labelToExpressionMap.end() || labelToBddMap.find(label) != labelToBddMap.end()) {
                     return true;
                 } else {
                     return label == "init" || label == "deadlock";
@@ -136,6 +170,11 @@ namespace storm {
                 return rowColumnMetaVariablePairs;
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::ExplicitConversionCache<Type, ValueType>& Model<Type, ValueType>::getExplicitConversionCache() const {
+                return *explicitConversionCache;
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             void Model<Type, ValueType>::setTransitionMatrix(storm::dd::Add<Type, ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
@@ -146,6 +185,11 @@ namespace storm {
                 return labelToExpressionMap;
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            std::map<std::string, storm::dd::Bdd<Type>> const& Model<Type, ValueType>::getLabelToBddMap() const {
+                return labelToBddMap;
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             storm::dd::Add<Type, ValueType> Model<Type, ValueType>::getRowColumnIdentity() const {
                 return storm::utility::dd::getRowColumnDiagonal<Type, ValueType>(this->getManager(), this->getRowColumnMetaVariablePairs());
@@ -212,6 +256,9 @@ namespace storm {
                 for(auto const& entry : labelToExpressionMap) {
                     labels.push_back(entry.first);
                 }
+                for (auto const& entry : labelToBddMap) {
+                    labels.push_back(entry.first);
+                }
                 return labels;
             }
             
@@ -228,10 +275,13 @@ namespace storm {
                 this->printRewardModelsInformationToStream(out);
                 this->printDdVariableInformationToStream(out);
                 out << std::endl;
-                out << "Labels: \t" << this->labelToExpressionMap.size() << std::endl;
+                out << "Labels: \t" << this->labelToExpressionMap.size() + this->labelToBddMap.size() << std::endl;
                 for (auto const& label : labelToExpressionMap) {
                     out << "   * " << label.first << std::endl;
                 }
+                for (auto const& label : labelToBddMap) {
+                    out << "   * " << label.first << std::endl;
+                }
                 out << "-------------------------------------------------------------- " << std::endl;
             }
             
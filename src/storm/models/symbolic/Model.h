@@ -30,6 +30,9 @@ namespace storm {
         template<storm::dd::DdType Type>
         class DdManager;
         
+        template<storm::dd::DdType Type, typename ValueType>
+        class ExplicitConversionCache;
+        
     }
     
     namespace adapters {
@@ -95,6 +98,40 @@ namespace storm {
                       std::map<std::string, storm::expressions::Expression> labelToExpressionMap = std::map<std::string, storm::expressions::Expression>(),
                       std::unordered_map<std::string, RewardModelType> const& rewardModels = std::unordered_map<std::string, RewardModelType>());
                 
+                /*!
+                 * Constructs a model from the given data. Instead of expressions, the labels are given as the sets of
+                 * states carrying them.
+                 *
+                 * @param modelType The type of the model.
+                 * @param manager The manager responsible for the decision diagrams.
+                 * @param reachableStates A DD representing the reachable states.
+                 * @param initialStates A DD representing the initial states of the model.
+                 * @param deadlockStates A DD representing the deadlock states of the model.
+                 * @param transitionMatrix The matrix representing the transitions in the model.
+                 * @param rowVariables The set of row meta variables used in the DDs.
+                 * @param rowExpressionAdapter An object that can be used to translate expressions in terms of the row
+                 * meta variables.
+                 * @param columVariables The set of column meta variables used in the DDs.
+                 * @param columnExpressionAdapter An object that can be used to translate expressions in terms of the
+                 * column meta variables.
+                 * @param rowColumnMetaVariablePairs All pairs of row/column meta variables.
+                 * @param labelToBddMap A mapping from label names to the states carrying them.
+                 * @param rewardModels The reward models associated with the model.
+                 */
+                Model(storm::models::ModelType const& modelType,
+                      std::shared_ptr<storm::dd::DdManager<Type>> manager,
+                      storm::dd::Bdd<Type> reachableStates,
+                      storm::dd::Bdd<Type> initialStates,
+                      storm::dd::Bdd<Type> deadlockStates,
+                      storm::dd::Add<Type, ValueType> transitionMatrix,
+                      std::set<storm::expressions::Variable> const& rowVariables,
+                      std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> rowExpressionAdapter,
+                      std::set<storm::expressions::Variable> const& columnVariables,
+                      std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> columnExpressionAdapter,
+                      std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                      std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap,
+                      std::unordered_map<std::string, RewardModelType> const& rewardModels = std::unordered_map<std::string, RewardModelType>());
+                
                 virtual uint_fast64_t getNumberOfStates() const override;
                 
                 virtual uint_fast64_t getNumberOfTransitions() const override;
@@ -149,6 +186,8 @@ namespace storm {
                 
                 /*!
                  * Returns the set of states labeled satisfying the given expression (that must be of boolean type).
+                 * If the model has no expression adapter, this is only possible if the states satisfying the
+                 * expression are stored as a label named like the expression.
                  *
                  * @param expression The expression that needs to hold in the states.
                  * @return The set of states satisfying the given expression.
@@ -206,6 +245,14 @@ namespace storm {
                  */
                 std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& getRowColumnMetaVariablePairs() const;
                 
+                /*!
+                 * Retrieves the cache for translations of the DDs of this model to explicit matrices. It is shared by
+                 * all copies of the model.
+                 *
+                 * @return The cache.
+                 */
+                storm::dd::ExplicitConversionCache<Type, ValueType>& getExplicitConversionCache() const;
+                
                 /*!
                  * Retrieves an ADD that represents the diagonal of the transition matrix.
                  *
@@ -290,6 +337,13 @@ namespace storm {
                  */
                 std::map<std::string, storm::expressions::Expression> const& getLabelToExpressionMap() const;
                 
+                /*!
+                 * Retrieves the mapping of labels to the states carrying them (for labels not defined by expressions).
+                 *
+                 * @returns The mapping of labels to the states carrying them.
+                 */
+                std::map<std::string, storm::dd::Bdd<Type>> const& getLabelToBddMap() const;
+                
                 /*!
                  * Prints the information header (number of states and transitions) of the model to the specified stream.
                  *
@@ -354,11 +408,18 @@ namespace storm {
                 // A mapping from labels to expressions defining them.
                 std::map<std::string, storm::expressions::Expression> labelToExpressionMap;
                 
+                // A mapping from labels to the states carrying them. This is used for labels that are not defined by
+                // expressions, for example in quotient models.
+                std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap;
+                
                 // The reward models associated with the model.
                 std::unordered_map<std::string, RewardModelType> rewardModels;
                 
                 // The parameters. Only meaningful for models over rational functions.
                 std::set<storm::RationalFunctionVariable> parameters;
+                
+                // A cache for translations of the DDs of the model to explicit matrices.
+                std::shared_ptr<storm::dd::ExplicitConversionCache<Type, ValueType>> explicitConversionCache;
             };
             
         } // namespace symbolic
@@ -33,6 +33,27 @@ namespace storm {
                 // Prepare the mask of illegal nondeterministic choices.
                 illegalMask = !(transitionMatrix.notZero().existsAbstract(this->getColumnVariables())) && reachableStates;
             }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            NondeterministicModel<Type, ValueType>::NondeterministicModel(storm::models::ModelType const& modelType,
+                                                                          std::shared_ptr<storm::dd::DdManager<Type>> manager,
+                                                                          storm::dd::Bdd<Type> reachableStates,
+                                                                          storm::dd::Bdd<Type> initialStates,
+                                                                          storm::dd::Bdd<Type> deadlockStates,
+                                                                          storm::dd::Add<Type, ValueType> transitionMatrix,
+                                                                          std::set<storm::expressions::Variable> const& rowVariables,
+                                                                          std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> rowExpressionAdapter,
+                                                                          std::set<storm::expressions::Variable> const& columnVariables,
+                                                                          std::shared_ptr<storm::adapters::AddExpressionAdapter<Type, ValueType>> columnExpressionAdapter,
+                                                                          std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                                                                          std::set<storm::expressions::Variable> const& nondeterminismVariables,
+                                                                          std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap,
+                                                                          std::unordered_map<std::string, RewardModelType> const& rewardModels)
+            : Model<Type, ValueType>(modelType, manager, reachableStates, initialStates, deadlockStates, transitionMatrix, rowVariables, rowExpressionAdapter, columnVariables, columnExpressionAdapter, rowColumnMetaVariablePairs, labelToBddMap, rewardModels), nondeterminismVariables(nondeterminismVariables) {
+                
+                // Prepare the mask of illegal nondeterministic choices.
+                illegalMask = !(transitionMatrix.notZero().existsAbstract(this->getColumnVariables())) && reachableStates;
+            }
             
             template<storm::dd::DdType Type, typename ValueType>
             uint_fast64_t NondeterministicModel<Type, ValueType>::getNumberOfChoices() const {
@@ -0,0 +1,201 @@
+#include "storm/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "storm/parser/MappedFile.h"
+#include "storm/storage/sparse/ModelComponents.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+#include "storm/utility/BinaryEncodingExporter.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            /*!
+             * Reads the sections of a binary model file one after another.
+             */
+            class SectionReader {
+            public:
+                SectionReader(MappedFile const& file, std::string const& filename) : position(file.getData()), end(file.getDataEnd()), filename(filename) {
+                    // Intentionally left empty.
+                }
+
+                uint64_t readUint64() {
+                    uint64_t result;
+                    copyTo(&result, sizeof(uint64_t));
+                    return result;
+                }
+
+                template<typename T>
+                void readArray(std::vector<T>& target, uint64_t count) {
+                    STORM_LOG_THROW(count <= static_cast<uint64_t>(end - position) / sizeof(T), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Unexpected end of file.");
+                    target.resize(count);
+                    if (count > 0) {
+                        copyTo(target.data(), count * sizeof(T));
+                    }
+                }
+
+                template<typename T>
+                std::vector<T> readVector() {
+                    std::vector<T> result;
+                    readArray(result, readUint64());
+                    return result;
+                }
+
+                std::string readString() {
+                    uint64_t length = readUint64();
+                    std::vector<uint64_t> words;
+                    readArray(words, (length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+                    return std::string(reinterpret_cast<char const*>(words.data()), length);
+                }
+
+                storm::storage::BitVector readBitVector() {
+                    uint64_t size = readUint64();
+                    std::vector<uint64_t> words;
+                    readArray(words, (size + 63) / 64);
+                    storm::storage::BitVector result(size);
+                    for (uint64_t word = 0; word < words.size(); ++word) {
+                        uint64_t index = word * 64;
+                        result.setFromInt(index, std::min<uint64_t>(64, size - index), words[word]);
+                    }
+                    return result;
+                }
+
+                template<typename LabelingType>
+                LabelingType readLabeling(uint64_t itemCount) {
+                    LabelingType result(itemCount);
+                    uint64_t labelCount = readUint64();
+                    for (uint64_t label = 0; label < labelCount; ++label) {
+                        std::string name = readString();
+                        storm::storage::BitVector items = readBitVector();
+                        STORM_LOG_THROW(items.size() == itemCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Labeling of '" << name << "' has unexpected size.");
+                        result.addLabel(name, std::move(items));
+                    }
+                    return result;
+                }
+
+                template<typename ValueType>
+                storm::storage::SparseMatrix<ValueType> readMatrix() {
+                    typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+                    typedef storm::storage::MatrixEntry<index_type, ValueType> entry_type;
+                    static_assert(sizeof(entry_type) == sizeof(index_type) + sizeof(ValueType) && std::is_standard_layout<entry_type>::value, "Matrix entries cannot be read as a raw array.");
+
+                    uint64_t rowCount = readUint64();
+                    uint64_t columnCount = readUint64();
+                    uint64_t entryCount = readUint64();
+
+                    STORM_LOG_THROW(rowCount < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Invalid row count " << rowCount << ".");
+                    std::vector<index_type> rowIndications;
+                    readArray(rowIndications, rowCount + 1);
+                    STORM_LOG_THROW(rowIndications.front() == 0 && rowIndications.back() == entryCount && std::is_sorted(rowIndications.begin(), rowIndications.end()), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row indications.");
+                    std::vector<entry_type> columnsAndValues;
+                    readArray(columnsAndValues, entryCount);
+                    for (auto const& entry : columnsAndValues) {
+                        STORM_LOG_THROW(entry.getColumn() < columnCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Column index " << entry.getColumn() << " exceeds the column count " << columnCount << ".");
+                    }
+
+                    boost::optional<std::vector<index_type>> rowGroupIndices;
+                    if (readUint64() != 0) {
+                        rowGroupIndices = readVector<index_type>();
+                        std::vector<index_type> const& groups = rowGroupIndices.get();
+                        STORM_LOG_THROW(!groups.empty() && groups.front() == 0 && groups.back() == rowCount && std::is_sorted(groups.begin(), groups.end()), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row groups.");
+                    }
+                    return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+                }
+
+            private:
+                void copyTo(void* target, uint64_t bytes) {
+                    STORM_LOG_THROW(bytes <= static_cast<uint64_t>(end - position), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Unexpected end of file.");
+                    std::memcpy(target, position, bytes);
+                    position += bytes;
+                }
+
+                char const* position;
+                char const* end;
+                std::string const& filename;
+            };
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+
+            // Map file
+            STORM_LOG_INFO("Reading from file " << filename);
+            MappedFile file(filename.c_str());
+            SectionReader reader(file, filename);
+
+            // Parse header
+            STORM_LOG_THROW(file.getDataSize() >= storm::exporter::binary::magicLength && std::memcmp(file.getData(), storm::exporter::binary::magic, storm::exporter::binary::magicLength) == 0, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Expected header information.");
+            std::vector<char> magic;
+            reader.readArray(magic, storm::exporter::binary::magicLength);
+            STORM_LOG_THROW(reader.readUint64() == storm::exporter::binary::byteOrderMark, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": The file was written on a machine with a different byte order.");
+            uint64_t version = reader.readUint64();
+            STORM_LOG_THROW(version == storm::exporter::binary::version, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Unsupported version " << version << ".");
+            STORM_LOG_THROW(reader.readUint64() == sizeof(ValueType), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": The values in the file do not match the requested value type.");
+            storm::models::ModelType type = storm::models::getModelType(reader.readString());
+            STORM_LOG_TRACE("Model type: " << type);
+            STORM_LOG_THROW(type != storm::models::ModelType::S2pg, storm::exceptions::NotSupportedException, "Stochastic Two Player Games in the binary format are not supported.");
+
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(reader.readMatrix<ValueType>());
+            uint64_t stateCount = components.transitionMatrix.getRowGroupCount();
+            uint64_t choiceCount = components.transitionMatrix.getRowCount();
+            STORM_LOG_THROW(components.transitionMatrix.getColumnCount() <= stateCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Transition matrix has " << components.transitionMatrix.getColumnCount() << " columns but only " << stateCount << " states.");
+            components.stateLabeling = reader.readLabeling<storm::models::sparse::StateLabeling>(stateCount);
+
+            // Parse reward models
+            uint64_t rewardModelCount = reader.readUint64();
+            for (uint64_t rewardModel = 0; rewardModel < rewardModelCount; ++rewardModel) {
+                std::string name = reader.readString();
+                uint64_t flags = reader.readUint64();
+                boost::optional<std::vector<ValueType>> stateRewards;
+                boost::optional<std::vector<ValueType>> stateActionRewards;
+                boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+                if (flags & storm::exporter::binary::stateRewardsFlag) {
+                    stateRewards = reader.readVector<ValueType>();
+                    STORM_LOG_THROW(stateRewards.get().size() == stateCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": State rewards of reward model '" << name << "' have unexpected size.");
+                }
+                if (flags & storm::exporter::binary::stateActionRewardsFlag) {
+                    stateActionRewards = reader.readVector<ValueType>();
+                    STORM_LOG_THROW(stateActionRewards.get().size() == choiceCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": State-action rewards of reward model '" << name << "' have unexpected size.");
+                }
+                if (flags & storm::exporter::binary::transitionRewardsFlag) {
+                    transitionRewards = reader.readMatrix<ValueType>();
+                    STORM_LOG_THROW(transitionRewards.get().getRowCount() == choiceCount && transitionRewards.get().getColumnCount() <= stateCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Transition rewards of reward model '" << name << "' have unexpected dimensions.");
+                }
+                components.rewardModels.emplace(name, RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+            }
+
+            // Parse choice labeling
+            if (reader.readUint64() != 0) {
+                components.choiceLabeling = reader.readLabeling<storm::models::sparse::ChoiceLabeling>(choiceCount);
+            }
+
+            // Parse exit rates and Markovian states
+            if (reader.readUint64() != 0) {
+                components.exitRates = reader.readVector<ValueType>();
+                STORM_LOG_THROW(components.exitRates.get().size() == stateCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Exit rates have unexpected size.");
+            }
+            if (reader.readUint64() != 0) {
+                components.markovianStates = reader.readBitVector();
+            }
+            STORM_LOG_THROW(type != storm::models::ModelType::MarkovAutomaton || components.markovianStates, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Markov automaton without Markovian states.");
+
+            // For CTMCs, the rate matrix was written.
+            components.rateTransitions = (type == storm::models::ModelType::Ctmc);
+
+            return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+        }
+
+        // Template instantiations.
+        template class BinaryEncodingParser<double>;
+
+    } // namespace parser
+} // namespace storm
@@ -0,0 +1,32 @@
+#ifndef STORM_PARSER_BINARYENCODINGPARSER_H_
+#define STORM_PARSER_BINARYENCODINGPARSER_H_
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         *	Parser for models that were exported in the binary format (see storm::exporter::binaryExportSparseModel).
+         *	The file is mapped into memory and the arrays of the model components are copied from the mapping as a
+         *	whole, i.e. no per-entry parsing takes place.
+         */
+        template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+        class BinaryEncodingParser {
+        public:
+
+            /*!
+             * Load a model in the binary format from a file and create the model.
+             *
+             * @param file The binary file to be loaded.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& file);
+        };
+
+    } // namespace parser
+} // namespace storm
+
+#endif /* STORM_PARSER_BINARYENCODINGPARSER_H_ */
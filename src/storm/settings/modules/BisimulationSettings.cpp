@@ -6,16 +6,26 @@
 #include "storm/settings/Argument.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/storage/bisimulation/SymbolicBisimulationDecomposition.h"
+
+#include "storm/exceptions/InvalidSettingsException.h"
+
 namespace storm {
     namespace settings {
         namespace modules {
             
             const std::string BisimulationSettings::moduleName = "bisimulation";
             const std::string BisimulationSettings::typeOptionName = "type";
+            const std::string BisimulationSettings::refinementOptionName = "refinement";
+            const std::string BisimulationSettings::quotientFormatOptionName = "quot";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, typeOptionName, true, "Sets the kind of bisimulation quotienting used.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the type to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(types)).setDefaultValueString("strong").build()).build());
+                std::vector<std::string> refinementMethods = { "splitter", "signature" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementOptionName, true, "Sets the partition refinement method. The signature-based method refines all blocks in parallel rounds and is only available for strong bisimulation on sparse models.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The name of the refinement method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementMethods)).setDefaultValueString("splitter").build()).build());
+                std::vector<std::string> quotTypes = { "dd", "sparse" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, quotientFormatOptionName, true, "Sets the format in which the quotient of a symbolic model is built.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("format", "The format of the quotient.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(quotTypes)).setDefaultValueString("dd").build()).build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -32,8 +42,20 @@ namespace storm {
                 return false;
             }
             
+            bool BisimulationSettings::isSignatureRefinementSet() const {
+                return this->getOption(refinementOptionName).getArgumentByName("method").getValueAsString() == "signature";
+            }
+            
+            storm::storage::BisimulationQuotientFormat BisimulationSettings::getQuotientFormat() const {
+                if (this->getOption(quotientFormatOptionName).getArgumentByName("format").getValueAsString() == "sparse") {
+                    return storm::storage::BisimulationQuotientFormat::Sparse;
+                }
+                return storm::storage::BisimulationQuotientFormat::Dd;
+            }
+            
             bool BisimulationSettings::check() const {
-                bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
+                bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet() || this->getOption(refinementOptionName).getHasOptionBeenSet() || this->getOption(quotientFormatOptionName).getHasOptionBeenSet();
+                STORM_LOG_THROW(!isWeakBisimulationSet() || !isSignatureRefinementSet(), storm::exceptions::InvalidSettingsException, "Signature-based refinement is only available for strong bisimulation.");
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
                 return true;
             }
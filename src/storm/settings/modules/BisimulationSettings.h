@@ -4,6 +4,10 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 namespace storm {
+    namespace storage {
+        enum class BisimulationQuotientFormat;
+    }
+    
     namespace settings {
         namespace modules {
             
@@ -33,6 +37,21 @@ namespace storm {
                  * @return True iff weak bisimulation is to be used.
                  */
                 bool isWeakBisimulationSet() const;
+                
+                /*!
+                 * Retrieves whether the signature-based partition refinement is to be used instead of the
+                 * splitter-based one.
+                 *
+                 * @return True iff the signature-based refinement is to be used.
+                 */
+                bool isSignatureRefinementSet() const;
+                
+                /*!
+                 * Retrieves the format in which the quotient of a symbolic model is to be built.
+                 *
+                 * @return The format of the quotient.
+                 */
+                storm::storage::BisimulationQuotientFormat getQuotientFormat() const;
 
                 virtual bool check() const override;
                 
@@ -42,6 +61,8 @@ namespace storm {
             private:
                 // Define the string names of the options as constants.
                 static const std::string typeOptionName;
+                static const std::string refinementOptionName;
+                static const std::string quotientFormatOptionName;
             };
         } // namespace modules
     } // namespace settings
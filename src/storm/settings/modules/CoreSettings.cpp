@@ -9,6 +9,7 @@
 #include "storm/solver/SolverSelectionOptions.h"
 
 #include "storm/storage/dd/DdType.h"
+#include "storm/builder/DdVariableOrder.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
@@ -30,17 +31,19 @@ namespace storm {
             const std::string CoreSettings::engineOptionName = "engine";
             const std::string CoreSettings::engineOptionShortName = "e";
             const std::string CoreSettings::ddLibraryOptionName = "ddlib";
+            const std::string CoreSettings::ddVariableOrderOptionName = "ddorder";
             const std::string CoreSettings::cudaOptionName = "cuda";
+            const std::string CoreSettings::batchCheckingOptionName = "batch";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(CoreSettings::Engine::Sparse) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false, "Generates a counterexample for the given PRCTL formulas if not satisfied by the model.").setShortName(counterexampleOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, dontFixDeadlockOptionName, false, "If the model contains deadlock states, they need to be fixed by setting this option.").setShortName(dontFixDeadlockOptionShortName).build());
                 
-                std::vector<std::string> engines = {"sparse", "hybrid", "dd", "expl", "abs"};
+                std::vector<std::string> engines = {"sparse", "hybrid", "dd", "expl", "abs", "smc"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, engineOptionName, false, "Sets which engine is used for model building and model checking.").setShortName(engineOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("sparse").build()).build());
                 
-                std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
+                std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological", "streaming"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eqSolverOptionName, false, "Sets which solver is preferred for solving systems of linear equations.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the solver to prefer.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(linearEquationSolver)).setDefaultValueString("gmm++").build()).build());
                 
@@ -48,6 +51,10 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, ddLibraryOptionName, false, "Sets which library is preferred for decision-diagram operations.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the library to prefer.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddLibraries)).setDefaultValueString("cudd").build()).build());
                 
+                std::vector<std::string> ddVariableOrders = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false, "Sets the heuristic used by the symbolic model builders to order the decision-diagram variables.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic. Available are: declaration (as declared in the model) and force (variables that are used together are placed next to each other).").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrders)).setDefaultValueString("declaration").build()).build());
+                
                 std::vector<std::string> lpSolvers = {"gurobi", "glpk", "z3"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, lpSolverOptionName, false, "Sets which LP solver is preferred.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of an LP solver.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(lpSolvers)).setDefaultValueString("glpk").build()).build());
@@ -57,6 +64,7 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of an SMT solver.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(smtSolvers)).setDefaultValueString("z3").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, false, "Sets whether to display statistics if available.").setShortName(statisticsOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, batchCheckingOptionName, false, "Sets whether all properties are checked together such that precomputations on the model are shared. For the hybrid engine, this keeps the explicit matrices of the model in memory.").build());
             }
 
             bool CoreSettings::isCounterexampleSet() const {
@@ -81,6 +89,10 @@ namespace storm {
                     return storm::solver::EquationSolverType::Eigen;
                 } else if (equationSolverName == "elimination") {
                     return storm::solver::EquationSolverType::Elimination;
+                } else if (equationSolverName == "topological") {
+                    return storm::solver::EquationSolverType::Topological;
+                } else if (equationSolverName == "streaming") {
+                    return storm::solver::EquationSolverType::Streaming;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown equation solver '" << equationSolverName << "'.");
             }
@@ -120,6 +132,15 @@ namespace storm {
                 }
             }
             
+            storm::builder::DdVariableOrder CoreSettings::getDdVariableOrder() const {
+                std::string ddVariableOrderAsString = this->getOption(ddVariableOrderOptionName).getArgumentByName("name").getValueAsString();
+                if (ddVariableOrderAsString == "force") {
+                    return storm::builder::DdVariableOrder::Force;
+                } else {
+                    return storm::builder::DdVariableOrder::Declaration;
+                }
+            }
+            
             bool CoreSettings::isShowStatisticsSet() const {
                 return this->getOption(statisticsOptionName).getHasOptionBeenSet();
             }
@@ -127,6 +148,10 @@ namespace storm {
             bool CoreSettings::isCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
+
+            bool CoreSettings::isBatchCheckingSet() const {
+                return this->getOption(batchCheckingOptionName).getHasOptionBeenSet();
+            }
             
             CoreSettings::Engine CoreSettings::getEngine() const {
                 return engine;
@@ -149,6 +174,8 @@ namespace storm {
                     engine = CoreSettings::Engine::Exploration;
                 } else if (engineStr == "abs") {
                     engine = CoreSettings::Engine::AbstractionRefinement;
+                } else if (engineStr == "smc") {
+                    engine = CoreSettings::Engine::Statistical;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown engine '" << engineStr << "'.");
                 }
@@ -17,6 +17,10 @@ namespace storm {
     namespace dd {
         enum class DdType;
     }
+    
+    namespace builder {
+        enum class DdVariableOrder;
+    }
 
     namespace settings {
         namespace modules {
@@ -28,7 +32,7 @@ namespace storm {
             public:
                 // An enumeration of all engines.
                 enum class Engine {
-                    Sparse, Hybrid, Dd, Exploration, AbstractionRefinement
+                    Sparse, Hybrid, Dd, Exploration, AbstractionRefinement, Statistical
                 };
 
                 /*!
@@ -102,6 +106,13 @@ namespace storm {
                  */
                 storm::dd::DdType getDdLibraryType() const;
                 
+                /*!
+                 * Retrieves the heuristic used by the symbolic model builders to order the DD variables.
+                 *
+                 * @return The selected heuristic.
+                 */
+                storm::builder::DdVariableOrder getDdVariableOrder() const;
+                
                 /*!
                  * Retrieves whether statistics are to be shown for counterexample generation.
                  *
@@ -116,6 +127,14 @@ namespace storm {
                  */
                 bool isCudaSet() const;
 
+                /*!
+                 * Retrieves whether the properties are to be checked together such that model checkers can share
+                 * precomputations among them.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isBatchCheckingSet() const;
+
                 /*!
                  * Retrieves the selected engine.
                  *
@@ -150,7 +169,9 @@ namespace storm {
                 static const std::string engineOptionName;
                 static const std::string engineOptionShortName;
                 static const std::string ddLibraryOptionName;
+                static const std::string ddVariableOrderOptionName;
                 static const std::string cudaOptionName;
+                static const std::string batchCheckingOptionName;
             };
 
         } // namespace modules
@@ -5,6 +5,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/ExpressionEvaluatorType.h"
 
 namespace storm {
     namespace settings {
@@ -63,6 +64,20 @@ namespace storm {
                  */
                 std::string getExportExplicitFilename() const;
                 
+                /*!
+                 * Retrieves whether the export-to-binary option was set
+                 *
+                 * @return True if the export-to-binary option was set
+                 */
+                bool isExportBinarySet() const;
+                
+                /*!
+                 * Retrieves the name in which to write the model in the binary format, if the option was set.
+                 *
+                 * @return The name of the file in which to write the exported model.
+                 */
+                std::string getExportBinaryFilename() const;
+                
                 /*!
                  * Retrieves whether the explicit option was set.
                  *
@@ -100,6 +115,20 @@ namespace storm {
                  */
                 std::string getExplicitDRNFilename() const;
                 
+                /*!
+                 * Retrieves whether the explicit option with the binary format was set.
+                 *
+                 * @return True if the explicit option with the binary format was set.
+                 */
+                bool isExplicitBinarySet() const;
+                
+                /*!
+                 * Retrieves the name of the file that contains the model in the binary format.
+                 *
+                 * @return The name of the binary file that contains the model.
+                 */
+                std::string getExplicitBinaryFilename() const;
+                
                 /*!
                  * Retrieves whether the explicit option with IMCA was set.
                  *
@@ -193,6 +222,13 @@ namespace storm {
                  */
                 uint64_t getExplorationShowProgressDelay() const;
                 
+                /*!
+                 * Retrieves the number of threads to use for expanding states during explicit model exploration.
+                 *
+                 * @return The number of threads. If the option was set to 0, the number of available cores is returned.
+                 */
+                uint64_t getExplorationThreadCount() const;
+                
                 /*!
                  * Retrieves the exploration order if it was set.
                  *
@@ -200,6 +236,13 @@ namespace storm {
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
 
+                /*!
+                 * Retrieves the backend that is to be used for evaluating expressions during model exploration.
+                 *
+                 * @return The chosen expression evaluator.
+                 */
+                storm::builder::ExpressionEvaluatorType getExpressionEvaluatorType() const;
+
                 /*!
                  * Retrieves whether the transition reward option was set.
                  *
@@ -336,10 +379,13 @@ namespace storm {
                 static const std::string exportDotOptionName;
                 static const std::string exportJaniDotOptionName;
                 static const std::string exportExplicitOptionName;
+                static const std::string exportBinaryOptionName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
                 static const std::string explicitDrnOptionShortName;
+                static const std::string explicitBinaryOptionName;
+                static const std::string explicitBinaryOptionShortName;
                 static const std::string explicitImcaOptionName;
                 static const std::string explicitImcaOptionShortName;
                 static const std::string prismInputOptionName;
@@ -350,6 +396,9 @@ namespace storm {
                 static const std::string explorationChecksOptionShortName;
                 static const std::string explorationShowProgressOptionName;
                 static const std::string explorationShowProgressOptionShortName;
+                static const std::string explorationThreadsOptionName;
+                static const std::string explorationThreadsOptionShortName;
+                static const std::string expressionEvaluatorOptionName;
                 static const std::string explorationOrderOptionName;
                 static const std::string explorationOrderOptionShortName;
                 static const std::string transitionRewardsOptionName;
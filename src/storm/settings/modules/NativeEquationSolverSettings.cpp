@@ -22,10 +22,11 @@ namespace storm {
             const std::string NativeEquationSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string NativeEquationSolverSettings::precisionOptionName = "precision";
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
+            const std::string NativeEquationSolverSettings::compactMatrixOptionName = "compact";
             
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor" };
-                this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
+                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "ii", "blockjacobi" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine. The method blockjacobi is not Gauss-Seidel: only within fixed blocks of rows, the new values are used immediately, so that the blocks can be processed in parallel.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false, "The maximal number of iterations to perform before iterative solving is aborted.").setShortName(maximalIterationsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal iteration count.").setDefaultValueUnsignedInteger(20000).build()).build());
                 
@@ -34,6 +35,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, omegaOptionName, false, "The omega used for SOR.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The value of the SOR parameter.").setDefaultValueDouble(0.9).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, compactMatrixOptionName, false, "If set, the iterations operate on a compact copy of the matrix that uses 32-bit column indices and a dictionary of distinct values where possible.").build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -48,6 +51,10 @@ namespace storm {
                     return NativeEquationSolverSettings::LinearEquationMethod::GaussSeidel;
                 } else if (linearEquationSystemTechniqueAsString == "sor") {
                     return NativeEquationSolverSettings::LinearEquationMethod::SOR;
+                } else if (linearEquationSystemTechniqueAsString == "ii") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration;
+                } else if (linearEquationSystemTechniqueAsString == "blockjacobi") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::BlockJacobi;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
             }
@@ -80,9 +87,13 @@ namespace storm {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet() ? NativeEquationSolverSettings::ConvergenceCriterion::Absolute : NativeEquationSolverSettings::ConvergenceCriterion::Relative;
             }
             
+            bool NativeEquationSolverSettings::isCompactMatrixSet() const {
+                return this->getOption(compactMatrixOptionName).getHasOptionBeenSet();
+            }
+            
             bool NativeEquationSolverSettings::check() const {
                 // This list does not include the precision, because this option is shared with other modules.
-                bool optionSet = isLinearEquationSystemTechniqueSet() || isMaximalIterationCountSet() || isConvergenceCriterionSet();
+                bool optionSet = isLinearEquationSystemTechniqueSet() || isMaximalIterationCountSet() || isConvergenceCriterionSet() || isCompactMatrixSet();
                 
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Native || !optionSet, "Native is not selected as the preferred equation solver, so setting options for native might have no effect.");
                 
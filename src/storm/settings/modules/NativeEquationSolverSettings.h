@@ -13,7 +13,7 @@ namespace storm {
             class NativeEquationSolverSettings : public ModuleSettings {
             public:
                 // An enumeration of all available methods for solving linear equations.
-                enum class LinearEquationMethod { Jacobi, GaussSeidel, SOR };
+                enum class LinearEquationMethod { Jacobi, GaussSeidel, SOR, IntervalIteration, BlockJacobi };
                 
                 // An enumeration of all available convergence criteria.
                 enum class ConvergenceCriterion { Absolute, Relative };
@@ -86,6 +86,13 @@ namespace storm {
                  */
                 ConvergenceCriterion getConvergenceCriterion() const;
                 
+                /*!
+                 * Retrieves whether compact matrices are to be used in the iterations.
+                 *
+                 * @return True iff compact matrices are to be used.
+                 */
+                bool isCompactMatrixSet() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -99,6 +106,7 @@ namespace storm {
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
+                static const std::string compactMatrixOptionName;
             };
             
         } // namespace modules
@@ -39,6 +39,14 @@ namespace storm {
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
 
+                /*!
+                 * Retrieves the number of threads that are to be used for parallel operations. A value of
+                 * zero indicates that the number of hardware threads is to be used.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -48,6 +56,7 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string threadsOptionName;
             };
         }
     }
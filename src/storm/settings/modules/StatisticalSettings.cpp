@@ -0,0 +1,68 @@
+#include "storm/settings/modules/StatisticalSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string StatisticalSettings::moduleName = "smc";
+            const std::string StatisticalSettings::stoppingMethodOptionName = "method";
+            const std::string StatisticalSettings::precisionOptionName = "precision";
+            const std::string StatisticalSettings::errorProbabilityOptionName = "error";
+            const std::string StatisticalSettings::seedOptionName = "seed";
+            
+            StatisticalSettings::StatisticalSettings() : ModuleSettings(moduleName) {
+                std::vector<std::string> stoppingMethods = { "chernoff", "sprt" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, stoppingMethodOptionName, true, "Sets the method that decides when enough paths have been sampled.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use. 'chernoff' samples the number of paths given by the Chernoff-Hoeffding bound, 'sprt' performs a sequential probability ratio test for probability operators with a bound and falls back to 'chernoff' otherwise.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stoppingMethods)).setDefaultValueString("chernoff").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The maximal distance between the estimate and the actual value (the half-width of the indifference region for hypothesis tests).")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-02).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, errorProbabilityOptionName, false, "The probability with which the result may be wrong.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.").setDefaultValueDouble(5e-02).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "If set, the random number generators are initialized with the given seed, which makes the results reproducible.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed to use.").build()).build());
+            }
+            
+            StatisticalSettings::StoppingMethod StatisticalSettings::getStoppingMethod() const {
+                std::string methodAsString = this->getOption(stoppingMethodOptionName).getArgumentByName("name").getValueAsString();
+                if (methodAsString == "chernoff") {
+                    return StatisticalSettings::StoppingMethod::ChernoffHoeffding;
+                } else if (methodAsString == "sprt") {
+                    return StatisticalSettings::StoppingMethod::Sprt;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown stopping method '" << methodAsString << "'.");
+            }
+            
+            double StatisticalSettings::getPrecision() const {
+                return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            double StatisticalSettings::getErrorProbability() const {
+                return this->getOption(errorProbabilityOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            bool StatisticalSettings::isSeedSet() const {
+                return this->getOption(seedOptionName).getHasOptionBeenSet();
+            }
+            
+            uint_fast64_t StatisticalSettings::getSeed() const {
+                return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+            
+            bool StatisticalSettings::check() const {
+                bool optionsSet = this->getOption(stoppingMethodOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(precisionOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(errorProbabilityOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(seedOptionName).getHasOptionBeenSet();
+                STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::settings::modules::CoreSettings::Engine::Statistical || !optionsSet, "Statistical model checking engine is not selected, so setting options for it has no effect.");
+                return true;
+            }
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,76 @@
+#ifndef STORM_SETTINGS_MODULES_STATISTICALSETTINGS_H_
+#define STORM_SETTINGS_MODULES_STATISTICALSETTINGS_H_
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings of the statistical model checking engine.
+             */
+            class StatisticalSettings : public ModuleSettings {
+            public:
+                // The available methods to decide when enough paths have been sampled.
+                enum class StoppingMethod { ChernoffHoeffding, Sprt };
+                
+                /*!
+                 * Creates a new set of statistical model checking settings.
+                 */
+                StatisticalSettings();
+                
+                /*!
+                 * Retrieves the method that decides when enough paths have been sampled.
+                 *
+                 * @return The selected stopping method.
+                 */
+                StoppingMethod getStoppingMethod() const;
+                
+                /*!
+                 * Retrieves the precision of the estimates, i.e. the maximal (absolute) distance between the estimate
+                 * and the actual value. For hypothesis tests, this is the half-width of the indifference region.
+                 *
+                 * @return The precision.
+                 */
+                double getPrecision() const;
+                
+                /*!
+                 * Retrieves the probability with which the result may violate the precision guarantee (or the
+                 * hypothesis test may give the wrong answer).
+                 *
+                 * @return The error probability.
+                 */
+                double getErrorProbability() const;
+                
+                /*!
+                 * Retrieves whether a seed for the random number generators was set.
+                 *
+                 * @return True iff a seed was set.
+                 */
+                bool isSeedSet() const;
+                
+                /*!
+                 * Retrieves the seed for the random number generators.
+                 *
+                 * @return The seed.
+                 */
+                uint_fast64_t getSeed() const;
+                
+                virtual bool check() const override;
+                
+                // The name of the module.
+                static const std::string moduleName;
+                
+            private:
+                // Define the string names of the options as constants.
+                static const std::string stoppingMethodOptionName;
+                static const std::string precisionOptionName;
+                static const std::string errorProbabilityOptionName;
+                static const std::string seedOptionName;
+            };
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
+
+#endif /* STORM_SETTINGS_MODULES_STATISTICALSETTINGS_H_ */
@@ -0,0 +1,47 @@
+#include "storm/settings/modules/StreamingEquationSolverSettings.h"
+
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string StreamingEquationSolverSettings::moduleName = "streaming";
+            const std::string StreamingEquationSolverSettings::blockSizeOptionName = "blocksize";
+            const std::string StreamingEquationSolverSettings::temporaryDirectoryOptionName = "tmpdir";
+            const std::string StreamingEquationSolverSettings::noPrefetchingOptionName = "noprefetch";
+            
+            StreamingEquationSolverSettings::StreamingEquationSolverSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, blockSizeOptionName, true, "Sets the maximal amount of matrix data that is loaded into memory at once.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The size of the blocks in MB.").setDefaultValueUnsignedInteger(64).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, temporaryDirectoryOptionName, true, "Sets the directory in which matrices that are given in memory are stored while they are solved.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The directory to use. By default, the temporary directory of the system is used.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noPrefetchingOptionName, true, "If set, the next block of the matrix is not read while the current one is processed.").build());
+            }
+            
+            uint64_t StreamingEquationSolverSettings::getBlockSize() const {
+                return this->getOption(blockSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger() * 1024 * 1024;
+            }
+            
+            bool StreamingEquationSolverSettings::isTemporaryDirectorySet() const {
+                return this->getOption(temporaryDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string StreamingEquationSolverSettings::getTemporaryDirectory() const {
+                return this->getOption(temporaryDirectoryOptionName).getArgumentByName("path").getValueAsString();
+            }
+            
+            bool StreamingEquationSolverSettings::isPrefetchingSet() const {
+                return !this->getOption(noPrefetchingOptionName).getHasOptionBeenSet();
+            }
+            
+            bool StreamingEquationSolverSettings::check() const {
+                return true;
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,64 @@
+#ifndef STORM_SETTINGS_MODULES_STREAMINGEQUATIONSOLVERSETTINGS_H_
+#define STORM_SETTINGS_MODULES_STREAMINGEQUATIONSOLVERSETTINGS_H_
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings for the streaming (out-of-core) equation solvers.
+             */
+            class StreamingEquationSolverSettings : public ModuleSettings {
+            public:
+                /*!
+                 * Creates a new set of streaming equation solver settings.
+                 */
+                StreamingEquationSolverSettings();
+                
+                /*!
+                 * Retrieves the maximal amount of matrix data that is loaded into memory at once.
+                 *
+                 * @return The size of the blocks in bytes.
+                 */
+                uint64_t getBlockSize() const;
+                
+                /*!
+                 * Retrieves whether a directory for the temporary matrix files has been set.
+                 *
+                 * @return True iff the directory has been set.
+                 */
+                bool isTemporaryDirectorySet() const;
+                
+                /*!
+                 * Retrieves the directory in which the matrices that are given in memory are stored.
+                 *
+                 * @return The name of the directory.
+                 */
+                std::string getTemporaryDirectory() const;
+                
+                /*!
+                 * Retrieves whether the next block of the matrix is to be read while the current one is processed.
+                 *
+                 * @return True iff prefetching is enabled.
+                 */
+                bool isPrefetchingSet() const;
+                
+                bool check() const override;
+                
+                // The name of the module.
+                static const std::string moduleName;
+                
+            private:
+                // Define the string names of the options as constants.
+                static const std::string blockSizeOptionName;
+                static const std::string temporaryDirectoryOptionName;
+                static const std::string noPrefetchingOptionName;
+            };
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
+
+#endif /* STORM_SETTINGS_MODULES_STREAMINGEQUATIONSOLVERSETTINGS_H_ */
@@ -7,6 +7,9 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
 
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
 namespace storm {
     namespace settings {
         namespace modules {
@@ -14,10 +17,19 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::reorderOptionName = "reorder";
+            const std::string SylvanSettings::maximalGrowthOptionName = "maxgrowth";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                
+                std::vector<std::string> reorderingTechniques;
+                reorderingTechniques.push_back("none");
+                reorderingTechniques.push_back("gsift");
+                reorderingTechniques.push_back("gsiftconv");
+                this->addOption(storm::settings::OptionBuilder(moduleName, reorderOptionName, true, "Sets the reordering technique used by Sylvan.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "Sets which technique is used by Sylvan's reordering routines.").setDefaultValueString("gsift").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(reorderingTechniques)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, maximalGrowthOptionName, true, "Sets the factor by which the DDs may grow while sifting a variable group.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The maximal growth factor.").setDefaultValueDouble(1.2).addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(1.0)).build()).build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -32,6 +44,22 @@ namespace storm {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            SylvanSettings::ReorderingTechnique SylvanSettings::getReorderingTechnique() const {
+                std::string reorderingTechniqueAsString = this->getOption(reorderOptionName).getArgumentByName("method").getValueAsString();
+                if (reorderingTechniqueAsString == "none") {
+                    return SylvanSettings::ReorderingTechnique::None;
+                } else if (reorderingTechniqueAsString == "gsift") {
+                    return SylvanSettings::ReorderingTechnique::GroupSift;
+                } else if (reorderingTechniqueAsString == "gsiftconv") {
+                    return SylvanSettings::ReorderingTechnique::GroupSiftConv;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << reorderingTechniqueAsString << "' set as reordering technique of Sylvan.");
+            }
+            
+            double SylvanSettings::getMaximalGrowth() const {
+                return this->getOption(maximalGrowthOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -12,6 +12,9 @@ namespace storm {
              */
             class SylvanSettings : public ModuleSettings {
             public:
+                // An enumeration of all available reordering techniques of Sylvan.
+                enum class ReorderingTechnique { None, GroupSift, GroupSiftConv };
+                
                 /*!
                  * Creates a new set of CUDD settings.
                  */
@@ -37,6 +40,21 @@ namespace storm {
                  */
                 bool isNumberOfThreadsSet() const;
                 
+                /*!
+                 * Retrieves the reordering technique that Sylvan is supposed to use.
+                 *
+                 * @return The reordering technique to use.
+                 */
+                ReorderingTechnique getReorderingTechnique() const;
+                
+                /*!
+                 * Retrieves the factor by which the DDs may grow while a variable group is moved during sifting before
+                 * moving it further in the same direction is abandoned.
+                 *
+                 * @return The maximal growth factor.
+                 */
+                double getMaximalGrowth() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -44,6 +62,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string reorderOptionName;
+                static const std::string maximalGrowthOptionName;
             };
             
         } // namespace modules
@@ -0,0 +1,51 @@
+#include "storm/settings/modules/TimeBoundedSolverSettings.h"
+
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
+            const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
+            const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+            const std::string TimeBoundedSolverSettings::steadyStateDetectionOptionName = "steadystate";
+            
+            TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
+                std::vector<std::string> ctmcMethods = { "uniformization", "adaptive" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, true, "Sets the method used for time-bounded reachability on CTMCs. The adaptive method only considers the states reachable from the initial states and is only used if the values of the initial states are requested.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods)).setDefaultValueString("uniformization").build()).build());
+                std::vector<std::string> maMethods = { "digitization", "unifplus" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, maMethodOptionName, true, "Sets the method used for time-bounded reachability on Markov automata. Unif+ is based on uniformization and does not support lower time bounds.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(maMethods)).setDefaultValueString("digitization").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, steadyStateDetectionOptionName, true, "If set, the transient analysis on CTMCs stops early once two successive iterations agree up to the precision. This is a heuristic: for slowly mixing models, the error of the result may exceed the precision.").build());
+            }
+            
+            TimeBoundedSolverSettings::CtmcMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+                if (this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString() == "adaptive") {
+                    return TimeBoundedSolverSettings::CtmcMethod::AdaptiveUniformization;
+                }
+                return TimeBoundedSolverSettings::CtmcMethod::Uniformization;
+            }
+            
+            TimeBoundedSolverSettings::MaMethod TimeBoundedSolverSettings::getMaMethod() const {
+                if (this->getOption(maMethodOptionName).getArgumentByName("name").getValueAsString() == "unifplus") {
+                    return TimeBoundedSolverSettings::MaMethod::UnifPlus;
+                }
+                return TimeBoundedSolverSettings::MaMethod::Digitization;
+            }
+            
+            bool TimeBoundedSolverSettings::isSteadyStateDetectionSet() const {
+                return this->getOption(steadyStateDetectionOptionName).getHasOptionBeenSet();
+            }
+            
+            bool TimeBoundedSolverSettings::check() const {
+                return true;
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
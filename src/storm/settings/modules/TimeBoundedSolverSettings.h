@@ -0,0 +1,65 @@
+#ifndef STORM_SETTINGS_MODULES_TIMEBOUNDEDSOLVERSETTINGS_H_
+#define STORM_SETTINGS_MODULES_TIMEBOUNDEDSOLVERSETTINGS_H_
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings for the computation of time-bounded properties on continuous-time models.
+             */
+            class TimeBoundedSolverSettings : public ModuleSettings {
+            public:
+                // An enumeration of all available methods for the transient analysis of CTMCs.
+                enum class CtmcMethod { Uniformization, AdaptiveUniformization };
+                
+                // An enumeration of all available methods for time-bounded reachability on Markov automata.
+                enum class MaMethod { Digitization, UnifPlus };
+                
+                /*!
+                 * Creates a new set of time-bounded solver settings.
+                 */
+                TimeBoundedSolverSettings();
+                
+                /*!
+                 * Retrieves the method that is to be used for the transient analysis of CTMCs.
+                 *
+                 * @return The selected method.
+                 */
+                CtmcMethod getCtmcMethod() const;
+                
+                /*!
+                 * Retrieves the method that is to be used for time-bounded reachability on Markov automata.
+                 *
+                 * @return The selected method.
+                 */
+                MaMethod getMaMethod() const;
+                
+                /*!
+                 * Retrieves whether the transient analysis is to stop as soon as it detects that a steady state was
+                 * reached. As this detection only compares successive iterations, it does not guarantee the requested
+                 * precision and is therefore disabled by default.
+                 *
+                 * @return True iff steady-state detection is enabled.
+                 */
+                bool isSteadyStateDetectionSet() const;
+                
+                bool check() const override;
+                
+                // The name of the module.
+                static const std::string moduleName;
+                
+            private:
+                // Define the string names of the options as constants.
+                static const std::string ctmcMethodOptionName;
+                static const std::string maMethodOptionName;
+                static const std::string steadyStateDetectionOptionName;
+            };
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
+
+#endif /* STORM_SETTINGS_MODULES_TIMEBOUNDEDSOLVERSETTINGS_H_ */
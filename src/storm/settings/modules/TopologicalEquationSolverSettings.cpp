@@ -0,0 +1,46 @@
+#include "storm/settings/modules/TopologicalEquationSolverSettings.h"
+
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+
+#include "storm/solver/SolverSelectionOptions.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string TopologicalEquationSolverSettings::moduleName = "topological";
+            const std::string TopologicalEquationSolverSettings::sccSolverOptionName = "sccsolver";
+            
+            TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
+                std::vector<std::string> sccSolvers = {"gmm++", "native", "eigen", "elimination"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, sccSolverOptionName, true, "Sets which solver is used for the equation systems of the non-trivial SCCs.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the solver to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sccSolvers)).setDefaultValueString("gmm++").build()).build());
+            }
+            
+            storm::solver::EquationSolverType TopologicalEquationSolverSettings::getSccEquationSolver() const {
+                std::string equationSolverName = this->getOption(sccSolverOptionName).getArgumentByName("name").getValueAsString();
+                if (equationSolverName == "gmm++") {
+                    return storm::solver::EquationSolverType::Gmmxx;
+                } else if (equationSolverName == "native") {
+                    return storm::solver::EquationSolverType::Native;
+                } else if (equationSolverName == "eigen") {
+                    return storm::solver::EquationSolverType::Eigen;
+                } else if (equationSolverName == "elimination") {
+                    return storm::solver::EquationSolverType::Elimination;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown equation solver '" << equationSolverName << "'.");
+            }
+            
+            bool TopologicalEquationSolverSettings::check() const {
+                return true;
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,45 @@
+#ifndef STORM_SETTINGS_MODULES_TOPOLOGICALEQUATIONSOLVERSETTINGS_H_
+#define STORM_SETTINGS_MODULES_TOPOLOGICALEQUATIONSOLVERSETTINGS_H_
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace solver {
+        enum class EquationSolverType;
+    }
+    
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings for the topological linear equation solver.
+             */
+            class TopologicalEquationSolverSettings : public ModuleSettings {
+            public:
+                /*!
+                 * Creates a new set of topological equation solver settings.
+                 */
+                TopologicalEquationSolverSettings();
+                
+                /*!
+                 * Retrieves the equation solver that is used to solve the equation systems of the non-trivial SCCs.
+                 *
+                 * @return The selected equation solver.
+                 */
+                storm::solver::EquationSolverType getSccEquationSolver() const;
+                
+                bool check() const override;
+                
+                // The name of the module.
+                static const std::string moduleName;
+                
+            private:
+                // Define the string names of the options as constants.
+                static const std::string sccSolverOptionName;
+            };
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
+
+#endif /* STORM_SETTINGS_MODULES_TOPOLOGICALEQUATIONSOLVERSETTINGS_H_ */
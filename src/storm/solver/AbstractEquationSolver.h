@@ -4,6 +4,8 @@
 #include "storm/solver/TerminationCondition.h"
 #include <memory>
 
+#include <boost/optional.hpp>
+
 namespace storm {
     namespace solver {
         
@@ -43,9 +45,37 @@ namespace storm {
                 return *terminationCondition;
             }
             
+            /*!
+             * Retrieves whether the solver needs an upper bound on the values of the solution in order to solve the
+             * equation system, e.g. because it approaches the solution from below and above.
+             */
+            virtual bool requiresUpperBound() const {
+                return false;
+            }
+            
+            /*!
+             * Retrieves whether the last solution computed by the solver comes with a guaranteed bound on its error.
+             */
+            bool hasErrorBound() const {
+                return static_cast<bool>(this->errorBound);
+            }
+            
+            /*!
+             * Retrieves the bound on the (absolute) error of the last solution computed by the solver. That is, all
+             * entries of the solution differ from the exact values by at most the returned value.
+             *
+             * @return The bound on the error.
+             */
+            ValueType const& getErrorBound() const {
+                return this->errorBound.get();
+            }
+            
         protected:
             // A termination condition to be used (can be unset).
             std::unique_ptr<TerminationCondition<ValueType>> terminationCondition;
+            
+            // If the last solution computed by the solver comes with a guaranteed bound on its error, this bound is stored here.
+            mutable boost::optional<ValueType> errorBound;
         };
         
     }
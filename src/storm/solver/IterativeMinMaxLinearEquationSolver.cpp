@@ -1,5 +1,7 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
+#include <numeric>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 
@@ -35,6 +37,8 @@ namespace storm {
                 case MinMaxMethod::ValueIteration: this->solutionMethod = SolutionMethod::ValueIteration; break;
                 case MinMaxMethod::PolicyIteration: this->solutionMethod = SolutionMethod::PolicyIteration; break;
                 case MinMaxMethod::Acyclic: this->solutionMethod = SolutionMethod::Acyclic; break;
+                case MinMaxMethod::IntervalIteration: this->solutionMethod = SolutionMethod::IntervalIteration; break;
+                case MinMaxMethod::OptimisticValueIteration: this->solutionMethod = SolutionMethod::OptimisticValueIteration; break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique for iterative MinMax linear equation solver.");
             }
@@ -87,6 +91,7 @@ namespace storm {
         
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquations(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            this->errorBound = boost::none;
             switch (this->getSettings().getSolutionMethod()) {
                 case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration:
                     return solveEquationsValueIteration(dir, x, b);
@@ -94,22 +99,38 @@ namespace storm {
                     return solveEquationsPolicyIteration(dir, x, b);
                 case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::Acyclic:
                     return solveEquationsAcyclic(dir, x, b);
+                case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration:
+                    return solveEquationsIntervalIteration(dir, x, b);
+                case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::OptimisticValueIteration:
+                    return solveEquationsOptimisticValueIteration(dir, x, b);
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "This solver does not implement the selected solution method");
             }
             return false;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquations(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const {
+            // Only value iteration is performed for several systems at once. Schedulers (and hints for them) as well as
+            // custom termination conditions refer to a single system, so in these cases the systems are solved one
+            // after another.
+            if (numberOfRightHandSides > 1 && this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration && !this->isTrackSchedulerSet() && !this->hasSchedulerHint() && !this->hasCustomTerminationCondition()) {
+                this->errorBound = boost::none;
+                return solveEquationsValueIteration(dir, x, b, numberOfRightHandSides);
+            }
+            return MinMaxLinearEquationSolver<ValueType>::solveEquations(dir, x, b, numberOfRightHandSides);
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             // Create the initial scheduler.
             std::vector<storm::storage::sparse::state_type> scheduler = this->hasSchedulerHint() ? this->choicesHint.get() : std::vector<storm::storage::sparse::state_type>(this->A.getRowGroupCount());
             
             // Get a vector for storing the right-hand side of the inner equation system.
-            if(!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A.getRowGroupCount());
+            if(!this->auxiliaryRowGroupVector) {
+                this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A.getRowGroupCount());
             }
-            std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
+            std::vector<ValueType>& subB = *this->auxiliaryRowGroupVector;
 
             // Resolve the nondeterminism according to the current scheduler.
             storm::storage::SparseMatrix<ValueType> submatrix = this->A.selectRowsFromRowGroups(scheduler, true);
@@ -219,20 +240,15 @@ namespace storm {
                 this->linEqSolverA->setCachingEnabled(true);
             }
             
-            if (!this->auxiliaryRowVector) {
-                this->auxiliaryRowVector = std::make_unique<std::vector<ValueType>>(this->A.getRowCount());
-            }
-            std::vector<ValueType>& multiplyResult = *this->auxiliaryRowVector;
-            
-            if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A.getRowGroupCount());
+            if (!this->auxiliaryRowGroupVector) {
+                this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A.getRowGroupCount());
             }
             
             if (this->hasSchedulerHint()) {
                 // Resolve the nondeterminism according to the scheduler hint
                 storm::storage::SparseMatrix<ValueType> submatrix = this->A.selectRowsFromRowGroups(this->choicesHint.get(), true);
                 submatrix.convertToEquationSystem();
-                storm::utility::vector::selectVectorValues<ValueType>(*auxiliaryRowGroupVector, this->choicesHint.get(), this->A.getRowGroupIndices(), b);
+                storm::utility::vector::selectVectorValues<ValueType>(*this->auxiliaryRowGroupVector, this->choicesHint.get(), this->A.getRowGroupIndices(), b);
 
                 // Solve the resulting equation system.
                 // Note that the linEqSolver might consider a slightly different interpretation of "equalModuloPrecision". Hence, we iteratively increase its precision.
@@ -240,10 +256,10 @@ namespace storm {
                 submatrixSolver->setCachingEnabled(true);
                 if (this->lowerBound) { submatrixSolver->setLowerBound(this->lowerBound.get()); }
                 if (this->upperBound) { submatrixSolver->setUpperBound(this->upperBound.get()); }
-                submatrixSolver->solveEquations(x, *auxiliaryRowGroupVector);
+                submatrixSolver->solveEquations(x, *this->auxiliaryRowGroupVector);
             }
             
-            std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
+            std::vector<ValueType>* newX = this->auxiliaryRowGroupVector.get();
             
             std::vector<ValueType>* currentX = &x;
             
@@ -252,11 +268,8 @@ namespace storm {
             
             Status status = Status::InProgress;
             while (status == Status::InProgress) {
-                // Compute x' = A*x + b.
-                this->linEqSolverA->multiply(*currentX, &b, multiplyResult);
-                
-                // Reduce the vector x' by applying min/max for all non-deterministic choices.
-                storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, *newX, this->A.getRowGroupIndices());
+                // Compute x' = min/max(A*x + b).
+                this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), *currentX, &b, *newX);
                 
                 // Determine whether the method converged.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
@@ -273,20 +286,16 @@ namespace storm {
             
             // If we performed an odd number of iterations, we need to swap the x and currentX, because the newest result
             // is currently stored in currentX, but x is the output vector.
-            if (currentX == auxiliaryRowGroupVector.get()) {
+            if (currentX == this->auxiliaryRowGroupVector.get()) {
                 std::swap(x, *currentX);
             }
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                // Due to a custom termination condition, it may be the case that no iterations are performed. In this
-                // case we need to compute x'= A*x+b once.
-                if (iterations==0) {
-                    this->linEqSolverA->multiply(x, &b, multiplyResult);
-                }
+                // We perform one more fused step on the solution and keep track of the choices made. The values are
+                // written to the auxiliary vector to leave x untouched.
                 this->schedulerChoices = std::vector<uint_fast64_t>(this->A.getRowGroupCount());
-                // Reduce the multiplyResult and keep track of the choices made
-                storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, x, this->A.getRowGroupIndices(), &this->schedulerChoices.get());
+                this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
 
             if (!this->isCachingEnabled()) {
@@ -296,6 +305,236 @@ namespace storm {
             return status == Status::Converged || status == Status::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const {
+            STORM_LOG_INFO("Solving " << numberOfRightHandSides << " equation systems (" << this->A.getRowGroupCount() << " row groups) with value iteration.");
+            
+            // The systems that did not yet converge. Only these are updated in the iterations.
+            std::vector<uint_fast64_t> columns(numberOfRightHandSides);
+            std::iota(columns.begin(), columns.end(), 0);
+            
+            // The new values are computed into x, so the systems that converge keep their latest values.
+            std::vector<ValueType> previousX = x;
+            uint64_t iterations = 0;
+            while (!columns.empty() && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                // Compute x' = min/max(A*x + b) for all systems at once.
+                this->A.multiplyAndReduce(dir, this->A.getRowGroupIndices(), previousX, &b, x, numberOfRightHandSides, columns);
+                std::vector<uint_fast64_t> updatedColumns = columns;
+                storm::utility::vector::removeEqualModuloPrecision<ValueType>(previousX, x, numberOfRightHandSides, columns, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion());
+                
+                // Keep the values of this iteration for the next one.
+                for (uint_fast64_t offset = 0; offset < x.size(); offset += numberOfRightHandSides) {
+                    for (auto const& column : updatedColumns) {
+                        previousX[offset + column] = x[offset + column];
+                    }
+                }
+                ++iterations;
+            }
+            
+            reportStatus(columns.empty() ? Status::Converged : Status::MaximalIterationsExceeded, iterations);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            return columns.empty();
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->lowerBound || !this->upperBound) {
+                STORM_LOG_WARN("Interval iteration requires a lower and an upper bound on the solution, but " << (this->lowerBound ? "no upper bound" : "no lower bound") << " is known. Falling back to value iteration.");
+                return solveEquationsValueIteration(dir, x, b);
+            }
+            
+            if(!this->linEqSolverA) {
+                this->linEqSolverA = this->linearEquationSolverFactory->create(this->A);
+                this->linEqSolverA->setCachingEnabled(true);
+            }
+            
+            if (!this->auxiliaryRowGroupVector) {
+                this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A.getRowGroupCount());
+            }
+            std::vector<ValueType>& tmpX = *this->auxiliaryRowGroupVector;
+            
+            // Start the iteration from the known bounds. As the min/max Bellman operator is monotone, applying it to
+            // a lower (upper) bound of its unique fixed point again yields a lower (upper) bound.
+            std::vector<ValueType> lowerX(this->A.getRowGroupCount(), this->lowerBound.get());
+            std::vector<ValueType> upperX(this->A.getRowGroupCount(), this->upperBound.get());
+            
+            // Since we return the center of the interval, the solution is precise enough as soon as the width of the
+            // interval drops below twice the precision.
+            ValueType precision = storm::utility::convertNumber<ValueType>(2.0) * this->getSettings().getPrecision();
+            
+            uint64_t iterations = 0;
+            Status status = Status::InProgress;
+            while (status == Status::InProgress) {
+                // Compute x' = min/max(A*x + b) for both bounds.
+                this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), lowerX, &b, tmpX);
+                lowerX.swap(tmpX);
+                
+                this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), upperX, &b, tmpX);
+                upperX.swap(tmpX);
+                
+                // Determine whether the bounds met.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(upperX, lowerX, precision, this->getSettings().getRelativeTerminationCriterion())) {
+                    status = Status::Converged;
+                }
+                
+                ++iterations;
+                status = updateStatusIfNotConverged(status, lowerX, iterations);
+            }
+            
+            reportStatus(status, iterations);
+            
+            // Use the center of the interval as the solution and record how far it can be off at most.
+            ValueType maximalDifference = storm::utility::zero<ValueType>();
+            for (uint64_t group = 0; group < x.size(); ++group) {
+                x[group] = (lowerX[group] + upperX[group]) / storm::utility::convertNumber<ValueType>(2.0);
+                maximalDifference = std::max(maximalDifference, upperX[group] - lowerX[group]);
+            }
+            this->errorBound = maximalDifference / storm::utility::convertNumber<ValueType>(2.0);
+            STORM_LOG_INFO("Interval iteration obtained a solution with error bound " << this->errorBound.get() << ".");
+            
+            // If requested, we store the scheduler for retrieval. We extract it from the center of the interval, but
+            // keep the values in x untouched to not invalidate the error bound.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A.getRowGroupCount());
+                this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), x, &b, tmpX, &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == Status::Converged || status == Status::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->lowerBound) {
+                STORM_LOG_WARN("Optimistic value iteration requires a lower bound on the solution, but none is known. Falling back to value iteration.");
+                return solveEquationsValueIteration(dir, x, b);
+            }
+            
+            if(!this->linEqSolverA) {
+                this->linEqSolverA = this->linearEquationSolverFactory->create(this->A);
+                this->linEqSolverA->setCachingEnabled(true);
+            }
+            
+            if (!this->auxiliaryRowGroupVector) {
+                this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A.getRowGroupCount());
+            }
+            std::vector<ValueType>& tmpX = *this->auxiliaryRowGroupVector;
+            
+            // Value iteration that starts from a lower bound approaches the (least) fixed point from below, so all
+            // iterates remain lower bounds.
+            std::vector<ValueType> lowerX(this->A.getRowGroupCount(), this->lowerBound.get());
+            std::vector<ValueType> upperX(this->A.getRowGroupCount());
+            
+            bool relative = this->getSettings().getRelativeTerminationCriterion();
+            ValueType precision = this->getSettings().getPrecision();
+            
+            uint64_t iterations = 0;
+            Status status = Status::InProgress;
+            while (status == Status::InProgress) {
+                // First, perform value iteration until the lower bound converges with respect to the current precision.
+                uint64_t guessingIterations = 0;
+                bool lowerConverged = false;
+                while (!lowerConverged && status == Status::InProgress) {
+                    this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), lowerX, &b, tmpX);
+                    lowerConverged = storm::utility::vector::equalModuloPrecision<ValueType>(lowerX, tmpX, precision, relative);
+                    lowerX.swap(tmpX);
+                    
+                    ++iterations;
+                    ++guessingIterations;
+                    status = updateStatusIfNotConverged(status, lowerX, iterations);
+                }
+                if (status != Status::InProgress) {
+                    break;
+                }
+                
+                // Then, guess an upper bound that is close to the lower bound.
+                for (uint64_t group = 0; group < upperX.size(); ++group) {
+                    if (relative && !storm::utility::isZero(lowerX[group])) {
+                        upperX[group] = lowerX[group] + precision * storm::utility::abs(lowerX[group]);
+                    } else {
+                        upperX[group] = lowerX[group] + precision;
+                    }
+                    if (this->upperBound && this->upperBound.get() < upperX[group]) {
+                        upperX[group] = this->upperBound.get();
+                    }
+                }
+                
+                // Now try to verify the guess. If applying the operator does not increase the guess anywhere, the guess
+                // is a pre-fixed point and thereby an upper bound on the (least) fixed point. Meanwhile, we keep improving
+                // the lower bound. If the lower bound exceeds the (improved) guess, the guess was wrong. We give up on
+                // verifying the guess after as many iterations as were necessary to come up with it.
+                for (uint64_t verificationIterations = 0; verificationIterations < guessingIterations && status == Status::InProgress; ++verificationIterations) {
+                    this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), lowerX, &b, tmpX);
+                    lowerX.swap(tmpX);
+                    
+                    this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), upperX, &b, tmpX);
+                    
+                    bool upperBoundVerified = true;
+                    bool boundsCrossed = false;
+                    for (uint64_t group = 0; group < upperX.size(); ++group) {
+                        if (tmpX[group] > upperX[group]) {
+                            upperBoundVerified = false;
+                        }
+                        if (lowerX[group] > tmpX[group]) {
+                            boundsCrossed = true;
+                            break;
+                        }
+                    }
+                    upperX.swap(tmpX);
+                    
+                    ++iterations;
+                    if (upperBoundVerified && !boundsCrossed) {
+                        status = Status::Converged;
+                    } else if (boundsCrossed) {
+                        break;
+                    } else {
+                        status = updateStatusIfNotConverged(status, lowerX, iterations);
+                    }
+                }
+                
+                if (status == Status::InProgress) {
+                    // The guess could not be verified, so we continue with a higher precision.
+                    precision /= storm::utility::convertNumber<ValueType>(2.0);
+                    STORM_LOG_TRACE("Optimistic value iteration failed to verify the guessed upper bound. Decreasing the precision to " << precision << ".");
+                }
+            }
+            
+            reportStatus(status, iterations);
+            
+            if (status == Status::Converged) {
+                // Use the center of the interval as the solution and record how far it can be off at most.
+                ValueType maximalDifference = storm::utility::zero<ValueType>();
+                for (uint64_t group = 0; group < x.size(); ++group) {
+                    x[group] = (lowerX[group] + upperX[group]) / storm::utility::convertNumber<ValueType>(2.0);
+                    maximalDifference = std::max(maximalDifference, upperX[group] - lowerX[group]);
+                }
+                this->errorBound = maximalDifference / storm::utility::convertNumber<ValueType>(2.0);
+                STORM_LOG_INFO("Optimistic value iteration obtained a solution with error bound " << this->errorBound.get() << ".");
+            } else {
+                // Without a verified upper bound, the best we have is the lower bound.
+                x = lowerX;
+            }
+            
+            // If requested, we store the scheduler for retrieval. We extract it from the solution, but keep the values
+            // in x untouched to not invalidate the error bound.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A.getRowGroupCount());
+                this->linEqSolverA->multiplyAndReduce(dir, this->A.getRowGroupIndices(), x, &b, tmpX, &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == Status::Converged || status == Status::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsAcyclic(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             uint64_t numGroups = this->A.getRowGroupCount();
@@ -426,6 +665,11 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::requiresUpperBound() const {
+            return this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration;
+        }
+        
         template<typename ValueType>
         IterativeMinMaxLinearEquationSolverSettings<ValueType> const& IterativeMinMaxLinearEquationSolver<ValueType>::getSettings() const {
             return settings;
@@ -438,7 +682,6 @@ namespace storm {
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
-            auxiliaryRowGroupVector.reset();
             rowGroupOrdering.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
@@ -6,10 +6,14 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
+#include "storm/solver/TopologicalLinearEquationSolver.h"
+#include "storm/solver/StreamingLinearEquationSolver.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/utility/vector.h"
+
 namespace storm {
     namespace solver {
         
@@ -18,6 +22,34 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const {
+            STORM_LOG_ASSERT(x.size() == getMatrixColumnCount() * numberOfRightHandSides, "Unexpected size of the solution vectors.");
+            STORM_LOG_ASSERT(b.size() == getMatrixRowCount() * numberOfRightHandSides, "Unexpected size of the right-hand sides.");
+            
+            bool solved = true;
+            boost::optional<ValueType> maximalErrorBound;
+            std::vector<ValueType> singleX(getMatrixColumnCount());
+            std::vector<ValueType> singleB(getMatrixRowCount());
+            for (uint64_t column = 0; column < numberOfRightHandSides; ++column) {
+                for (uint64_t index = 0; index < singleX.size(); ++index) {
+                    singleX[index] = x[index * numberOfRightHandSides + column];
+                }
+                for (uint64_t index = 0; index < singleB.size(); ++index) {
+                    singleB[index] = b[index * numberOfRightHandSides + column];
+                }
+                solved &= this->solveEquations(singleX, singleB);
+                if (this->hasErrorBound() && (!maximalErrorBound || this->getErrorBound() > maximalErrorBound.get())) {
+                    maximalErrorBound = this->getErrorBound();
+                }
+                for (uint64_t index = 0; index < singleX.size(); ++index) {
+                    x[index * numberOfRightHandSides + column] = singleX[index];
+                }
+            }
+            this->errorBound = maximalErrorBound;
+            return solved;
+        }
+        
         template<typename ValueType>
         void LinearEquationSolver<ValueType>::repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
             
@@ -55,6 +87,27 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void LinearEquationSolver<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (!cachedRowVector) {
+                cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+            }
+            
+            // We enable caching for this. But remember how the old setting was
+            bool cachingWasEnabled = isCachingEnabled();
+            setCachingEnabled(true);
+            
+            this->multiply(x, b, *cachedRowVector);
+            storm::utility::vector::reduceVectorMinOrMax(dir, *cachedRowVector, result, rowGroupIndices, choices);
+            
+            // restore the old caching setting
+            setCachingEnabled(cachingWasEnabled);
+            
+            if (!isCachingEnabled()) {
+                clearCache();
+            }
+        }
+        
         template<typename ValueType>
         void LinearEquationSolver<ValueType>::setCachingEnabled(bool value) const {
             if(cachingEnabled && !value) {
@@ -114,6 +167,8 @@ namespace storm {
                 case EquationSolverType::Native: return std::make_unique<NativeLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
                 case EquationSolverType::Eigen: return std::make_unique<EigenLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
                 case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
+                case EquationSolverType::Topological: return TopologicalLinearEquationSolverFactory<ValueType>().create(std::forward<MatrixType>(matrix));
+                case EquationSolverType::Streaming: return std::make_unique<StreamingLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
                 default: return std::make_unique<GmmxxLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
             }
         }
@@ -137,6 +192,7 @@ namespace storm {
             EquationSolverType equationSolver = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
             switch (equationSolver) {
                 case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolver<storm::RationalNumber>>(std::forward<MatrixType>(matrix));
+                case EquationSolverType::Topological: return TopologicalLinearEquationSolverFactory<storm::RationalNumber>().create(std::forward<MatrixType>(matrix));
                 default: return std::make_unique<EigenLinearEquationSolver<storm::RationalNumber>>(std::forward<MatrixType>(matrix));
             }
         }
@@ -158,6 +214,7 @@ namespace storm {
             EquationSolverType equationSolver = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
             switch (equationSolver) {
                 case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolver<storm::RationalFunction>>(std::forward<MatrixType>(matrix));
+                case EquationSolverType::Topological: return TopologicalLinearEquationSolverFactory<storm::RationalFunction>().create(std::forward<MatrixType>(matrix));
                 default: return std::make_unique<EigenLinearEquationSolver<storm::RationalFunction>>(std::forward<MatrixType>(matrix));
             }
         }
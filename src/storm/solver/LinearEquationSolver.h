@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "storm/solver/AbstractEquationSolver.h"
+#include "storm/solver/OptimizationDirection.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -43,6 +44,21 @@ namespace storm {
              */
             virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+            /*!
+             * Solves the equation systems A*x_j = b_j for several right-hand sides b_j at once. The vectors are stored
+             * interleaved, i.e. entry i of vector j is located at position i * numberOfRightHandSides + j. Solvers that
+             * provide a dedicated implementation load every entry of A only once per iteration for all systems and
+             * track the convergence of each system separately. Otherwise, the systems are solved one after another.
+             * If the solver provides an error bound, it is the maximal error bound over all systems.
+             *
+             * @param x The (interleaved) solution vectors that have to be computed.
+             * @param b The (interleaved) right-hand sides of the equation systems.
+             * @param numberOfRightHandSides The number of equation systems.
+             *
+             * @return true iff all equation systems were solved.
+             */
+            virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const;
+
             /*!
              * Performs on matrix-vector multiplication x' = A*x + b.
              *
@@ -55,6 +71,23 @@ namespace storm {
              */
             virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const = 0;
             
+            /*!
+             * Performs on matrix-vector multiplication x' = A*x + b and then minimizes/maximizes over the row groups
+             * so that the resulting vector has the size of number of row groups of A. Unless overridden by a solver
+             * that provides a fused implementation, this multiplies first and reduces the result afterwards.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x The input vector with which to multiply the matrix. Its length must be equal
+             * to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A.
+             * @param result The target vector into which to write the multiplication result. Its length must be equal
+             * to the number of row groups.
+             * @param choices If given, the choices made in the reduction process are written to this vector.
+             */
+            virtual void multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
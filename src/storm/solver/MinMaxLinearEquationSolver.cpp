@@ -6,6 +6,7 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
+#include "storm/solver/StreamingMinMaxLinearEquationSolver.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
@@ -28,6 +29,35 @@ namespace storm {
             // Intentionally left empty.
         }
 
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::solveEquations(OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const {
+            if (numberOfRightHandSides == 1) {
+                return solveEquations(d, x, b);
+            }
+            
+            bool solved = true;
+            boost::optional<ValueType> maximalErrorBound;
+            std::vector<ValueType> singleX(x.size() / numberOfRightHandSides);
+            std::vector<ValueType> singleB(b.size() / numberOfRightHandSides);
+            for (uint64_t column = 0; column < numberOfRightHandSides; ++column) {
+                for (uint64_t index = 0; index < singleX.size(); ++index) {
+                    singleX[index] = x[index * numberOfRightHandSides + column];
+                }
+                for (uint64_t index = 0; index < singleB.size(); ++index) {
+                    singleB[index] = b[index * numberOfRightHandSides + column];
+                }
+                solved &= solveEquations(d, singleX, singleB);
+                if (this->hasErrorBound() && (!maximalErrorBound || this->getErrorBound() > maximalErrorBound.get())) {
+                    maximalErrorBound = this->getErrorBound();
+                }
+                for (uint64_t index = 0; index < singleX.size(); ++index) {
+                    x[index * numberOfRightHandSides + column] = singleX[index];
+                }
+            }
+            this->errorBound = maximalErrorBound;
+            return solved;
+        }
+        
         template<typename ValueType>
         void MinMaxLinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             STORM_LOG_THROW(isSet(this->direction), storm::exceptions::IllegalFunctionCallException, "Optimization direction not set.");
@@ -190,12 +220,14 @@ namespace storm {
         std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquationSolverFactory<ValueType>::selectSolver(MatrixType&& matrix) const {
             std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> result;
             auto method = this->getMinMaxMethod();
-            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Acyclic) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Acyclic || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration) {
                 IterativeMinMaxLinearEquationSolverSettings<ValueType> iterativeSolverSettings;
                 iterativeSolverSettings.setSolutionMethod(method);
                 result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix), std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>(), iterativeSolverSettings);
             } else if (method == MinMaxMethod::Topological) {
                 result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
+            } else if (method == MinMaxMethod::Streaming) {
+                result = std::make_unique<StreamingMinMaxLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
             } else if (method == MinMaxMethod::LinearProgramming) {
                 result = std::make_unique<LpMinMaxLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix), std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>(), std::make_unique<storm::utility::solver::LpSolverFactory<ValueType>>());
             } else {
@@ -211,7 +243,7 @@ namespace storm {
         std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMaxLinearEquationSolverFactory<storm::RationalNumber>::selectSolver(MatrixType&& matrix) const {
             std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> result;
             auto method = this->getMinMaxMethod();
-            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Acyclic) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Acyclic || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration) {
                 IterativeMinMaxLinearEquationSolverSettings<storm::RationalNumber> iterativeSolverSettings;
                 iterativeSolverSettings.setSolutionMethod(method);
                 result =  std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(std::forward<MatrixType>(matrix), std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>(), iterativeSolverSettings);
@@ -46,6 +46,22 @@ namespace storm {
              */
             virtual bool solveEquations(OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
             
+            /*!
+             * Solves the equation systems x_j = min/max(A*x_j + b_j) for several vectors b_j at once. The vectors are
+             * stored interleaved, i.e. entry i of vector j is located at position i * numberOfRightHandSides + j.
+             * Solvers that provide a dedicated implementation load every entry of A only once per iteration for all
+             * systems and track the convergence of each system separately. Otherwise, the systems are solved one
+             * after another (and a generated scheduler belongs to the last system). If the solver provides an error
+             * bound, it is the maximal error bound over all systems.
+             *
+             * @param d The optimization direction.
+             * @param x The (interleaved) solution vectors.
+             * @param b The (interleaved) vectors to add after matrix-vector multiplication.
+             * @param numberOfRightHandSides The number of equation systems.
+             * @return true iff all equation systems were solved.
+             */
+            virtual bool solveEquations(OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const;
+            
             /*!
              * Behaves the same as the other variant of <code>solveEquations</code>, with the distinction that
              * instead of providing the optimization direction as an argument, the internally set optimization direction
@@ -1,6 +1,7 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
 #include <utility>
+#include <numeric>
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
@@ -23,6 +24,10 @@ namespace storm {
                 method = SolutionMethod::Jacobi;
             } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::SOR) {
                 method = SolutionMethod::SOR;
+            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::IntervalIteration) {
+                method = SolutionMethod::IntervalIteration;
+            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::BlockJacobi) {
+                method = SolutionMethod::BlockJacobi;
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "The selected solution technique is invalid for this solver.");
             }
@@ -31,6 +36,7 @@ namespace storm {
             precision = settings.getPrecision();
             relative = settings.getConvergenceCriterion() == storm::settings::modules::NativeEquationSolverSettings::ConvergenceCriterion::Relative;
             omega = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getOmega();
+            useCompactMatrix = settings.isCompactMatrixSet();
         }
         
         template<typename ValueType>
@@ -58,6 +64,11 @@ namespace storm {
             this->omega = omega;
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolverSettings<ValueType>::setUseCompactMatrix(bool value) {
+            this->useCompactMatrix = value;
+        }
+        
         template<typename ValueType>
         typename NativeLinearEquationSolverSettings<ValueType>::SolutionMethod NativeLinearEquationSolverSettings<ValueType>::getSolutionMethod() const {
             return method;
@@ -83,6 +94,11 @@ namespace storm {
             return omega;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolverSettings<ValueType>::getUseCompactMatrix() const {
+            return useCompactMatrix;
+        }
+        
         template<typename ValueType>
         NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, NativeLinearEquationSolverSettings<ValueType> const& settings) : localA(nullptr), A(nullptr), settings(settings) {
             this->setMatrix(A);
@@ -97,6 +113,7 @@ namespace storm {
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
             localA.reset();
             this->A = &A;
+            compactA.reset();
             clearCache();
         }
 
@@ -104,6 +121,7 @@ namespace storm {
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
             localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
             this->A = localA.get();
+            compactA.reset();
             clearCache();
         }
 
@@ -113,6 +131,14 @@ namespace storm {
             if (!this->cachedRowVector) {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
             }
+            this->errorBound = boost::none;
+            
+            if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration) {
+                if (this->lowerBound && this->upperBound) {
+                    return solveEquationsIntervalIteration(x, b);
+                }
+                STORM_LOG_WARN("Interval iteration requires a lower and an upper bound on the solution, but " << (this->lowerBound ? "no upper bound" : "no lower bound") << " is known. Falling back to the Jacobi method.");
+            }
             
             if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel) {
                 // Define the omega used for SOR.
@@ -125,7 +151,11 @@ namespace storm {
                 bool converged = false;
                 
                 while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations()) {
-                    A->performSuccessiveOverRelaxationStep(omega, x, b);
+                    if (this->getSettings().getUseCompactMatrix()) {
+                        getCompactMatrix().performSuccessiveOverRelaxationStep(omega, x, b);
+                    } else {
+                        A->performSuccessiveOverRelaxationStep(omega, x, b);
+                    }
                     
                     // Now check if the process already converged within our precision.
                     converged = storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion()) || (this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(x));
@@ -151,15 +181,55 @@ namespace storm {
 
                 return converged;
                 
+            } else if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::BlockJacobi) {
+                STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (block Jacobi, " << BLOCK_JACOBI_BLOCK_SIZE << " rows per block)");
+                
+                std::vector<ValueType>* currentX = &x;
+                std::vector<ValueType>* nextX = this->cachedRowVector.get();
+                
+                // Set up additional environment variables.
+                uint_fast64_t iterationCount = 0;
+                bool converged = false;
+                
+                while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations() && !(this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(*currentX))) {
+                    if (this->getSettings().getUseCompactMatrix()) {
+                        getCompactMatrix().performBlockJacobiStep(*currentX, b, *nextX, BLOCK_JACOBI_BLOCK_SIZE);
+                    } else {
+                        A->performBlockJacobiStep(*currentX, b, *nextX, BLOCK_JACOBI_BLOCK_SIZE);
+                    }
+                    
+                    // Now check if the process already converged within our precision.
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                    
+                    // Swap the two pointers as a preparation for the next iteration.
+                    std::swap(nextX, currentX);
+                    
+                    // Increase iteration count so we can abort if convergence is too slow.
+                    ++iterationCount;
+                }
+                
+                // If the last iteration did not write to the original x we have to swap the contents, because the
+                // output has to be written to the input parameter x.
+                if (currentX == this->cachedRowVector.get()) {
+                    std::swap(x, *currentX);
+                }
+                
+                if (!this->isCachingEnabled()) {
+                    clearCache();
+                }
+                
+                if (converged) {
+                    STORM_LOG_INFO("Iterative solver converged in " << iterationCount << " iterations.");
+                } else {
+                    STORM_LOG_WARN("Iterative solver did not converge in " << iterationCount << " iterations.");
+                }
+                
+                return converged;
             } else {
                 STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Jacobi)");
 
                 // Get a Jacobi decomposition of the matrix A.
-                if(!jacobiDecomposition) {
-                    jacobiDecomposition = std::make_unique<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(A->getJacobiDecomposition());
-                }
-                storm::storage::SparseMatrix<ValueType> const& jacobiLU = jacobiDecomposition->first;
-                std::vector<ValueType> const& jacobiD = jacobiDecomposition->second;
+                createJacobiDecomposition();
                 
                 std::vector<ValueType>* currentX = &x;
                 std::vector<ValueType>* nextX = this->cachedRowVector.get();
@@ -170,9 +240,7 @@ namespace storm {
                 
                 while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations() && !(this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(*currentX))) {
                     // Compute D^-1 * (b - LU * x) and store result in nextX.
-                    jacobiLU.multiplyWithVector(*currentX, *nextX);
-                    storm::utility::vector::subtractVectors(b, *nextX, *nextX);
-                    storm::utility::vector::multiplyVectorsPointwise(jacobiD, *nextX, *nextX);
+                    performJacobiStep(*currentX, b, *nextX);
                     
                     // Now check if the process already converged within our precision.
                     converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
@@ -204,10 +272,243 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (interval iteration)");
+            
+            // Get a Jacobi decomposition of the matrix A.
+            createJacobiDecomposition();
+            
+            // Start the iteration from the known bounds. As the matrix is of the form I - P for a non-negative P, a
+            // Jacobi step is monotone and the two vectors therefore remain a lower and an upper bound of the solution.
+            std::vector<ValueType> lowerX(x.size(), this->lowerBound.get());
+            std::vector<ValueType> upperX(x.size(), this->upperBound.get());
+            std::vector<ValueType>& tmpX = *this->cachedRowVector;
+            
+            // Since we return the center of the interval, the solution is precise enough as soon as the width of the
+            // interval drops below twice the precision.
+            ValueType precision = storm::utility::convertNumber<ValueType>(2.0) * static_cast<ValueType>(this->getSettings().getPrecision());
+            
+            uint_fast64_t iterationCount = 0;
+            bool converged = false;
+            while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations() && !(this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(lowerX))) {
+                // Compute D^-1 * (b - LU * x) for both bounds.
+                performJacobiStep(lowerX, b, tmpX);
+                lowerX.swap(tmpX);
+                
+                performJacobiStep(upperX, b, tmpX);
+                upperX.swap(tmpX);
+                
+                // Now check whether the bounds met within our precision.
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(upperX, lowerX, precision, this->getSettings().getRelativeTerminationCriterion());
+                
+                ++iterationCount;
+            }
+            
+            // Use the center of the interval as the solution and record how far it can be off at most.
+            ValueType maximalDifference = storm::utility::zero<ValueType>();
+            for (uint_fast64_t index = 0; index < x.size(); ++index) {
+                x[index] = (lowerX[index] + upperX[index]) / storm::utility::convertNumber<ValueType>(2.0);
+                maximalDifference = std::max(maximalDifference, upperX[index] - lowerX[index]);
+            }
+            this->errorBound = maximalDifference / storm::utility::convertNumber<ValueType>(2.0);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            if (converged) {
+                STORM_LOG_INFO("Interval iteration converged in " << iterationCount << " iterations (error bound " << this->errorBound.get() << ").");
+            } else {
+                STORM_LOG_WARN("Interval iteration did not converge in " << iterationCount << " iterations (error bound " << this->errorBound.get() << ").");
+            }
+            
+            return converged;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const {
+            if (numberOfRightHandSides == 1) {
+                return solveEquations(x, b);
+            }
+            
+            // Custom termination conditions refer to a single solution vector and the compact matrices and the block
+            // Jacobi method provide no kernels for several vectors, so in these cases the systems are solved one after
+            // another.
+            if (this->hasCustomTerminationCondition() || this->getSettings().getUseCompactMatrix() || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::BlockJacobi) {
+                return LinearEquationSolver<ValueType>::solveEquations(x, b, numberOfRightHandSides);
+            }
+            this->errorBound = boost::none;
+            
+            if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration) {
+                if (this->lowerBound && this->upperBound) {
+                    return solveEquationsIntervalIteration(x, b, numberOfRightHandSides);
+                }
+                STORM_LOG_WARN("Interval iteration requires a lower and an upper bound on the solution, but " << (this->lowerBound ? "no upper bound" : "no lower bound") << " is known. Falling back to the Jacobi method.");
+            }
+            
+            // The systems that did not yet converge. Only these are updated in the iterations.
+            std::vector<uint_fast64_t> columns(numberOfRightHandSides);
+            std::iota(columns.begin(), columns.end(), 0);
+            
+            std::vector<ValueType> previousX = x;
+            uint_fast64_t iterationCount = 0;
+            if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel) {
+                ValueType omega = this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR ? this->getSettings().getOmega() : storm::utility::one<ValueType>();
+                STORM_LOG_INFO("Solving " << numberOfRightHandSides << " linear equation systems (" << A->getRowCount() << " rows) with NativeLinearEquationSolver (Gauss-Seidel, SOR omega = " << omega << ")");
+                
+                while (!columns.empty() && iterationCount < this->getSettings().getMaximalNumberOfIterations()) {
+                    A->performSuccessiveOverRelaxationStep(omega, x, b, numberOfRightHandSides, columns);
+                    storm::utility::vector::removeEqualModuloPrecision<ValueType>(previousX, x, numberOfRightHandSides, columns, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                    
+                    // Back up the systems that did not yet converge.
+                    for (uint_fast64_t offset = 0; offset < x.size(); offset += numberOfRightHandSides) {
+                        for (auto const& column : columns) {
+                            previousX[offset + column] = x[offset + column];
+                        }
+                    }
+                    ++iterationCount;
+                }
+            } else {
+                STORM_LOG_INFO("Solving " << numberOfRightHandSides << " linear equation systems (" << A->getRowCount() << " rows) with NativeLinearEquationSolver (Jacobi)");
+                createJacobiDecomposition();
+                
+                while (!columns.empty() && iterationCount < this->getSettings().getMaximalNumberOfIterations()) {
+                    // The new values are computed into x, so the systems that converge keep their latest values.
+                    performJacobiStep(previousX, b, x, numberOfRightHandSides, columns);
+                    std::vector<uint_fast64_t> updatedColumns = columns;
+                    storm::utility::vector::removeEqualModuloPrecision<ValueType>(previousX, x, numberOfRightHandSides, columns, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                    
+                    // Keep the values of this iteration for the next one.
+                    for (uint_fast64_t offset = 0; offset < x.size(); offset += numberOfRightHandSides) {
+                        for (auto const& column : updatedColumns) {
+                            previousX[offset + column] = x[offset + column];
+                        }
+                    }
+                    ++iterationCount;
+                }
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            if (columns.empty()) {
+                STORM_LOG_INFO("Iterative solver converged in " << iterationCount << " iterations.");
+            } else {
+                STORM_LOG_WARN("Iterative solver did not converge in " << iterationCount << " iterations for " << columns.size() << " of " << numberOfRightHandSides << " equation systems.");
+            }
+            return columns.empty();
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const {
+            STORM_LOG_INFO("Solving " << numberOfRightHandSides << " linear equation systems (" << A->getRowCount() << " rows) with NativeLinearEquationSolver (interval iteration)");
+            createJacobiDecomposition();
+            
+            std::vector<ValueType> lowerX(x.size(), this->lowerBound.get());
+            std::vector<ValueType> upperX(x.size(), this->upperBound.get());
+            std::vector<ValueType> tmpX(x.size());
+            ValueType precision = storm::utility::convertNumber<ValueType>(2.0) * static_cast<ValueType>(this->getSettings().getPrecision());
+            
+            std::vector<uint_fast64_t> columns(numberOfRightHandSides);
+            std::iota(columns.begin(), columns.end(), 0);
+            
+            // As the bounds of the converged systems are no longer updated, we only swap the values of the others.
+            auto swapColumns = [&] (std::vector<ValueType>& first, std::vector<ValueType>& second) {
+                for (uint_fast64_t offset = 0; offset < x.size(); offset += numberOfRightHandSides) {
+                    for (auto const& column : columns) {
+                        std::swap(first[offset + column], second[offset + column]);
+                    }
+                }
+            };
+            
+            uint_fast64_t iterationCount = 0;
+            while (!columns.empty() && iterationCount < this->getSettings().getMaximalNumberOfIterations()) {
+                performJacobiStep(lowerX, b, tmpX, numberOfRightHandSides, columns);
+                swapColumns(lowerX, tmpX);
+                performJacobiStep(upperX, b, tmpX, numberOfRightHandSides, columns);
+                swapColumns(upperX, tmpX);
+                
+                storm::utility::vector::removeEqualModuloPrecision<ValueType>(upperX, lowerX, numberOfRightHandSides, columns, precision, this->getSettings().getRelativeTerminationCriterion());
+                ++iterationCount;
+            }
+            
+            ValueType maximalDifference = storm::utility::zero<ValueType>();
+            for (uint_fast64_t index = 0; index < x.size(); ++index) {
+                x[index] = (lowerX[index] + upperX[index]) / storm::utility::convertNumber<ValueType>(2.0);
+                maximalDifference = std::max(maximalDifference, upperX[index] - lowerX[index]);
+            }
+            this->errorBound = maximalDifference / storm::utility::convertNumber<ValueType>(2.0);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            if (columns.empty()) {
+                STORM_LOG_INFO("Interval iteration converged in " << iterationCount << " iterations (error bound " << this->errorBound.get() << ").");
+            } else {
+                STORM_LOG_WARN("Interval iteration did not converge in " << iterationCount << " iterations for " << columns.size() << " of " << numberOfRightHandSides << " equation systems (error bound " << this->errorBound.get() << ").");
+            }
+            return columns.empty();
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::createJacobiDecomposition() const {
+            if (!jacobiDecomposition) {
+                jacobiDecomposition = std::make_unique<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(A->getJacobiDecomposition());
+                if (this->getSettings().getUseCompactMatrix()) {
+                    // Only the compact representation of the LU part is used from now on, so we can release the
+                    // original one.
+                    compactJacobiLU = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(jacobiDecomposition->first);
+                    jacobiDecomposition->first = storm::storage::SparseMatrix<ValueType>();
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::performJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const {
+            if (compactJacobiLU) {
+                compactJacobiLU->multiplyWithVector(x, result);
+            } else {
+                jacobiDecomposition->first.multiplyWithVector(x, result);
+            }
+            storm::utility::vector::subtractVectors(b, result, result);
+            storm::utility::vector::multiplyVectorsPointwise(jacobiDecomposition->second, result, result);
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::performJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, uint64_t numberOfRightHandSides, std::vector<uint_fast64_t> const& columns) const {
+            jacobiDecomposition->first.multiplyWithVectors(x, result, numberOfRightHandSides, columns);
+            for (uint_fast64_t row = 0; row < jacobiDecomposition->second.size(); ++row) {
+                for (auto const& column : columns) {
+                    uint_fast64_t position = row * numberOfRightHandSides + column;
+                    result[position] = jacobiDecomposition->second[row] * (b[position] - result[position]);
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        storm::storage::CompactSparseMatrix<ValueType> const& NativeLinearEquationSolver<ValueType>::getCompactMatrix() const {
+            if (!compactA) {
+                compactA = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(*A);
+            }
+            return *compactA;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::requiresUpperBound() const {
+            return this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration;
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             if (&x != &result) {
-                A->multiplyWithVector(x, result);
+                if (this->getSettings().getUseCompactMatrix()) {
+                    getCompactMatrix().multiplyWithVector(x, result);
+                } else {
+                    A->multiplyWithVector(x, result);
+                }
                 if (b != nullptr) {
                     storm::utility::vector::addVectors(result, *b, result);
                 }
@@ -217,7 +518,11 @@ namespace storm {
                     this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
                 }
                 
-                A->multiplyWithVector(x, *this->cachedRowVector);
+                if (this->getSettings().getUseCompactMatrix()) {
+                    getCompactMatrix().multiplyWithVector(x, *this->cachedRowVector);
+                } else {
+                    A->multiplyWithVector(x, *this->cachedRowVector);
+                }
                 if (b != nullptr) {
                     storm::utility::vector::addVectors(*this->cachedRowVector, *b, result);
                 } else {
@@ -230,6 +535,16 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (this->getSettings().getUseCompactMatrix()) {
+                // The compact matrix has no fused kernel, so we multiply and reduce separately.
+                LinearEquationSolver<ValueType>::multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            } else {
+                A->multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            }
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::setSettings(NativeLinearEquationSolverSettings<ValueType> const& newSettings) {
             settings = newSettings;
@@ -243,6 +558,7 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
             jacobiDecomposition.reset();
+            compactJacobiLU.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
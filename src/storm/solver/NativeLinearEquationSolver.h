@@ -5,6 +5,8 @@
 
 #include "LinearEquationSolver.h"
 
+#include "storm/storage/CompactSparseMatrix.h"
+
 namespace storm {
     namespace solver {
         
@@ -12,7 +14,7 @@ namespace storm {
         class NativeLinearEquationSolverSettings {
         public:
             enum class SolutionMethod {
-                Jacobi, GaussSeidel, SOR
+                Jacobi, GaussSeidel, SOR, IntervalIteration, BlockJacobi
             };
 
             NativeLinearEquationSolverSettings();
@@ -22,12 +24,14 @@ namespace storm {
             void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
             void setRelativeTerminationCriterion(bool value);
             void setOmega(ValueType omega);
+            void setUseCompactMatrix(bool value);
             
             SolutionMethod getSolutionMethod() const;
             ValueType getPrecision() const;
             uint64_t getMaximalNumberOfIterations() const;
             uint64_t getRelativeTerminationCriterion() const;
             ValueType getOmega() const;
+            bool getUseCompactMatrix() const;
             
         private:
             SolutionMethod method;
@@ -35,6 +39,7 @@ namespace storm {
             bool relative;
             uint_fast64_t maximalNumberOfIterations;
             ValueType omega;
+            bool useCompactMatrix;
         };
         
         /*!
@@ -50,7 +55,11 @@ namespace storm {
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
             
             virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const override;
             virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+
+            virtual bool requiresUpperBound() const override;
 
             void setSettings(NativeLinearEquationSolverSettings<ValueType> const& newSettings);
             NativeLinearEquationSolverSettings<ValueType> const& getSettings() const;
@@ -58,9 +67,45 @@ namespace storm {
             virtual void clearCache() const override;
 
         private:
+            /*!
+             * Solves the equation system by performing Jacobi iterations on a lower and an upper bound of the solution
+             * until the two bounds are close enough. This requires that the equation system is of the form (I - P) x = b
+             * for some non-negative (sub-stochastic) matrix P and that bounds on the solution have been set.
+             */
+            bool solveEquationsIntervalIteration(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Solves the (interleaved) equation systems with interval iteration (see solveEquationsIntervalIteration).
+             */
+            bool solveEquationsIntervalIteration(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfRightHandSides) const;
+            
+            /*!
+             * Creates the Jacobi decomposition of the matrix (if not already done).
+             */
+            void createJacobiDecomposition() const;
+            
+            /*!
+             * Computes D^-1 * (b - LU * x), where L, U and D are the parts of the Jacobi decomposition of the matrix.
+             */
+            void performJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const;
+            
+            /*!
+             * Performs the Jacobi step for the (interleaved) solution vectors with the given indices.
+             */
+            void performJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, uint64_t numberOfRightHandSides, std::vector<uint_fast64_t> const& columns) const;
+            
+            /*!
+             * Retrieves the compact representation of the matrix (and creates it if necessary).
+             */
+            storm::storage::CompactSparseMatrix<ValueType> const& getCompactMatrix() const;
+            
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
 
+            // The number of rows per block of the block Jacobi method. It is fixed (rather than derived from the number
+            // of threads), so that the iterations do not depend on the number of threads.
+            static const uint64_t BLOCK_JACOBI_BLOCK_SIZE = 4096;
+
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
             std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
@@ -74,6 +119,11 @@ namespace storm {
             
             // cached auxiliary data
             mutable std::unique_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>> jacobiDecomposition;
+            
+            // If compact matrices are to be used, the compact representations of the matrix and of the LU part of the
+            // Jacobi decomposition. Note that the former is kept until the matrix changes.
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactA;
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactJacobiLU;
         };
         
         template<typename ValueType>
@@ -14,6 +14,12 @@ namespace storm {
                     return "topological";
                 case MinMaxMethod::Acyclic:
                     return "acyclic";
+                case MinMaxMethod::IntervalIteration:
+                    return "intervaliteration";
+                case MinMaxMethod::OptimisticValueIteration:
+                    return "optimisticvalueiteration";
+                case MinMaxMethod::Streaming:
+                    return "streaming";
             }
             return "invalid";
         }
@@ -50,6 +56,10 @@ namespace storm {
                     return "Eigen";
                 case EquationSolverType::Elimination:
                     return "Elimination";
+                case EquationSolverType::Topological:
+                    return "Topological";
+                case EquationSolverType::Streaming:
+                    return "Streaming";
             }
             return "invalid";
         }
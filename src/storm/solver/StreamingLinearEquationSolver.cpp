@@ -0,0 +1,275 @@
+#include "storm/solver/StreamingLinearEquationSolver.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/settings/modules/StreamingEquationSolverSettings.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        StreamingLinearEquationSolverSettings<ValueType>::StreamingLinearEquationSolverSettings() {
+            // The convergence criteria are shared with the native solver.
+            storm::settings::modules::NativeEquationSolverSettings const& nativeSettings = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>();
+            precision = storm::utility::convertNumber<ValueType>(nativeSettings.getPrecision());
+            maximalNumberOfIterations = nativeSettings.getMaximalIterationCount();
+            relative = nativeSettings.getConvergenceCriterion() == storm::settings::modules::NativeEquationSolverSettings::ConvergenceCriterion::Relative;
+
+            storm::settings::modules::StreamingEquationSolverSettings const& streamingSettings = storm::settings::getModule<storm::settings::modules::StreamingEquationSolverSettings>();
+            blockSize = streamingSettings.getBlockSize();
+            if (streamingSettings.isTemporaryDirectorySet()) {
+                temporaryDirectory = streamingSettings.getTemporaryDirectory();
+            }
+            prefetching = streamingSettings.isPrefetchingSet();
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolverSettings<ValueType>::setPrecision(ValueType precision) {
+            this->precision = precision;
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolverSettings<ValueType>::setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations) {
+            this->maximalNumberOfIterations = maximalNumberOfIterations;
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolverSettings<ValueType>::setRelativeTerminationCriterion(bool value) {
+            this->relative = value;
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolverSettings<ValueType>::setBlockSize(uint64_t blockSize) {
+            this->blockSize = blockSize;
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolverSettings<ValueType>::setTemporaryDirectory(std::string const& directory) {
+            this->temporaryDirectory = directory;
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolverSettings<ValueType>::setPrefetching(bool value) {
+            this->prefetching = value;
+        }
+
+        template<typename ValueType>
+        ValueType StreamingLinearEquationSolverSettings<ValueType>::getPrecision() const {
+            return precision;
+        }
+
+        template<typename ValueType>
+        uint64_t StreamingLinearEquationSolverSettings<ValueType>::getMaximalNumberOfIterations() const {
+            return maximalNumberOfIterations;
+        }
+
+        template<typename ValueType>
+        bool StreamingLinearEquationSolverSettings<ValueType>::getRelativeTerminationCriterion() const {
+            return relative;
+        }
+
+        template<typename ValueType>
+        uint64_t StreamingLinearEquationSolverSettings<ValueType>::getBlockSize() const {
+            return blockSize;
+        }
+
+        template<typename ValueType>
+        std::string const& StreamingLinearEquationSolverSettings<ValueType>::getTemporaryDirectory() const {
+            return temporaryDirectory;
+        }
+
+        template<typename ValueType>
+        bool StreamingLinearEquationSolverSettings<ValueType>::getPrefetching() const {
+            return prefetching;
+        }
+
+        template<typename ValueType>
+        StreamingLinearEquationSolver<ValueType>::StreamingLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, StreamingLinearEquationSolverSettings<ValueType> const& settings) : settings(settings) {
+            this->setMatrix(A);
+        }
+
+        template<typename ValueType>
+        StreamingLinearEquationSolver<ValueType>::StreamingLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, StreamingLinearEquationSolverSettings<ValueType> const& settings) : settings(settings) {
+            this->setMatrix(std::move(A));
+        }
+
+        template<typename ValueType>
+        StreamingLinearEquationSolver<ValueType>::StreamingLinearEquationSolver(std::shared_ptr<storm::storage::OutOfCoreSparseMatrix<ValueType>> const& A, StreamingLinearEquationSolverSettings<ValueType> const& settings) : A(A), settings(settings) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
+            this->A = storm::storage::OutOfCoreSparseMatrix<ValueType>::createTemporary(A, settings.getTemporaryDirectory(), settings.getBlockSize(), settings.getPrefetching());
+            this->clearCache();
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
+            // Take posession of the matrix, so its memory is released as soon as it is written to disk.
+            storm::storage::SparseMatrix<ValueType> localA(std::move(A));
+            this->setMatrix(localA);
+        }
+
+        template<typename ValueType>
+        bool StreamingLinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with StreamingLinearEquationSolver (Gauss-Seidel).");
+
+            ValueType precision = this->getSettings().getPrecision();
+            bool relative = this->getSettings().getRelativeTerminationCriterion();
+            uint64_t iterationCount = 0;
+            bool converged = false;
+            while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations()) {
+                converged = true;
+                A->forEachBlock([&] (typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block) {
+                    for (uint64_t row = block.getStartRow(); row < block.getEndRow(); ++row) {
+                        ValueType diagonalElement = storm::utility::zero<ValueType>();
+                        ValueType newValue = b[row];
+                        for (auto it = block.begin(row), ite = block.end(row); it != ite; ++it) {
+                            if (it->getColumn() == row) {
+                                diagonalElement += it->getValue();
+                            } else {
+                                newValue -= it->getValue() * x[it->getColumn()];
+                            }
+                        }
+                        newValue /= diagonalElement;
+                        if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[row], newValue, precision, relative)) {
+                            converged = false;
+                        }
+                        x[row] = newValue;
+                    }
+                });
+                ++iterationCount;
+
+                if (this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(x)) {
+                    break;
+                }
+            }
+
+            if (converged) {
+                STORM_LOG_INFO("Iterative solver converged in " << iterationCount << " iterations.");
+            } else {
+                STORM_LOG_WARN("Iterative solver did not converge in " << iterationCount << " iterations.");
+            }
+            A->logIoStatistics();
+
+            return converged;
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            // If the two vectors are aliases, we need to create a temporary.
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (!this->cachedRowVector) {
+                    this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+                }
+                target = this->cachedRowVector.get();
+            }
+
+            A->forEachBlock([&] (typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block) {
+                for (uint64_t row = block.getStartRow(); row < block.getEndRow(); ++row) {
+                    ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto it = block.begin(row), ite = block.end(row); it != ite; ++it) {
+                        value += it->getValue() * x[it->getColumn()];
+                    }
+                    (*target)[row] = value;
+                }
+            });
+
+            if (target != &result) {
+                result.swap(*target);
+                if (!this->isCachingEnabled()) {
+                    this->clearCache();
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolver<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(rowGroupIndices.size() == A->getRowGroupIndices().size() || A->hasTrivialRowGrouping(), "The row groups do not match the groups of the matrix.");
+            if (!A->hasTrivialRowGrouping()) {
+                // The blocks of the matrix consist of whole row groups, so we can reduce while streaming.
+                std::vector<ValueType> newValues(rowGroupIndices.size() - 1);
+                A->forEachBlock([&] (typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block) {
+                    for (uint64_t group = block.getStartRowGroup(); group < block.getEndRowGroup(); ++group) {
+                        for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                            ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                            for (auto it = block.begin(row), ite = block.end(row); it != ite; ++it) {
+                                value += it->getValue() * x[it->getColumn()];
+                            }
+                            if (row == rowGroupIndices[group] || (minimize(dir) ? value < newValues[group] : value > newValues[group])) {
+                                newValues[group] = value;
+                                if (choices) {
+                                    (*choices)[group] = row - rowGroupIndices[group];
+                                }
+                            }
+                        }
+                    }
+                });
+                result.swap(newValues);
+            } else {
+                // The row groups are not stored in the matrix, so we multiply first and reduce the result afterwards.
+                LinearEquationSolver<ValueType>::multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void StreamingLinearEquationSolver<ValueType>::setSettings(StreamingLinearEquationSolverSettings<ValueType> const& newSettings) {
+            settings = newSettings;
+        }
+
+        template<typename ValueType>
+        StreamingLinearEquationSolverSettings<ValueType> const& StreamingLinearEquationSolver<ValueType>::getSettings() const {
+            return settings;
+        }
+
+        template<typename ValueType>
+        storm::storage::OutOfCoreSparseMatrix<ValueType> const& StreamingLinearEquationSolver<ValueType>::getMatrix() const {
+            return *A;
+        }
+
+        template<typename ValueType>
+        uint64_t StreamingLinearEquationSolver<ValueType>::getMatrixRowCount() const {
+            return this->A->getRowCount();
+        }
+
+        template<typename ValueType>
+        uint64_t StreamingLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
+            return this->A->getColumnCount();
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> StreamingLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+            return std::make_unique<storm::solver::StreamingLinearEquationSolver<ValueType>>(matrix, settings);
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> StreamingLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType>&& matrix) const {
+            return std::make_unique<storm::solver::StreamingLinearEquationSolver<ValueType>>(std::move(matrix), settings);
+        }
+
+        template<typename ValueType>
+        StreamingLinearEquationSolverSettings<ValueType>& StreamingLinearEquationSolverFactory<ValueType>::getSettings() {
+            return settings;
+        }
+
+        template<typename ValueType>
+        StreamingLinearEquationSolverSettings<ValueType> const& StreamingLinearEquationSolverFactory<ValueType>::getSettings() const {
+            return settings;
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<LinearEquationSolverFactory<ValueType>> StreamingLinearEquationSolverFactory<ValueType>::clone() const {
+            return std::make_unique<StreamingLinearEquationSolverFactory<ValueType>>(*this);
+        }
+
+        template class StreamingLinearEquationSolverSettings<double>;
+        template class StreamingLinearEquationSolver<double>;
+        template class StreamingLinearEquationSolverFactory<double>;
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef STORM_SOLVER_STREAMINGLINEAREQUATIONSOLVER_H_
+#define STORM_SOLVER_STREAMINGLINEAREQUATIONSOLVER_H_
+
+#include "storm/solver/LinearEquationSolver.h"
+
+#include "storm/storage/OutOfCoreSparseMatrix.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        class StreamingLinearEquationSolverSettings {
+        public:
+            StreamingLinearEquationSolverSettings();
+
+            void setPrecision(ValueType precision);
+            void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
+            void setRelativeTerminationCriterion(bool value);
+            void setBlockSize(uint64_t blockSize);
+            void setTemporaryDirectory(std::string const& directory);
+            void setPrefetching(bool value);
+
+            ValueType getPrecision() const;
+            uint64_t getMaximalNumberOfIterations() const;
+            bool getRelativeTerminationCriterion() const;
+            uint64_t getBlockSize() const;
+            std::string const& getTemporaryDirectory() const;
+            bool getPrefetching() const;
+
+        private:
+            ValueType precision;
+            uint64_t maximalNumberOfIterations;
+            bool relative;
+
+            // The maximal amount of matrix data (in bytes) that is loaded at once.
+            uint64_t blockSize;
+
+            // The directory in which matrices given in memory are stored. If empty, the system's default is used.
+            std::string temporaryDirectory;
+
+            bool prefetching;
+        };
+
+        /*!
+         * A class that implements the LinearEquationSolver interface for matrices that do not fit into main memory.
+         * The matrix is stored on disk (see storm::storage::OutOfCoreSparseMatrix) and streamed through memory block
+         * by block in every iteration, so only the vectors are kept in memory. Equation systems are solved with the
+         * Gauss-Seidel method, because it updates the solution in place and therefore only needs one pass over the
+         * matrix (and no additional vector) per iteration. Matrices that are given in memory are written to a
+         * temporary file first. After solving, the solver reports the amount of data read and the I/O throughput.
+         */
+        template<typename ValueType>
+        class StreamingLinearEquationSolver : public LinearEquationSolver<ValueType> {
+        public:
+            StreamingLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, StreamingLinearEquationSolverSettings<ValueType> const& settings = StreamingLinearEquationSolverSettings<ValueType>());
+            StreamingLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, StreamingLinearEquationSolverSettings<ValueType> const& settings = StreamingLinearEquationSolverSettings<ValueType>());
+            StreamingLinearEquationSolver(std::shared_ptr<storm::storage::OutOfCoreSparseMatrix<ValueType>> const& A, StreamingLinearEquationSolverSettings<ValueType> const& settings = StreamingLinearEquationSolverSettings<ValueType>());
+
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+
+            virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+
+            void setSettings(StreamingLinearEquationSolverSettings<ValueType> const& newSettings);
+            StreamingLinearEquationSolverSettings<ValueType> const& getSettings() const;
+
+            /*!
+             * Retrieves the matrix of this solver.
+             */
+            storm::storage::OutOfCoreSparseMatrix<ValueType> const& getMatrix() const;
+
+        private:
+            virtual uint64_t getMatrixRowCount() const override;
+            virtual uint64_t getMatrixColumnCount() const override;
+
+            // The matrix on disk.
+            std::shared_ptr<storm::storage::OutOfCoreSparseMatrix<ValueType>> A;
+
+            // The settings used by the solver.
+            StreamingLinearEquationSolverSettings<ValueType> settings;
+        };
+
+        template<typename ValueType>
+        class StreamingLinearEquationSolverFactory : public LinearEquationSolverFactory<ValueType> {
+        public:
+            virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType> const& matrix) const override;
+            virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType>&& matrix) const override;
+
+            StreamingLinearEquationSolverSettings<ValueType>& getSettings();
+            StreamingLinearEquationSolverSettings<ValueType> const& getSettings() const;
+
+            virtual std::unique_ptr<LinearEquationSolverFactory<ValueType>> clone() const override;
+
+        private:
+            StreamingLinearEquationSolverSettings<ValueType> settings;
+        };
+    }
+}
+
+#endif /* STORM_SOLVER_STREAMINGLINEAREQUATIONSOLVER_H_ */
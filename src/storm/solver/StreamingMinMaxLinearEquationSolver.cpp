@@ -0,0 +1,248 @@
+#include "storm/solver/StreamingMinMaxLinearEquationSolver.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/modules/StreamingEquationSolverSettings.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolverSettings<ValueType>::StreamingMinMaxLinearEquationSolverSettings() {
+            // The convergence criteria are shared with the other min/max solvers.
+            storm::settings::modules::MinMaxEquationSolverSettings const& minMaxSettings = storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>();
+            precision = storm::utility::convertNumber<ValueType>(minMaxSettings.getPrecision());
+            maximalNumberOfIterations = minMaxSettings.getMaximalIterationCount();
+            relative = minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Relative;
+
+            storm::settings::modules::StreamingEquationSolverSettings const& streamingSettings = storm::settings::getModule<storm::settings::modules::StreamingEquationSolverSettings>();
+            blockSize = streamingSettings.getBlockSize();
+            if (streamingSettings.isTemporaryDirectorySet()) {
+                temporaryDirectory = streamingSettings.getTemporaryDirectory();
+            }
+            prefetching = streamingSettings.isPrefetchingSet();
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverSettings<ValueType>::setPrecision(ValueType precision) {
+            this->precision = precision;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverSettings<ValueType>::setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations) {
+            this->maximalNumberOfIterations = maximalNumberOfIterations;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverSettings<ValueType>::setRelativeTerminationCriterion(bool value) {
+            this->relative = value;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverSettings<ValueType>::setBlockSize(uint64_t blockSize) {
+            this->blockSize = blockSize;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverSettings<ValueType>::setTemporaryDirectory(std::string const& directory) {
+            this->temporaryDirectory = directory;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverSettings<ValueType>::setPrefetching(bool value) {
+            this->prefetching = value;
+        }
+
+        template<typename ValueType>
+        ValueType StreamingMinMaxLinearEquationSolverSettings<ValueType>::getPrecision() const {
+            return precision;
+        }
+
+        template<typename ValueType>
+        uint64_t StreamingMinMaxLinearEquationSolverSettings<ValueType>::getMaximalNumberOfIterations() const {
+            return maximalNumberOfIterations;
+        }
+
+        template<typename ValueType>
+        bool StreamingMinMaxLinearEquationSolverSettings<ValueType>::getRelativeTerminationCriterion() const {
+            return relative;
+        }
+
+        template<typename ValueType>
+        uint64_t StreamingMinMaxLinearEquationSolverSettings<ValueType>::getBlockSize() const {
+            return blockSize;
+        }
+
+        template<typename ValueType>
+        std::string const& StreamingMinMaxLinearEquationSolverSettings<ValueType>::getTemporaryDirectory() const {
+            return temporaryDirectory;
+        }
+
+        template<typename ValueType>
+        bool StreamingMinMaxLinearEquationSolverSettings<ValueType>::getPrefetching() const {
+            return prefetching;
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolver<ValueType>::StreamingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, StreamingMinMaxLinearEquationSolverSettings<ValueType> const& settings) : settings(settings) {
+            this->A = storm::storage::OutOfCoreSparseMatrix<ValueType>::createTemporary(A, settings.getTemporaryDirectory(), settings.getBlockSize(), settings.getPrefetching());
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolver<ValueType>::StreamingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, StreamingMinMaxLinearEquationSolverSettings<ValueType> const& settings) : settings(settings) {
+            // Take posession of the matrix, so its memory is released as soon as it is written to disk.
+            storm::storage::SparseMatrix<ValueType> localA(std::move(A));
+            this->A = storm::storage::OutOfCoreSparseMatrix<ValueType>::createTemporary(localA, settings.getTemporaryDirectory(), settings.getBlockSize(), settings.getPrefetching());
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolver<ValueType>::StreamingMinMaxLinearEquationSolver(std::shared_ptr<storm::storage::OutOfCoreSparseMatrix<ValueType>> const& A, StreamingMinMaxLinearEquationSolverSettings<ValueType> const& settings) : A(A), settings(settings) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        bool StreamingMinMaxLinearEquationSolver<ValueType>::solveEquations(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving min/max equation system (" << x.size() << " row groups) with StreamingMinMaxLinearEquationSolver (Gauss-Seidel value iteration).");
+
+            ValueType precision = this->getSettings().getPrecision();
+            bool relative = this->getSettings().getRelativeTerminationCriterion();
+            uint64_t iterationCount = 0;
+            bool converged = false;
+            while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations()) {
+                converged = true;
+                A->forEachBlock([&] (typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block) {
+                    for (uint64_t group = block.getStartRowGroup(); group < block.getEndRowGroup(); ++group) {
+                        ValueType newValue = computeOptimalValue(dir, block, group, x, &b);
+                        if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[group], newValue, precision, relative)) {
+                            converged = false;
+                        }
+                        x[group] = newValue;
+                    }
+                });
+                ++iterationCount;
+
+                if (this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(x)) {
+                    break;
+                }
+            }
+
+            if (converged) {
+                STORM_LOG_INFO("Iterative solver converged in " << iterationCount << " iterations.");
+            } else {
+                STORM_LOG_WARN("Iterative solver did not converge in " << iterationCount << " iterations.");
+            }
+
+            // If requested, we extract the scheduler with one more pass over the matrix.
+            if (this->isTrackSchedulerSet()) {
+                std::vector<uint_fast64_t> choices(A->getRowGroupCount());
+                A->forEachBlock([&] (typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block) {
+                    for (uint64_t group = block.getStartRowGroup(); group < block.getEndRowGroup(); ++group) {
+                        computeOptimalValue(dir, block, group, x, &b, &choices[group]);
+                    }
+                });
+                this->schedulerChoices = std::move(choices);
+            }
+            A->logIoStatistics();
+
+            return converged;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolver<ValueType>::repeatedMultiply(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
+            std::vector<ValueType> newX(x.size());
+            for (uint_fast64_t iteration = 0; iteration < n; ++iteration) {
+                A->forEachBlock([&] (typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block) {
+                    for (uint64_t group = block.getStartRowGroup(); group < block.getEndRowGroup(); ++group) {
+                        newX[group] = computeOptimalValue(dir, block, group, x, b);
+                    }
+                });
+                x.swap(newX);
+            }
+        }
+
+        template<typename ValueType>
+        ValueType StreamingMinMaxLinearEquationSolver<ValueType>::computeOptimalValue(OptimizationDirection dir, typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block, uint64_t group, std::vector<ValueType> const& x, std::vector<ValueType> const* b, uint_fast64_t* choice) const {
+            auto const& rowGroupIndices = A->getRowGroupIndices();
+            ValueType optimalValue = storm::utility::zero<ValueType>();
+            for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                for (auto it = block.begin(row), ite = block.end(row); it != ite; ++it) {
+                    value += it->getValue() * x[it->getColumn()];
+                }
+                if (row == rowGroupIndices[group] || (minimize(dir) ? value < optimalValue : value > optimalValue)) {
+                    optimalValue = value;
+                    if (choice) {
+                        *choice = row - rowGroupIndices[group];
+                    }
+                }
+            }
+            return optimalValue;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolver<ValueType>::setSettings(StreamingMinMaxLinearEquationSolverSettings<ValueType> const& newSettings) {
+            settings = newSettings;
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolverSettings<ValueType> const& StreamingMinMaxLinearEquationSolver<ValueType>::getSettings() const {
+            return settings;
+        }
+
+        template<typename ValueType>
+        storm::storage::OutOfCoreSparseMatrix<ValueType> const& StreamingMinMaxLinearEquationSolver<ValueType>::getMatrix() const {
+            return *A;
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolverFactory<ValueType>::StreamingMinMaxLinearEquationSolverFactory(bool trackScheduler) : MinMaxLinearEquationSolverFactory<ValueType>(MinMaxMethodSelection::Streaming, trackScheduler) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> StreamingMinMaxLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+            std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> result = std::make_unique<StreamingMinMaxLinearEquationSolver<ValueType>>(matrix, settings);
+            result->setTrackScheduler(this->isTrackSchedulerSet());
+            return result;
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> StreamingMinMaxLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType>&& matrix) const {
+            std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> result = std::make_unique<StreamingMinMaxLinearEquationSolver<ValueType>>(std::move(matrix), settings);
+            result->setTrackScheduler(this->isTrackSchedulerSet());
+            return result;
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverFactory<ValueType>::setMinMaxMethod(MinMaxMethodSelection const& newMethod) {
+            STORM_LOG_THROW(newMethod == MinMaxMethodSelection::Streaming, storm::exceptions::InvalidOperationException, "The factory can only create streaming MinMax solvers.");
+            MinMaxLinearEquationSolverFactory<ValueType>::setMinMaxMethod(newMethod);
+        }
+
+        template<typename ValueType>
+        void StreamingMinMaxLinearEquationSolverFactory<ValueType>::setMinMaxMethod(MinMaxMethod const& newMethod) {
+            STORM_LOG_THROW(newMethod == MinMaxMethod::Streaming, storm::exceptions::InvalidOperationException, "The factory can only create streaming MinMax solvers.");
+            MinMaxLinearEquationSolverFactory<ValueType>::setMinMaxMethod(newMethod);
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolverSettings<ValueType>& StreamingMinMaxLinearEquationSolverFactory<ValueType>::getSettings() {
+            return settings;
+        }
+
+        template<typename ValueType>
+        StreamingMinMaxLinearEquationSolverSettings<ValueType> const& StreamingMinMaxLinearEquationSolverFactory<ValueType>::getSettings() const {
+            return settings;
+        }
+
+        template class StreamingMinMaxLinearEquationSolverSettings<double>;
+        template class StreamingMinMaxLinearEquationSolver<double>;
+        template class StreamingMinMaxLinearEquationSolverFactory<double>;
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef STORM_SOLVER_STREAMINGMINMAXLINEAREQUATIONSOLVER_H_
+#define STORM_SOLVER_STREAMINGMINMAXLINEAREQUATIONSOLVER_H_
+
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+
+#include "storm/storage/OutOfCoreSparseMatrix.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        class StreamingMinMaxLinearEquationSolverSettings {
+        public:
+            StreamingMinMaxLinearEquationSolverSettings();
+
+            void setPrecision(ValueType precision);
+            void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
+            void setRelativeTerminationCriterion(bool value);
+            void setBlockSize(uint64_t blockSize);
+            void setTemporaryDirectory(std::string const& directory);
+            void setPrefetching(bool value);
+
+            ValueType getPrecision() const;
+            uint64_t getMaximalNumberOfIterations() const;
+            bool getRelativeTerminationCriterion() const;
+            uint64_t getBlockSize() const;
+            std::string const& getTemporaryDirectory() const;
+            bool getPrefetching() const;
+
+        private:
+            ValueType precision;
+            uint64_t maximalNumberOfIterations;
+            bool relative;
+
+            // The maximal amount of matrix data (in bytes) that is loaded at once.
+            uint64_t blockSize;
+
+            // The directory in which matrices given in memory are stored. If empty, the system's default is used.
+            std::string temporaryDirectory;
+
+            bool prefetching;
+        };
+
+        /*!
+         * A min/max linear equation solver for matrices that do not fit into main memory. The matrix is stored on disk
+         * (see storm::storage::OutOfCoreSparseMatrix) and streamed through memory block by block, so only the vectors
+         * are kept in memory. The equation system is solved by value iteration in Gauss-Seidel style, i.e. the values
+         * of a row group are updated as soon as the group has been processed, which requires only one pass over the
+         * matrix per iteration. After solving, the solver reports the amount of data read and the I/O throughput.
+         */
+        template<typename ValueType>
+        class StreamingMinMaxLinearEquationSolver : public MinMaxLinearEquationSolver<ValueType> {
+        public:
+            StreamingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, StreamingMinMaxLinearEquationSolverSettings<ValueType> const& settings = StreamingMinMaxLinearEquationSolverSettings<ValueType>());
+            StreamingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, StreamingMinMaxLinearEquationSolverSettings<ValueType> const& settings = StreamingMinMaxLinearEquationSolverSettings<ValueType>());
+            StreamingMinMaxLinearEquationSolver(std::shared_ptr<storm::storage::OutOfCoreSparseMatrix<ValueType>> const& A, StreamingMinMaxLinearEquationSolverSettings<ValueType> const& settings = StreamingMinMaxLinearEquationSolverSettings<ValueType>());
+
+            virtual bool solveEquations(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual void repeatedMultiply(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const override;
+
+            void setSettings(StreamingMinMaxLinearEquationSolverSettings<ValueType> const& newSettings);
+            StreamingMinMaxLinearEquationSolverSettings<ValueType> const& getSettings() const;
+
+            /*!
+             * Retrieves the matrix of this solver.
+             */
+            storm::storage::OutOfCoreSparseMatrix<ValueType> const& getMatrix() const;
+
+        private:
+            /*!
+             * Computes the optimal value of the given row group (which needs to be part of the block) based on the
+             * given values. If requested, the index of the optimal row within the group is written to the choice.
+             */
+            ValueType computeOptimalValue(OptimizationDirection dir, typename storm::storage::OutOfCoreSparseMatrix<ValueType>::Block const& block, uint64_t group, std::vector<ValueType> const& x, std::vector<ValueType> const* b, uint_fast64_t* choice = nullptr) const;
+
+            // The matrix on disk.
+            std::shared_ptr<storm::storage::OutOfCoreSparseMatrix<ValueType>> A;
+
+            // The settings used by the solver.
+            StreamingMinMaxLinearEquationSolverSettings<ValueType> settings;
+        };
+
+        template<typename ValueType>
+        class StreamingMinMaxLinearEquationSolverFactory : public MinMaxLinearEquationSolverFactory<ValueType> {
+        public:
+            StreamingMinMaxLinearEquationSolverFactory(bool trackScheduler = false);
+
+            virtual std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType> const& matrix) const override;
+            virtual std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType>&& matrix) const override;
+
+            virtual void setMinMaxMethod(MinMaxMethodSelection const& newMethod) override;
+            virtual void setMinMaxMethod(MinMaxMethod const& newMethod) override;
+
+            StreamingMinMaxLinearEquationSolverSettings<ValueType>& getSettings();
+            StreamingMinMaxLinearEquationSolverSettings<ValueType> const& getSettings() const;
+
+        private:
+            StreamingMinMaxLinearEquationSolverSettings<ValueType> settings;
+        };
+    }
+}
+
+#endif /* STORM_SOLVER_STREAMINGMINMAXLINEAREQUATIONSOLVER_H_ */
@@ -0,0 +1,334 @@
+#include "storm/solver/TopologicalLinearEquationSolver.h"
+
+#include <atomic>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/TopologicalEquationSolverSettings.h"
+
+#include "storm/solver/GmmxxLinearEquationSolver.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
+#include "storm/solver/EigenLinearEquationSolver.h"
+#include "storm/solver/EliminationLinearEquationSolver.h"
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolverSettings<ValueType>::TopologicalLinearEquationSolverSettings() {
+            sccSolverType = storm::settings::getModule<storm::settings::modules::TopologicalEquationSolverSettings>().getSccEquationSolver();
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolverSettings<ValueType>::setSccSolverType(EquationSolverType const& solverType) {
+            STORM_LOG_THROW(solverType != EquationSolverType::Topological, storm::exceptions::InvalidSettingsException, "The topological solver cannot be used to solve the SCCs.");
+            this->sccSolverType = solverType;
+        }
+
+        template<typename ValueType>
+        EquationSolverType TopologicalLinearEquationSolverSettings<ValueType>::getSccSolverType() const {
+            return sccSolverType;
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory) : localA(nullptr), A(nullptr), sccSolverFactory(std::move(sccSolverFactory)) {
+            this->setMatrix(A);
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory) : localA(nullptr), A(nullptr), sccSolverFactory(std::move(sccSolverFactory)) {
+            this->setMatrix(std::move(A));
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
+            this->A = &A;
+            localA.reset();
+            this->clearCache();
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
+            localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+            this->A = localA.get();
+            this->clearCache();
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::computeSccLevels() const {
+            storm::storage::StronglyConnectedComponentDecomposition<ValueType> decomposition(*this->A, false, false);
+            STORM_LOG_INFO("Decomposed equation system (" << this->A->getRowCount() << " rows) into " << decomposition.size() << " SCCs.");
+
+            rowToSccIndex = std::make_unique<std::vector<uint_fast64_t>>(this->A->getRowCount());
+            rowIndicesInScc = std::make_unique<std::vector<uint_fast64_t>>(this->A->getRowCount());
+            for (uint_fast64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+                uint_fast64_t indexInScc = 0;
+                for (auto const& row : decomposition[sccIndex]) {
+                    (*rowToSccIndex)[row] = sccIndex;
+                    (*rowIndicesInScc)[row] = indexInScc;
+                    ++indexInScc;
+                }
+            }
+
+            // Determine for each SCC the number of distinct SCCs it depends on and for each SCC the SCCs that depend on it.
+            std::vector<uint_fast64_t> numberOfUnsolvedDependencies(decomposition.size(), 0);
+            std::vector<std::vector<uint_fast64_t>> dependentSccs(decomposition.size());
+            std::vector<uint_fast64_t> lastSeenBy(decomposition.size(), decomposition.size());
+            for (uint_fast64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+                lastSeenBy[sccIndex] = sccIndex;
+                for (auto const& row : decomposition[sccIndex]) {
+                    for (auto const& entry : this->A->getRow(row)) {
+                        uint_fast64_t successorScc = (*rowToSccIndex)[entry.getColumn()];
+                        if (lastSeenBy[successorScc] != sccIndex) {
+                            lastSeenBy[successorScc] = sccIndex;
+                            ++numberOfUnsolvedDependencies[sccIndex];
+                            dependentSccs[successorScc].push_back(sccIndex);
+                        }
+                    }
+                }
+            }
+
+            // Now group the SCCs into levels. An SCC is put into the first level after all the SCCs it depends on.
+            std::vector<uint_fast64_t> currentLevel;
+            for (uint_fast64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+                if (numberOfUnsolvedDependencies[sccIndex] == 0) {
+                    currentLevel.push_back(sccIndex);
+                }
+            }
+
+            sccLevels = std::make_unique<std::vector<std::vector<storm::storage::StateBlock>>>();
+            while (!currentLevel.empty()) {
+                std::vector<uint_fast64_t> nextLevel;
+                sccLevels->emplace_back();
+                sccLevels->back().reserve(currentLevel.size());
+                for (auto const& sccIndex : currentLevel) {
+                    for (auto const& dependentScc : dependentSccs[sccIndex]) {
+                        if (--numberOfUnsolvedDependencies[dependentScc] == 0) {
+                            nextLevel.push_back(dependentScc);
+                        }
+                    }
+                    sccLevels->back().push_back(std::move(decomposition[sccIndex]));
+                }
+                currentLevel = std::move(nextLevel);
+            }
+            STORM_LOG_INFO("Solving the SCCs in " << sccLevels->size() << " levels.");
+        }
+
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with the topological solver");
+
+            if (!sccLevels) {
+                computeSccLevels();
+            }
+
+            bool result = true;
+            for (auto const& level : *sccLevels) {
+                uint_fast64_t rowsInLevel = 0;
+                for (auto const& scc : level) {
+                    rowsInLevel += scc.size();
+                }
+
+                if (level.size() > 1 && storm::utility::parallel::useParallelExecution<ValueType>(rowsInLevel)) {
+                    // The SCCs of one level do not depend on each other, so they can be solved in parallel. As every
+                    // SCC only writes the entries of x that belong to its own rows, no synchronization is needed.
+                    std::atomic<bool> levelResult(true);
+                    storm::utility::parallel::parallelFor(0, level.size(), 1, [&] (uint64_t begin, uint64_t end) {
+                        for (uint64_t sccIndex = begin; sccIndex < end; ++sccIndex) {
+                            if (!solveScc(level[sccIndex], x, b)) {
+                                levelResult = false;
+                            }
+                        }
+                    });
+                    result &= levelResult.load();
+                } else {
+                    for (auto const& scc : level) {
+                        result &= solveScc(scc, x, b);
+                    }
+                }
+            }
+
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+
+            return result;
+        }
+
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::storage::StateBlock const& scc, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (scc.size() == 1) {
+                // A trivial SCC consists of a single equation, which we can solve directly.
+                uint_fast64_t row = *scc.begin();
+                ValueType diagonalValue = storm::utility::zero<ValueType>();
+                ValueType rowValue = b[row];
+                for (auto const& entry : this->A->getRow(row)) {
+                    if (entry.getColumn() == row) {
+                        diagonalValue += entry.getValue();
+                    } else {
+                        rowValue -= entry.getValue() * x[entry.getColumn()];
+                    }
+                }
+                STORM_LOG_THROW(!storm::utility::isZero(diagonalValue), storm::exceptions::InvalidStateException, "Unable to solve equation system: the equation system is singular in row " << row << ".");
+                x[row] = rowValue / diagonalValue;
+                return true;
+            }
+
+            // Build the equation system restricted to the SCC. All values outside the SCC are already known, so their
+            // contribution is moved to the right-hand side.
+            storm::storage::SparseMatrixBuilder<ValueType> builder(scc.size(), scc.size());
+            std::vector<ValueType> sccB;
+            sccB.reserve(scc.size());
+            uint_fast64_t localRow = 0;
+            for (auto const& row : scc) {
+                ValueType rowValue = b[row];
+                for (auto const& entry : this->A->getRow(row)) {
+                    if ((*rowToSccIndex)[entry.getColumn()] == (*rowToSccIndex)[row]) {
+                        builder.addNextValue(localRow, (*rowIndicesInScc)[entry.getColumn()], entry.getValue());
+                    } else {
+                        rowValue -= entry.getValue() * x[entry.getColumn()];
+                    }
+                }
+                sccB.push_back(std::move(rowValue));
+                ++localRow;
+            }
+
+            std::vector<ValueType> sccX;
+            sccX.reserve(scc.size());
+            for (auto const& row : scc) {
+                sccX.push_back(x[row]);
+            }
+
+            std::unique_ptr<LinearEquationSolver<ValueType>> sccSolver = sccSolverFactory->create(builder.build());
+            if (this->lowerBound) {
+                sccSolver->setLowerBound(this->lowerBound.get());
+            }
+            if (this->upperBound) {
+                sccSolver->setUpperBound(this->upperBound.get());
+            }
+            bool result = sccSolver->solveEquations(sccX, sccB);
+
+            auto sccXIt = sccX.begin();
+            for (auto const& row : scc) {
+                x[row] = std::move(*sccXIt);
+                ++sccXIt;
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (&x != &result) {
+                A->multiplyWithVector(x, result);
+                if (b != nullptr) {
+                    storm::utility::vector::addVectors(result, *b, result);
+                }
+            } else {
+                // If the two vectors are aliases, we need to create a temporary.
+                std::vector<ValueType> tmp(result.size());
+                A->multiplyWithVector(x, tmp);
+                if (b != nullptr) {
+                    storm::utility::vector::addVectors(tmp, *b, result);
+                } else {
+                    result.swap(tmp);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
+            sccLevels.reset();
+            rowIndicesInScc.reset();
+            rowToSccIndex.reset();
+            LinearEquationSolver<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        uint64_t TopologicalLinearEquationSolver<ValueType>::getMatrixRowCount() const {
+            return this->A->getRowCount();
+        }
+
+        template<typename ValueType>
+        uint64_t TopologicalLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
+            return this->A->getColumnCount();
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+            return std::make_unique<storm::solver::TopologicalLinearEquationSolver<ValueType>>(matrix, createSccSolverFactory());
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType>&& matrix) const {
+            return std::make_unique<storm::solver::TopologicalLinearEquationSolver<ValueType>>(std::move(matrix), createSccSolverFactory());
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<LinearEquationSolverFactory<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::createSccSolverFactory() const {
+            switch (settings.getSccSolverType()) {
+                case EquationSolverType::Gmmxx: return std::make_unique<GmmxxLinearEquationSolverFactory<ValueType>>();
+                case EquationSolverType::Native: return std::make_unique<NativeLinearEquationSolverFactory<ValueType>>();
+                case EquationSolverType::Eigen: return std::make_unique<EigenLinearEquationSolverFactory<ValueType>>();
+                case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolverFactory<ValueType>>();
+                default: STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported equation solver for the SCCs of the topological solver.");
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        std::unique_ptr<LinearEquationSolverFactory<storm::RationalNumber>> TopologicalLinearEquationSolverFactory<storm::RationalNumber>::createSccSolverFactory() const {
+            switch (settings.getSccSolverType()) {
+                case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolverFactory<storm::RationalNumber>>();
+                default: return std::make_unique<EigenLinearEquationSolverFactory<storm::RationalNumber>>();
+            }
+        }
+
+        template<>
+        std::unique_ptr<LinearEquationSolverFactory<storm::RationalFunction>> TopologicalLinearEquationSolverFactory<storm::RationalFunction>::createSccSolverFactory() const {
+            switch (settings.getSccSolverType()) {
+                case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolverFactory<storm::RationalFunction>>();
+                default: return std::make_unique<EigenLinearEquationSolverFactory<storm::RationalFunction>>();
+            }
+        }
+#endif
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolverSettings<ValueType>& TopologicalLinearEquationSolverFactory<ValueType>::getSettings() {
+            return settings;
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolverSettings<ValueType> const& TopologicalLinearEquationSolverFactory<ValueType>::getSettings() const {
+            return settings;
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<LinearEquationSolverFactory<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::clone() const {
+            return std::make_unique<TopologicalLinearEquationSolverFactory<ValueType>>(*this);
+        }
+
+        template class TopologicalLinearEquationSolverSettings<double>;
+        template class TopologicalLinearEquationSolver<double>;
+        template class TopologicalLinearEquationSolverFactory<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class TopologicalLinearEquationSolverSettings<storm::RationalNumber>;
+        template class TopologicalLinearEquationSolverSettings<storm::RationalFunction>;
+
+        template class TopologicalLinearEquationSolver<storm::RationalNumber>;
+        template class TopologicalLinearEquationSolver<storm::RationalFunction>;
+
+        template class TopologicalLinearEquationSolverFactory<storm::RationalNumber>;
+        template class TopologicalLinearEquationSolverFactory<storm::RationalFunction>;
+#endif
+    }
+}
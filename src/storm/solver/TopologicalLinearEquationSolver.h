@@ -0,0 +1,110 @@
+#ifndef STORM_SOLVER_TOPOLOGICALLINEAREQUATIONSOLVER_H_
+#define STORM_SOLVER_TOPOLOGICALLINEAREQUATIONSOLVER_H_
+
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/SolverSelectionOptions.h"
+
+#include "storm/storage/StateBlock.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        class TopologicalLinearEquationSolverSettings {
+        public:
+            TopologicalLinearEquationSolverSettings();
+
+            void setSccSolverType(EquationSolverType const& solverType);
+
+            EquationSolverType getSccSolverType() const;
+
+        private:
+            // The type of the solver that is used for the equation systems of the non-trivial SCCs.
+            EquationSolverType sccSolverType;
+        };
+
+        /*!
+         * A class that implements the LinearEquationSolver interface by decomposing the equation system into its
+         * strongly connected components (SCCs) and solving them one after another in a topological order. That is, an
+         * SCC is only solved after the values of all SCCs it depends on are known. The equation of a trivial SCC (i.e.
+         * one consisting of a single row) is solved directly and the equation systems of the remaining SCCs are handed
+         * to another linear equation solver. SCCs that do not depend on each other are solved in parallel if parallel
+         * execution is enabled.
+         */
+        template<typename ValueType>
+        class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
+        public:
+            TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory);
+            TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory);
+
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+
+            virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+
+            virtual void clearCache() const override;
+
+        private:
+            /*!
+             * Computes the SCC decomposition of the equation system and groups the SCCs into levels such that the
+             * SCCs of each level only depend on SCCs of lower levels.
+             */
+            void computeSccLevels() const;
+
+            /*!
+             * Solves the equation system restricted to the given SCC, assuming that the values of all rows outside the
+             * SCC on which it depends are already stored in x.
+             *
+             * @return True iff the solving succeeded.
+             */
+            bool solveScc(storm::storage::StateBlock const& scc, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            virtual uint64_t getMatrixRowCount() const override;
+            virtual uint64_t getMatrixColumnCount() const override;
+
+            // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
+            // when the solver is destructed.
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+
+            // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
+            // the pointer refers to localA.
+            storm::storage::SparseMatrix<ValueType> const* A;
+
+            // The factory used to obtain the solvers for the non-trivial SCCs.
+            std::unique_ptr<LinearEquationSolverFactory<ValueType>> sccSolverFactory;
+
+            // cached auxiliary data
+            // The SCCs of the equation system, grouped by their level in the dependency order of the SCCs.
+            mutable std::unique_ptr<std::vector<std::vector<storm::storage::StateBlock>>> sccLevels;
+
+            // For each row, the index of the row within its SCC.
+            mutable std::unique_ptr<std::vector<uint_fast64_t>> rowIndicesInScc;
+
+            // For each row, the index of the SCC it belongs to.
+            mutable std::unique_ptr<std::vector<uint_fast64_t>> rowToSccIndex;
+        };
+
+        template<typename ValueType>
+        class TopologicalLinearEquationSolverFactory : public LinearEquationSolverFactory<ValueType> {
+        public:
+            virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType> const& matrix) const override;
+            virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType>&& matrix) const override;
+
+            TopologicalLinearEquationSolverSettings<ValueType>& getSettings();
+            TopologicalLinearEquationSolverSettings<ValueType> const& getSettings() const;
+
+            virtual std::unique_ptr<LinearEquationSolverFactory<ValueType>> clone() const override;
+
+        private:
+            /*!
+             * Creates the factory for the solvers of the non-trivial SCCs as specified by the settings.
+             */
+            std::unique_ptr<LinearEquationSolverFactory<ValueType>> createSccSolverFactory() const;
+
+            TopologicalLinearEquationSolverSettings<ValueType> settings;
+        };
+    }
+}
+
+#endif /* STORM_SOLVER_TOPOLOGICALLINEAREQUATIONSOLVER_H_ */
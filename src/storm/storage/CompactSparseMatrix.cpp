@@ -0,0 +1,241 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            template<typename ValueType>
+            struct PlainValues {
+                ValueType operator()(uint64_t entry) const {
+                    return values[entry];
+                }
+
+                ValueType const* values;
+            };
+
+            template<typename ValueType, typename IndexType>
+            struct DictionaryValues {
+                ValueType operator()(uint64_t entry) const {
+                    return dictionary[indices[entry]];
+                }
+
+                ValueType const* dictionary;
+                IndexType const* indices;
+            };
+        }
+
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool deduplicateValues) : columnCount(matrix.getColumnCount()), valueStorage(ValueStorage::Plain) {
+            uint64_t entryCount = matrix.getEntryCount();
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                rowIndications.push_back(std::distance(matrix.begin(), matrix.begin(row)));
+            }
+            rowIndications.push_back(entryCount);
+
+            if (columnCount <= static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1) {
+                narrowColumns.reserve(entryCount);
+                for (auto it = matrix.begin(), ite = matrix.end(); it != ite; ++it) {
+                    narrowColumns.push_back(static_cast<uint32_t>(it->getColumn()));
+                }
+            } else {
+                wideColumns.reserve(entryCount);
+                for (auto it = matrix.begin(), ite = matrix.end(); it != ite; ++it) {
+                    wideColumns.push_back(it->getColumn());
+                }
+            }
+
+            if (deduplicateValues) {
+                // Collect the distinct values, but give up as soon as they do not fit into the largest dictionary.
+                uint64_t const maximalDictionarySize = static_cast<uint64_t>(std::numeric_limits<uint16_t>::max()) + 1;
+                std::unordered_map<ValueType, uint64_t> valueToIndex;
+                for (auto it = matrix.begin(), ite = matrix.end(); it != ite && valueToIndex.size() <= maximalDictionarySize; ++it) {
+                    valueToIndex.emplace(it->getValue(), valueToIndex.size());
+                }
+
+                if (valueToIndex.size() <= maximalDictionarySize) {
+                    values.resize(valueToIndex.size());
+                    for (auto const& valueIndexPair : valueToIndex) {
+                        values[valueIndexPair.second] = valueIndexPair.first;
+                    }
+
+                    if (valueToIndex.size() <= static_cast<uint64_t>(std::numeric_limits<uint8_t>::max()) + 1) {
+                        valueStorage = ValueStorage::ByteDictionary;
+                        byteValueIndices.reserve(entryCount);
+                        for (auto it = matrix.begin(), ite = matrix.end(); it != ite; ++it) {
+                            byteValueIndices.push_back(static_cast<uint8_t>(valueToIndex[it->getValue()]));
+                        }
+                    } else {
+                        valueStorage = ValueStorage::ShortDictionary;
+                        shortValueIndices.reserve(entryCount);
+                        for (auto it = matrix.begin(), ite = matrix.end(); it != ite; ++it) {
+                            shortValueIndices.push_back(static_cast<uint16_t>(valueToIndex[it->getValue()]));
+                        }
+                    }
+                }
+            }
+
+            if (valueStorage == ValueStorage::Plain) {
+                values.reserve(entryCount);
+                for (auto it = matrix.begin(), ite = matrix.end(); it != ite; ++it) {
+                    values.push_back(it->getValue());
+                }
+            }
+
+            STORM_LOG_TRACE("Compacted matrix with " << entryCount << " entries to " << this->getSizeInBytes() << " bytes.");
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getEntryCount() const {
+            return rowIndications.back();
+        }
+
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::hasNarrowColumnIndices() const {
+            return wideColumns.empty();
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::ValueStorage CompactSparseMatrix<ValueType>::getValueStorage() const {
+            return valueStorage;
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getNumberOfStoredValues() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getSizeInBytes() const {
+            uint64_t size = sizeof(*this);
+            size += rowIndications.size() * sizeof(uint64_t);
+            size += narrowColumns.size() * sizeof(uint32_t) + wideColumns.size() * sizeof(uint64_t);
+            size += values.size() * sizeof(ValueType);
+            size += byteValueIndices.size() * sizeof(uint8_t) + shortValueIndices.size() * sizeof(uint16_t);
+            return size;
+        }
+
+        template<typename ValueType>
+        template<typename Function>
+        void CompactSparseMatrix<ValueType>::dispatch(Function const& function) const {
+            auto dispatchValues = [&] (auto const* columns) {
+                switch (valueStorage) {
+                    case ValueStorage::Plain:
+                        function(columns, PlainValues<ValueType>{values.data()});
+                        break;
+                    case ValueStorage::ByteDictionary:
+                        function(columns, DictionaryValues<ValueType, uint8_t>{values.data(), byteValueIndices.data()});
+                        break;
+                    case ValueStorage::ShortDictionary:
+                        function(columns, DictionaryValues<ValueType, uint16_t>{values.data(), shortValueIndices.data()});
+                        break;
+                }
+            };
+
+            if (this->hasNarrowColumnIndices()) {
+                dispatchValues(narrowColumns.data());
+            } else {
+                dispatchValues(wideColumns.data());
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+            STORM_LOG_ASSERT(&vector != &result, "Matrix-vector-multiplication requires different input and output vectors.");
+            this->dispatch([&] (auto const* columns, auto const& valueOf) {
+                auto multiplyRows = [&] (uint64_t startRow, uint64_t endRow) {
+                    uint64_t entry = rowIndications[startRow];
+                    for (uint64_t row = startRow; row < endRow; ++row) {
+                        ValueType newValue = storm::utility::zero<ValueType>();
+                        for (uint64_t rowEnd = rowIndications[row + 1]; entry < rowEnd; ++entry) {
+                            newValue += valueOf(entry) * vector[columns[entry]];
+                        }
+                        result[row] = newValue;
+                    }
+                };
+
+                if (storm::utility::parallel::useParallelExecution<ValueType>(this->getEntryCount())) {
+                    storm::utility::parallel::parallelFor(0, this->getRowCount(), 64, multiplyRows);
+                } else {
+                    multiplyRows(0, this->getRowCount());
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            this->dispatch([&] (auto const* columns, auto const& valueOf) {
+                uint64_t entry = 0;
+                for (uint64_t row = 0; row < this->getRowCount(); ++row) {
+                    ValueType tmpValue = storm::utility::zero<ValueType>();
+                    ValueType diagonalElement = storm::utility::zero<ValueType>();
+                    for (uint64_t rowEnd = rowIndications[row + 1]; entry < rowEnd; ++entry) {
+                        uint64_t column = columns[entry];
+                        if (column != row) {
+                            tmpValue += valueOf(entry) * x[column];
+                        } else {
+                            diagonalElement += valueOf(entry);
+                        }
+                    }
+                    x[row] = ((storm::utility::one<ValueType>() - omega) * x[row]) + (omega / diagonalElement) * (b[row] - tmpValue);
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::performBlockJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, uint64_t blockSize) const {
+            STORM_LOG_ASSERT(&x != &result, "The block Jacobi step requires different input and output vectors.");
+            uint64_t numberOfBlocks = (this->getRowCount() + blockSize - 1) / blockSize;
+            this->dispatch([&] (auto const* columns, auto const& valueOf) {
+                auto processBlocks = [&] (uint64_t startBlock, uint64_t endBlock) {
+                    for (uint64_t block = startBlock; block < endBlock; ++block) {
+                        uint64_t startRow = block * blockSize;
+                        uint64_t endRow = std::min(startRow + blockSize, this->getRowCount());
+                        uint64_t entry = rowIndications[startRow];
+                        for (uint64_t row = startRow; row < endRow; ++row) {
+                            ValueType tmpValue = storm::utility::zero<ValueType>();
+                            ValueType diagonalElement = storm::utility::zero<ValueType>();
+                            for (uint64_t rowEnd = rowIndications[row + 1]; entry < rowEnd; ++entry) {
+                                uint64_t column = columns[entry];
+                                if (column == row) {
+                                    diagonalElement += valueOf(entry);
+                                } else if (column >= startRow && column < row) {
+                                    tmpValue += valueOf(entry) * result[column];
+                                } else {
+                                    tmpValue += valueOf(entry) * x[column];
+                                }
+                            }
+                            result[row] = (b[row] - tmpValue) / diagonalElement;
+                        }
+                    }
+                };
+
+                if (storm::utility::parallel::useParallelExecution<ValueType>(this->getEntryCount()) && numberOfBlocks > 1) {
+                    storm::utility::parallel::parallelFor(0, numberOfBlocks, 1, processBlocks);
+                } else {
+                    processBlocks(0, numberOfBlocks);
+                }
+            });
+        }
+
+        template class CompactSparseMatrix<double>;
+    }
+}
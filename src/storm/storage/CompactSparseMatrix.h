@@ -0,0 +1,141 @@
+#ifndef STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+#define STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only representation of a sparse matrix that reduces the memory needed per entry. While the entries of
+         * a SparseMatrix occupy 16 bytes each (for double values), this representation stores the columns and the
+         * values in separate arrays. The column indices are stored with 32 bits whenever the number of columns
+         * permits this. Moreover, if the matrix has only a few distinct values (which is typical for models in which
+         * the probabilities stem from a small set of constants), the values are stored in a dictionary and every entry
+         * only refers to its value by means of an 8-bit or 16-bit index. Depending on the matrix, an entry thus
+         * occupies between 5 and 16 bytes, which reduces the memory bandwidth needed by iterative methods.
+         */
+        template<typename ValueType>
+        class CompactSparseMatrix {
+        public:
+            // The ways in which the values of the entries can be stored.
+            enum class ValueStorage {
+                // One value per entry.
+                Plain,
+                // A dictionary of at most 2^8 distinct values and an 8-bit index per entry.
+                ByteDictionary,
+                // A dictionary of at most 2^16 distinct values and a 16-bit index per entry.
+                ShortDictionary
+            };
+
+            /*!
+             * Creates a compact representation of the given matrix.
+             *
+             * @param matrix The matrix to represent.
+             * @param deduplicateValues If set, the values are stored in a dictionary if there are sufficiently few
+             * distinct values.
+             */
+            CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool deduplicateValues = true);
+
+            /*!
+             * Retrieves the number of rows of the matrix.
+             */
+            uint64_t getRowCount() const;
+
+            /*!
+             * Retrieves the number of columns of the matrix.
+             */
+            uint64_t getColumnCount() const;
+
+            /*!
+             * Retrieves the number of entries of the matrix.
+             */
+            uint64_t getEntryCount() const;
+
+            /*!
+             * Retrieves whether the column indices are stored with 32 bits.
+             */
+            bool hasNarrowColumnIndices() const;
+
+            /*!
+             * Retrieves how the values of the entries are stored.
+             */
+            ValueStorage getValueStorage() const;
+
+            /*!
+             * Retrieves the number of distinct values stored in the dictionary (or the number of entries if the
+             * values are not stored in a dictionary).
+             */
+            uint64_t getNumberOfStoredValues() const;
+
+            /*!
+             * Returns (an approximation of) the size of the matrix measured in bytes.
+             */
+            uint64_t getSizeInBytes() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * It must not be the same as the input vector.
+             */
+            void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+
+            /*!
+             * Performs one step of the successive over-relaxation technique (see
+             * SparseMatrix::performSuccessiveOverRelaxationStep).
+             *
+             * @param omega The Omega parameter for SOR.
+             * @param x The current solution vector. The result will be written to the very same vector.
+             * @param b The 'right-hand side' of the problem.
+             */
+            void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            /*!
+             * Performs one step of the block Jacobi method (see SparseMatrix::performBlockJacobiStep).
+             *
+             * @param x The current solution vector.
+             * @param b The 'right-hand side' of the problem.
+             * @param result The vector to which the new solution vector is written. It must not be the same as x.
+             * @param blockSize The number of rows per block.
+             */
+            void performBlockJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, uint64_t blockSize) const;
+
+        private:
+            /*!
+             * Invokes the given function with a pointer to the column indices and an object that retrieves the value
+             * of an entry, both being of the types that match the way the matrix is stored. This way, the kernels are
+             * compiled once for each storage variant.
+             */
+            template<typename Function>
+            void dispatch(Function const& function) const;
+
+            // The number of columns of the matrix.
+            uint64_t columnCount;
+
+            // For each row (and one more), the index of its first entry.
+            std::vector<uint64_t> rowIndications;
+
+            // The column indices of the entries. Exactly one of these vectors is used.
+            std::vector<uint32_t> narrowColumns;
+            std::vector<uint64_t> wideColumns;
+
+            // How the values of the entries are stored.
+            ValueStorage valueStorage;
+
+            // Either the values of the entries or the dictionary of distinct values.
+            std::vector<ValueType> values;
+
+            // For each entry, the position of its value in the dictionary. At most one of these vectors is used.
+            std::vector<uint8_t> byteValueIndices;
+            std::vector<uint16_t> shortValueIndices;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_COMPACTSPARSEMATRIX_H_ */
@@ -0,0 +1,175 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        template<class ValueType, class Hash1, class Hash2>
+        ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t shardIndex, typename BitVectorHashMap<ValueType, Hash1, Hash2>::const_iterator shardIt) : map(map), shardIndex(shardIndex), shardIt(shardIt) {
+            skipExhaustedShards();
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) {
+            return &map == &other.map && shardIndex == other.shardIndex && shardIt.get() == other.shardIt.get();
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) {
+            return !(*this == other);
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator::operator++() {
+            ++shardIt.get();
+            skipExhaustedShards();
+            return *this;
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator::operator*() const {
+            return *shardIt.get();
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        void ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMapIterator::skipExhaustedShards() {
+            // The last shard is never skipped, because its end serves as the end of the whole map.
+            while (shardIndex + 1 < map.shards.size() && shardIt.get() == map.shards[shardIndex]->map.end()) {
+                ++shardIndex;
+                shardIt.emplace(map.shards[shardIndex]->map.begin());
+            }
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::Shard::Shard(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : mutex(), map(bucketSize, initialSize, loadFactor) {
+            // Intentionally left empty.
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, uint64_t numberOfShards, double loadFactor) : bucketSize(bucketSize), shardBits(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+
+            // Round the number of shards up to the next power of two.
+            while ((1ull << shardBits) < std::max<uint64_t>(numberOfShards, 1)) {
+                ++shardBits;
+            }
+            numberOfShards = 1ull << shardBits;
+
+            uint64_t initialShardSize = std::max<uint64_t>(initialSize / numberOfShards, 1);
+            shards.reserve(numberOfShards);
+            for (uint64_t shard = 0; shard < numberOfShards; ++shard) {
+                shards.emplace_back(new Shard(bucketSize, initialShardSize, loadFactor));
+            }
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::Shard& ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::getShard(storm::storage::BitVector const& key) const {
+            if (shardBits == 0) {
+                return *shards.front();
+            }
+            // Scramble the hash value (Fibonacci hashing) and use its highest bits, so that the choice of the shard is
+            // as independent as possible from the bucket that the key is assigned within the shard.
+            uint64_t scrambledHash = static_cast<uint64_t>(hasher(key)) * 11400714819323198485ull;
+            return *shards[scrambledHash >> (64 - shardBits)];
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard.map.findOrAdd(key, value);
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::findOrAdd(storm::storage::BitVector const& key, std::function<ValueType ()> const& valueGenerator) {
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            // Note that a key can only be added by the thread holding the lock, so the key is still absent when
+            // inserting it below.
+            if (shard.map.contains(key)) {
+                return std::make_pair(shard.map.getValue(key), false);
+            }
+            ValueType value = valueGenerator();
+            shard.map.findOrAdd(key, value);
+            return std::make_pair(value, true);
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        void ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::setOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.map.setOrAdd(key, value);
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::getValue(storm::storage::BitVector const& key) const {
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard.map.getValue(key);
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::contains(storm::storage::BitVector const& key) const {
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard.map.contains(key);
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::begin() const {
+            return const_iterator(*this, 0, shards.front()->map.begin());
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::end() const {
+            return const_iterator(*this, shards.size() - 1, shards.back()->map.end());
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        std::size_t ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::size() const {
+            std::size_t result = 0;
+            for (auto const& shard : shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                result += shard->map.size();
+            }
+            return result;
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        std::size_t ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::capacity() const {
+            std::size_t result = 0;
+            for (auto const& shard : shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                result += shard->map.capacity();
+            }
+            return result;
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        void ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            for (auto& shard : shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                shard->map.remap(remapping);
+            }
+        }
+
+        template<class ValueType, class Hash1, class Hash2>
+        BitVectorHashMap<ValueType, Hash1, Hash2> ConcurrentBitVectorHashMap<ValueType, Hash1, Hash2>::toBitVectorHashMap() const {
+            BitVectorHashMap<ValueType, Hash1, Hash2> result(bucketSize, this->size());
+            for (auto const& shard : shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                for (auto const& keyValuePair : shard->map) {
+                    result.setOrAdd(keyValuePair.first, keyValuePair.second);
+                }
+            }
+            return result;
+        }
+
+        template class ConcurrentBitVectorHashMap<uint_fast64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,212 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash-map whose keys are bit vectors and that can be accessed by several threads
+         * concurrently. It offers the same interface for queries and insertions as the BitVectorHashMap. Internally,
+         * the keys are distributed among a number of shards, each of which is a BitVectorHashMap protected by its own
+         * lock. Since every shard grows independently, increasing the size of the map only rehashes the elements of a
+         * single shard and only blocks the threads accessing this shard.
+         */
+        template<typename ValueType, typename Hash1 = std::hash<storm::storage::BitVector>, class Hash2 = storm::storage::NonZeroBitVectorHash>
+        class ConcurrentBitVectorHashMap {
+        public:
+            class ConcurrentBitVectorHashMapIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the given position of the given shard of the given map.
+                 *
+                 * @param map The map of the iterator.
+                 * @param shardIndex The index of the shard the iterator points into.
+                 * @param shardIt The iterator to the element within the shard.
+                 */
+                ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t shardIndex, typename BitVectorHashMap<ValueType, Hash1, Hash2>::const_iterator shardIt);
+
+                // Methods to compare two iterators.
+                bool operator==(ConcurrentBitVectorHashMapIterator const& other);
+                bool operator!=(ConcurrentBitVectorHashMapIterator const& other);
+
+                // Method to move iterator forward.
+                ConcurrentBitVectorHashMapIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+                std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+            private:
+                /*!
+                 * Moves the iterator to the next shard that is not exhausted (if any).
+                 */
+                void skipExhaustedShards();
+
+                // The map this iterator refers to.
+                ConcurrentBitVectorHashMap const& map;
+
+                // The index of the shard this iterator points into.
+                uint64_t shardIndex;
+
+                // An iterator to the element within the shard. This is wrapped in an optional, because the iterators of
+                // the shards can only be constructed but not assigned.
+                boost::optional<typename BitVectorHashMap<ValueType, Hash1, Hash2>::const_iterator> shardIt;
+            };
+
+            typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of buckets that is initially available (in total over all shards).
+             * @param numberOfShards The number of independently locked shards. This is rounded up to a power of two.
+             * @param loadFactor The load factor that determines at which point the size of the storage of a shard is
+             * increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, uint64_t numberOfShards = 256, double loadFactor = 0.75);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the value produced by the given generator. The generator is only invoked if the key
+             * is actually inserted and it is invoked while holding the lock of the shard, which makes it possible to
+             * hand out unique values (e.g. indices) to new keys only.
+             *
+             * @param key The key to search or insert.
+             * @param valueGenerator The function producing the value for a newly inserted key.
+             * @return A pair whose first component is the value mapped to the key and whose second component indicates
+             * whether the key was newly inserted.
+             */
+            std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, std::function<ValueType ()> const& valueGenerator);
+
+            /*!
+             * Sets the given key value pair in the map. If the key is found in the map, the corresponding value is
+             * overwritten with the given value. Otherwise, the key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value to set.
+             */
+            void setOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+             * undefined.
+             *
+             * @return The value associated with the given key (if any).
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves an iterator to the elements of the map. Note that iterating the map must not be interleaved
+             * with insertions.
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             *
+             * @return The size of the map.
+             */
+            std::size_t size() const;
+
+            /*!
+             * Retrieves the capacity of the underlying containers (in total over all shards).
+             *
+             * @return The capacity of the underlying containers.
+             */
+            std::size_t capacity() const;
+
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+            /*!
+             * Converts the map to a (sequential) bit vector hash map holding the same key-value pairs.
+             *
+             * @return The resulting map.
+             */
+            BitVectorHashMap<ValueType, Hash1, Hash2> toBitVectorHashMap() const;
+
+        private:
+            // A shard of the map, i.e. a part of the map that is protected by a lock. Since the shards are allocated
+            // separately, we cannot rely on over-aligned allocation (which operator new only guarantees as of C++17).
+            // Instead, the shards are padded by one cache line, such that the locks of two shards never share a cache
+            // line (which would lead to false sharing between cores).
+            struct Shard {
+                Shard(uint64_t bucketSize, uint64_t initialSize, double loadFactor);
+
+                // The lock protecting the map of this shard.
+                mutable std::mutex mutex;
+
+                // The elements of this shard.
+                BitVectorHashMap<ValueType, Hash1, Hash2> map;
+
+                // Padding that keeps the lock of the next shard out of the cache line of this shard's lock.
+                char padding[64];
+            };
+
+            /*!
+             * Retrieves the shard that is responsible for the given key.
+             *
+             * @param key The key whose shard to retrieve.
+             * @return The shard responsible for the key.
+             */
+            Shard& getShard(storm::storage::BitVector const& key) const;
+
+            // The size of one bucket.
+            uint64_t bucketSize;
+
+            // The number of bits of the hash value that are used to select a shard.
+            uint64_t shardBits;
+
+            // The shards holding the elements of the map.
+            std::vector<std::unique_ptr<Shard>> shards;
+
+            // Functor object that is used to select the shard of a key.
+            Hash1 hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
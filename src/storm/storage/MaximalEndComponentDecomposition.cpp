@@ -1,10 +1,10 @@
-#include <list>
-#include <queue>
+#include <mutex>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
@@ -58,134 +58,153 @@ namespace storm {
         }
         
         template <typename ValueType>
-        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const& subsystem) {
+        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem) {
             // Get some data for convenient access.
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
             std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+            bool useParallelExecution = storm::utility::parallel::useParallelExecution<ValueType>(subsystem.getNumberOfSetBits());
             
-            // Initialize the maximal end component list to be the full state space.
-            std::list<StateBlock> endComponentStateSets;
-            if(!subsystem.empty()) {
-                endComponentStateSets.emplace_back(subsystem.begin(), subsystem.end());
+            // Initially, all states of the subsystem and all of their choices are candidates for MECs.
+            storm::storage::BitVector remainingStates(subsystem);
+            storm::storage::BitVector remainingChoices(transitionMatrix.getRowCount());
+            for (auto state : subsystem) {
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    remainingChoices.set(choice, true);
+                }
             }
-            storm::storage::BitVector statesToCheck(numberOfStates);
             
-            // The iterator used here should really be a const_iterator.
-            // However, gcc 4.8 (and assorted libraries) does not provide an erase(const_iterator) method for std::list
-            // but only an erase(iterator). This is in compliance with the c++11 draft N3337, which specifies the change
-            // from iterator to const_iterator only for "set, multiset, map [and] multimap".
-            for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-                StateBlock const& mec = *mecIterator;
-                
-                // Keep track of whether the MEC changed during this iteration.
-                bool mecChanged = false;
-                
-                // Get an SCC decomposition of the current MEC candidate.
-                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, mec, true);
-                
-                // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-                // the MEC canditate itself.
-                mecChanged |= sccs.size() > 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
+            std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
+            auto choiceStaysInScc = [&] (uint_fast64_t choice, uint_fast64_t sccIndex) {
+                for (auto const& entry : transitionMatrix.getRow(choice)) {
+                    if (entry.getValue() != storm::utility::zero<ValueType>() && (!remainingStates.get(entry.getColumn()) || stateToSccMapping[entry.getColumn()] != sccIndex)) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            
+            StronglyConnectedComponentDecomposition<ValueType> sccs;
+            bool mecsChanged = true;
+            while (mecsChanged) {
+                // Get an SCC decomposition of all remaining states that only takes the remaining choices into account.
+                // As the remaining choices never leave the candidate that contains their state, the SCCs are the
+                // refinements of all candidates.
+                sccs = StronglyConnectedComponentDecomposition<ValueType>(transitionMatrix, remainingStates, remainingChoices);
+                for (uint_fast64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+                    for (auto state : sccs[sccIndex]) {
+                        stateToSccMapping[state] = sccIndex;
+                    }
+                }
                 
-                // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-                for (auto& scc : sccs) {
-                    statesToCheck.set(scc.begin(), scc.end());
-                    
-                    while (!statesToCheck.empty()) {
-                        storm::storage::BitVector statesToRemove(numberOfStates);
-                        
-                        for (auto state : statesToCheck) {
-                            bool keepStateInMEC = false;
-                            
+                // Check for each of the SCCs which choices leave the SCC and which states have no choice that stays
+                // inside the SCC. As the SCCs are independent of each other, they can be checked in parallel.
+                std::vector<uint_fast64_t> choicesToRemove;
+                std::vector<uint_fast64_t> statesToRemove;
+                std::mutex resultMutex;
+                auto checkSccs = [&] (uint64_t startScc, uint64_t endScc) {
+                    std::vector<uint_fast64_t> localChoicesToRemove;
+                    std::vector<uint_fast64_t> localStatesToRemove;
+                    for (uint64_t sccIndex = startScc; sccIndex < endScc; ++sccIndex) {
+                        for (auto state : sccs[sccIndex]) {
+                            bool keepStateInMec = false;
                             for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                                bool choiceContainedInMEC = true;
-                                for (auto const& entry : transitionMatrix.getRow(choice)) {
-                                    if (entry.getValue() == storm::utility::zero<ValueType>()) {
-                                        continue;
-                                    }
-                                        
-                                    if (!scc.containsState(entry.getColumn())) {
-                                        choiceContainedInMEC = false;
-                                        break;
+                                if (remainingChoices.get(choice)) {
+                                    if (choiceStaysInScc(choice, sccIndex)) {
+                                        keepStateInMec = true;
+                                    } else {
+                                        localChoicesToRemove.push_back(choice);
                                     }
                                 }
-                                
-                                // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                                if (choiceContainedInMEC) {
-                                    keepStateInMEC = true;
-                                    break;
-                                }
                             }
-                            
-                            if (!keepStateInMEC) {
-                                statesToRemove.set(state, true);
+                            if (!keepStateInMec) {
+                                localStatesToRemove.push_back(state);
                             }
                         }
-                        
-                        // Now erase the states that have no option to stay inside the MEC with all successors.
-                        mecChanged |= !statesToRemove.empty();
-                        for (uint_fast64_t state : statesToRemove) {
-                            scc.erase(state);
+                    }
+                    
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    choicesToRemove.insert(choicesToRemove.end(), localChoicesToRemove.begin(), localChoicesToRemove.end());
+                    statesToRemove.insert(statesToRemove.end(), localStatesToRemove.begin(), localStatesToRemove.end());
+                };
+                if (useParallelExecution) {
+                    storm::utility::parallel::parallelFor(0, sccs.size(), 16, checkSccs);
+                } else {
+                    checkSccs(0, sccs.size());
+                }
+                
+                // If no choice needs to be removed, every SCC is an end component and the decomposition is complete.
+                mecsChanged = !choicesToRemove.empty() || !statesToRemove.empty();
+                for (auto choice : choicesToRemove) {
+                    remainingChoices.set(choice, false);
+                }
+                
+                // Now erase the states that have no option to stay inside their SCC. This may force predecessors in the
+                // same SCC to give up the choices leading to the removed states, which we treat right away.
+                for (auto state : statesToRemove) {
+                    remainingStates.set(state, false);
+                }
+                while (!statesToRemove.empty()) {
+                    uint_fast64_t state = statesToRemove.back();
+                    statesToRemove.pop_back();
+                    
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        uint_fast64_t predecessor = entry.getColumn();
+                        if (!remainingStates.get(predecessor) || stateToSccMapping[predecessor] != stateToSccMapping[state]) {
+                            continue;
                         }
                         
-                        // Now check which states should be reconsidered, because successors of them were removed.
-                        statesToCheck.clear();
-                        for (auto state : statesToRemove) {
-                            for (auto const& entry : backwardTransitions.getRow(state)) {
-                                if (scc.containsState(entry.getColumn())) {
-                                    statesToCheck.set(entry.getColumn());
+                        bool keepStateInMec = false;
+                        for (uint_fast64_t choice = nondeterministicChoiceIndices[predecessor]; choice < nondeterministicChoiceIndices[predecessor + 1]; ++choice) {
+                            if (remainingChoices.get(choice)) {
+                                if (choiceStaysInScc(choice, stateToSccMapping[predecessor])) {
+                                    keepStateInMec = true;
+                                } else {
+                                    remainingChoices.set(choice, false);
                                 }
                             }
                         }
-                    }
-                }
-                
-                // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-                // the list instead.
-                if (mecChanged) {
-                    for (StronglyConnectedComponent& scc : sccs) {
-                        if (!scc.empty()) {
-                            endComponentStateSets.push_back(std::move(scc));
+                        if (!keepStateInMec) {
+                            remainingStates.set(predecessor, false);
+                            statesToRemove.push_back(predecessor);
                         }
                     }
-                    
-                    std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-                    ++mecIterator;
-                    endComponentStateSets.erase(eraseIterator);
-                } else {
-                    // Otherwise, we proceed with the next MEC candidate.
-                    ++mecIterator;
                 }
-                
-            } // End of loop over all MEC candidates.
+            }
             
             // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
             // contained in the MEC and store them as actual MECs.
-            this->blocks.reserve(endComponentStateSets.size());
-            for (auto const& mecStateSet : endComponentStateSets) {
-                MaximalEndComponent newMec;
-                
-                for (auto state : mecStateSet) {
-                    MaximalEndComponent::set_type containedChoices;
-                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        bool choiceContained = true;
-                        for (auto const& entry : transitionMatrix.getRow(choice)) {
-                            if (!mecStateSet.containsState(entry.getColumn())) {
-                                choiceContained = false;
-                                break;
+            this->blocks.resize(sccs.size());
+            auto buildMecs = [&] (uint64_t startScc, uint64_t endScc) {
+                for (uint64_t sccIndex = startScc; sccIndex < endScc; ++sccIndex) {
+                    MaximalEndComponent newMec;
+                    
+                    for (auto state : sccs[sccIndex]) {
+                        MaximalEndComponent::set_type containedChoices;
+                        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                            bool choiceContained = true;
+                            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                if (!remainingStates.get(entry.getColumn()) || stateToSccMapping[entry.getColumn()] != sccIndex) {
+                                    choiceContained = false;
+                                    break;
+                                }
+                            }
+                            
+                            if (choiceContained) {
+                                containedChoices.insert(choice);
                             }
                         }
                         
-                        if (choiceContained) {
-                            containedChoices.insert(choice);
-                        }
+                        STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
+                        newMec.addState(state, std::move(containedChoices));
                     }
                     
-                    STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
-                    newMec.addState(state, std::move(containedChoices));
+                    this->blocks[sccIndex] = std::move(newMec);
                 }
-                
-                this->blocks.emplace_back(std::move(newMec));
+            };
+            if (useParallelExecution) {
+                storm::utility::parallel::parallelFor(0, sccs.size(), 16, buildMecs);
+            } else {
+                buildMecs(0, sccs.size());
             }
         }
         
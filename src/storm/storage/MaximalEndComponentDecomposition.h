@@ -83,13 +83,16 @@ namespace storm  {
         private:
             /*!
              * Performs the actual decomposition of the given subsystem in the given model into MECs. As a side-effect
-             * this stores the MECs found in the current decomposition.
+             * this stores the MECs found in the current decomposition. The MECs are obtained by repeatedly decomposing
+             * the remaining states into SCCs (considering only the remaining choices) and removing all choices that
+             * leave the SCC of their state as well as all states without a remaining choice. As every such round
+             * treats all MEC candidates at once, it benefits from the parallel SCC decomposition of large subsystems.
              *
              * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
              * @param backwardTransitions The reversed transition relation.
              * @param subsystem The subsystem to decompose.
              */
-            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const& subsystem);
+            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem);
         };
     }
 }
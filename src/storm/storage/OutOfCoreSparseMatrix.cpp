@@ -0,0 +1,298 @@
+#include "storm/storage/OutOfCoreSparseMatrix.h"
+
+#include <cstring>
+#include <future>
+#include <numeric>
+#include <type_traits>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/BinaryEncodingExporter.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::Block::getStartRowGroup() const {
+            return startRowGroup;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::Block::getEndRowGroup() const {
+            return endRowGroup;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::Block::getStartRow() const {
+            return startRow;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::Block::getEndRow() const {
+            return endRow;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::entry_type const* OutOfCoreSparseMatrix<ValueType>::Block::begin(index_type row) const {
+            STORM_LOG_ASSERT(row >= startRow && row < endRow, "Row " << row << " is not part of the block.");
+            return entries.data() + rowIndications[row - startRow];
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::entry_type const* OutOfCoreSparseMatrix<ValueType>::Block::end(index_type row) const {
+            STORM_LOG_ASSERT(row >= startRow && row < endRow, "Row " << row << " is not part of the block.");
+            return entries.data() + rowIndications[row - startRow + 1];
+        }
+
+        template<typename ValueType>
+        OutOfCoreSparseMatrix<ValueType>::OutOfCoreSparseMatrix(std::string const& filename, uint64_t offset, uint64_t blockSize, bool prefetch) : filename(filename), removeFile(false), file(filename, std::ios::binary), prefetch(prefetch), passes(0), bytesRead(0) {
+            static_assert(sizeof(entry_type) == sizeof(index_type) + sizeof(ValueType) && std::is_standard_layout<entry_type>::value && std::is_trivially_copyable<ValueType>::value, "Matrix entries cannot be read as a raw array.");
+            STORM_LOG_THROW(file.is_open(), storm::exceptions::FileIoException, "Unable to open file " << filename << ".");
+
+            readArray(offset, &rowCount, 1);
+            readArray(offset + sizeof(uint64_t), &columnCount, 1);
+            readArray(offset + 2 * sizeof(uint64_t), &entryCount, 1);
+            rowIndicationsPosition = offset + 3 * sizeof(uint64_t);
+            entriesPosition = rowIndicationsPosition + (rowCount + 1) * sizeof(index_type);
+
+            uint64_t rowGroupPosition = entriesPosition + entryCount * sizeof(entry_type);
+            uint64_t hasRowGroups;
+            readArray(rowGroupPosition, &hasRowGroups, 1);
+            trivialRowGrouping = hasRowGroups == 0;
+            if (trivialRowGrouping) {
+                rowGroupIndices.resize(rowCount + 1);
+                std::iota(rowGroupIndices.begin(), rowGroupIndices.end(), 0);
+            } else {
+                uint64_t size;
+                readArray(rowGroupPosition + sizeof(uint64_t), &size, 1);
+                STORM_LOG_THROW(size > 0, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row groups.");
+                rowGroupIndices.resize(size);
+                readArray(rowGroupPosition + 2 * sizeof(uint64_t), rowGroupIndices.data(), size);
+                STORM_LOG_THROW(rowGroupIndices.front() == 0 && rowGroupIndices.back() == rowCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row groups.");
+            }
+
+            // Partition the row groups into blocks. As the row groups are visited in order, the row indications are
+            // read sequentially in chunks.
+            std::vector<index_type> rowIndicationsChunk;
+            index_type chunkStartRow = 0;
+            auto getRowIndication = [&] (index_type row) {
+                if (rowIndicationsChunk.empty() || row >= chunkStartRow + rowIndicationsChunk.size()) {
+                    chunkStartRow = row;
+                    rowIndicationsChunk.resize(std::min<index_type>(1ull << 16, rowCount + 1 - row));
+                    readArray(rowIndicationsPosition + row * sizeof(index_type), rowIndicationsChunk.data(), rowIndicationsChunk.size());
+                }
+                return rowIndicationsChunk[row - chunkStartRow];
+            };
+
+            STORM_LOG_THROW(getRowIndication(0) == 0, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row indications.");
+            index_type rowGroupCount = this->getRowGroupCount();
+            index_type blockStartEntry = 0;
+            index_type groupStartEntry = 0;
+            for (index_type group = 0; group < rowGroupCount; ++group) {
+                index_type groupEndEntry = getRowIndication(rowGroupIndices[group + 1]);
+                STORM_LOG_THROW(groupEndEntry >= groupStartEntry && groupEndEntry <= entryCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row indications.");
+                if (blockStartRowGroups.empty() || (group > blockStartRowGroups.back() && (groupEndEntry - blockStartEntry) * sizeof(entry_type) > blockSize)) {
+                    blockStartRowGroups.push_back(group);
+                    blockStartEntry = groupStartEntry;
+                }
+                groupStartEntry = groupEndEntry;
+            }
+            STORM_LOG_THROW(groupStartEntry == entryCount, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Inconsistent row indications.");
+            blockStartRowGroups.push_back(rowGroupCount);
+
+            // The partitioning is not counted as I/O of the traversals.
+            bytesRead = 0;
+            readWatch.reset();
+            STORM_LOG_INFO("Opened matrix with " << rowCount << " rows and " << entryCount << " entries in " << filename << " (" << this->getNumberOfBlocks() << " blocks).");
+        }
+
+        template<typename ValueType>
+        OutOfCoreSparseMatrix<ValueType>::~OutOfCoreSparseMatrix() {
+            file.close();
+            if (removeFile) {
+                boost::system::error_code errorCode;
+                boost::filesystem::remove(filename, errorCode);
+                STORM_LOG_WARN_COND(!errorCode, "Unable to remove temporary file " << filename << ".");
+            }
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<OutOfCoreSparseMatrix<ValueType>> OutOfCoreSparseMatrix<ValueType>::openBinaryModelFile(std::string const& filename, uint64_t blockSize, bool prefetch) {
+            std::ifstream in(filename, std::ios::binary);
+            STORM_LOG_THROW(in.is_open(), storm::exceptions::FileIoException, "Unable to open file " << filename << ".");
+
+            // Parse the header to find the position of the transition matrix.
+            char magic[storm::exporter::binary::magicLength];
+            uint64_t header[4];
+            in.read(magic, storm::exporter::binary::magicLength);
+            in.read(reinterpret_cast<char*>(header), sizeof(header));
+            STORM_LOG_THROW(in.good() && std::memcmp(magic, storm::exporter::binary::magic, storm::exporter::binary::magicLength) == 0, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Expected header information.");
+            STORM_LOG_THROW(header[0] == storm::exporter::binary::byteOrderMark, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": The file was written on a machine with a different byte order.");
+            STORM_LOG_THROW(header[1] == storm::exporter::binary::version, storm::exceptions::WrongFormatException, "Error while reading " << filename << ": Unsupported version " << header[1] << ".");
+            STORM_LOG_THROW(header[2] == sizeof(ValueType), storm::exceptions::WrongFormatException, "Error while reading " << filename << ": The values in the file do not match the requested value type.");
+
+            // Skip the (padded) model type.
+            uint64_t typeLength = header[3];
+            uint64_t offset = storm::exporter::binary::magicLength + 4 * sizeof(uint64_t) + (typeLength + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+            return std::make_unique<OutOfCoreSparseMatrix<ValueType>>(filename, offset, blockSize, prefetch);
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<OutOfCoreSparseMatrix<ValueType>> OutOfCoreSparseMatrix<ValueType>::createTemporary(SparseMatrix<ValueType> const& matrix, std::string const& directory, uint64_t blockSize, bool prefetch) {
+            boost::filesystem::path path = directory.empty() ? boost::filesystem::temp_directory_path() : boost::filesystem::path(directory);
+            path /= boost::filesystem::unique_path("storm-matrix-%%%%-%%%%-%%%%-%%%%.bin");
+
+            std::ofstream out(path.native(), std::ios::binary);
+            STORM_LOG_THROW(out.is_open(), storm::exceptions::FileIoException, "Unable to create temporary file " << path.string() << ".");
+            storm::exporter::binaryExportSparseMatrix(out, matrix);
+            out.close();
+            STORM_LOG_THROW(!out.fail(), storm::exceptions::FileIoException, "Unable to write temporary file " << path.string() << ".");
+
+            std::unique_ptr<OutOfCoreSparseMatrix<ValueType>> result;
+            try {
+                result = std::make_unique<OutOfCoreSparseMatrix<ValueType>>(path.string(), 0, blockSize, prefetch);
+            } catch (...) {
+                boost::system::error_code errorCode;
+                boost::filesystem::remove(path, errorCode);
+                throw;
+            }
+            result->removeFile = true;
+            return result;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::getRowCount() const {
+            return rowCount;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::getEntryCount() const {
+            return entryCount;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::getRowGroupCount() const {
+            return rowGroupIndices.size() - 1;
+        }
+
+        template<typename ValueType>
+        typename OutOfCoreSparseMatrix<ValueType>::index_type OutOfCoreSparseMatrix<ValueType>::getNumberOfBlocks() const {
+            return blockStartRowGroups.size() - 1;
+        }
+
+        template<typename ValueType>
+        bool OutOfCoreSparseMatrix<ValueType>::hasTrivialRowGrouping() const {
+            return trivialRowGrouping;
+        }
+
+        template<typename ValueType>
+        std::vector<typename OutOfCoreSparseMatrix<ValueType>::index_type> const& OutOfCoreSparseMatrix<ValueType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
+        template<typename ValueType>
+        void OutOfCoreSparseMatrix<ValueType>::forEachBlock(std::function<void (Block const&)> const& callback) const {
+            ++passes;
+            index_type numberOfBlocks = this->getNumberOfBlocks();
+            if (numberOfBlocks == 0) {
+                return;
+            }
+
+            if (!prefetch) {
+                std::unique_ptr<Block> block;
+                for (index_type blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                    waitWatch.start();
+                    block = readBlock(blockIndex, std::move(block));
+                    waitWatch.stop();
+                    callback(*block);
+                }
+                return;
+            }
+
+            // Read the next block asynchronously while the current one is processed. The storage of a processed block
+            // is handed to the read of the block after the next one.
+            std::future<std::unique_ptr<Block>> nextBlock = std::async(std::launch::async, [this] { return readBlock(0, nullptr); });
+            std::unique_ptr<Block> processedBlock;
+            for (index_type blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                waitWatch.start();
+                std::unique_ptr<Block> block = nextBlock.get();
+                waitWatch.stop();
+                if (blockIndex + 1 < numberOfBlocks) {
+                    nextBlock = std::async(std::launch::async, [this, blockIndex, recycledBlock = std::move(processedBlock)] () mutable { return readBlock(blockIndex + 1, std::move(recycledBlock)); });
+                }
+                callback(*block);
+                processedBlock = std::move(block);
+            }
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<typename OutOfCoreSparseMatrix<ValueType>::Block> OutOfCoreSparseMatrix<ValueType>::readBlock(index_type blockIndex, std::unique_ptr<Block>&& recycledBlock) const {
+            std::unique_ptr<Block> block = recycledBlock ? std::move(recycledBlock) : std::make_unique<Block>();
+            block->startRowGroup = blockStartRowGroups[blockIndex];
+            block->endRowGroup = blockStartRowGroups[blockIndex + 1];
+            block->startRow = rowGroupIndices[block->startRowGroup];
+            block->endRow = rowGroupIndices[block->endRowGroup];
+
+            block->rowIndications.resize(block->endRow - block->startRow + 1);
+            readArray(rowIndicationsPosition + block->startRow * sizeof(index_type), block->rowIndications.data(), block->rowIndications.size());
+            index_type firstEntry = block->rowIndications.front();
+            for (auto& rowIndication : block->rowIndications) {
+                rowIndication -= firstEntry;
+            }
+
+            block->entries.resize(block->rowIndications.back());
+            readArray(entriesPosition + firstEntry * sizeof(entry_type), block->entries.data(), block->entries.size());
+            return block;
+        }
+
+        template<typename ValueType>
+        template<typename T>
+        void OutOfCoreSparseMatrix<ValueType>::readArray(uint64_t position, T* target, uint64_t count) const {
+            readWatch.start();
+            file.seekg(position);
+            file.read(reinterpret_cast<char*>(target), count * sizeof(T));
+            readWatch.stop();
+            STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Error while reading " << filename << ": Unexpected end of file.");
+            bytesRead += count * sizeof(T);
+        }
+
+        template<typename ValueType>
+        uint64_t OutOfCoreSparseMatrix<ValueType>::getNumberOfPasses() const {
+            return passes;
+        }
+
+        template<typename ValueType>
+        uint64_t OutOfCoreSparseMatrix<ValueType>::getNumberOfBytesRead() const {
+            return bytesRead;
+        }
+
+        template<typename ValueType>
+        storm::utility::Stopwatch const& OutOfCoreSparseMatrix<ValueType>::getReadWatch() const {
+            return readWatch;
+        }
+
+        template<typename ValueType>
+        storm::utility::Stopwatch const& OutOfCoreSparseMatrix<ValueType>::getWaitWatch() const {
+            return waitWatch;
+        }
+
+        template<typename ValueType>
+        void OutOfCoreSparseMatrix<ValueType>::logIoStatistics() const {
+            double megabytes = static_cast<double>(bytesRead) / (1024 * 1024);
+            auto readTime = readWatch.getTimeInMilliseconds();
+            double throughput = readTime > 0 ? megabytes * 1000 / readTime : 0;
+            STORM_LOG_INFO("Read " << megabytes << "MB of matrix data in " << passes << " passes (" << readTime << "ms, " << throughput << "MB/s). Waited " << waitWatch.getTimeInMilliseconds() << "ms for data.");
+        }
+
+        template class OutOfCoreSparseMatrix<double>;
+    }
+}
@@ -0,0 +1,177 @@
+#ifndef STORM_STORAGE_OUTOFCORESPARSEMATRIX_H_
+#define STORM_STORAGE_OUTOFCORESPARSEMATRIX_H_
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A sparse matrix whose entries reside on disk. The matrix is stored in the binary format (see
+         * storm::exporter::binaryExportSparseMatrix), either as part of a binary model file or in a file of its own,
+         * and is partitioned into blocks of consecutive row groups. Only the boundaries of the blocks and the row group
+         * indices are kept in memory. The entries are read block by block whenever the matrix is traversed and, if
+         * prefetching is enabled, the next block is read while the current one is processed.
+         */
+        template<typename ValueType>
+        class OutOfCoreSparseMatrix {
+        public:
+            typedef typename SparseMatrix<ValueType>::index_type index_type;
+            typedef MatrixEntry<index_type, ValueType> entry_type;
+
+            /*!
+             * A block of consecutive row groups of the matrix together with their entries.
+             */
+            class Block {
+            public:
+                index_type getStartRowGroup() const;
+                index_type getEndRowGroup() const;
+                index_type getStartRow() const;
+                index_type getEndRow() const;
+
+                /*!
+                 * Retrieves the first entry of the given row. The row needs to be part of the block.
+                 */
+                entry_type const* begin(index_type row) const;
+
+                /*!
+                 * Retrieves the position after the last entry of the given row. The row needs to be part of the block.
+                 */
+                entry_type const* end(index_type row) const;
+
+            private:
+                friend class OutOfCoreSparseMatrix<ValueType>;
+
+                index_type startRowGroup;
+                index_type endRowGroup;
+                index_type startRow;
+                index_type endRow;
+
+                // The offsets of the rows of the block within the entry vector.
+                std::vector<index_type> rowIndications;
+                std::vector<entry_type> entries;
+            };
+
+            /*!
+             * Opens the matrix stored at the given offset of the file.
+             *
+             * @param filename The name of the file that contains the matrix.
+             * @param offset The position of the matrix within the file.
+             * @param blockSize The maximal amount of entry data (in bytes) per block. Row groups whose entries exceed
+             * this size form a block on their own.
+             * @param prefetch If set, the next block is read while the current one is processed.
+             */
+            OutOfCoreSparseMatrix(std::string const& filename, uint64_t offset, uint64_t blockSize, bool prefetch = true);
+
+            OutOfCoreSparseMatrix(OutOfCoreSparseMatrix const& other) = delete;
+            OutOfCoreSparseMatrix& operator=(OutOfCoreSparseMatrix const& other) = delete;
+
+            ~OutOfCoreSparseMatrix();
+
+            /*!
+             * Opens the transition matrix of a model file in the binary format (see
+             * storm::exporter::binaryExportSparseModel) without loading the model.
+             */
+            static std::unique_ptr<OutOfCoreSparseMatrix<ValueType>> openBinaryModelFile(std::string const& filename, uint64_t blockSize, bool prefetch = true);
+
+            /*!
+             * Writes the given matrix to a temporary file in the given directory (or the temporary directory of the
+             * system if it is empty) and opens it. The file is removed when the matrix is destructed.
+             */
+            static std::unique_ptr<OutOfCoreSparseMatrix<ValueType>> createTemporary(SparseMatrix<ValueType> const& matrix, std::string const& directory, uint64_t blockSize, bool prefetch = true);
+
+            index_type getRowCount() const;
+            index_type getColumnCount() const;
+            index_type getEntryCount() const;
+            index_type getRowGroupCount() const;
+            index_type getNumberOfBlocks() const;
+            bool hasTrivialRowGrouping() const;
+
+            /*!
+             * Retrieves the row group indices. If the matrix has a trivial row grouping, every row forms a group.
+             */
+            std::vector<index_type> const& getRowGroupIndices() const;
+
+            /*!
+             * Reads all blocks of the matrix in the order of their rows and calls the given function for each of them.
+             * The block is only valid during the call.
+             */
+            void forEachBlock(std::function<void (Block const&)> const& callback) const;
+
+            /*!
+             * Retrieves the number of times the matrix was traversed.
+             */
+            uint64_t getNumberOfPasses() const;
+
+            /*!
+             * Retrieves the number of bytes that were read from the file.
+             */
+            uint64_t getNumberOfBytesRead() const;
+
+            /*!
+             * Retrieves the time that was spent reading from the file.
+             */
+            storm::utility::Stopwatch const& getReadWatch() const;
+
+            /*!
+             * Retrieves the time that the traversals had to wait for blocks to be read.
+             */
+            storm::utility::Stopwatch const& getWaitWatch() const;
+
+            /*!
+             * Logs the amount of data read so far and the resulting I/O throughput.
+             */
+            void logIoStatistics() const;
+
+        private:
+            /*!
+             * Reads the given block. If given, the storage of the recycled block is reused.
+             */
+            std::unique_ptr<Block> readBlock(index_type blockIndex, std::unique_ptr<Block>&& recycledBlock) const;
+
+            /*!
+             * Reads the given number of values of type T at the given position of the file.
+             */
+            template<typename T>
+            void readArray(uint64_t position, T* target, uint64_t count) const;
+
+            std::string filename;
+
+            // Whether the file is to be removed upon destruction.
+            bool removeFile;
+
+            mutable std::ifstream file;
+
+            index_type rowCount;
+            index_type columnCount;
+            index_type entryCount;
+            bool trivialRowGrouping;
+            std::vector<index_type> rowGroupIndices;
+
+            // The positions of the row indications and the entries within the file.
+            uint64_t rowIndicationsPosition;
+            uint64_t entriesPosition;
+
+            // For each block, its first row group (and the row group count as an additional last element).
+            std::vector<index_type> blockStartRowGroups;
+
+            bool prefetch;
+
+            // Statistics about the traversals.
+            mutable uint64_t passes;
+            mutable uint64_t bytesRead;
+            mutable storm::utility::Stopwatch readWatch;
+            mutable storm::utility::Stopwatch waitWatch;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_OUTOFCORESPARSEMATRIX_H_ */
@@ -15,6 +15,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -25,9 +26,81 @@
 
 #include <iterator>
 
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
 namespace storm {
     namespace storage {
         
+        namespace {
+            /*!
+             * Multiplies the entries in the given range with the corresponding values of the given vector and sums up
+             * the products.
+             */
+            template<typename ValueType, typename IteratorType>
+            ValueType multiplyEntriesWithVector(IteratorType it, IteratorType ite, std::vector<ValueType> const& vector) {
+                ValueType result = storm::utility::zero<ValueType>();
+                for (; it != ite; ++it) {
+                    result += it->getValue() * vector[it->getColumn()];
+                }
+                return result;
+            }
+            
+#if defined(__AVX2__) || defined(__AVX512F__)
+            // Only rows with at least this many entries are worth the setup of the vectorized multiplication.
+            uint_fast64_t const minimalVectorizedRowLength = 16;
+            
+            /*!
+             * Multiplies the entries in the given range with the corresponding values of the given vector by gathering
+             * the values of several columns at once. Since every entry consists of a 64-bit column and the value, two
+             * entries make up a 256-bit lane that is split into the columns and the values by unpacking.
+             */
+            double multiplyEntriesWithVector(std::vector<MatrixEntry<uint_fast64_t, double>>::const_iterator it, std::vector<MatrixEntry<uint_fast64_t, double>>::const_iterator ite, std::vector<double> const& vector) {
+                static_assert(sizeof(MatrixEntry<uint_fast64_t, double>) == 2 * sizeof(uint64_t), "Unexpected layout of matrix entries.");
+                uint_fast64_t entryCount = std::distance(it, ite);
+                if (entryCount < minimalVectorizedRowLength) {
+                    return multiplyEntriesWithVector<double>(it, ite, vector);
+                }
+                
+                MatrixEntry<uint_fast64_t, double> const* entries = &*it;
+                uint_fast64_t entry = 0;
+                double result;
+#ifdef __AVX512F__
+                __m512d sum = _mm512_setzero_pd();
+                for (; entry + 8 <= entryCount; entry += 8) {
+                    __m512i first = _mm512_loadu_si512(reinterpret_cast<void const*>(entries + entry));
+                    __m512i second = _mm512_loadu_si512(reinterpret_cast<void const*>(entries + entry + 4));
+                    __m512i columns = _mm512_unpacklo_epi64(first, second);
+                    __m512d values = _mm512_castsi512_pd(_mm512_unpackhi_epi64(first, second));
+                    sum = _mm512_fmadd_pd(values, _mm512_i64gather_pd(columns, vector.data(), sizeof(double)), sum);
+                }
+                result = _mm512_reduce_add_pd(sum);
+#else
+                __m256d sum = _mm256_setzero_pd();
+                for (; entry + 4 <= entryCount; entry += 4) {
+                    __m256i first = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(entries + entry));
+                    __m256i second = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(entries + entry + 2));
+                    __m256i columns = _mm256_unpacklo_epi64(first, second);
+                    __m256d values = _mm256_castsi256_pd(_mm256_unpackhi_epi64(first, second));
+                    __m256d gathered = _mm256_i64gather_pd(vector.data(), columns, sizeof(double));
+#ifdef __FMA__
+                    sum = _mm256_fmadd_pd(values, gathered, sum);
+#else
+                    sum = _mm256_add_pd(sum, _mm256_mul_pd(values, gathered));
+#endif
+                }
+                __m128d halves = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+                result = _mm_cvtsd_f64(halves) + _mm_cvtsd_f64(_mm_unpackhi_pd(halves, halves));
+#endif
+                for (; entry < entryCount; ++entry) {
+                    result += entries[entry].getValue() * vector[entries[entry].getColumn()];
+                }
+                return result;
+            }
+#endif
+        }
+        
         template<typename IndexType, typename ValueType>
         MatrixEntry<IndexType, ValueType>::MatrixEntry(IndexType column, ValueType value) : entry(column, value) {
             // Intentionally left empty.
@@ -1279,14 +1352,15 @@ namespace storm {
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
 #ifdef STORM_HAVE_INTELTBB
-            if (this->getNonzeroEntryCount() > 10000) {
+            bool useParallelMultiplication = this->getNonzeroEntryCount() > 10000;
+#else
+            bool useParallelMultiplication = storm::utility::parallel::useParallelExecution<ValueType>(this->getNonzeroEntryCount());
+#endif
+            if (useParallelMultiplication) {
                 return this->multiplyWithVectorParallel(vector, result);
             } else {
                 return this->multiplyWithVectorSequential(vector, result);
             }
-#else
-            return multiplyWithVectorSequential(vector, result);
-#endif
         }
 
         template<typename ValueType>
@@ -1313,7 +1387,6 @@ namespace storm {
             }
         }
 
-#ifdef STORM_HAVE_INTELTBB
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
             if (&vector == &result) {
@@ -1322,27 +1395,228 @@ namespace storm {
                 multiplyWithVectorParallel(vector, tmpVector);
                 result = std::move(tmpVector);
             } else {
+                auto multiplyRows = [&] (index_type startRow, index_type endRow) {
+                    const_iterator it = this->begin(startRow);
+                    const_iterator ite;
+                    std::vector<index_type>::const_iterator rowIterator = this->rowIndications.begin() + startRow;
+                    typename std::vector<ValueType>::iterator resultIterator = result.begin() + startRow;
+                    typename std::vector<ValueType>::iterator resultIteratorEnd = result.begin() + endRow;
+                    
+                    for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator) {
+                        *resultIterator = storm::utility::zero<ValueType>();
+                        
+                        for (ite = this->begin() + *(rowIterator + 1); it != ite; ++it) {
+                            *resultIterator += it->getValue() * vector[it->getColumn()];
+                        }
+                    }
+                };
+                
+#ifdef STORM_HAVE_INTELTBB
                 tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 10),
                                   [&] (tbb::blocked_range<index_type> const& range) {
-                                      index_type startRow = range.begin();
-                                      index_type endRow = range.end();
-                                      const_iterator it = this->begin(startRow);
-                                      const_iterator ite;
-                                      std::vector<index_type>::const_iterator rowIterator = this->rowIndications.begin() + startRow;
-                                      std::vector<index_type>::const_iterator rowIteratorEnd = this->rowIndications.begin() + endRow;
-                                      typename std::vector<ValueType>::iterator resultIterator = result.begin() + startRow;
-                                      typename std::vector<ValueType>::iterator resultIteratorEnd = result.begin() + endRow;
-
-                                      for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator) {
-                                          *resultIterator = storm::utility::zero<ValueType>();
-
-                                          for (ite = this->begin() + *(rowIterator + 1); it != ite; ++it) {
-                                              *resultIterator += it->getValue() * vector[it->getColumn()];
-                                          }
-                                      }
+                                      multiplyRows(range.begin(), range.end());
                                   });
+#else
+                storm::utility::parallel::parallelFor(0, result.size(), 64, [&] (uint64_t startRow, uint64_t endRow) {
+                    multiplyRows(startRow, endRow);
+                });
+#endif
             }
         }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<index_type>* choices) const {
+            if (&vector == &result) {
+                STORM_LOG_WARN("Fused matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
+                std::vector<ValueType> tmpVector(result.size());
+                multiplyAndReduce(dir, rowGroupIndices, vector, summand, tmpVector, choices);
+                result = std::move(tmpVector);
+                return;
+            }
+            
+            index_type rowGroupCount = rowGroupIndices.size() - 1;
+#ifdef STORM_HAVE_INTELTBB
+            if (this->getNonzeroEntryCount() > 10000) {
+                tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupCount, 10),
+                                  [&] (tbb::blocked_range<index_type> const& range) {
+                                      multiplyAndReduceForRowGroups(dir, rowGroupIndices, vector, summand, result, choices, range.begin(), range.end());
+                                  });
+                return;
+            }
+#else
+            if (storm::utility::parallel::useParallelExecution<ValueType>(this->getNonzeroEntryCount())) {
+                storm::utility::parallel::parallelFor(0, rowGroupCount, 64, [&] (uint64_t startGroup, uint64_t endGroup) {
+                    multiplyAndReduceForRowGroups(dir, rowGroupIndices, vector, summand, result, choices, startGroup, endGroup);
+                });
+                return;
+            }
+#endif
+            multiplyAndReduceForRowGroups(dir, rowGroupIndices, vector, summand, result, choices, 0, rowGroupCount);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceForRowGroups(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<index_type>* choices, index_type startGroup, index_type endGroup) const {
+            // Instantiate the loop once for each direction to keep the comparison out of the innermost branches.
+            auto reduceGroups = [&] (auto const& isBetter) {
+                for (index_type group = startGroup; group < endGroup; ++group) {
+                    index_type row = rowGroupIndices[group];
+                    index_type rowEnd = rowGroupIndices[group + 1];
+                    STORM_LOG_ASSERT(row < rowEnd, "Cannot reduce empty row group " << group << ".");
+                    
+                    ValueType optimalValue = multiplyEntriesWithVector(this->begin(row), this->end(row), vector);
+                    if (summand) {
+                        optimalValue += (*summand)[row];
+                    }
+                    index_type optimalChoice = 0;
+                    
+                    for (index_type choice = 1, choiceEnd = rowEnd - row; choice < choiceEnd; ++choice) {
+                        ValueType value = multiplyEntriesWithVector(this->begin(row + choice), this->end(row + choice), vector);
+                        if (summand) {
+                            value += (*summand)[row + choice];
+                        }
+                        if (isBetter(value, optimalValue)) {
+                            optimalValue = std::move(value);
+                            optimalChoice = choice;
+                        }
+                    }
+                    
+                    result[group] = std::move(optimalValue);
+                    if (choices) {
+                        (*choices)[group] = optimalChoice;
+                    }
+                }
+            };
+            
+            if (storm::solver::minimize(dir)) {
+                reduceGroups(std::less<ValueType>());
+            } else {
+                reduceGroups(std::greater<ValueType>());
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectors(std::vector<ValueType> const& vectors, std::vector<ValueType>& result, index_type numberOfVectors, std::vector<index_type> const& vectorIndices) const {
+            STORM_LOG_ASSERT(&vectors != &result, "The target vectors must not use the same memory as the input vectors.");
+            auto multiplyRows = [&] (index_type startRow, index_type endRow) {
+                // The sums of the current row are accumulated locally, so the matrix entries are loaded only once.
+                std::vector<ValueType> rowSums(vectorIndices.size());
+                for (index_type row = startRow; row < endRow; ++row) {
+                    std::fill(rowSums.begin(), rowSums.end(), storm::utility::zero<ValueType>());
+                    for (const_iterator it = this->begin(row), ite = this->end(row); it != ite; ++it) {
+                        typename std::vector<ValueType>::const_iterator columnValues = vectors.begin() + it->getColumn() * numberOfVectors;
+                        for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                            rowSums[index] += it->getValue() * columnValues[vectorIndices[index]];
+                        }
+                    }
+                    for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                        result[row * numberOfVectors + vectorIndices[index]] = std::move(rowSums[index]);
+                    }
+                }
+            };
+            
+            if (storm::utility::parallel::useParallelExecution<ValueType>(this->getNonzeroEntryCount() * vectorIndices.size())) {
+                storm::utility::parallel::parallelFor(0, this->getRowCount(), 256, multiplyRows);
+            } else {
+                multiplyRows(0, this->getRowCount());
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, index_type numberOfVectors, std::vector<index_type> const& vectorIndices) const {
+            std::vector<ValueType> rowSums(vectorIndices.size());
+            std::vector<ValueType> diagonalElements(vectorIndices.size());
+            for (index_type row = 0; row < this->getRowCount(); ++row) {
+                std::fill(rowSums.begin(), rowSums.end(), storm::utility::zero<ValueType>());
+                ValueType diagonalElement = storm::utility::zero<ValueType>();
+                for (const_iterator it = this->begin(row), ite = this->end(row); it != ite; ++it) {
+                    if (it->getColumn() != row) {
+                        typename std::vector<ValueType>::const_iterator columnValues = x.begin() + it->getColumn() * numberOfVectors;
+                        for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                            rowSums[index] += it->getValue() * columnValues[vectorIndices[index]];
+                        }
+                    } else {
+                        diagonalElement += it->getValue();
+                    }
+                }
+                
+                for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                    index_type position = row * numberOfVectors + vectorIndices[index];
+                    x[position] = ((storm::utility::one<ValueType>() - omega) * x[position]) + (omega / diagonalElement) * (b[position] - rowSums[index]);
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType> const& vectors, std::vector<ValueType> const* summands, std::vector<ValueType>& result, index_type numberOfVectors, std::vector<index_type> const& vectorIndices) const {
+            STORM_LOG_ASSERT(&vectors != &result, "The target vectors must not use the same memory as the input vectors.");
+            index_type rowGroupCount = rowGroupIndices.size() - 1;
+            if (storm::utility::parallel::useParallelExecution<ValueType>(this->getNonzeroEntryCount() * vectorIndices.size())) {
+                storm::utility::parallel::parallelFor(0, rowGroupCount, 64, [&] (uint64_t startGroup, uint64_t endGroup) {
+                    multiplyAndReduceWithVectorsForRowGroups(dir, rowGroupIndices, vectors, summands, result, numberOfVectors, vectorIndices, startGroup, endGroup);
+                });
+            } else {
+                multiplyAndReduceWithVectorsForRowGroups(dir, rowGroupIndices, vectors, summands, result, numberOfVectors, vectorIndices, 0, rowGroupCount);
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceWithVectorsForRowGroups(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType> const& vectors, std::vector<ValueType> const* summands, std::vector<ValueType>& result, index_type numberOfVectors, std::vector<index_type> const& vectorIndices, index_type startGroup, index_type endGroup) const {
+            std::vector<ValueType> rowSums(vectorIndices.size());
+            std::vector<ValueType> optimalValues(vectorIndices.size());
+            
+            // Instantiate the loop once for each direction to keep the comparison out of the innermost branches.
+            auto reduceGroups = [&] (auto const& isBetter) {
+                for (index_type group = startGroup; group < endGroup; ++group) {
+                    STORM_LOG_ASSERT(rowGroupIndices[group] < rowGroupIndices[group + 1], "Cannot reduce empty row group " << group << ".");
+                    for (index_type row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                        for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                            rowSums[index] = summands ? (*summands)[row * numberOfVectors + vectorIndices[index]] : storm::utility::zero<ValueType>();
+                        }
+                        for (const_iterator it = this->begin(row), ite = this->end(row); it != ite; ++it) {
+                            typename std::vector<ValueType>::const_iterator columnValues = vectors.begin() + it->getColumn() * numberOfVectors;
+                            for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                                rowSums[index] += it->getValue() * columnValues[vectorIndices[index]];
+                            }
+                        }
+                        for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                            if (row == rowGroupIndices[group] || isBetter(rowSums[index], optimalValues[index])) {
+                                optimalValues[index] = rowSums[index];
+                            }
+                        }
+                    }
+                    for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                        result[group * numberOfVectors + vectorIndices[index]] = optimalValues[index];
+                    }
+                }
+            };
+            
+            if (storm::solver::minimize(dir)) {
+                reduceGroups(std::less<ValueType>());
+            } else {
+                reduceGroups(std::greater<ValueType>());
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<Interval>::multiplyAndReduceForRowGroups(OptimizationDirection const&, std::vector<index_type> const&, std::vector<Interval> const&, std::vector<Interval> const*, std::vector<Interval>&, std::vector<index_type>*, index_type, index_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void SparseMatrix<RationalFunction>::multiplyAndReduceForRowGroups(OptimizationDirection const&, std::vector<index_type> const&, std::vector<RationalFunction> const&, std::vector<RationalFunction> const*, std::vector<RationalFunction>&, std::vector<index_type>*, index_type, index_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void SparseMatrix<Interval>::multiplyAndReduceWithVectorsForRowGroups(OptimizationDirection const&, std::vector<index_type> const&, std::vector<Interval> const&, std::vector<Interval> const*, std::vector<Interval>&, index_type, std::vector<index_type> const&, index_type, index_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void SparseMatrix<RationalFunction>::multiplyAndReduceWithVectorsForRowGroups(OptimizationDirection const&, std::vector<index_type> const&, std::vector<RationalFunction> const&, std::vector<RationalFunction> const*, std::vector<RationalFunction>&, index_type, std::vector<index_type> const&, index_type, index_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This operation is not supported.");
+        }
 #endif
         
         template<typename ValueType>
@@ -1383,11 +1657,55 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::performBlockJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, index_type blockSize) const {
+            STORM_LOG_ASSERT(&x != &result, "The block Jacobi step requires different input and output vectors.");
+            index_type numberOfBlocks = (this->getRowCount() + blockSize - 1) / blockSize;
+            
+            auto processBlocks = [&] (uint64_t startBlock, uint64_t endBlock) {
+                for (uint64_t block = startBlock; block < endBlock; ++block) {
+                    index_type startRow = block * blockSize;
+                    index_type endRow = std::min(startRow + blockSize, this->getRowCount());
+                    const_iterator it = this->begin(startRow);
+                    const_iterator ite;
+                    for (index_type currentRow = startRow; currentRow < endRow; ++currentRow) {
+                        ValueType tmpValue = storm::utility::zero<ValueType>();
+                        ValueType diagonalElement = storm::utility::zero<ValueType>();
+                        
+                        for (ite = this->end(currentRow); it != ite; ++it) {
+                            index_type column = it->getColumn();
+                            if (column == currentRow) {
+                                diagonalElement += it->getValue();
+                            } else if (column >= startRow && column < currentRow) {
+                                // Rows of the current block that were already processed contribute their new value.
+                                tmpValue += it->getValue() * result[column];
+                            } else {
+                                tmpValue += it->getValue() * x[column];
+                            }
+                        }
+                        
+                        result[currentRow] = (b[currentRow] - tmpValue) / diagonalElement;
+                    }
+                }
+            };
+            
+            if (storm::utility::parallel::useParallelExecution<ValueType>(this->getNonzeroEntryCount()) && numberOfBlocks > 1) {
+                storm::utility::parallel::parallelFor(0, numberOfBlocks, 1, processBlocks);
+            } else {
+                processBlocks(0, numberOfBlocks);
+            }
+        }
+        
 #ifdef STORM_HAVE_CARL
         template<>
         void SparseMatrix<Interval>::performSuccessiveOverRelaxationStep(Interval, std::vector<Interval>&, std::vector<Interval> const&) const {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This operation is not supported.");
         }
+        
+        template<>
+        void SparseMatrix<Interval>::performBlockJacobiStep(std::vector<Interval> const&, std::vector<Interval> const&, std::vector<Interval>&, index_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This operation is not supported.");
+        }
 #endif
         
         template<typename ValueType>
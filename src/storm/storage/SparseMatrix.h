@@ -13,6 +13,7 @@
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/OptimizationDirection.h"
 
 // Forward declaration for adapter classes.
 namespace storm {
@@ -821,6 +822,21 @@ s             * @param insertDiagonalEntries If set to true, the resulting matri
              */
             void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
+            /*!
+             * Performs one step of the block Jacobi method. For this, the rows are split into contiguous blocks of the
+             * given size. Within a block, the rows are processed in the Gauss-Seidel manner, whereas the values of the
+             * rows of the other blocks are taken from the given old solution vector (as in the Jacobi method). Note
+             * that this is not the Gauss-Seidel method: the iteration generally requires more steps, but the blocks can
+             * be processed in parallel. As the blocks only depend on the given block size, the result does not depend
+             * on the number of threads.
+             *
+             * @param x The current solution vector.
+             * @param b The 'right-hand side' of the problem.
+             * @param result The vector to which the new solution vector is written. It must not be the same as x.
+             * @param blockSize The number of rows per block.
+             */
+            void performBlockJacobiStep(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, index_type blockSize) const;
+            
             /*!
              * Multiplies the matrix with the given vector in a sequential way and writes the result to the given result
              * vector.
@@ -831,17 +847,74 @@ s             * @param insertDiagonalEntries If set to true, the resulting matri
              */
             void multiplyWithVectorSequential(std::vector<value_type> const& vector, std::vector<value_type>& result) const;
 
-#ifdef STORM_HAVE_INTELTBB
             /*!
-             * Multiplies the matrix with the given vector in a parallel fashion using Intel's TBB and writes the result
-             * to the given result vector.
+             * Multiplies the matrix with the given vector in a parallel fashion and writes the result to the given
+             * result vector. If available, Intel's TBB is used and the built-in thread pool otherwise.
              *
              * @param vector The vector with which to multiply the matrix.
              * @param result The vector that is supposed to hold the result of the multiplication after the operation.
              * @return The product of the matrix and the given vector as the content of the given result vector.
              */
             void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result) const;
-#endif
+            
+            /*!
+             * Multiplies the matrix with the given vector, adds the summand (if given) and writes the minimal or
+             * maximal value of each row group to the given result vector. In contrast to multiplying first and reducing
+             * the result afterwards, this does not require an auxiliary vector with one entry per row and traverses
+             * the memory only once. If parallel execution is enabled and considered worthwhile, the row groups are
+             * processed in parallel.
+             *
+             * @param dir The direction of the optimization.
+             * @param rowGroupIndices The row groups over which to optimize.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If non-null, this vector is added to the product. Its length must be equal to the number
+             * of rows.
+             * @param result The vector that is supposed to hold the optimal value of each row group after the
+             * operation.
+             * @param choices If non-null, the index of the optimal row within each row group is written to this
+             * vector. If several rows are optimal, the first one is taken.
+             */
+            void multiplyAndReduce(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<index_type>* choices) const;
+            
+            /*!
+             * Multiplies the matrix with several vectors at once such that every entry of the matrix is loaded only
+             * once for all vectors. The vectors are stored interleaved, i.e. entry i of vector j is located at position
+             * i * numberOfVectors + j, and the result is stored in the same way.
+             *
+             * @param vectors The (interleaved) vectors with which to multiply the matrix.
+             * @param result The (interleaved) vectors that are supposed to hold the results of the multiplications.
+             * @param numberOfVectors The number of vectors.
+             * @param vectorIndices The indices of the vectors that are to be multiplied. The entries of the result that
+             * belong to the other vectors are not touched.
+             */
+            void multiplyWithVectors(std::vector<value_type> const& vectors, std::vector<value_type>& result, index_type numberOfVectors, std::vector<index_type> const& vectorIndices) const;
+            
+            /*!
+             * Performs one step of the successive over-relaxation technique (see performSuccessiveOverRelaxationStep)
+             * for several (interleaved, see multiplyWithVectors) solution vectors and right-hand sides at once.
+             *
+             * @param omega The Omega parameter for SOR.
+             * @param x The current solution vectors. The result will be written to the very same vectors.
+             * @param b The 'right-hand sides' of the problems.
+             * @param numberOfVectors The number of vectors.
+             * @param vectorIndices The indices of the vectors that are to be updated.
+             */
+            void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, index_type numberOfVectors, std::vector<index_type> const& vectorIndices) const;
+            
+            /*!
+             * Performs the fused multiplication and reduction (see multiplyAndReduce) for several (interleaved, see
+             * multiplyWithVectors) vectors and summands at once.
+             *
+             * @param dir The direction of the optimization.
+             * @param rowGroupIndices The row groups over which to optimize.
+             * @param vectors The vectors with which to multiply the matrix.
+             * @param summands If non-null, these vectors are added to the products.
+             * @param result The vectors that are supposed to hold the optimal value of each row group.
+             * @param numberOfVectors The number of vectors.
+             * @param vectorIndices The indices of the vectors that are to be multiplied. The entries of the result that
+             * belong to the other vectors are not touched.
+             */
+            void multiplyAndReduce(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type> const& vectors, std::vector<value_type> const* summands, std::vector<value_type>& result, index_type numberOfVectors, std::vector<index_type> const& vectorIndices) const;
             
             /*!
              * Computes the sum of the entries in a given row.
@@ -1051,6 +1124,24 @@ s             * @param insertDiagonalEntries If set to true, the resulting matri
              */
             SparseMatrix getSubmatrix(storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint, std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries = false) const;
             
+            /*!
+             * Performs the fused multiplication and reduction (see multiplyAndReduce) for the given range of row
+             * groups.
+             *
+             * @param startGroup The first row group to process.
+             * @param endGroup The row group one past the last row group to process.
+             */
+            void multiplyAndReduceForRowGroups(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<index_type>* choices, index_type startGroup, index_type endGroup) const;
+            
+            /*!
+             * Performs the fused multiplication and reduction for several vectors (see multiplyAndReduce) for the given
+             * range of row groups.
+             *
+             * @param startGroup The first row group to process.
+             * @param endGroup The row group one past the last row group to process.
+             */
+            void multiplyAndReduceWithVectorsForRowGroups(OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type> const& vectors, std::vector<value_type> const* summands, std::vector<value_type>& result, index_type numberOfVectors, std::vector<index_type> const& vectorIndices, index_type startGroup, index_type endGroup) const;
+            
             // The number of rows of the matrix.
             index_type rowCount;
             
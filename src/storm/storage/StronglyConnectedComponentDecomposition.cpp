@@ -1,10 +1,88 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include <mutex>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
+
+        namespace {
+            /*!
+             * Applies the given function to all successors of the given state that lie in the given subsystem and are
+             * reached with non-zero probability by one of the given choices (or any choice if none are given).
+             */
+            template <typename ValueType, typename FunctionType>
+            void forEachSuccessor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, uint_fast64_t state, FunctionType const& function) {
+                for (uint_fast64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row < rowEnd; ++row) {
+                    if (choices && !choices->get(row)) {
+                        continue;
+                    }
+                    for (auto const& entry : transitionMatrix.getRow(row)) {
+                        if (subsystem.get(entry.getColumn()) && entry.getValue() != storm::utility::zero<ValueType>()) {
+                            function(entry.getColumn());
+                        }
+                    }
+                }
+            }
+            
+            /*!
+             * Performs a level-synchronous search starting from the given frontier. The states of each (sufficiently
+             * large) level are processed by several threads and the newly found states are merged sequentially. Only
+             * the allowed states are visited and all visited states are added to the given bit vector.
+             */
+            template <typename SuccessorFunctionType>
+            void performParallelSearch(std::vector<uint_fast64_t> frontier, storm::storage::BitVector const& allowedStates, storm::storage::BitVector& visitedStates, SuccessorFunctionType const& forEachSuccessorOf) {
+                std::vector<uint_fast64_t> candidates;
+                std::mutex candidatesMutex;
+                
+                while (!frontier.empty()) {
+                    if (frontier.size() < 256) {
+                        // For small frontiers (e.g. on long paths), the parallel processing does not pay off, so we
+                        // continue the search sequentially until sufficiently many states are pending.
+                        while (!frontier.empty() && frontier.size() < 256) {
+                            uint_fast64_t state = frontier.back();
+                            frontier.pop_back();
+                            forEachSuccessorOf(state, [&] (uint_fast64_t successor) {
+                                if (allowedStates.get(successor) && !visitedStates.get(successor)) {
+                                    visitedStates.set(successor, true);
+                                    frontier.push_back(successor);
+                                }
+                            });
+                        }
+                        continue;
+                    }
+                    
+                    candidates.clear();
+                    storm::utility::parallel::parallelFor(0, frontier.size(), 256, [&] (uint64_t startIndex, uint64_t endIndex) {
+                        std::vector<uint_fast64_t> localCandidates;
+                        for (uint64_t index = startIndex; index < endIndex; ++index) {
+                            forEachSuccessorOf(frontier[index], [&] (uint_fast64_t successor) {
+                                if (allowedStates.get(successor) && !visitedStates.get(successor)) {
+                                    localCandidates.push_back(successor);
+                                }
+                            });
+                        }
+                        
+                        std::lock_guard<std::mutex> lock(candidatesMutex);
+                        candidates.insert(candidates.end(), localCandidates.begin(), localCandidates.end());
+                    });
+                    
+                    // A state may have been found by several threads, so we only put it into the frontier once.
+                    frontier.clear();
+                    for (auto candidate : candidates) {
+                        if (!visitedStates.get(candidate)) {
+                            visitedStates.set(candidate, true);
+                            frontier.push_back(candidate);
+                        }
+                    }
+                }
+            }
+        }
+        
         template <typename ValueType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition() : Decomposition() {
             // Intentionally left empty.
@@ -20,30 +98,35 @@ namespace storm {
         template <typename RewardModelType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::models::sparse::Model<ValueType, RewardModelType> const& model, StateBlock const& block, bool dropNaiveSccs, bool onlyBottomSccs) {
             storm::storage::BitVector subsystem(model.getNumberOfStates(), block.begin(), block.end());
-            performSccDecomposition(model.getTransitionMatrix(), subsystem, dropNaiveSccs, onlyBottomSccs);
+            performSccDecomposition(model.getTransitionMatrix(), subsystem, nullptr, dropNaiveSccs, onlyBottomSccs);
         }
         
         template <typename ValueType>
         template <typename RewardModelType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::models::sparse::Model<ValueType, RewardModelType> const& model, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs) {
-            performSccDecomposition(model.getTransitionMatrix(), subsystem, dropNaiveSccs, onlyBottomSccs);
+            performSccDecomposition(model.getTransitionMatrix(), subsystem, nullptr, dropNaiveSccs, onlyBottomSccs);
         }
         
         template <typename ValueType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StateBlock const& block, bool dropNaiveSccs, bool onlyBottomSccs) {
             storm::storage::BitVector subsystem(transitionMatrix.getRowGroupCount(), block.begin(), block.end());
-            performSccDecomposition(transitionMatrix, subsystem, dropNaiveSccs, onlyBottomSccs);
+            performSccDecomposition(transitionMatrix, subsystem, nullptr, dropNaiveSccs, onlyBottomSccs);
         }
         
         
         template <typename ValueType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, bool dropNaiveSccs, bool onlyBottomSccs) {
-            performSccDecomposition(transitionMatrix, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), dropNaiveSccs, onlyBottomSccs);
+            performSccDecomposition(transitionMatrix, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), nullptr, dropNaiveSccs, onlyBottomSccs);
         }
 
         template <typename ValueType>
         StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs) {
-            performSccDecomposition(transitionMatrix, subsystem, dropNaiveSccs, onlyBottomSccs);
+            performSccDecomposition(transitionMatrix, subsystem, nullptr, dropNaiveSccs, onlyBottomSccs);
+        }
+        
+        template <typename ValueType>
+        StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& choices, bool dropNaiveSccs, bool onlyBottomSccs) {
+            performSccDecomposition(transitionMatrix, subsystem, &choices, dropNaiveSccs, onlyBottomSccs);
         }
         
         template <typename ValueType>
@@ -69,32 +152,18 @@ namespace storm {
         }
 
         template <typename ValueType>
-        void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs) {
+        void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, bool dropNaiveSccs, bool onlyBottomSccs) {
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
 
-            // Set up the environment of the algorithm.
-            // Start with the two stacks it maintains.
-            std::vector<uint_fast64_t> s;
-            s.reserve(numberOfStates);
-            std::vector<uint_fast64_t> p;
-            p.reserve(numberOfStates);
-            
-            // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
-            std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
-            storm::storage::BitVector hasPreorderNumber(numberOfStates);
-            storm::storage::BitVector stateHasScc(numberOfStates);
+            // Compute the mapping of states to their SCCs. Along the way, we keep track of the states with a self-loop
+            // to identify naive SCCs.
             std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-            uint_fast64_t sccCount = 0;
-            
-            // Finally, we need to keep track of the states with a self-loop to identify naive SCCs.
             storm::storage::BitVector statesWithSelfLoop(numberOfStates);
-            
-            // Start the search for SCCs from every state in the block.
-            uint_fast64_t currentIndex = 0;
-            for (auto state : subsystem) {
-                if (!hasPreorderNumber.get(state)) {
-                    performSccDecompositionGCM(transitionMatrix, state, statesWithSelfLoop, subsystem, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount);
-                }
+            uint_fast64_t sccCount = 0;
+            if (storm::utility::parallel::useParallelExecution<ValueType>(subsystem.getNumberOfSetBits())) {
+                performParallelSccDecomposition(transitionMatrix, subsystem, choices, statesWithSelfLoop, stateToSccMapping, sccCount);
+            } else {
+                performSequentialSccDecomposition(transitionMatrix, subsystem, choices, statesWithSelfLoop, stateToSccMapping, sccCount);
             }
 
             // After we obtained the state-to-SCC mapping, we build the actual blocks.
@@ -129,15 +198,14 @@ namespace storm {
                 
                 // If requested, we need to drop all non-bottom SCCs.
                 if (onlyBottomSccs) {
-                    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                    for (auto state : subsystem) {
                         // If the block of the state is already known to be dropped, we don't need to check the transitions.
                         if (!blocksToDrop.get(stateToSccMapping[state])) {
-                            for (typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIt = transitionMatrix.getRowGroup(state).begin(), successorIte = transitionMatrix.getRowGroup(state).end(); successorIt != successorIte; ++successorIt) {
-                                if (subsystem.get(successorIt->getColumn()) && stateToSccMapping[state] != stateToSccMapping[successorIt->getColumn()]) {
+                            forEachSuccessor(transitionMatrix, subsystem, choices, state, [&] (uint_fast64_t successor) {
+                                if (stateToSccMapping[state] != stateToSccMapping[successor]) {
                                     blocksToDrop.set(stateToSccMapping[state]);
-                                    break;
                                 }
-                            }
+                            });
                         }
                     }
                 }
@@ -157,6 +225,194 @@ namespace storm {
             }
         }
         
+        template <typename ValueType>
+        void StronglyConnectedComponentDecomposition<ValueType>::performSequentialSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, storm::storage::BitVector& statesWithSelfLoop, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount) {
+            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+
+            // Set up the environment of the algorithm.
+            // Start with the two stacks it maintains.
+            std::vector<uint_fast64_t> s;
+            s.reserve(numberOfStates);
+            std::vector<uint_fast64_t> p;
+            p.reserve(numberOfStates);
+            
+            // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
+            std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
+            storm::storage::BitVector hasPreorderNumber(numberOfStates);
+            storm::storage::BitVector stateHasScc(numberOfStates);
+            
+            // Start the search for SCCs from every state in the block.
+            uint_fast64_t currentIndex = 0;
+            for (auto state : subsystem) {
+                if (!hasPreorderNumber.get(state)) {
+                    performSccDecompositionGCM(transitionMatrix, state, statesWithSelfLoop, subsystem, choices, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount);
+                }
+            }
+        }
+        
+        template <typename ValueType>
+        void StronglyConnectedComponentDecomposition<ValueType>::performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, storm::storage::BitVector& statesWithSelfLoop, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount) {
+            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            uint_fast64_t firstScc = sccCount;
+            
+            auto forEachSuccessorOf = [&] (uint_fast64_t state, auto const& function) {
+                forEachSuccessor(transitionMatrix, subsystem, choices, state, [&] (uint_fast64_t successor) {
+                    if (successor != state) {
+                        function(successor);
+                    }
+                });
+            };
+            
+            // Collect the predecessors of all states in the subsystem, because the backward search and the trimming
+            // need them. Along the way, we count the successors of every state. Self-loops are not taken into account,
+            // because they do not connect a state to other states.
+            std::vector<uint_fast64_t> outDegrees(numberOfStates);
+            std::vector<uint_fast64_t> predecessorIndications(numberOfStates + 1);
+            for (auto state : subsystem) {
+                forEachSuccessor(transitionMatrix, subsystem, choices, state, [&] (uint_fast64_t successor) {
+                    if (successor == state) {
+                        statesWithSelfLoop.set(state);
+                    } else {
+                        ++outDegrees[state];
+                        ++predecessorIndications[successor + 1];
+                    }
+                });
+            }
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                predecessorIndications[state + 1] += predecessorIndications[state];
+            }
+            std::vector<uint_fast64_t> predecessors(predecessorIndications.back());
+            std::vector<uint_fast64_t> inDegrees(predecessorIndications.begin(), predecessorIndications.end() - 1);
+            for (auto state : subsystem) {
+                forEachSuccessorOf(state, [&] (uint_fast64_t successor) {
+                    predecessors[inDegrees[successor]++] = state;
+                });
+            }
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                inDegrees[state] -= predecessorIndications[state];
+            }
+            auto forEachPredecessorOf = [&] (uint_fast64_t state, auto const& function) {
+                for (uint_fast64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                    function(predecessors[index]);
+                }
+            };
+            
+            // Trim all states that have no predecessor or no successor among the remaining states, because each of
+            // them forms an SCC on its own. Removing a state may in turn make its neighbours trimmable.
+            storm::storage::BitVector remainingStates(subsystem);
+            std::vector<uint_fast64_t> trimStack;
+            for (auto state : subsystem) {
+                if (inDegrees[state] == 0 || outDegrees[state] == 0) {
+                    trimStack.push_back(state);
+                }
+            }
+            while (!trimStack.empty()) {
+                uint_fast64_t state = trimStack.back();
+                trimStack.pop_back();
+                if (!remainingStates.get(state)) {
+                    continue;
+                }
+                
+                remainingStates.set(state, false);
+                stateToSccMapping[state] = sccCount++;
+                forEachSuccessorOf(state, [&] (uint_fast64_t successor) {
+                    if (remainingStates.get(successor) && --inDegrees[successor] == 0) {
+                        trimStack.push_back(successor);
+                    }
+                });
+                forEachPredecessorOf(state, [&] (uint_fast64_t predecessor) {
+                    if (remainingStates.get(predecessor) && --outDegrees[predecessor] == 0) {
+                        trimStack.push_back(predecessor);
+                    }
+                });
+            }
+            
+            if (!remainingStates.empty()) {
+                // Choose the state with the most connections as the pivot, because it is likely to be part of the
+                // largest SCC.
+                uint_fast64_t pivot = *remainingStates.begin();
+                for (auto state : remainingStates) {
+                    if (inDegrees[state] * outDegrees[state] > inDegrees[pivot] * outDegrees[pivot]) {
+                        pivot = state;
+                    }
+                }
+                
+                // The SCC of the pivot consists of all states that are reachable from the pivot and that can reach
+                // the pivot. As all states on a path from such a state to the pivot are reachable from the pivot, the
+                // backward search can be restricted to the states found by the forward search.
+                storm::storage::BitVector forwardStates(numberOfStates);
+                forwardStates.set(pivot, true);
+                performParallelSearch({pivot}, remainingStates, forwardStates, forEachSuccessorOf);
+                storm::storage::BitVector pivotScc(numberOfStates);
+                pivotScc.set(pivot, true);
+                performParallelSearch({pivot}, forwardStates, pivotScc, forEachPredecessorOf);
+                
+                for (auto state : pivotScc) {
+                    stateToSccMapping[state] = sccCount;
+                }
+                ++sccCount;
+                remainingStates &= ~pivotScc;
+                STORM_LOG_TRACE("Found SCC with " << pivotScc.getNumberOfSetBits() << " states by a parallel forward-backward search, " << remainingStates.getNumberOfSetBits() << " states remain.");
+            }
+            
+            // As the states found so far form complete SCCs, the SCCs of the remaining states are the same in the
+            // subsystem they induce, which we decompose sequentially.
+            if (!remainingStates.empty()) {
+                performSequentialSccDecomposition(transitionMatrix, remainingStates, choices, statesWithSelfLoop, stateToSccMapping, sccCount);
+            }
+            
+            // Unlike the sequential search, the steps above do not number the SCCs in reverse topological order, which
+            // users of the decomposition (e.g. the topological solvers) rely on. We therefore renumber the SCCs such
+            // that every SCC is numbered after all SCCs it can reach. For this, we repeatedly number an SCC whose
+            // successor SCCs are all numbered already.
+            uint_fast64_t numberOfSccs = sccCount - firstScc;
+            std::vector<uint_fast64_t> sccIndications(numberOfSccs + 1);
+            std::vector<uint_fast64_t> sccOutDegrees(numberOfSccs);
+            for (auto state : subsystem) {
+                uint_fast64_t scc = stateToSccMapping[state] - firstScc;
+                ++sccIndications[scc + 1];
+                forEachSuccessorOf(state, [&] (uint_fast64_t successor) {
+                    if (stateToSccMapping[successor] - firstScc != scc) {
+                        ++sccOutDegrees[scc];
+                    }
+                });
+            }
+            for (uint_fast64_t scc = 0; scc < numberOfSccs; ++scc) {
+                sccIndications[scc + 1] += sccIndications[scc];
+            }
+            std::vector<uint_fast64_t> sccStates(sccIndications.back());
+            std::vector<uint_fast64_t> nextSccStateIndex(sccIndications.begin(), sccIndications.end() - 1);
+            for (auto state : subsystem) {
+                sccStates[nextSccStateIndex[stateToSccMapping[state] - firstScc]++] = state;
+            }
+            
+            std::vector<uint_fast64_t> newSccIndices(numberOfSccs);
+            std::vector<uint_fast64_t> sccStack;
+            for (uint_fast64_t scc = 0; scc < numberOfSccs; ++scc) {
+                if (sccOutDegrees[scc] == 0) {
+                    sccStack.push_back(scc);
+                }
+            }
+            uint_fast64_t nextSccIndex = firstScc;
+            while (!sccStack.empty()) {
+                uint_fast64_t scc = sccStack.back();
+                sccStack.pop_back();
+                newSccIndices[scc] = nextSccIndex++;
+                for (uint_fast64_t index = sccIndications[scc]; index < sccIndications[scc + 1]; ++index) {
+                    forEachPredecessorOf(sccStates[index], [&] (uint_fast64_t predecessor) {
+                        uint_fast64_t predecessorScc = stateToSccMapping[predecessor] - firstScc;
+                        if (predecessorScc != scc && --sccOutDegrees[predecessorScc] == 0) {
+                            sccStack.push_back(predecessorScc);
+                        }
+                    });
+                }
+            }
+            STORM_LOG_ASSERT(nextSccIndex == sccCount, "Expected to renumber " << numberOfSccs << " SCCs, but renumbered " << (nextSccIndex - firstScc) << ".");
+            for (auto state : subsystem) {
+                stateToSccMapping[state] = newSccIndices[stateToSccMapping[state] - firstScc];
+            }
+        }
+        
         template <typename ValueType>
         template <typename RewardModelType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::models::sparse::Model<ValueType, RewardModelType> const& model, bool dropNaiveSccs, bool onlyBottomSccs) {
@@ -164,51 +420,48 @@ namespace storm {
             storm::storage::BitVector fullSystem(model.getNumberOfStates(), true);
             
             // Call the overloaded function.
-            performSccDecomposition(model.getTransitionMatrix(), fullSystem, dropNaiveSccs, onlyBottomSccs);
+            performSccDecomposition(model.getTransitionMatrix(), fullSystem, nullptr, dropNaiveSccs, onlyBottomSccs);
         }
         
         template <typename ValueType>
-        void StronglyConnectedComponentDecomposition<ValueType>::performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState, storm::storage::BitVector& statesWithSelfLoop, storm::storage::BitVector const& subsystem, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber, std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& s, std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount) {
+        void StronglyConnectedComponentDecomposition<ValueType>::performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState, storm::storage::BitVector& statesWithSelfLoop, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber, std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& s, std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount) {
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
             
-            // Prepare the stack used for turning the recursive procedure into an iterative one.
-            std::vector<uint_fast64_t> recursionStateStack;
-            recursionStateStack.reserve(transitionMatrix.getRowGroupCount());
-            recursionStateStack.push_back(startState);
-
-            while (!recursionStateStack.empty()) {
-                // Peek at the topmost state in the stack, but leave it on there for now.
-                uint_fast64_t currentState = recursionStateStack.back();
-
-                // If the state has not yet been seen, we need to assign it a preorder number and iterate over its successors.
-                if (!hasPreorderNumber.get(currentState)) {
-                    preorderNumbers[currentState] = currentIndex++;
-                    hasPreorderNumber.set(currentState, true);
+            // Prepare the stack used for turning the recursive procedure into an iterative one. For every state on the
+            // current path, it stores the row and the entry that are to be considered next.
+            struct SearchPosition {
+                uint_fast64_t state;
+                uint_fast64_t row;
+                typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIt;
+            };
+            std::vector<SearchPosition> recursionStack;
+            
+            auto visitState = [&] (uint_fast64_t state) {
+                preorderNumbers[state] = currentIndex++;
+                hasPreorderNumber.set(state, true);
                 
-                    s.push_back(currentState);
-                    p.push_back(currentState);
+                s.push_back(state);
+                p.push_back(state);
                 
-                    for (auto const& successor : transitionMatrix.getRowGroup(currentState)) {
-                        if (subsystem.get(successor.getColumn()) && successor.getValue() != storm::utility::zero<ValueType>()) {
-                            if (currentState == successor.getColumn()) {
-                                statesWithSelfLoop.set(currentState);
-                            }
-                            
-                            if (!hasPreorderNumber.get(successor.getColumn())) {
-                                // In this case, we must recursively visit the successor. We therefore push the state
-                                // onto the recursion stack.
-                                recursionStateStack.push_back(successor.getColumn());
-                            } else {
-                                if (!stateHasScc.get(successor.getColumn())) {
-                                    while (preorderNumbers[p.back()] > preorderNumbers[successor.getColumn()]) {
-                                        p.pop_back();
-                                    }
-                                }
-                            }
-                        }
-                    }
-                } else {
+                recursionStack.push_back({state, rowGroupIndices[state], transitionMatrix.begin(rowGroupIndices[state])});
+            };
+            visitState(startState);
+            
+            while (!recursionStack.empty()) {
+                SearchPosition& position = recursionStack.back();
+                uint_fast64_t currentState = position.state;
+                
+                // Skip the rows that are exhausted or that are not to be considered.
+                uint_fast64_t rowGroupEnd = rowGroupIndices[currentState + 1];
+                while (position.row < rowGroupEnd && (position.successorIt == transitionMatrix.end(position.row) || (choices && !choices->get(position.row)))) {
+                    position.successorIt = transitionMatrix.end(position.row);
+                    ++position.row;
+                }
+                
+                if (position.row == rowGroupEnd) {
                     // In this case, we have searched all successors of the current state and can exit the "recursion"
                     // on the current state.
+                    recursionStack.pop_back();
                     if (currentState == p.back()) {
                         p.pop_back();
                         uint_fast64_t poppedState = 0;
@@ -220,8 +473,27 @@ namespace storm {
                         } while (poppedState != currentState);
                         ++sccCount;
                     }
+                    continue;
+                }
+                
+                uint_fast64_t successor = position.successorIt->getColumn();
+                bool isTransition = subsystem.get(successor) && position.successorIt->getValue() != storm::utility::zero<ValueType>();
+                ++position.successorIt;
+                
+                if (isTransition) {
+                    if (currentState == successor) {
+                        statesWithSelfLoop.set(currentState);
+                    }
                     
-                    recursionStateStack.pop_back();
+                    if (!hasPreorderNumber.get(successor)) {
+                        // In this case, we must recursively visit the successor. Note that this invalidates the
+                        // reference to the current search position.
+                        visitState(successor);
+                    } else if (!stateHasScc.get(successor)) {
+                        while (preorderNumbers[p.back()] > preorderNumbers[successor]) {
+                            p.pop_back();
+                        }
+                    }
                 }
             }
         }
@@ -103,6 +103,20 @@ namespace storm {
              */
             StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs = false, bool onlyBottomSccs = false);
             
+            /*
+             * Creates an SCC decomposition of the given subsystem in the given system (whose transition relation is
+             * given by a sparse matrix), where only the transitions of the given choices are considered.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param subsystem A bit vector indicating which subsystem to consider for the decomposition into SCCs.
+             * @param choices A bit vector indicating which choices (i.e. rows of the matrix) to consider.
+             * @param dropNaiveSccs A flag that indicates whether trivial SCCs (i.e. SCCs consisting of just one state
+             * without a self-loop) are to be kept in the decomposition.
+             * @param onlyBottomSccs If set to true, only bottom SCCs, i.e. SCCs in which all states have no way of
+             * leaving the SCC), are kept.
+             */
+            StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& choices, bool dropNaiveSccs = false, bool onlyBottomSccs = false);
+            
             /*!
              * Creates an SCC decomposition by copying the given SCC decomposition.
              *
@@ -147,27 +161,67 @@ namespace storm {
             
             /*
              * Performs the SCC decomposition of the given block in the given model. As a side-effect this fills
-             * the vector of blocks of the decomposition.
+             * the vector of blocks of the decomposition. If the subsystem is sufficiently large and several threads
+             * are available, the decomposition is computed in parallel.
              *
              * @param transitionMatrix The transition matrix of the system to decompose.
              * @param subsystem A bit vector indicating which subsystem to consider for the decomposition into SCCs.
+             * @param choices If given, only the transitions of these choices are considered.
              * @param dropNaiveSccs A flag that indicates whether trivial SCCs (i.e. SCCs consisting of just one state
              * without a self-loop) are to be kept in the decomposition.
              * @param onlyBottomSccs If set to true, only bottom SCCs, i.e. SCCs in which all states have no way of
              * leaving the SCC), are kept.
              */
-            void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs);
+            void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, bool dropNaiveSccs, bool onlyBottomSccs);
+            
+            /*!
+             * Computes a mapping of the states of the given subsystem to their SCCs by means of the algorithm of
+             * Gabow/Cheriyan/Mehlhorn. The SCCs are numbered starting from the given SCC count.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param subsystem The subsystem to search.
+             * @param choices If given, only the transitions of these choices are considered.
+             * @param statesWithSelfLoop A bit vector that is to be filled with all states that have a self-loop.
+             * @param stateToSccMapping A mapping from states to the SCC indices they belong to that is filled for all
+             * states of the subsystem.
+             * @param sccCount The number of SCCs that have been computed. As a side effect of this function, this count
+             * is increased.
+             */
+            void performSequentialSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, storm::storage::BitVector& statesWithSelfLoop, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount);
+            
+            /*!
+             * Computes a mapping of the states of the given subsystem to their SCCs using several threads. First, all
+             * states without predecessors or successors are (repeatedly) trimmed, because they form SCCs on their own.
+             * Then, the SCC of a pivot state that is likely to be large is determined by a parallel forward and backward
+             * search. The remaining (typically small) SCCs are computed sequentially. See Hong et al.: "On Fast
+             * Parallel Detection of Strongly Connected Components (SCC) in Small-World Graphs" (SC 2013). Afterwards,
+             * the SCCs are renumbered in reverse topological order (as by the sequential algorithm) starting from the
+             * given SCC count.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param subsystem The subsystem to search.
+             * @param choices If given, only the transitions of these choices are considered.
+             * @param statesWithSelfLoop A bit vector that is to be filled with all states that have a self-loop.
+             * @param stateToSccMapping A mapping from states to the SCC indices they belong to that is filled for all
+             * states of the subsystem.
+             * @param sccCount The number of SCCs that have been computed. As a side effect of this function, this count
+             * is increased.
+             */
+            void performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, storm::storage::BitVector& statesWithSelfLoop, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount);
             
             /*!
              * Uses the algorithm by Gabow/Cheriyan/Mehlhorn ("Path-based strongly connected component algorithm") to
              * compute a mapping of states to their SCCs. All arguments given by (non-const) reference are modified by
-             * the function as a side-effect.
+             * the function as a side-effect. The depth-first search is performed without recursion and keeps the
+             * position in the list of successors for every state on the search path, so the memory it needs is linear
+             * in the number of states and every transition is considered only once.
              *
              * @param transitionMatrix The transition matrix of the system to decompose.
              * @param startState The starting state for the search of Tarjan's algorithm.
              * @param statesWithSelfLoop A bit vector that is to be filled with all states that have a self-loop. This
              * is later needed for identification of the naive SCCs.
              * @param subsystem The subsystem to search.
+             * @param choices If given, only the transitions of these choices are considered.
              * @param currentIndex The next free index that can be assigned to states.
              * @param hasPreorderNumber A bit that is used to keep track of the states that already have a preorder number.
              * @param preorderNumbers A vector storing the preorder number for each state.
@@ -179,7 +233,7 @@ namespace storm {
              * @param sccCount The number of SCCs that have been computed. As a side effect of this function, this count
              * is increased.
              */
-            void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState, storm::storage::BitVector& statesWithSelfLoop, storm::storage::BitVector const& subsystem, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber, std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& s, std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount);
+            void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState, storm::storage::BitVector& statesWithSelfLoop, storm::storage::BitVector const& subsystem, storm::storage::BitVector const* choices, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber, std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& s, std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount);
         };
     }
 }
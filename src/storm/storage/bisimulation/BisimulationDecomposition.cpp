@@ -1,6 +1,9 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <numeric>
+
+#include <boost/functional/hash.hpp>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -19,6 +22,7 @@
 #include "storm/logic/FragmentSpecification.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
 
@@ -47,7 +51,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false), refinementMethod(BisimulationRefinementMethod::SplitterQueue) {
             // Intentionally left empty.
         }
         
@@ -170,6 +174,7 @@ namespace storm {
             STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || model.hasUniqueRewardModel(), storm::exceptions::IllegalFunctionCallException, "Bisimulation currently only supports models with at most one reward model.");
             STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || model.getUniqueRewardModel().hasOnlyStateRewards(), storm::exceptions::IllegalFunctionCallException, "Bisimulation is currently supported for models with state rewards only. Consider converting the transition rewards to state rewards (via suitable function calls).");
             STORM_LOG_THROW(options.getType() != BisimulationType::Weak || !options.getBounded(), storm::exceptions::IllegalFunctionCallException, "Weak bisimulation cannot preserve bounded properties.");
+            STORM_LOG_THROW(options.getType() != BisimulationType::Weak || options.getRefinementMethod() != BisimulationRefinementMethod::Signature, storm::exceptions::IllegalFunctionCallException, "Signature-based refinement is only available for strong bisimulation.");
             
             // Fix the respected atomic propositions if they were not explicitly given.
             if (!this->options.respectedAtomicPropositions) {
@@ -192,10 +197,14 @@ namespace storm {
             }
             std::chrono::high_resolution_clock::duration initialPartitionTime = std::chrono::high_resolution_clock::now() - initialPartitionStart;
             
-            this->initialize();
-            
             std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-            this->performPartitionRefinement();
+            if (options.getRefinementMethod() == BisimulationRefinementMethod::Signature) {
+                this->performSignatureRefinement();
+                this->initialize();
+            } else {
+                this->initialize();
+                this->performPartitionRefinement();
+            }
             std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
             
             std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -252,6 +261,169 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            uint_fast64_t numberOfStates = model.getNumberOfStates();
+            
+            // The signature of a choice is its distribution over the blocks of the current partition. As it never has
+            // more entries than the choice itself, we store it at the positions of the matrix entries of the choice.
+            std::vector<std::pair<storm::storage::sparse::state_type, ValueType>> signatureEntries(transitionMatrix.getEntryCount());
+            std::vector<uint_fast64_t> signatureSizes(transitionMatrix.getRowCount());
+            
+            // For each state, we keep its choices ordered by their signatures, where only the first choices of each
+            // state (the ones with distinct signatures) are relevant. The hash of a state only covers the blocks that
+            // appear in its signature, because the probabilities are compared using the comparator.
+            std::vector<uint_fast64_t> orderedChoices(transitionMatrix.getRowCount());
+            std::vector<uint_fast64_t> numberOfDistinctSignatures(numberOfStates);
+            std::vector<std::size_t> signatureHashes(numberOfStates);
+            
+            auto signatureBegin = [&] (uint_fast64_t choice) {
+                return signatureEntries.begin() + std::distance(transitionMatrix.begin(), transitionMatrix.begin(choice));
+            };
+            
+            auto choiceSignatureLess = [&] (uint_fast64_t choice1, uint_fast64_t choice2) {
+                if (signatureSizes[choice1] != signatureSizes[choice2]) {
+                    return signatureSizes[choice1] < signatureSizes[choice2];
+                }
+                for (auto firstIt = signatureBegin(choice1), firstIte = firstIt + signatureSizes[choice1], secondIt = signatureBegin(choice2); firstIt != firstIte; ++firstIt, ++secondIt) {
+                    if (firstIt->first != secondIt->first) {
+                        return firstIt->first < secondIt->first;
+                    }
+                    if (!comparator.isEqual(firstIt->second, secondIt->second)) {
+                        return comparator.isLess(firstIt->second, secondIt->second);
+                    }
+                }
+                return false;
+            };
+            
+            auto stateSignatureLess = [&] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                if (signatureHashes[state1] != signatureHashes[state2]) {
+                    return signatureHashes[state1] < signatureHashes[state2];
+                }
+                auto firstIt = orderedChoices.begin() + rowGroupIndices[state1];
+                auto firstIte = firstIt + numberOfDistinctSignatures[state1];
+                auto secondIt = orderedChoices.begin() + rowGroupIndices[state2];
+                auto secondIte = secondIt + numberOfDistinctSignatures[state2];
+                for (; firstIt != firstIte && secondIt != secondIte; ++firstIt, ++secondIt) {
+                    if (choiceSignatureLess(*firstIt, *secondIt)) {
+                        return true;
+                    } else if (choiceSignatureLess(*secondIt, *firstIt)) {
+                        return false;
+                    }
+                }
+                return firstIt == firstIte && secondIt != secondIte;
+            };
+            
+            auto computeSignatures = [&] (uint_fast64_t startState, uint_fast64_t endState) {
+                for (storm::storage::sparse::state_type state = startState; state < endState; ++state) {
+                    // The states of absorbing blocks are never split, so there is no need to compute their signatures.
+                    if (partition.getBlock(state).data().absorbing()) {
+                        numberOfDistinctSignatures[state] = 0;
+                        signatureHashes[state] = 0;
+                        continue;
+                    }
+                    
+                    for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                        auto signatureIt = signatureBegin(choice);
+                        auto signatureIte = signatureIt;
+                        for (auto const& entry : transitionMatrix.getRow(choice)) {
+                            if (!comparator.isZero(entry.getValue())) {
+                                *signatureIte = std::make_pair(static_cast<storm::storage::sparse::state_type>(partition.getBlock(entry.getColumn()).getId()), entry.getValue());
+                                ++signatureIte;
+                            }
+                        }
+                        std::sort(signatureIt, signatureIte, [] (std::pair<storm::storage::sparse::state_type, ValueType> const& a, std::pair<storm::storage::sparse::state_type, ValueType> const& b) { return a.first < b.first; });
+                        
+                        // Sum up the probabilities that lead to the same block.
+                        auto targetIt = signatureIt;
+                        for (auto it = signatureIt; it != signatureIte; ++it) {
+                            if (it != signatureIt && it->first == targetIt->first) {
+                                targetIt->second += it->second;
+                            } else {
+                                if (it != signatureIt) {
+                                    ++targetIt;
+                                }
+                                *targetIt = *it;
+                            }
+                        }
+                        signatureSizes[choice] = signatureIt == signatureIte ? 0 : std::distance(signatureIt, targetIt) + 1;
+                    }
+                    
+                    // Order the choices by their signatures and only keep the distinct ones.
+                    auto choicesIt = orderedChoices.begin() + rowGroupIndices[state];
+                    auto choicesIte = orderedChoices.begin() + rowGroupIndices[state + 1];
+                    std::iota(choicesIt, choicesIte, rowGroupIndices[state]);
+                    std::sort(choicesIt, choicesIte, choiceSignatureLess);
+                    numberOfDistinctSignatures[state] = std::distance(choicesIt, std::unique(choicesIt, choicesIte, [&] (uint_fast64_t choice1, uint_fast64_t choice2) { return !choiceSignatureLess(choice1, choice2); }));
+                    
+                    std::size_t hash = 0;
+                    for (auto it = choicesIt, ite = choicesIt + numberOfDistinctSignatures[state]; it != ite; ++it) {
+                        boost::hash_combine(hash, signatureSizes[*it]);
+                        for (auto signatureIt = signatureBegin(*it), signatureIte = signatureIt + signatureSizes[*it]; signatureIt != signatureIte; ++signatureIt) {
+                            boost::hash_combine(hash, signatureIt->first);
+                        }
+                    }
+                    signatureHashes[state] = hash;
+                }
+            };
+            
+            bool useParallelExecution = storm::utility::parallel::useParallelExecution<ValueType>(transitionMatrix.getEntryCount());
+            uint_fast64_t iterations = 0;
+            bool partitionChanged = true;
+            while (partitionChanged) {
+                ++iterations;
+                
+                if (useParallelExecution) {
+                    storm::utility::parallel::parallelFor(0, numberOfStates, 1024, computeSignatures);
+                } else {
+                    computeSignatures(0, numberOfStates);
+                }
+                
+                // Sort the states of every block according to their signatures and determine the positions at which
+                // the blocks need to be split. The blocks occupy disjoint ranges of the partition, so they can be
+                // processed concurrently.
+                std::vector<std::unique_ptr<Block<BlockDataType>>> const& blocks = partition.getBlocks();
+                uint_fast64_t numberOfBlocks = partition.size();
+                std::vector<std::vector<uint_fast64_t>> splitPositions(numberOfBlocks);
+                auto computeSplitPositions = [&] (uint_fast64_t startBlock, uint_fast64_t endBlock) {
+                    for (uint_fast64_t blockIndex = startBlock; blockIndex < endBlock; ++blockIndex) {
+                        Block<BlockDataType> const& block = *blocks[blockIndex];
+                        if (block.getNumberOfStates() <= 1 || block.data().absorbing()) {
+                            continue;
+                        }
+                        
+                        // Avoid sorting blocks that are already stable, which is the case for most blocks in later rounds.
+                        storm::storage::sparse::state_type firstState = *partition.begin(block);
+                        if (std::all_of(partition.begin(block) + 1, partition.end(block), [&] (storm::storage::sparse::state_type state) { return !stateSignatureLess(firstState, state) && !stateSignatureLess(state, firstState); })) {
+                            continue;
+                        }
+                        
+                        partition.sortRange(block.getBeginIndex(), block.getEndIndex(), stateSignatureLess);
+                        splitPositions[blockIndex] = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), stateSignatureLess);
+                    }
+                };
+                
+                if (useParallelExecution) {
+                    storm::utility::parallel::parallelFor(0, numberOfBlocks, 16, computeSplitPositions);
+                } else {
+                    computeSplitPositions(0, numberOfBlocks);
+                }
+                
+                // Finally, split the blocks. This modifies the block structure and is therefore done sequentially.
+                partitionChanged = false;
+                for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                    std::vector<uint_fast64_t> const& positions = splitPositions[blockIndex];
+                    for (uint_fast64_t positionIndex = 1; positionIndex + 1 < positions.size(); ++positionIndex) {
+                        partition.splitBlock(*partition.getBlocks()[blockIndex], positions[positionIndex]);
+                        partitionChanged = true;
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Signature-based refinement terminated after " << iterations << " rounds with " << partition.size() << " blocks.");
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
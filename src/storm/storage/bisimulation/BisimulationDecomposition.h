@@ -27,6 +27,7 @@ namespace storm {
 
         enum class BisimulationType { Strong, Weak };
         enum class BisimulationTypeChoice { Strong, Weak, FromSettings };
+        enum class BisimulationRefinementMethod { SplitterQueue, Signature };
         
         inline BisimulationType resolveBisimulationTypeChoice(BisimulationTypeChoice c) {
             switch(c) {
@@ -103,6 +104,18 @@ namespace storm {
                     return this->type;
                 }
                 
+                /*!
+                 * Sets the method that is used to refine the initial partition. The signature-based refinement is only
+                 * available for strong bisimulation.
+                 */
+                void setRefinementMethod(BisimulationRefinementMethod method) {
+                    refinementMethod = method;
+                }
+                
+                BisimulationRefinementMethod getRefinementMethod() const {
+                    return this->refinementMethod;
+                }
+                
                 bool getBounded() const {
                     return this->bounded;
                 }
@@ -148,6 +161,9 @@ namespace storm {
                 /// when computing strong bisimulation equivalence.
                 bool bounded;
                 
+                /// The method used to refine the initial partition.
+                BisimulationRefinementMethod refinementMethod;
+                
                 /*!
                  * Sets the options under the assumption that the given formula is the only one that is to be checked.
                  *
@@ -213,6 +229,16 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs a signature-based partition refinement as an alternative to the splitter-based refinement. In
+             * every round, the signature of each state, i.e. the (set of) distribution(s) over the blocks of the current
+             * partition, is computed in parallel and all blocks are split according to these signatures. This is
+             * repeated until the partition is stable (see Wimmer et al.: "Sigref - A Symbolic Bisimulation Tool Box",
+             * ATVA 2006). As opposed to performPartitionRefinement(), the auxiliary data structures of the sub classes
+             * are not maintained during the refinement, so they need to be initialized afterwards.
+             */
+            void performSignatureRefinement();
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -0,0 +1,349 @@
+#include "storm/storage/bisimulation/SymbolicBisimulationDecomposition.h"
+
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Odd.h"
+
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Ctmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FormulaInformation.h"
+
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        SymbolicBisimulationDecomposition<DdType, ValueType>::SymbolicBisimulationDecomposition(storm::models::symbolic::Model<DdType, ValueType> const& model) : model(model), preserveAllRewardModels(true), numberOfBlocks(0) {
+            for (auto const& label : model.getLabels()) {
+                preservedLabels.insert(label);
+            }
+            this->initialize();
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        SymbolicBisimulationDecomposition<DdType, ValueType>::SymbolicBisimulationDecomposition(storm::models::symbolic::Model<DdType, ValueType> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : model(model), preserveAllRewardModels(false), numberOfBlocks(0) {
+            this->collectPreservedProperties(formulas);
+            this->initialize();
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        void SymbolicBisimulationDecomposition<DdType, ValueType>::collectPreservedProperties(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+            std::set<std::string> expressionStrings;
+            for (auto const& formula : formulas) {
+                for (auto const& labelFormula : formula->getAtomicLabelFormulas()) {
+                    preservedLabels.insert(labelFormula->getLabel());
+                }
+                for (auto const& expressionFormula : formula->getAtomicExpressionFormulas()) {
+                    if (expressionStrings.insert(expressionFormula->getExpression().toString()).second) {
+                        preservedExpressions.push_back(expressionFormula->getExpression());
+                    }
+                }
+                if (formula->info().containsRewardOperator()) {
+                    formula->gatherReferencedRewardModels(preservedRewardModels);
+                }
+            }
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        void SymbolicBisimulationDecomposition<DdType, ValueType>::initialize() {
+            STORM_LOG_THROW(model.isOfType(storm::models::ModelType::Dtmc) || model.isOfType(storm::models::ModelType::Ctmc) || model.isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException, "Symbolic bisimulation minimization is only supported for DTMCs, CTMCs and MDPs.");
+            storm::dd::DdManager<DdType>& manager = *model.getManagerAsSharedPointer();
+
+            // Every block (and, for nondeterministic models, every class of choices) needs to get a number, so we
+            // determine how many bits are required for the block variable.
+            uint64_t maximalNumberOfBlocks = model.getNumberOfStates();
+            if (model.isOfType(storm::models::ModelType::Mdp)) {
+                maximalNumberOfBlocks = std::max<uint64_t>(maximalNumberOfBlocks, static_cast<storm::models::symbolic::Mdp<DdType, ValueType> const&>(model).getNumberOfChoices());
+            }
+            uint64_t numberOfBits = 1;
+            while (numberOfBits < 62 && (1ull << numberOfBits) < maximalNumberOfBlocks) {
+                ++numberOfBits;
+            }
+            STORM_LOG_THROW((1ull << numberOfBits) >= maximalNumberOfBlocks, storm::exceptions::NotSupportedException, "The model is too large to be minimized symbolically.");
+
+            // Since the block variable is added last, its DD variables are ordered below all others.
+            std::string blockVariableName = "blocks";
+            while (manager.hasMetaVariable(blockVariableName)) {
+                blockVariableName = "_" + blockVariableName;
+            }
+            blockVariables = manager.addMetaVariable(blockVariableName, 0, static_cast<int_fast64_t>((1ull << numberOfBits) - 1));
+
+            // All reachable states start out in the block with number zero.
+            partition = model.getReachableStates() && manager.getEncoding(blockVariables.first, 0);
+            numberOfBlocks = 1;
+
+            for (auto const& label : preservedLabels) {
+                this->refinePartition(this->getStates(label).template toAdd<ValueType>());
+            }
+            for (auto const& expression : preservedExpressions) {
+                this->refinePartition(this->getStates(expression).template toAdd<ValueType>());
+            }
+
+            if (model.isOfType(storm::models::ModelType::Mdp)) {
+                choicePartition = model.getTransitionMatrix().notZero().existsAbstract(model.getColumnVariables());
+            }
+            for (auto const& rewardModelName : this->getPreservedRewardModelNames()) {
+                auto const& rewardModel = model.getRewardModel(rewardModelName);
+                STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Symbolic bisimulation minimization does not support transition rewards.");
+                if (rewardModel.hasStateRewards()) {
+                    this->refinePartition(rewardModel.getStateRewardVector());
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    if (model.isOfType(storm::models::ModelType::Mdp)) {
+                        // Choices with different rewards must never be considered equivalent, so we split them up front.
+                        choicePartition = choicePartition.refinePartition(rewardModel.getStateActionRewardVector(), blockVariables.first).first;
+                    } else {
+                        this->refinePartition(rewardModel.getStateActionRewardVector());
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Initial partition has " << numberOfBlocks << " blocks.");
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        void SymbolicBisimulationDecomposition<DdType, ValueType>::computeBisimulationDecomposition() {
+            storm::dd::DdManager<DdType>& manager = *model.getManagerAsSharedPointer();
+
+            // Reordering the variables during the refinement would break the assumption that the block variable is
+            // ordered below all other variables.
+            bool reorderingAllowed = manager.isDynamicReorderingAllowed();
+            manager.allowDynamicReordering(false);
+
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs = model.getRowColumnMetaVariablePairs();
+            uint64_t iterations = 0;
+            bool changed = true;
+            while (changed) {
+                ++iterations;
+
+                // The signature of a state (or choice) is the probability distribution over the blocks of the current
+                // partition.
+                storm::dd::Add<DdType, ValueType> signature = model.getTransitionMatrix().multiplyMatrix(partition.swapVariables(rowColumnMetaVariablePairs).template toAdd<ValueType>(), model.getColumnVariables());
+                if (model.isOfType(storm::models::ModelType::Mdp)) {
+                    // For nondeterministic models, the signature of a state is the set of classes of its choices.
+                    storm::dd::Bdd<DdType> choiceClasses = choicePartition.refinePartition(signature, blockVariables.first).first;
+                    signature = choiceClasses.existsAbstract(static_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(model).getNondeterminismVariables()).template toAdd<ValueType>();
+                }
+                changed = this->refinePartition(signature);
+                STORM_LOG_TRACE("Partition has " << numberOfBlocks << " blocks after iteration " << iterations << ".");
+            }
+
+            manager.allowDynamicReordering(reorderingAllowed);
+            STORM_LOG_DEBUG("Symbolic bisimulation converged after " << iterations << " iterations with " << numberOfBlocks << " blocks.");
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        bool SymbolicBisimulationDecomposition<DdType, ValueType>::refinePartition(storm::dd::Add<DdType, ValueType> const& signature) {
+            std::pair<storm::dd::Bdd<DdType>, uint64_t> refined = partition.refinePartition(signature, blockVariables.first);
+            bool changed = refined.second != numberOfBlocks;
+            partition = std::move(refined.first);
+            numberOfBlocks = refined.second;
+            return changed;
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        uint64_t SymbolicBisimulationDecomposition<DdType, ValueType>::getNumberOfBlocks() const {
+            return numberOfBlocks;
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Bdd<DdType> const& SymbolicBisimulationDecomposition<DdType, ValueType>::getPartition() const {
+            return partition;
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::expressions::Variable const& SymbolicBisimulationDecomposition<DdType, ValueType>::getBlockVariable() const {
+            return blockVariables.first;
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Bdd<DdType> SymbolicBisimulationDecomposition<DdType, ValueType>::getStates(std::string const& label) const {
+            STORM_LOG_THROW(model.hasLabel(label), storm::exceptions::InvalidPropertyException, "The property refers to unknown label '" << label << "'.");
+            return model.getStates(label);
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Bdd<DdType> SymbolicBisimulationDecomposition<DdType, ValueType>::getStates(storm::expressions::Expression const& expression) const {
+            return model.getStates(expression);
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        std::set<std::string> SymbolicBisimulationDecomposition<DdType, ValueType>::getPreservedRewardModelNames() const {
+            std::set<std::string> result;
+            if (preserveAllRewardModels) {
+                for (auto const& rewardModel : model.getRewardModels()) {
+                    result.insert(rewardModel.first);
+                }
+            } else {
+                for (auto const& rewardModelName : preservedRewardModels) {
+                    if (rewardModelName.empty()) {
+                        STORM_LOG_THROW(model.hasUniqueRewardModel(), storm::exceptions::InvalidPropertyException, "The property refers to the default reward model, but the model does not have a unique reward model.");
+                        result.insert(model.getRewardModels().begin()->first);
+                    } else {
+                        STORM_LOG_THROW(model.hasRewardModel(rewardModelName), storm::exceptions::InvalidPropertyException, "The property refers to unknown reward model '" << rewardModelName << "'.");
+                        result.insert(rewardModelName);
+                    }
+                }
+            }
+            return result;
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        std::shared_ptr<storm::models::ModelBase> SymbolicBisimulationDecomposition<DdType, ValueType>::getQuotient(BisimulationQuotientFormat const& format) const {
+            if (format == BisimulationQuotientFormat::Dd) {
+                return this->buildSymbolicQuotient();
+            } else {
+                return this->buildSparseQuotient();
+            }
+        }
+
+        namespace {
+            /*!
+             * The parts of the quotient that are shared by the symbolic and the sparse representation. All DDs are
+             * expressed in terms of the block variable (and its primed copy) instead of the state variables.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            struct QuotientComponents {
+                storm::dd::Bdd<DdType> reachableStates;
+                storm::dd::Bdd<DdType> initialStates;
+                storm::dd::Bdd<DdType> deadlockStates;
+                storm::dd::Add<DdType, ValueType> transitionMatrix;
+                std::map<std::string, storm::dd::Bdd<DdType>> labelToBddMap;
+                std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<DdType, ValueType>> rewardModels;
+            };
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            QuotientComponents<DdType, ValueType> buildQuotientComponents(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& partition, std::pair<storm::expressions::Variable, storm::expressions::Variable> const& blockVariables, std::map<std::string, storm::dd::Bdd<DdType>> const& labelToStatesMap, std::set<std::string> const& rewardModelNames) {
+                QuotientComponents<DdType, ValueType> result;
+                std::set<storm::expressions::Variable> const& rowVariables = model.getRowVariables();
+
+                // Every block is represented by one of its states.
+                storm::dd::Bdd<DdType> representatives = partition.existsAbstractRepresentative(rowVariables);
+                storm::dd::Add<DdType, ValueType> representativesAdd = representatives.template toAdd<ValueType>();
+
+                std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> metaVariablePairs = model.getRowColumnMetaVariablePairs();
+                metaVariablePairs.push_back(blockVariables);
+                storm::dd::Add<DdType, ValueType> partitionAsColumn = partition.swapVariables(metaVariablePairs).template toAdd<ValueType>();
+
+                result.transitionMatrix = (model.getTransitionMatrix() * representativesAdd).multiplyMatrix(partitionAsColumn, model.getColumnVariables()).sumAbstract(rowVariables);
+                result.reachableStates = partition.existsAbstract(rowVariables);
+                result.initialStates = (partition && model.getInitialStates()).existsAbstract(rowVariables);
+                result.deadlockStates = (representatives && model.getDeadlockStates()).existsAbstract(rowVariables);
+
+                for (auto const& labelStatesPair : labelToStatesMap) {
+                    result.labelToBddMap.emplace(labelStatesPair.first, (partition && labelStatesPair.second).existsAbstract(rowVariables));
+                }
+
+                for (auto const& rewardModelName : rewardModelNames) {
+                    auto const& rewardModel = model.getRewardModel(rewardModelName);
+                    boost::optional<storm::dd::Add<DdType, ValueType>> stateRewards;
+                    boost::optional<storm::dd::Add<DdType, ValueType>> stateActionRewards;
+                    if (rewardModel.hasStateRewards()) {
+                        stateRewards = (representativesAdd * rewardModel.getStateRewardVector()).sumAbstract(rowVariables);
+                    }
+                    if (rewardModel.hasStateActionRewards()) {
+                        stateActionRewards = (representativesAdd * rewardModel.getStateActionRewardVector()).sumAbstract(rowVariables);
+                    }
+                    result.rewardModels.emplace(rewardModelName, storm::models::symbolic::StandardRewardModel<DdType, ValueType>(stateRewards, stateActionRewards, boost::none));
+                }
+                return result;
+            }
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        std::shared_ptr<storm::models::ModelBase> SymbolicBisimulationDecomposition<DdType, ValueType>::buildSymbolicQuotient() const {
+            std::map<std::string, storm::dd::Bdd<DdType>> labelToStatesMap;
+            for (auto const& label : preservedLabels) {
+                labelToStatesMap.emplace(label, this->getStates(label));
+            }
+            for (auto const& expression : preservedExpressions) {
+                labelToStatesMap.emplace(expression.toString(), this->getStates(expression));
+            }
+            QuotientComponents<DdType, ValueType> components = buildQuotientComponents(model, partition, blockVariables, labelToStatesMap, this->getPreservedRewardModelNames());
+
+            std::shared_ptr<storm::dd::DdManager<DdType>> manager = model.getManagerAsSharedPointer();
+            std::set<storm::expressions::Variable> rowVariables = {blockVariables.first};
+            std::set<storm::expressions::Variable> columnVariables = {blockVariables.second};
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs = {blockVariables};
+
+            if (model.isOfType(storm::models::ModelType::Dtmc)) {
+                return std::make_shared<storm::models::symbolic::Dtmc<DdType, ValueType>>(manager, components.reachableStates, components.initialStates, components.deadlockStates, components.transitionMatrix, rowVariables, nullptr, columnVariables, nullptr, rowColumnMetaVariablePairs, components.labelToBddMap, components.rewardModels);
+            } else if (model.isOfType(storm::models::ModelType::Ctmc)) {
+                return std::make_shared<storm::models::symbolic::Ctmc<DdType, ValueType>>(manager, components.reachableStates, components.initialStates, components.deadlockStates, components.transitionMatrix, rowVariables, nullptr, columnVariables, nullptr, rowColumnMetaVariablePairs, components.labelToBddMap, components.rewardModels);
+            } else {
+                std::set<storm::expressions::Variable> const& nondeterminismVariables = static_cast<storm::models::symbolic::Mdp<DdType, ValueType> const&>(model).getNondeterminismVariables();
+                return std::make_shared<storm::models::symbolic::Mdp<DdType, ValueType>>(manager, components.reachableStates, components.initialStates, components.deadlockStates, components.transitionMatrix, rowVariables, nullptr, columnVariables, nullptr, rowColumnMetaVariablePairs, nondeterminismVariables, components.labelToBddMap, components.rewardModels);
+            }
+        }
+
+        template<storm::dd::DdType DdType, typename ValueType>
+        std::shared_ptr<storm::models::ModelBase> SymbolicBisimulationDecomposition<DdType, ValueType>::buildSparseQuotient() const {
+            // The sparse model checkers look up atomic expressions by their string representation.
+            std::map<std::string, storm::dd::Bdd<DdType>> labelToStatesMap;
+            for (auto const& label : preservedLabels) {
+                labelToStatesMap.emplace(label, this->getStates(label));
+            }
+            for (auto const& expression : preservedExpressions) {
+                labelToStatesMap.emplace(expression.toString(), this->getStates(expression));
+            }
+            QuotientComponents<DdType, ValueType> components = buildQuotientComponents(model, partition, blockVariables, labelToStatesMap, this->getPreservedRewardModelNames());
+
+            storm::dd::Odd odd = components.reachableStates.createOdd();
+            bool nondeterministic = model.isOfType(storm::models::ModelType::Mdp);
+            std::set<storm::expressions::Variable> nondeterminismVariables;
+            if (nondeterministic) {
+                nondeterminismVariables = static_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(model).getNondeterminismVariables();
+            }
+
+            storm::storage::SparseMatrix<ValueType> transitionMatrix = nondeterministic ? components.transitionMatrix.toMatrix(nondeterminismVariables, odd, odd) : components.transitionMatrix.toMatrix(odd, odd);
+
+            storm::models::sparse::StateLabeling stateLabeling(odd.getTotalOffset());
+            stateLabeling.addLabel("init", components.initialStates.toVector(odd));
+            for (auto const& labelStatesPair : components.labelToBddMap) {
+                if (labelStatesPair.first != "init") {
+                    stateLabeling.addLabel(labelStatesPair.first, labelStatesPair.second.toVector(odd));
+                }
+            }
+
+            std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+            for (auto const& rewardModel : components.rewardModels) {
+                boost::optional<std::vector<ValueType>> stateRewards;
+                boost::optional<std::vector<ValueType>> stateActionRewards;
+                if (rewardModel.second.hasStateRewards()) {
+                    stateRewards = rewardModel.second.getStateRewardVector().toVector(odd);
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    if (nondeterministic) {
+                        std::vector<uint_fast64_t> rowGroupSizes = components.transitionMatrix.notZero().existsAbstract({blockVariables.second}).template toAdd<uint_fast64_t>().sumAbstract(nondeterminismVariables).toVector(odd);
+                        stateActionRewards = components.transitionMatrix.toMatrixVector(rewardModel.second.getStateActionRewardVector(), std::move(rowGroupSizes), nondeterminismVariables, odd, odd).second;
+                    } else {
+                        stateActionRewards = rewardModel.second.getStateActionRewardVector().toVector(odd);
+                    }
+                }
+                rewardModels.emplace(rewardModel.first, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards)));
+            }
+
+            storm::storage::sparse::ModelComponents<ValueType> sparseComponents(std::move(transitionMatrix), std::move(stateLabeling), std::move(rewardModels), model.isOfType(storm::models::ModelType::Ctmc));
+            return storm::utility::builder::buildModelFromComponents(model.getType(), std::move(sparseComponents));
+        }
+
+        template class SymbolicBisimulationDecomposition<storm::dd::DdType::CUDD, double>;
+        template class SymbolicBisimulationDecomposition<storm::dd::DdType::Sylvan, double>;
+
+#ifdef STORM_HAVE_CARL
+        template class SymbolicBisimulationDecomposition<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        template class SymbolicBisimulationDecomposition<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+#endif
+    }
+}
@@ -0,0 +1,148 @@
+#ifndef STORM_STORAGE_BISIMULATION_SYMBOLICBISIMULATIONDECOMPOSITION_H_
+#define STORM_STORAGE_BISIMULATION_SYMBOLICBISIMULATIONDECOMPOSITION_H_
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Add.h"
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace logic {
+        class Formula;
+    }
+
+    namespace models {
+        class ModelBase;
+
+        namespace symbolic {
+            template<storm::dd::DdType Type, typename ValueType>
+            class Model;
+        }
+    }
+
+    namespace storage {
+
+        // The representations in which the quotient of a symbolic bisimulation can be built.
+        enum class BisimulationQuotientFormat { Dd, Sparse };
+
+        /*!
+         * This class computes the coarsest strong bisimulation of a symbolic DTMC, CTMC or MDP by means of signature-based
+         * partition refinement. The partition is represented as a BDD over the row variables of the model and an
+         * additional meta variable that encodes the block numbers. In every round, the signatures of all states are
+         * computed by a single matrix-matrix multiplication and all blocks are split simultaneously.
+         */
+        template<storm::dd::DdType DdType, typename ValueType>
+        class SymbolicBisimulationDecomposition {
+        public:
+            /*!
+             * Creates a decomposition of the given model that preserves all labels and reward models of the model.
+             *
+             * @param model The model to decompose. The meta variable used for the block numbers is added to its manager.
+             */
+            SymbolicBisimulationDecomposition(storm::models::symbolic::Model<DdType, ValueType> const& model);
+
+            /*!
+             * Creates a decomposition of the given model that preserves the given formulas.
+             *
+             * @param model The model to decompose. The meta variable used for the block numbers is added to its manager.
+             * @param formulas The formulas that need to be preserved.
+             */
+            SymbolicBisimulationDecomposition(storm::models::symbolic::Model<DdType, ValueType> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
+            /*!
+             * Refines the initial partition until it is stable.
+             */
+            void computeBisimulationDecomposition();
+
+            /*!
+             * Retrieves the number of blocks of the current partition.
+             */
+            uint64_t getNumberOfBlocks() const;
+
+            /*!
+             * Retrieves the current partition as a BDD over the row variables of the model and the block variable.
+             */
+            storm::dd::Bdd<DdType> const& getPartition() const;
+
+            /*!
+             * Retrieves the meta variable that is used to encode the block numbers.
+             */
+            storm::expressions::Variable const& getBlockVariable() const;
+
+            /*!
+             * Builds the quotient of the model with respect to the current partition.
+             *
+             * @param format The format in which to build the quotient. A symbolic quotient uses the block variable to
+             * encode its states while a sparse quotient has one state per block.
+             * @return The quotient model.
+             */
+            std::shared_ptr<storm::models::ModelBase> getQuotient(BisimulationQuotientFormat const& format) const;
+
+        private:
+            /*!
+             * Determines which labels, expressions and reward models need to be preserved by the decomposition.
+             */
+            void collectPreservedProperties(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
+            /*!
+             * Adds the block variable to the manager and creates the initial partition.
+             */
+            void initialize();
+
+            /*!
+             * Refines the current partition by the given signature.
+             *
+             * @return True iff the number of blocks increased.
+             */
+            bool refinePartition(storm::dd::Add<DdType, ValueType> const& signature);
+
+            /*!
+             * Retrieves the states of the model that carry the given label.
+             */
+            storm::dd::Bdd<DdType> getStates(std::string const& label) const;
+
+            /*!
+             * Retrieves the states of the model that satisfy the given expression.
+             */
+            storm::dd::Bdd<DdType> getStates(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Retrieves the names of the reward models to preserve.
+             */
+            std::set<std::string> getPreservedRewardModelNames() const;
+
+            std::shared_ptr<storm::models::ModelBase> buildSymbolicQuotient() const;
+            std::shared_ptr<storm::models::ModelBase> buildSparseQuotient() const;
+
+            // The model to decompose.
+            storm::models::symbolic::Model<DdType, ValueType> const& model;
+
+            // The labels, expressions and reward models that are preserved.
+            std::set<std::string> preservedLabels;
+            std::vector<storm::expressions::Expression> preservedExpressions;
+            std::set<std::string> preservedRewardModels;
+            bool preserveAllRewardModels;
+
+            // The meta variable (and its primed copy) encoding the block numbers.
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> blockVariables;
+
+            // The current partition and its number of blocks.
+            storm::dd::Bdd<DdType> partition;
+            uint64_t numberOfBlocks;
+
+            // For nondeterministic models, the choices of the model, possibly already partitioned by the
+            // state-action rewards.
+            storm::dd::Bdd<DdType> choicePartition;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_BISIMULATION_SYMBOLICBISIMULATIONDECOMPOSITION_H_ */
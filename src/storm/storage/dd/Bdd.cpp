@@ -371,6 +371,20 @@ namespace storm {
             return result;
         }
         
+        template<DdType LibraryType>
+        template<typename ValueType>
+        std::pair<Bdd<LibraryType>, uint64_t> Bdd<LibraryType>::refinePartition(Add<LibraryType, ValueType> const& signature, storm::expressions::Variable const& blockVariable) const {
+            std::vector<uint_fast64_t> blockDdVariableIndices;
+            for (auto const& ddVariable : this->getDdManager().getMetaVariable(blockVariable).getDdVariables()) {
+                blockDdVariableIndices.push_back(ddVariable.getIndex());
+            }
+            
+            std::pair<InternalBdd<LibraryType>, uint64_t> result = internalBdd.refinePartition(signature.internalAdd, blockDdVariableIndices);
+            std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::joinMetaVariables(*this, signature);
+            metaVariables.insert(blockVariable);
+            return std::make_pair(Bdd<LibraryType>(this->getDdManager(), result.first, metaVariables), result.second);
+        }
+        
         template<DdType LibraryType>
         Bdd<LibraryType>::operator InternalBdd<LibraryType>() const {
             return internalBdd;
@@ -389,6 +403,8 @@ namespace storm {
         template Add<DdType::CUDD, double> Bdd<DdType::CUDD>::ite(Add<DdType::CUDD, double> const& thenAdd, Add<DdType::CUDD, double> const& elseAdd) const;
         template Add<DdType::CUDD, uint_fast64_t> Bdd<DdType::CUDD>::ite(Add<DdType::CUDD, uint_fast64_t> const& thenAdd, Add<DdType::CUDD, uint_fast64_t> const& elseAdd) const;
         
+        template std::pair<Bdd<DdType::CUDD>, uint64_t> Bdd<DdType::CUDD>::refinePartition(Add<DdType::CUDD, double> const& signature, storm::expressions::Variable const& blockVariable) const;
+        
         
         template class Bdd<DdType::Sylvan>;
 
@@ -423,5 +439,12 @@ namespace storm {
         template Add<DdType::Sylvan, storm::RationalNumber> Bdd<DdType::Sylvan>::ite(Add<DdType::Sylvan, storm::RationalNumber> const& thenAdd, Add<DdType::Sylvan, storm::RationalNumber> const& elseAdd) const;
 		template Add<DdType::Sylvan, storm::RationalFunction> Bdd<DdType::Sylvan>::ite(Add<DdType::Sylvan, storm::RationalFunction> const& thenAdd, Add<DdType::Sylvan, storm::RationalFunction> const& elseAdd) const;
 #endif
+        
+        template std::pair<Bdd<DdType::Sylvan>, uint64_t> Bdd<DdType::Sylvan>::refinePartition(Add<DdType::Sylvan, double> const& signature, storm::expressions::Variable const& blockVariable) const;
+        
+#ifdef STORM_HAVE_CARL
+        template std::pair<Bdd<DdType::Sylvan>, uint64_t> Bdd<DdType::Sylvan>::refinePartition(Add<DdType::Sylvan, storm::RationalNumber> const& signature, storm::expressions::Variable const& blockVariable) const;
+        template std::pair<Bdd<DdType::Sylvan>, uint64_t> Bdd<DdType::Sylvan>::refinePartition(Add<DdType::Sylvan, storm::RationalFunction> const& signature, storm::expressions::Variable const& blockVariable) const;
+#endif
     }
 }
@@ -353,6 +353,24 @@ namespace storm {
              */
             storm::storage::BitVector filterExplicitVector(Odd const& odd, storm::storage::BitVector const& values) const;
             
+            /*!
+             * Refines the partition represented by this BDD with respect to the given signature. The BDD is assumed to
+             * map each encoding of its other variables to (at most) one block, which is encoded by the given block
+             * variable. In the result, each encoding that is mapped to a block is assigned a new block such that two
+             * encodings share a block iff they shared a block before and their signatures (i.e. the functions that
+             * remain of the signature after fixing the encodings) coincide. Note that signatures are compared for
+             * exact equality.
+             *
+             * The DD variables of the block variable (and its primed version) must be ordered below all other DD
+             * variables appearing in this BDD and the signature.
+             *
+             * @param signature The signature, which may depend on the block variable.
+             * @param blockVariable The meta variable used to encode the blocks.
+             * @return The refined partition and its number of blocks.
+             */
+            template<typename ValueType>
+            std::pair<Bdd<LibraryType>, uint64_t> refinePartition(Add<LibraryType, ValueType> const& signature, storm::expressions::Variable const& blockVariable) const;
+            
             friend struct std::hash<storm::dd::Bdd<LibraryType>>;
             
             template<DdType LibraryTypePrime, typename ValueType>
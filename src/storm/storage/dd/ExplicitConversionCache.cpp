@@ -0,0 +1,128 @@
+#include "storm/storage/dd/ExplicitConversionCache.h"
+
+#include "storm/utility/macros.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace dd {
+
+        template<DdType LibraryType, typename ValueType>
+        ExplicitConversionCache<LibraryType, ValueType>::ExplicitConversionCache(uint64_t maximalNumberOfOdds, uint64_t maximalNumberOfTranslations) : maximalNumberOfOdds(maximalNumberOfOdds), maximalNumberOfTranslations(maximalNumberOfTranslations) {
+            // Intentionally left empty.
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        void ExplicitConversionCache<LibraryType, ValueType>::setMaximalNumberOfTranslations(uint64_t maximalNumberOfTranslations) {
+            this->maximalNumberOfTranslations = maximalNumberOfTranslations;
+            while (translations.size() > maximalNumberOfTranslations) {
+                translations.pop_front();
+            }
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        Odd ExplicitConversionCache<LibraryType, ValueType>::getOdd(Bdd<LibraryType> const& states) {
+            for (auto const& statesOddPair : odds) {
+                if (statesOddPair.first == states) {
+                    STORM_LOG_TRACE("Retrieved ODD from cache.");
+                    return statesOddPair.second;
+                }
+            }
+
+            Odd odd = states.createOdd();
+            if (maximalNumberOfOdds > 0) {
+                if (odds.size() >= maximalNumberOfOdds) {
+                    odds.pop_front();
+                }
+                odds.emplace_back(states, odd);
+            }
+            return odd;
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ExplicitConversionCache<LibraryType, ValueType>::toMatrix(Add<LibraryType, ValueType> const& matrix, Odd const& rowOdd, Odd const& columnOdd) {
+            CachedTranslation const* translation = findTranslation(matrix, boost::none, boost::none, rowOdd, columnOdd);
+            if (translation != nullptr) {
+                return translation->resultMatrix;
+            }
+
+            auto result = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(matrix.toMatrix(rowOdd, columnOdd));
+            addTranslation(CachedTranslation{matrix, boost::none, boost::none, rowOdd, columnOdd, result, nullptr});
+            return result;
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ExplicitConversionCache<LibraryType, ValueType>::toMatrix(Add<LibraryType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& groupMetaVariables, Odd const& rowOdd, Odd const& columnOdd) {
+            CachedTranslation const* translation = findTranslation(matrix, boost::none, groupMetaVariables, rowOdd, columnOdd);
+            if (translation != nullptr) {
+                return translation->resultMatrix;
+            }
+
+            auto result = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(matrix.toMatrix(groupMetaVariables, rowOdd, columnOdd));
+            addTranslation(CachedTranslation{matrix, boost::none, groupMetaVariables, rowOdd, columnOdd, result, nullptr});
+            return result;
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::shared_ptr<std::vector<ValueType> const>> ExplicitConversionCache<LibraryType, ValueType>::toMatrixVector(Add<LibraryType, ValueType> const& matrix, Add<LibraryType, ValueType> const& vector, std::vector<uint_fast64_t>&& rowGroupSizes, std::set<storm::expressions::Variable> const& groupMetaVariables, Odd const& rowOdd, Odd const& columnOdd) {
+            CachedTranslation const* translation = findTranslation(matrix, vector, groupMetaVariables, rowOdd, columnOdd);
+            if (translation != nullptr) {
+                return std::make_pair(translation->resultMatrix, translation->resultVector);
+            }
+
+            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = matrix.toMatrixVector(vector, std::move(rowGroupSizes), groupMetaVariables, rowOdd, columnOdd);
+            auto resultMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(explicitRepresentation.first));
+            auto resultVector = std::make_shared<std::vector<ValueType> const>(std::move(explicitRepresentation.second));
+            addTranslation(CachedTranslation{matrix, vector, groupMetaVariables, rowOdd, columnOdd, resultMatrix, resultVector});
+            return std::make_pair(resultMatrix, resultVector);
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        void ExplicitConversionCache<LibraryType, ValueType>::clear() {
+            odds.clear();
+            translations.clear();
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        bool ExplicitConversionCache<LibraryType, ValueType>::isSameOdd(Odd const& first, Odd const& second) {
+            if (first.getElseOffset() != second.getElseOffset() || first.getThenOffset() != second.getThenOffset()) {
+                return false;
+            }
+            if (first.isTerminalNode() || second.isTerminalNode()) {
+                return first.isTerminalNode() && second.isTerminalNode();
+            }
+
+            // As the cache holds a copy of all ODDs it compares against, their nodes cannot be reused for other ODDs.
+            // Hence, two ODDs sharing their successor nodes are copies of the same ODD.
+            return &first.getElseSuccessor() == &second.getElseSuccessor() && &first.getThenSuccessor() == &second.getThenSuccessor();
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        typename ExplicitConversionCache<LibraryType, ValueType>::CachedTranslation const* ExplicitConversionCache<LibraryType, ValueType>::findTranslation(Add<LibraryType, ValueType> const& matrix, boost::optional<Add<LibraryType, ValueType>> const& vector, boost::optional<std::set<storm::expressions::Variable>> const& groupMetaVariables, Odd const& rowOdd, Odd const& columnOdd) const {
+            for (auto const& translation : translations) {
+                if (translation.matrix == matrix && translation.vector == vector && translation.groupMetaVariables == groupMetaVariables && isSameOdd(translation.rowOdd, rowOdd) && isSameOdd(translation.columnOdd, columnOdd)) {
+                    STORM_LOG_TRACE("Retrieved explicit translation from cache.");
+                    return &translation;
+                }
+            }
+            return nullptr;
+        }
+
+        template<DdType LibraryType, typename ValueType>
+        void ExplicitConversionCache<LibraryType, ValueType>::addTranslation(CachedTranslation&& translation) {
+            if (maximalNumberOfTranslations == 0) {
+                return;
+            }
+            if (translations.size() >= maximalNumberOfTranslations) {
+                translations.pop_front();
+            }
+            translations.push_back(std::move(translation));
+        }
+
+        template class ExplicitConversionCache<storm::dd::DdType::CUDD, double>;
+        template class ExplicitConversionCache<storm::dd::DdType::Sylvan, double>;
+
+        template class ExplicitConversionCache<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        template class ExplicitConversionCache<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef STORM_STORAGE_DD_EXPLICITCONVERSIONCACHE_H_
+#define STORM_STORAGE_DD_EXPLICITCONVERSIONCACHE_H_
+
+#include <deque>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Odd.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace dd {
+
+        /*!
+         * A cache for the translation of DDs to explicit matrices. It stores the ODDs of state sets and, if enabled,
+         * the matrices (and vectors) obtained from matrix DDs, such that repeated translations, for example when
+         * checking several properties of the same model, do not need to traverse the DDs again. A translation is only
+         * answered from the cache if its ODDs are (copies of) ODDs that were used for the cached translation, which is
+         * the case if they are retrieved from the cache. The cache only keeps the most recent entries. As explicit
+         * matrices can be large, caching them is disabled by default.
+         */
+        template<DdType LibraryType, typename ValueType>
+        class ExplicitConversionCache {
+        public:
+            /*!
+             * Creates an empty cache.
+             *
+             * @param maximalNumberOfOdds The maximal number of ODDs that are kept.
+             * @param maximalNumberOfTranslations The maximal number of explicit matrices (and vectors) that are kept.
+             */
+            ExplicitConversionCache(uint64_t maximalNumberOfOdds = 4, uint64_t maximalNumberOfTranslations = 0);
+
+            /*!
+             * Sets the maximal number of explicit matrices (and vectors) that are kept. If the cache currently holds
+             * more translations, the oldest ones are evicted.
+             *
+             * @param maximalNumberOfTranslations The new maximal number of translations. Zero disables the caching of
+             * translations.
+             */
+            void setMaximalNumberOfTranslations(uint64_t maximalNumberOfTranslations);
+
+            /*!
+             * Retrieves the ODD of the given set of states.
+             *
+             * @param states The states for which to retrieve the ODD.
+             * @return The ODD of the states.
+             */
+            Odd getOdd(Bdd<LibraryType> const& states);
+
+            /*!
+             * Translates the given matrix DD to an explicit matrix (see Add::toMatrix).
+             *
+             * @param matrix The matrix to translate.
+             * @param rowOdd The ODD used for determining the correct row.
+             * @param columnOdd The ODD used for determining the correct column.
+             * @return The explicit matrix. It is shared with the cache and must therefore not be modified.
+             */
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> toMatrix(Add<LibraryType, ValueType> const& matrix, Odd const& rowOdd, Odd const& columnOdd);
+
+            /*!
+             * Translates the given matrix DD to an explicit matrix with row groups (see Add::toMatrix).
+             *
+             * @param matrix The matrix to translate.
+             * @param groupMetaVariables The meta variables that are used to distinguish different row groups.
+             * @param rowOdd The ODD used for determining the correct row.
+             * @param columnOdd The ODD used for determining the correct column.
+             * @return The explicit matrix. It is shared with the cache and must therefore not be modified.
+             */
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> toMatrix(Add<LibraryType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& groupMetaVariables, Odd const& rowOdd, Odd const& columnOdd);
+
+            /*!
+             * Translates the given matrix DD and the given vector DD to an explicit matrix with row groups and an
+             * explicit vector (see Add::toMatrixVector). As the row group sizes are determined by the DDs and the ODDs,
+             * they are not taken into account when looking up the cached translation.
+             *
+             * @param matrix The matrix to translate.
+             * @param vector The vector to translate.
+             * @param rowGroupSizes The sizes of the row groups.
+             * @param groupMetaVariables The meta variables that are used to distinguish different row groups.
+             * @param rowOdd The ODD used for determining the correct row.
+             * @param columnOdd The ODD used for determining the correct column.
+             * @return The explicit matrix and vector. They are shared with the cache and must therefore not be modified.
+             */
+            std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::shared_ptr<std::vector<ValueType> const>> toMatrixVector(Add<LibraryType, ValueType> const& matrix, Add<LibraryType, ValueType> const& vector, std::vector<uint_fast64_t>&& rowGroupSizes, std::set<storm::expressions::Variable> const& groupMetaVariables, Odd const& rowOdd, Odd const& columnOdd);
+
+            /*!
+             * Removes all entries from the cache.
+             */
+            void clear();
+
+        private:
+            struct CachedTranslation {
+                Add<LibraryType, ValueType> matrix;
+                boost::optional<Add<LibraryType, ValueType>> vector;
+                boost::optional<std::set<storm::expressions::Variable>> groupMetaVariables;
+                Odd rowOdd;
+                Odd columnOdd;
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> resultMatrix;
+                std::shared_ptr<std::vector<ValueType> const> resultVector;
+            };
+
+            /*!
+             * Retrieves whether the two ODDs are copies of the same ODD.
+             */
+            static bool isSameOdd(Odd const& first, Odd const& second);
+
+            /*!
+             * Retrieves the cached translation for the given arguments, if there is any.
+             */
+            CachedTranslation const* findTranslation(Add<LibraryType, ValueType> const& matrix, boost::optional<Add<LibraryType, ValueType>> const& vector, boost::optional<std::set<storm::expressions::Variable>> const& groupMetaVariables, Odd const& rowOdd, Odd const& columnOdd) const;
+
+            /*!
+             * Adds the given translation to the cache (and evicts the oldest one if the cache is full).
+             */
+            void addTranslation(CachedTranslation&& translation);
+
+            // The maximal number of ODDs that are kept.
+            uint64_t maximalNumberOfOdds;
+
+            // The maximal number of translations that are kept.
+            uint64_t maximalNumberOfTranslations;
+
+            // The cached ODDs together with the states they were built for (most recent last).
+            std::deque<std::pair<Bdd<LibraryType>, Odd>> odds;
+
+            // The cached translations (most recent last).
+            std::deque<CachedTranslation> translations;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_DD_EXPLICITCONVERSIONCACHE_H_ */
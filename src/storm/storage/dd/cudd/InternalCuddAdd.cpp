@@ -9,10 +9,53 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotImplementedException.h"
 
 namespace storm {
     namespace dd {
+        namespace {
+            /*!
+             * Retrieves the level at which a DD with the given number of (row) levels is split to translate it to an
+             * explicit structure in parallel. The level is chosen such that there are enough parts to balance the load.
+             */
+            uint_fast64_t getParallelSplitLevel(uint_fast64_t numberOfLevels) {
+                uint_fast64_t splitLevel = 0;
+                while (splitLevel < numberOfLevels && (1ull << splitLevel) < 16 * storm::utility::parallel::getNumberOfThreads()) {
+                    ++splitLevel;
+                }
+                return splitLevel;
+            }
+            
+            /*!
+             * Computes the four cofactors of the given DD wrt. the given row and column variable.
+             */
+            void getRowColumnCofactors(DdNode const* dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex, DdNode const*& elseElse, DdNode const*& elseThen, DdNode const*& thenElse, DdNode const*& thenThen) {
+                if (ddColumnVariableIndex < Cudd_NodeReadIndex(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndex < Cudd_NodeReadIndex(dd)) {
+                    elseElse = thenElse = Cudd_E_const(dd);
+                    elseThen = thenThen = Cudd_T_const(dd);
+                } else {
+                    DdNode const* elseNode = Cudd_E_const(dd);
+                    if (ddColumnVariableIndex < Cudd_NodeReadIndex(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = Cudd_E_const(elseNode);
+                        elseThen = Cudd_T_const(elseNode);
+                    }
+                    
+                    DdNode const* thenNode = Cudd_T_const(dd);
+                    if (ddColumnVariableIndex < Cudd_NodeReadIndex(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = Cudd_E_const(thenNode);
+                        thenThen = Cudd_T_const(thenNode);
+                    }
+                }
+            }
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::CUDD, ValueType>::InternalAdd(InternalDdManager<DdType::CUDD> const* ddManager, cudd::ADD cuddAdd) : ddManager(ddManager), cuddAdd(cuddAdd) {
             // Intentionally left empty.
@@ -427,12 +470,29 @@ namespace storm {
 
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            composeWithExplicitVectorRec(this->getCuddDdNode(), nullptr, 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, targetVector, function);
+            composeWithExplicitVector(odd, ddVariableIndices, nullptr, targetVector, function);
         }
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            composeWithExplicitVectorRec(this->getCuddDdNode(), &offsets, 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, targetVector, function);
+            composeWithExplicitVector(odd, ddVariableIndices, &offsets, targetVector, function);
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const* offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
+            uint_fast64_t splitLevel = getParallelSplitLevel(ddVariableIndices.size());
+            if (splitLevel > 0 && storm::utility::parallel::useParallelExecution<ValueType>(odd.getTotalOffset())) {
+                // The sub-DDs below the split level write to disjoint positions of the target vector.
+                std::vector<std::tuple<DdNode const*, Odd const*, uint_fast64_t>> subDds;
+                splitForExplicitVectorRec(this->getCuddDdNode(), 0, splitLevel, 0, odd, ddVariableIndices, subDds);
+                storm::utility::parallel::parallelFor(0, subDds.size(), 1, [&] (uint64_t startIndex, uint64_t endIndex) {
+                    for (uint64_t index = startIndex; index < endIndex; ++index) {
+                        composeWithExplicitVectorRec(std::get<0>(subDds[index]), offsets, splitLevel, ddVariableIndices.size(), std::get<2>(subDds[index]), *std::get<1>(subDds[index]), ddVariableIndices, targetVector, function);
+                    }
+                });
+            } else {
+                composeWithExplicitVectorRec(this->getCuddDdNode(), offsets, 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, targetVector, function);
+            }
         }
 
         template<typename ValueType>
@@ -458,6 +518,23 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::splitForExplicitVectorRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::tuple<DdNode const*, Odd const*, uint_fast64_t>>& subDds) const {
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                subDds.emplace_back(dd, &odd, currentOffset);
+            } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                splitForExplicitVectorRec(dd, currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, subDds);
+                splitForExplicitVectorRec(dd, currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, subDds);
+            } else {
+                splitForExplicitVectorRec(Cudd_E_const(dd), currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, subDds);
+                splitForExplicitVectorRec(Cudd_T_const(dd), currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, subDds);
+            }
+        }
+        
         template<typename ValueType>
         std::vector<InternalAdd<DdType::CUDD, ValueType>> InternalAdd<DdType::CUDD, ValueType>::splitIntoGroups(std::vector<uint_fast64_t> const& ddGroupVariableIndices) const {
             std::vector<InternalAdd<DdType::CUDD, ValueType>> result;
@@ -518,7 +595,28 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t splitLevel = getParallelSplitLevel(ddRowVariableIndices.size());
+            if (splitLevel > 0 && storm::utility::parallel::useParallelExecution<ValueType>(rowOdd.getTotalOffset())) {
+                // All entries of a row stem from the sub-DDs that share the row offset, so the groups of sub-DDs fill
+                // disjoint rows and can be processed concurrently.
+                std::map<uint_fast64_t, std::vector<std::tuple<DdNode const*, Odd const*, Odd const*, uint_fast64_t>>> rowOffsetToSubDds;
+                splitForMatrixComponentsRec(this->getCuddDdNode(), rowOdd, columnOdd, 0, splitLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                
+                std::vector<std::pair<uint_fast64_t const, std::vector<std::tuple<DdNode const*, Odd const*, Odd const*, uint_fast64_t>>> const*> groups;
+                for (auto const& rowOffsetSubDdsPair : rowOffsetToSubDds) {
+                    groups.push_back(&rowOffsetSubDdsPair);
+                }
+                storm::utility::parallel::parallelFor(0, groups.size(), 1, [&] (uint64_t startIndex, uint64_t endIndex) {
+                    for (uint64_t index = startIndex; index < endIndex; ++index) {
+                        for (auto const& subDd : groups[index]->second) {
+                            toMatrixComponentsRec(std::get<0>(subDd), rowGroupIndices, rowIndications, columnsAndValues, *std::get<1>(subDd), *std::get<2>(subDd), splitLevel, splitLevel, maxLevel, groups[index]->first, std::get<3>(subDd), ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                        }
+                    }
+                });
+            } else {
+                toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            }
         }
 
         template<typename ValueType>
@@ -539,29 +637,7 @@ namespace storm {
                 DdNode const* elseThen;
                 DdNode const* thenElse;
                 DdNode const* thenThen;
-                
-                if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-                    elseElse = elseThen = thenElse = thenThen = dd;
-                } else if (ddRowVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-                    elseElse = thenElse = Cudd_E_const(dd);
-                    elseThen = thenThen = Cudd_T_const(dd);
-                } else {
-                    DdNode const* elseNode = Cudd_E_const(dd);
-                    if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(elseNode)) {
-                        elseElse = elseThen = elseNode;
-                    } else {
-                        elseElse = Cudd_E_const(elseNode);
-                        elseThen = Cudd_T_const(elseNode);
-                    }
-                    
-                    DdNode const* thenNode = Cudd_T_const(dd);
-                    if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(thenNode)) {
-                        thenElse = thenThen = thenNode;
-                    } else {
-                        thenElse = Cudd_E_const(thenNode);
-                        thenThen = Cudd_T_const(thenNode);
-                    }
-                }
+                getRowColumnCofactors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
                 
                 // Visit else-else.
                 toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
@@ -574,6 +650,28 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::splitForMatrixComponentsRec(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::map<uint_fast64_t, std::vector<std::tuple<DdNode const*, Odd const*, Odd const*, uint_fast64_t>>>& rowOffsetToSubDds) const {
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                rowOffsetToSubDds[currentRowOffset].emplace_back(dd, &rowOdd, &columnOdd, currentColumnOffset);
+            } else {
+                DdNode const* elseElse;
+                DdNode const* elseThen;
+                DdNode const* thenElse;
+                DdNode const* thenThen;
+                getRowColumnCofactors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+                
+                splitForMatrixComponentsRec(elseElse, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                splitForMatrixComponentsRec(elseThen, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                splitForMatrixComponentsRec(thenElse, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                splitForMatrixComponentsRec(thenThen, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+            }
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::fromVector(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices) {
             uint_fast64_t offset = 0;
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 
+#include <limits>
+
 #include <boost/functional/hash.hpp>
 
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
@@ -10,6 +12,8 @@
 
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     namespace dd {
         InternalBdd<DdType::CUDD>::InternalBdd(InternalDdManager<DdType::CUDD> const* ddManager, cudd::BDD cuddBdd) : ddManager(ddManager), cuddBdd(cuddBdd) {
@@ -534,6 +538,85 @@ namespace storm {
             // Return the variable for this node.
             return newNodeVariable;
         }
+        
+        template<typename ValueType>
+        std::pair<InternalBdd<DdType::CUDD>, uint64_t> InternalBdd<DdType::CUDD>::refinePartition(InternalAdd<DdType::CUDD, ValueType> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const {
+            std::unordered_map<std::pair<DdNode*, DdNode*>, cudd::BDD, boost::hash<std::pair<DdNode*, DdNode*>>> computedTable;
+            std::unordered_map<std::pair<DdNode*, DdNode*>, cudd::BDD, boost::hash<std::pair<DdNode*, DdNode*>>> blockTable;
+            // Since the variables may have been reordered, we compare the levels of the variables rather than their indices.
+            uint_fast64_t blockLevel = std::numeric_limits<uint_fast64_t>::max();
+            for (auto const& index : blockDdVariableIndices) {
+                blockLevel = std::min(blockLevel, static_cast<uint_fast64_t>(Cudd_ReadPerm(ddManager->getCuddManager().getManager(), static_cast<int>(index))));
+            }
+            cudd::BDD result = refinePartitionRec(this->getCuddDdNode(), signature.getCuddDdNode(), ddManager->getCuddManager(), blockDdVariableIndices, blockLevel, computedTable, blockTable);
+            return std::make_pair(InternalBdd<DdType::CUDD>(ddManager, result), blockTable.size());
+        }
+        
+        cudd::BDD InternalBdd<DdType::CUDD>::refinePartitionRec(DdNode* partitionNode, DdNode* signatureNode, cudd::Cudd const& manager, std::vector<uint_fast64_t> const& blockDdVariableIndices, uint_fast64_t blockLevel, std::unordered_map<std::pair<DdNode*, DdNode*>, cudd::BDD, boost::hash<std::pair<DdNode*, DdNode*>>>& computedTable, std::unordered_map<std::pair<DdNode*, DdNode*>, cudd::BDD, boost::hash<std::pair<DdNode*, DdNode*>>>& blockTable) {
+            // Encodings that are not mapped to a block remain unassigned.
+            if (partitionNode == Cudd_ReadLogicZero(manager.getManager())) {
+                return manager.bddZero();
+            }
+            
+            std::pair<DdNode*, DdNode*> nodePair(partitionNode, signatureNode);
+            uint_fast64_t partitionLevel = Cudd_IsConstant(partitionNode) ? std::numeric_limits<uint_fast64_t>::max() : Cudd_ReadPerm(manager.getManager(), Cudd_NodeReadIndex(partitionNode));
+            uint_fast64_t signatureLevel = Cudd_IsConstant(signatureNode) ? std::numeric_limits<uint_fast64_t>::max() : Cudd_ReadPerm(manager.getManager(), Cudd_NodeReadIndex(signatureNode));
+            bool partitionReachedBlocks = partitionLevel >= blockLevel;
+            bool signatureReachedBlocks = signatureLevel >= blockLevel;
+            
+            // If both nodes only depend on the block variables, the pair of nodes determines the new block.
+            if (partitionReachedBlocks && signatureReachedBlocks) {
+                auto blockIt = blockTable.find(nodePair);
+                if (blockIt != blockTable.end()) {
+                    return blockIt->second;
+                }
+                
+                uint64_t blockNumber = blockTable.size();
+                STORM_LOG_THROW(blockDdVariableIndices.size() >= 64 || blockNumber < (1ull << blockDdVariableIndices.size()), storm::exceptions::InvalidArgumentException, "Too few DD variables to encode the blocks of the partition.");
+                cudd::BDD encoding = manager.bddOne();
+                for (uint_fast64_t bit = 0; bit < blockDdVariableIndices.size(); ++bit) {
+                    cudd::BDD variable = manager.bddVar(static_cast<int>(blockDdVariableIndices[blockDdVariableIndices.size() - bit - 1]));
+                    if (blockNumber & (1ull << bit)) {
+                        encoding &= variable;
+                    } else {
+                        encoding &= !variable;
+                    }
+                }
+                blockTable.emplace(nodePair, encoding);
+                return encoding;
+            }
+            
+            auto computedIt = computedTable.find(nodePair);
+            if (computedIt != computedTable.end()) {
+                return computedIt->second;
+            }
+            
+            // Determine the topmost variable of the two nodes and compute the cofactors with respect to it.
+            uint_fast64_t level = std::min(partitionLevel, signatureLevel);
+            uint_fast64_t index = (partitionLevel == level) ? Cudd_NodeReadIndex(partitionNode) : Cudd_NodeReadIndex(signatureNode);
+            
+            DdNode* partitionThen = partitionNode;
+            DdNode* partitionElse = partitionNode;
+            if (partitionLevel == level) {
+                DdNode* regularNode = Cudd_Regular(partitionNode);
+                partitionThen = Cudd_NotCond(Cudd_T(regularNode), Cudd_IsComplement(partitionNode));
+                partitionElse = Cudd_NotCond(Cudd_E(regularNode), Cudd_IsComplement(partitionNode));
+            }
+            
+            // Since ADDs do not have complement edges, we can directly take the successors of the signature.
+            DdNode* signatureThen = signatureNode;
+            DdNode* signatureElse = signatureNode;
+            if (signatureLevel == level) {
+                signatureThen = Cudd_T(signatureNode);
+                signatureElse = Cudd_E(signatureNode);
+            }
+            
+            cudd::BDD thenResult = refinePartitionRec(partitionThen, signatureThen, manager, blockDdVariableIndices, blockLevel, computedTable, blockTable);
+            cudd::BDD elseResult = refinePartitionRec(partitionElse, signatureElse, manager, blockDdVariableIndices, blockLevel, computedTable, blockTable);
+            cudd::BDD result = manager.bddVar(static_cast<int>(index)).Ite(thenResult, elseResult);
+            computedTable.emplace(nodePair, result);
+            return result;
+        }
                 
         template InternalAdd<DdType::CUDD, double> InternalBdd<DdType::CUDD>::toAdd() const;
         template InternalAdd<DdType::CUDD, uint_fast64_t> InternalBdd<DdType::CUDD>::toAdd() const;
@@ -546,5 +629,7 @@ namespace storm {
 
         template InternalAdd<DdType::CUDD, double> InternalBdd<DdType::CUDD>::ite(InternalAdd<DdType::CUDD, double> const& thenAdd, InternalAdd<DdType::CUDD, double> const& elseAdd) const;
         template InternalAdd<DdType::CUDD, uint_fast64_t> InternalBdd<DdType::CUDD>::ite(InternalAdd<DdType::CUDD, uint_fast64_t> const& thenAdd, InternalAdd<DdType::CUDD, uint_fast64_t> const& elseAdd) const;
+        
+        template std::pair<InternalBdd<DdType::CUDD>, uint64_t> InternalBdd<DdType::CUDD>::refinePartition(InternalAdd<DdType::CUDD, double> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const;
     }
 }
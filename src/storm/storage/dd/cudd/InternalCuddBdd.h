@@ -6,6 +6,8 @@
 #include <functional>
 #include <memory>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
 
@@ -385,6 +387,20 @@ namespace storm {
              */
             void filterExplicitVector(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, storm::storage::BitVector const& sourceValues, storm::storage::BitVector& targetValues) const;
             
+            /*!
+             * Refines the partition represented by this BDD with respect to the given signature. Every encoding that
+             * is mapped to a block by this BDD is mapped to a new block such that two encodings share a block iff they
+             * shared a block before and their cofactors in the signature coincide.
+             *
+             * @param signature The signature with respect to which to refine the partition.
+             * @param blockDdVariableIndices The indices of the DD variables encoding the blocks (most significant bit
+             * first). All DD variables that are not ordered above the topmost of these variables are considered to
+             * encode blocks.
+             * @return The refined partition and its number of blocks.
+             */
+            template<typename ValueType>
+            std::pair<InternalBdd<DdType::CUDD>, uint64_t> refinePartition(InternalAdd<DdType::CUDD, ValueType> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const;
+            
             friend struct std::hash<storm::dd::InternalBdd<storm::dd::DdType::CUDD>>;
             
         private:
@@ -504,6 +520,21 @@ namespace storm {
              * how many nodes with the given variable index have been seen before.
              */
             static storm::expressions::Variable toExpressionRec(DdNode const* dd, cudd::Cudd const& ddManager, storm::expressions::ExpressionManager& manager, std::vector<storm::expressions::Expression>& expressions, std::unordered_map<uint_fast64_t, storm::expressions::Variable>& indexToVariableMap, std::unordered_map<std::pair<uint_fast64_t, uint_fast64_t>, storm::expressions::Variable>& countIndexToVariablePair, std::unordered_map<DdNode const*, uint_fast64_t>& nodeToCounterMap, std::vector<uint_fast64_t>& nextCounterForIndex);
+            
+            /*!
+             * Recursively refines the partition with respect to the signature.
+             *
+             * @param partitionNode The current node of the BDD representing the partition.
+             * @param signatureNode The current node of the ADD representing the signature.
+             * @param manager The manager responsible for the DDs.
+             * @param blockDdVariableIndices The indices of the DD variables encoding the blocks.
+             * @param blockLevel The level of the topmost DD variable encoding the blocks.
+             * @param computedTable A table storing the results of the already treated pairs of nodes.
+             * @param blockTable A table that maps the pairs of nodes encountered at the block variables to the BDD
+             * encoding of their new block.
+             * @return The resulting (CUDD) BDD.
+             */
+            static cudd::BDD refinePartitionRec(DdNode* partitionNode, DdNode* signatureNode, cudd::Cudd const& manager, std::vector<uint_fast64_t> const& blockDdVariableIndices, uint_fast64_t blockLevel, std::unordered_map<std::pair<DdNode*, DdNode*>, cudd::BDD, boost::hash<std::pair<DdNode*, DdNode*>>>& computedTable, std::unordered_map<std::pair<DdNode*, DdNode*>, cudd::BDD, boost::hash<std::pair<DdNode*, DdNode*>>>& blockTable);
 
             InternalDdManager<DdType::CUDD> const* ddManager;
             
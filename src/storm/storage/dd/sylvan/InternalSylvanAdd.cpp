@@ -8,6 +8,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 
@@ -15,6 +16,48 @@
 
 namespace storm {
     namespace dd {
+        namespace {
+            /*!
+             * Retrieves the level at which a DD with the given number of (row) levels is split to translate it to an
+             * explicit structure in parallel. The level is chosen such that there are enough parts to balance the load.
+             */
+            uint_fast64_t getParallelSplitLevel(uint_fast64_t numberOfLevels) {
+                uint_fast64_t splitLevel = 0;
+                while (splitLevel < numberOfLevels && (1ull << splitLevel) < 16 * storm::utility::parallel::getNumberOfThreads()) {
+                    ++splitLevel;
+                }
+                return splitLevel;
+            }
+            
+            /*!
+             * Computes the four cofactors of the given (regular) DD wrt. the given row and column variable.
+             */
+            void getRowColumnCofactors(MTBDD dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex, MTBDD& elseElse, MTBDD& elseThen, MTBDD& thenElse, MTBDD& thenThen) {
+                if (mtbdd_isleaf(dd) || ddColumnVariableIndex < mtbdd_getvar(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndex < mtbdd_getvar(dd)) {
+                    elseElse = thenElse = mtbdd_getlow(dd);
+                    elseThen = thenThen = mtbdd_gethigh(dd);
+                } else {
+                    MTBDD elseNode = mtbdd_getlow(dd);
+                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndex < mtbdd_getvar(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = mtbdd_getlow(elseNode);
+                        elseThen = mtbdd_gethigh(elseNode);
+                    }
+                    
+                    MTBDD thenNode = mtbdd_gethigh(dd);
+                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndex < mtbdd_getvar(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = mtbdd_getlow(thenNode);
+                        thenThen = mtbdd_gethigh(thenNode);
+                    }
+                }
+            }
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
             // Intentionally left empty.
@@ -830,12 +873,30 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            composeWithExplicitVectorRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), nullptr, 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, targetVector, function);
+            composeWithExplicitVector(odd, ddVariableIndices, nullptr, targetVector, function);
         }
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            composeWithExplicitVectorRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), &offsets, 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, targetVector, function);
+            composeWithExplicitVector(odd, ddVariableIndices, &offsets, targetVector, function);
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const* offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
+            MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+            uint_fast64_t splitLevel = getParallelSplitLevel(ddVariableIndices.size());
+            if (splitLevel > 0 && storm::utility::parallel::useParallelExecution<ValueType>(odd.getTotalOffset())) {
+                // The sub-DDs below the split level write to disjoint positions of the target vector.
+                std::vector<std::tuple<MTBDD, bool, Odd const*, uint_fast64_t>> subDds;
+                splitForExplicitVectorRec(mtbdd_regular(dd), mtbdd_hascomp(dd), 0, splitLevel, 0, odd, ddVariableIndices, subDds);
+                storm::utility::parallel::parallelFor(0, subDds.size(), 1, [&] (uint64_t startIndex, uint64_t endIndex) {
+                    for (uint64_t index = startIndex; index < endIndex; ++index) {
+                        composeWithExplicitVectorRec(std::get<0>(subDds[index]), std::get<1>(subDds[index]), offsets, splitLevel, ddVariableIndices.size(), std::get<3>(subDds[index]), *std::get<2>(subDds[index]), ddVariableIndices, targetVector, function);
+                    }
+                });
+            } else {
+                composeWithExplicitVectorRec(mtbdd_regular(dd), mtbdd_hascomp(dd), offsets, 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, targetVector, function);
+            }
         }
         
         template<typename ValueType>
@@ -868,6 +929,25 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::splitForExplicitVectorRec(MTBDD dd, bool negated, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::tuple<MTBDD, bool, Odd const*, uint_fast64_t>>& subDds) const {
+            if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                subDds.emplace_back(dd, negated, &odd, currentOffset);
+            } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                splitForExplicitVectorRec(dd, negated, currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, subDds);
+                splitForExplicitVectorRec(dd, negated, currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, subDds);
+            } else {
+                MTBDD thenNode = mtbdd_gethigh(dd);
+                MTBDD elseNode = mtbdd_getlow(dd);
+                splitForExplicitVectorRec(mtbdd_regular(elseNode), mtbdd_hascomp(elseNode) ^ negated, currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, subDds);
+                splitForExplicitVectorRec(mtbdd_regular(thenNode), mtbdd_hascomp(thenNode) ^ negated, currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, subDds);
+            }
+        }
+        
         template<typename ValueType>
         std::vector<InternalAdd<DdType::Sylvan, ValueType>> InternalAdd<DdType::Sylvan, ValueType>::splitIntoGroups(std::vector<uint_fast64_t> const& ddGroupVariableIndices) const {
             std::vector<InternalAdd<DdType::Sylvan, ValueType>> result;
@@ -961,7 +1041,29 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t splitLevel = getParallelSplitLevel(ddRowVariableIndices.size());
+            if (splitLevel > 0 && storm::utility::parallel::useParallelExecution<ValueType>(rowOdd.getTotalOffset())) {
+                // All entries of a row stem from the sub-DDs that share the row offset, so the groups of sub-DDs fill
+                // disjoint rows and can be processed concurrently.
+                std::map<uint_fast64_t, std::vector<std::tuple<MTBDD, bool, Odd const*, Odd const*, uint_fast64_t>>> rowOffsetToSubDds;
+                splitForMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowOdd, columnOdd, 0, splitLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                
+                std::vector<std::pair<uint_fast64_t const, std::vector<std::tuple<MTBDD, bool, Odd const*, Odd const*, uint_fast64_t>>> const*> groups;
+                for (auto const& rowOffsetSubDdsPair : rowOffsetToSubDds) {
+                    groups.push_back(&rowOffsetSubDdsPair);
+                }
+                storm::utility::parallel::parallelFor(0, groups.size(), 1, [&] (uint64_t startIndex, uint64_t endIndex) {
+                    for (uint64_t index = startIndex; index < endIndex; ++index) {
+                        for (auto const& subDd : groups[index]->second) {
+                            toMatrixComponentsRec(std::get<0>(subDd), std::get<1>(subDd), rowGroupIndices, rowIndications, columnsAndValues, *std::get<2>(subDd), *std::get<3>(subDd), splitLevel, splitLevel, maxLevel, groups[index]->first, std::get<4>(subDd), ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                        }
+                    }
+                });
+            } else {
+                toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            }
         }
         
         template<typename ValueType>
@@ -982,29 +1084,7 @@ namespace storm {
                 MTBDD elseThen;
                 MTBDD thenElse;
                 MTBDD thenThen;
-                
-                if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-                    elseElse = elseThen = thenElse = thenThen = dd;
-                } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-                    elseElse = thenElse = mtbdd_getlow(dd);
-                    elseThen = thenThen = mtbdd_gethigh(dd);
-                } else {
-                    MTBDD elseNode = mtbdd_getlow(dd);
-                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                        elseElse = elseThen = elseNode;
-                    } else {
-                        elseElse = mtbdd_getlow(elseNode);
-                        elseThen = mtbdd_gethigh(elseNode);
-                    }
-                    
-                    MTBDD thenNode = mtbdd_gethigh(dd);
-                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                        thenElse = thenThen = thenNode;
-                    } else {
-                        thenElse = mtbdd_getlow(thenNode);
-                        thenThen = mtbdd_gethigh(thenNode);
-                    }
-                }
+                getRowColumnCofactors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
                 
                 // Visit else-else.
                 toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
@@ -1017,6 +1097,28 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::splitForMatrixComponentsRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::map<uint_fast64_t, std::vector<std::tuple<MTBDD, bool, Odd const*, Odd const*, uint_fast64_t>>>& rowOffsetToSubDds) const {
+            if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                rowOffsetToSubDds[currentRowOffset].emplace_back(dd, negated, &rowOdd, &columnOdd, currentColumnOffset);
+            } else {
+                MTBDD elseElse;
+                MTBDD elseThen;
+                MTBDD thenElse;
+                MTBDD thenThen;
+                getRowColumnCofactors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+                
+                splitForMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                splitForMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                splitForMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+                splitForMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, rowOffsetToSubDds);
+            }
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::fromVector(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices) {
             uint_fast64_t offset = 0;
@@ -2,6 +2,8 @@
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANADD_H_
 
 #include <set>
+#include <map>
+#include <tuple>
 #include <unordered_map>
 
 #include "storm/storage/dd/DdType.h"
@@ -555,7 +557,8 @@ namespace storm {
             std::vector<std::pair<InternalAdd<DdType::Sylvan, ValueType>, InternalAdd<DdType::Sylvan, ValueType>>> splitIntoGroups(InternalAdd<DdType::Sylvan, ValueType> vector, std::vector<uint_fast64_t> const& ddGroupVariableIndices) const;
             
             /*!
-             * Translates the ADD into the components needed for constructing a matrix.
+             * Translates the ADD into the components needed for constructing a matrix. If the matrix is sufficiently
+             * large, the DD is split at a fixed row level and the resulting row ranges are filled concurrently.
              *
              * @param rowGroupIndices The row group indices.
              * @param rowIndications The vector that is to be filled with the row indications.
@@ -600,6 +603,19 @@ namespace storm {
              */
             static std::shared_ptr<Odd> createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>>& uniqueTableForLevels);
             
+            /*!
+             * Composes the ADD with an explicit vector by performing a specified function between the entries of the
+             * ADD and the explicit vector. If the vector is sufficiently large, the DD is split at a fixed level and
+             * the resulting parts are processed concurrently.
+             *
+             * @param odd The ODD to use for the translation from symbolic to explicit positions.
+             * @param ddVariableIndices The indices of the DD variables present in this ADD.
+             * @param offsets If given, the offsets that map the explicit positions to positions in the target vector.
+             * @param targetVector The explicit vector that is to be composed with the ADD.
+             * @param function The function to perform in the composition.
+             */
+            void composeWithExplicitVector(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<uint_fast64_t> const* offsets, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const;
+            
             /*!
              * Performs a recursive step to perform the given function between the given DD-based vector and the given
              * explicit vector.
@@ -615,6 +631,22 @@ namespace storm {
              */
             void composeWithExplicitVectorRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const* offsets, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const;
             
+            /*!
+             * Collects the (non-zero) sub-DDs that are reached at the given split level when translating the DD to an
+             * explicit vector. As the sub-DDs cover disjoint parts of the vector, they can be translated independently.
+             *
+             * @param dd The DD to split.
+             * @param negated A flag indicating whether the DD node is to be interpreted as being negated.
+             * @param currentLevel The currently considered level in the DD.
+             * @param splitLevel The level at which to split the DD.
+             * @param currentOffset The current offset.
+             * @param odd The ODD used for the translation.
+             * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
+             * @param subDds The vector to which the sub-DDs are added together with their negation flags, ODDs and
+             * offsets.
+             */
+            void splitForExplicitVectorRec(MTBDD dd, bool negated, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::tuple<MTBDD, bool, Odd const*, uint_fast64_t>>& subDds) const;
+            
             /*!
              * Splits the given matrix DD into the groups using the given group variables.
              *
@@ -684,6 +716,27 @@ namespace storm {
              */
             void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
             
+            /*!
+             * Collects the (non-zero) sub-DDs that are reached at the given split level when translating the DD to a
+             * matrix. The sub-DDs are grouped by their row offset and, within each group, kept in the order in which
+             * the sequential translation visits them, so the entries of each row are still generated in the order of
+             * their columns.
+             *
+             * @param dd The DD to split.
+             * @param negated A flag indicating whether the DD node is to be interpreted as being negated.
+             * @param rowOdd The ODD used for the row translation.
+             * @param columnOdd The ODD used for the column translation.
+             * @param currentLevel The currently considered row (and column) level in the DD.
+             * @param splitLevel The row level at which to split the DD.
+             * @param currentRowOffset The current row offset.
+             * @param currentColumnOffset The current column offset.
+             * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+             * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+             * @param rowOffsetToSubDds A mapping from row offsets to the sub-DDs (together with their negation flags,
+             * row and column ODDs and column offsets) that is to be filled.
+             */
+            void splitForMatrixComponentsRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::map<uint_fast64_t, std::vector<std::tuple<MTBDD, bool, Odd const*, Odd const*, uint_fast64_t>>>& rowOffsetToSubDds) const;
+            
             /*!
              * Retrieves the sylvan representation of the given double value.
              *
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
 
+#include <algorithm>
+
 #include <boost/functional/hash.hpp>
 
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
@@ -10,6 +12,7 @@
 #include "storm/storage/PairHash.h"
 
 #include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -527,6 +530,98 @@ namespace storm {
             return newNodeVariable;
         }
         
+        template<typename ValueType>
+        std::pair<InternalBdd<DdType::Sylvan>, uint64_t> InternalBdd<DdType::Sylvan>::refinePartition(InternalAdd<DdType::Sylvan, ValueType> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const {
+            std::unordered_map<std::pair<BDD, MTBDD>, sylvan::Bdd, boost::hash<std::pair<BDD, MTBDD>>> computedTable;
+            std::unordered_map<std::pair<BDD, MTBDD>, sylvan::Bdd, boost::hash<std::pair<BDD, MTBDD>>> blockTable;
+            
+            // Since the variables may have been reordered, the block variables need not have the largest indices, so
+            // we check the membership of a variable explicitly. However, the refinement is only correct if the block
+            // variables are ordered below all other variables that the partition and the signature depend on.
+            STORM_LOG_ASSERT(!blockDdVariableIndices.empty(), "Expected at least one block variable.");
+            std::vector<bool> isBlockDdVariable(ddManager->getNumberOfDdVariables());
+            uint_fast64_t firstBlockDdVariableIndex = *std::min_element(blockDdVariableIndices.begin(), blockDdVariableIndices.end());
+            for (auto const& index : blockDdVariableIndices) {
+                isBlockDdVariable[index] = true;
+            }
+            sylvan::Bdd support = this->getSylvanBdd().Support() & sylvan::Bdd(static_cast<BDD>(signature.getSylvanMtbdd().Support().GetMTBDD()));
+            for (; !support.isOne(); support = support.Then()) {
+                STORM_LOG_THROW(isBlockDdVariable[support.TopVar()] || support.TopVar() < firstBlockDdVariableIndex, storm::exceptions::InvalidArgumentException, "The DD variables encoding the blocks must be ordered below all other variables of the partition and the signature.");
+            }
+            
+            sylvan::Bdd result = refinePartitionRec(this->getSylvanBdd().GetBDD(), signature.getSylvanMtbdd().GetMTBDD(), blockDdVariableIndices, isBlockDdVariable, computedTable, blockTable);
+            return std::make_pair(InternalBdd<DdType::Sylvan>(ddManager, result), blockTable.size());
+        }
+        
+        sylvan::Bdd InternalBdd<DdType::Sylvan>::refinePartitionRec(BDD partitionNode, MTBDD signatureNode, std::vector<uint_fast64_t> const& blockDdVariableIndices, std::vector<bool> const& isBlockDdVariable, std::unordered_map<std::pair<BDD, MTBDD>, sylvan::Bdd, boost::hash<std::pair<BDD, MTBDD>>>& computedTable, std::unordered_map<std::pair<BDD, MTBDD>, sylvan::Bdd, boost::hash<std::pair<BDD, MTBDD>>>& blockTable) {
+            // Encodings that are not mapped to a block remain unassigned.
+            if (partitionNode == sylvan_false) {
+                return sylvan::Bdd::bddZero();
+            }
+            
+            std::pair<BDD, MTBDD> nodePair(partitionNode, signatureNode);
+            bool partitionReachedBlocks = mtbdd_isleaf(partitionNode) || isBlockDdVariable[mtbdd_getvar(partitionNode)];
+            bool signatureReachedBlocks = mtbdd_isleaf(signatureNode) || isBlockDdVariable[mtbdd_getvar(signatureNode)];
+            
+            // If both nodes only depend on the block variables, the pair of nodes determines the new block.
+            if (partitionReachedBlocks && signatureReachedBlocks) {
+                auto blockIt = blockTable.find(nodePair);
+                if (blockIt != blockTable.end()) {
+                    return blockIt->second;
+                }
+                
+                uint64_t blockNumber = blockTable.size();
+                STORM_LOG_THROW(blockDdVariableIndices.size() >= 64 || blockNumber < (1ull << blockDdVariableIndices.size()), storm::exceptions::InvalidArgumentException, "Too few DD variables to encode the blocks of the partition.");
+                sylvan::Bdd encoding = sylvan::Bdd::bddOne();
+                for (uint_fast64_t bit = 0; bit < blockDdVariableIndices.size(); ++bit) {
+                    sylvan::Bdd variable = sylvan::Bdd::bddVar(static_cast<BDDVAR>(blockDdVariableIndices[blockDdVariableIndices.size() - bit - 1]));
+                    if (blockNumber & (1ull << bit)) {
+                        encoding &= variable;
+                    } else {
+                        encoding &= !variable;
+                    }
+                }
+                blockTable.emplace(nodePair, encoding);
+                return encoding;
+            }
+            
+            auto computedIt = computedTable.find(nodePair);
+            if (computedIt != computedTable.end()) {
+                return computedIt->second;
+            }
+            
+            // Determine the topmost variable of the two nodes and compute the cofactors with respect to it. Note that
+            // the successor functions of Sylvan already take care of complemented edges.
+            BDDVAR variable;
+            if (partitionReachedBlocks) {
+                variable = mtbdd_getvar(signatureNode);
+            } else if (signatureReachedBlocks) {
+                variable = mtbdd_getvar(partitionNode);
+            } else {
+                variable = std::min(mtbdd_getvar(partitionNode), mtbdd_getvar(signatureNode));
+            }
+            
+            BDD partitionThen = partitionNode;
+            BDD partitionElse = partitionNode;
+            if (!partitionReachedBlocks && mtbdd_getvar(partitionNode) == variable) {
+                partitionThen = mtbdd_gethigh(partitionNode);
+                partitionElse = mtbdd_getlow(partitionNode);
+            }
+            
+            MTBDD signatureThen = signatureNode;
+            MTBDD signatureElse = signatureNode;
+            if (!signatureReachedBlocks && mtbdd_getvar(signatureNode) == variable) {
+                signatureThen = mtbdd_gethigh(signatureNode);
+                signatureElse = mtbdd_getlow(signatureNode);
+            }
+            
+            sylvan::Bdd thenResult = refinePartitionRec(partitionThen, signatureThen, blockDdVariableIndices, isBlockDdVariable, computedTable, blockTable);
+            sylvan::Bdd elseResult = refinePartitionRec(partitionElse, signatureElse, blockDdVariableIndices, isBlockDdVariable, computedTable, blockTable);
+            sylvan::Bdd result = sylvan::Bdd::bddVar(variable).Ite(thenResult, elseResult);
+            computedTable.emplace(nodePair, result);
+            return result;
+        }
+        
         template InternalAdd<DdType::Sylvan, double> InternalBdd<DdType::Sylvan>::toAdd() const;
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalBdd<DdType::Sylvan>::toAdd() const;
         template InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalBdd<DdType::Sylvan>::toAdd() const;
@@ -541,5 +636,9 @@ namespace storm {
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalBdd<DdType::Sylvan>::ite(InternalAdd<DdType::Sylvan, uint_fast64_t> const& thenAdd, InternalAdd<DdType::Sylvan, uint_fast64_t> const& elseAdd) const;
         template InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalBdd<DdType::Sylvan>::ite(InternalAdd<DdType::Sylvan, storm::RationalNumber> const& thenAdd, InternalAdd<DdType::Sylvan, storm::RationalNumber> const& elseAdd) const;
 		template InternalAdd<DdType::Sylvan, storm::RationalFunction> InternalBdd<DdType::Sylvan>::ite(InternalAdd<DdType::Sylvan, storm::RationalFunction> const& thenAdd, InternalAdd<DdType::Sylvan, storm::RationalFunction> const& elseAdd) const;
+        
+        template std::pair<InternalBdd<DdType::Sylvan>, uint64_t> InternalBdd<DdType::Sylvan>::refinePartition(InternalAdd<DdType::Sylvan, double> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const;
+        template std::pair<InternalBdd<DdType::Sylvan>, uint64_t> InternalBdd<DdType::Sylvan>::refinePartition(InternalAdd<DdType::Sylvan, storm::RationalNumber> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const;
+		template std::pair<InternalBdd<DdType::Sylvan>, uint64_t> InternalBdd<DdType::Sylvan>::refinePartition(InternalAdd<DdType::Sylvan, storm::RationalFunction> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const;
     }
 }
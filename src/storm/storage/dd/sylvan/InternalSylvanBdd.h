@@ -6,6 +6,8 @@
 #include <functional>
 #include <memory>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
 
@@ -374,6 +376,20 @@ namespace storm {
              */
             void filterExplicitVector(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, storm::storage::BitVector const& sourceValues, storm::storage::BitVector& targetValues) const;
 
+            /*!
+             * Refines the partition represented by this BDD with respect to the given signature. Every encoding that
+             * is mapped to a block by this BDD is mapped to a new block such that two encodings share a block iff they
+             * shared a block before and their cofactors in the signature coincide.
+             *
+             * @param signature The signature with respect to which to refine the partition.
+             * @param blockDdVariableIndices The indices of the DD variables encoding the blocks (most significant bit
+             * first). These variables must be ordered below all other variables the partition and the signature depend
+             * on.
+             * @return The refined partition and its number of blocks.
+             */
+            template<typename ValueType>
+            std::pair<InternalBdd<DdType::Sylvan>, uint64_t> refinePartition(InternalAdd<DdType::Sylvan, ValueType> const& signature, std::vector<uint_fast64_t> const& blockDdVariableIndices) const;
+            
             friend struct std::hash<storm::dd::InternalBdd<storm::dd::DdType::Sylvan>>;
             
         private:
@@ -474,6 +490,20 @@ namespace storm {
              */
             static storm::expressions::Variable toExpressionRec(BDD dd, storm::expressions::ExpressionManager& manager, std::vector<storm::expressions::Expression>& expressions, std::unordered_map<uint_fast64_t, storm::expressions::Variable>& indexToVariableMap, std::unordered_map<std::pair<uint_fast64_t, uint_fast64_t>, storm::expressions::Variable>& countIndexToVariablePair, std::unordered_map<BDD, uint_fast64_t>& nodeToCounterMap, std::vector<uint_fast64_t>& nextCounterForIndex);
             
+            /*!
+             * Recursively refines the partition with respect to the signature.
+             *
+             * @param partitionNode The current node of the BDD representing the partition.
+             * @param signatureNode The current node of the MTBDD representing the signature.
+             * @param blockDdVariableIndices The indices of the DD variables encoding the blocks.
+             * @param isBlockDdVariable A flag for every DD variable index that indicates whether it encodes blocks.
+             * @param computedTable A table storing the results of the already treated pairs of nodes.
+             * @param blockTable A table that maps the pairs of nodes encountered at the block variables to the BDD
+             * encoding of their new block.
+             * @return The resulting (Sylvan) BDD.
+             */
+            static sylvan::Bdd refinePartitionRec(BDD partitionNode, MTBDD signatureNode, std::vector<uint_fast64_t> const& blockDdVariableIndices, std::vector<bool> const& isBlockDdVariable, std::unordered_map<std::pair<BDD, MTBDD>, sylvan::Bdd, boost::hash<std::pair<BDD, MTBDD>>>& computedTable, std::unordered_map<std::pair<BDD, MTBDD>, sylvan::Bdd, boost::hash<std::pair<BDD, MTBDD>>>& blockTable);
+            
             /*!
              * Retrieves the sylvan BDD.
              *
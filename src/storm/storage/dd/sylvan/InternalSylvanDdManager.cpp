@@ -1,7 +1,9 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
@@ -22,6 +24,24 @@ namespace storm {
         // some operations.
         uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
         
+        std::vector<uint_fast64_t> InternalDdManager<DdType::Sylvan>::variableGroupSizes;
+        
+        bool InternalDdManager<DdType::Sylvan>::dynamicReorderingAllowed = false;
+        
+        // Like CUDD, we do not reorder before the DDs have reached a certain size.
+        uint_fast64_t const firstReorderingThreshold = 4096;
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::nextReorderingThreshold = firstReorderingThreshold;
+        
+        // The number of nodes that were alive after the last garbage collection. It is updated by a hook that is
+        // called by sylvan after every garbage collection.
+        uint_fast64_t numberOfLiveNodesAfterGarbageCollection = 0;
+        
+        VOID_TASK_0(updateNumberOfLiveNodes) {
+            size_t filled;
+            sylvan_table_usage(&filled, NULL);
+            numberOfLiveNodesAfterGarbageCollection = filled;
+        }
+        
         uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
             for (uint_fast64_t index = 0; index < 64; ++index) {
                 if ((number & (1ull << (63 - index))) != 0) {
@@ -31,7 +51,7 @@ namespace storm {
             return 0;
         }
         
-        InternalDdManager<DdType::Sylvan>::InternalDdManager() {
+        InternalDdManager<DdType::Sylvan>::InternalDdManager() : reorderingTechnique(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getReorderingTechnique()), maximalGrowth(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalGrowth()) {
             if (numberOfInstances == 0) {
                 storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
                 if (settings.isNumberOfThreadsSet()) {
@@ -51,6 +71,7 @@ namespace storm {
                 sylvan::Sylvan::initBdd();
                 sylvan::Sylvan::initMtbdd();
                 sylvan::Sylvan::initCustomMtbdd();
+                sylvan_gc_hook_postgc(TASK(updateNumberOfLiveNodes));
             }
             ++numberOfInstances;
         }
@@ -144,6 +165,9 @@ namespace storm {
 
         std::vector<InternalBdd<DdType::Sylvan>> InternalDdManager<DdType::Sylvan>::createDdVariables(uint64_t numberOfLayers, boost::optional<uint_fast64_t> const& position) {
             STORM_LOG_THROW(!position, storm::exceptions::NotSupportedException, "The manager does not support ordered insertion.");
+            
+            // Since no operation is running when variables are created, this is a safe point for dynamic reordering.
+            this->reorderIfNecessary();
 			
             std::vector<InternalBdd<DdType::Sylvan>> result;
             
@@ -151,6 +175,9 @@ namespace storm {
                 result.emplace_back(InternalBdd<DdType::Sylvan>(this, sylvan::Bdd::bddVar(nextFreeVariableIndex)));
                 ++nextFreeVariableIndex;
             }
+            if (numberOfLayers > 0) {
+                variableGroupSizes.push_back(numberOfLayers);
+            }
             
             return result;
         }
@@ -159,16 +186,158 @@ namespace storm {
             return false;
         }
         
-        void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool) {
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+        void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool value) {
+            dynamicReorderingAllowed = value;
         }
         
         bool InternalDdManager<DdType::Sylvan>::isDynamicReorderingAllowed() const {
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+            return dynamicReorderingAllowed;
         }
         
         void InternalDdManager<DdType::Sylvan>::triggerReordering() {
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+            if (reorderingTechnique != storm::settings::modules::SylvanSettings::ReorderingTechnique::None) {
+                this->performReordering();
+            }
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::reorderIfNecessary() {
+            if (dynamicReorderingAllowed && reorderingTechnique != storm::settings::modules::SylvanSettings::ReorderingTechnique::None && numberOfLiveNodesAfterGarbageCollection > nextReorderingThreshold) {
+                this->performReordering();
+            }
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::performReordering() {
+            // Sylvan can only reorder by renaming the variables of all DDs and requires row and column variables to be
+            // located on even and odd levels, respectively. We therefore move units of consecutive groups that span an
+            // even number of levels, which preserves the parity of the level of every variable. If the groups do not
+            // add up to an even number, the remaining groups stay at the bottom.
+            std::vector<std::vector<uint_fast64_t>> unitGroupSizes;
+            std::vector<uint_fast64_t> unitSizes;
+            std::vector<uint_fast64_t> remainingGroupSizes;
+            uint_fast64_t currentUnitSize = 0;
+            for (auto const& groupSize : variableGroupSizes) {
+                remainingGroupSizes.push_back(groupSize);
+                currentUnitSize += groupSize;
+                if (currentUnitSize % 2 == 0) {
+                    unitGroupSizes.push_back(std::move(remainingGroupSizes));
+                    unitSizes.push_back(currentUnitSize);
+                    remainingGroupSizes.clear();
+                    currentUnitSize = 0;
+                }
+            }
+            uint_fast64_t numberOfUnits = unitSizes.size();
+            if (numberOfUnits < 2) {
+                return;
+            }
+            
+            LACE_ME;
+            sylvan_gc();
+            uint_fast64_t size = mtbdd_protected_nodecount();
+            uint_fast64_t initialSize = size;
+            
+            // The units in the order of their levels.
+            std::vector<uint_fast64_t> order(numberOfUnits);
+            std::iota(order.begin(), order.end(), 0);
+            std::vector<uint32_t> permutation(nextFreeVariableIndex);
+            
+            // Swaps the units at the given position and the next position and (optionally) returns the new size.
+            auto swapUnits = [&] (uint_fast64_t position, bool countNodes) {
+                uint_fast64_t first = 0;
+                for (uint_fast64_t index = 0; index < position; ++index) {
+                    first += unitSizes[order[index]];
+                }
+                uint_fast64_t upperSize = unitSizes[order[position]];
+                uint_fast64_t lowerSize = unitSizes[order[position + 1]];
+                for (uint_fast64_t level = first; level < first + upperSize; ++level) {
+                    permutation[level] = static_cast<uint32_t>(level + lowerSize);
+                }
+                for (uint_fast64_t level = first + upperSize; level < first + upperSize + lowerSize; ++level) {
+                    permutation[level] = static_cast<uint32_t>(level - upperSize);
+                }
+                mtbdd_protected_permute_block(permutation.data(), static_cast<uint32_t>(first), static_cast<uint32_t>(first + upperSize + lowerSize - 1));
+                std::swap(order[position], order[position + 1]);
+                return countNodes ? mtbdd_protected_nodecount() : 0;
+            };
+            
+            uint_fast64_t sizeBeforeRound;
+            do {
+                sizeBeforeRound = size;
+                
+                // Sift the units in the order of decreasing number of nodes labeled with their variables.
+                std::vector<size_t> levelCounts(nextFreeVariableIndex);
+                mtbdd_protected_level_counts(levelCounts.data(), static_cast<uint32_t>(nextFreeVariableIndex));
+                std::vector<uint_fast64_t> unitNodeCounts(numberOfUnits);
+                uint_fast64_t level = 0;
+                for (auto const& unit : order) {
+                    for (uint_fast64_t offset = 0; offset < unitSizes[unit]; ++offset, ++level) {
+                        unitNodeCounts[unit] += levelCounts[level];
+                    }
+                }
+                std::vector<uint_fast64_t> unitsToSift(order);
+                std::stable_sort(unitsToSift.begin(), unitsToSift.end(), [&unitNodeCounts] (uint_fast64_t const& a, uint_fast64_t const& b) { return unitNodeCounts[a] > unitNodeCounts[b]; });
+                
+                for (auto const& unit : unitsToSift) {
+                    uint_fast64_t position = std::distance(order.begin(), std::find(order.begin(), order.end(), unit));
+                    uint_fast64_t bestPosition = position;
+                    uint_fast64_t bestSize = size;
+                    
+                    // Moves the unit in the given direction until the DDs grow too much or the end is reached.
+                    auto moveDown = [&] () {
+                        while (position + 1 < numberOfUnits) {
+                            size = swapUnits(position, true);
+                            ++position;
+                            if (size < bestSize) {
+                                bestSize = size;
+                                bestPosition = position;
+                            } else if (size > maximalGrowth * bestSize) {
+                                break;
+                            }
+                        }
+                    };
+                    auto moveUp = [&] () {
+                        while (position > 0) {
+                            size = swapUnits(position - 1, true);
+                            --position;
+                            if (size < bestSize) {
+                                bestSize = size;
+                                bestPosition = position;
+                            } else if (size > maximalGrowth * bestSize) {
+                                break;
+                            }
+                        }
+                    };
+                    
+                    // Like CUDD, we first move the unit towards the closer end.
+                    if (2 * position >= numberOfUnits) {
+                        moveDown();
+                        moveUp();
+                    } else {
+                        moveUp();
+                        moveDown();
+                    }
+                    
+                    // Finally, move the unit back to its best position.
+                    for (; position < bestPosition; ++position) {
+                        swapUnits(position, false);
+                    }
+                    for (; position > bestPosition; --position) {
+                        swapUnits(position - 1, false);
+                    }
+                    size = bestSize;
+                }
+            } while (reorderingTechnique == storm::settings::modules::SylvanSettings::ReorderingTechnique::GroupSiftConv && size < sizeBeforeRound);
+            
+            // Record the new order of the groups.
+            std::vector<uint_fast64_t> newVariableGroupSizes;
+            for (auto const& unit : order) {
+                newVariableGroupSizes.insert(newVariableGroupSizes.end(), unitGroupSizes[unit].begin(), unitGroupSizes[unit].end());
+            }
+            newVariableGroupSizes.insert(newVariableGroupSizes.end(), remainingGroupSizes.begin(), remainingGroupSizes.end());
+            variableGroupSizes = std::move(newVariableGroupSizes);
+            
+            sylvan_gc();
+            nextReorderingThreshold = std::max(2 * size, firstReorderingThreshold);
+            STORM_LOG_DEBUG("Reordered DD variables, reducing the number of nodes from " << initialSize << " to " << size << ".");
         }
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
@@ -1,6 +1,8 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -9,6 +11,8 @@
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include "storm/settings/modules/SylvanSettings.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm-config.h"
 
@@ -94,7 +98,9 @@ namespace storm {
             bool supportsOrderedInsertion() const;
             
             /*!
-             * Sets whether or not dynamic reordering is allowed for the DDs managed by this manager.
+             * Sets whether or not dynamic reordering is allowed for the DDs managed by this manager. As Sylvan cannot
+             * reorder while an operation is running, a reordering that becomes necessary is only performed at the next
+             * safe point, i.e. when new DD variables are created.
              *
              * @param value If set to true, dynamic reordering is allowed and forbidden otherwise.
              */
@@ -108,7 +114,8 @@ namespace storm {
             bool isDynamicReorderingAllowed() const;
             
             /*!
-             * Triggers a reordering of the DDs managed by this manager.
+             * Triggers a reordering of the DDs managed by this manager. Since the variable indices coincide with the
+             * levels in Sylvan, this changes the indices of the DD variables.
              */
             void triggerReordering();
             
@@ -120,6 +127,23 @@ namespace storm {
             uint_fast64_t getNumberOfDdVariables() const;
             
         private:
+            /*!
+             * Performs a reordering if dynamic reordering is allowed and the number of nodes has grown sufficiently
+             * since the last reordering. This may only be called when no DD operation is running.
+             */
+            void reorderIfNecessary();
+            
+            /*!
+             * Reorders the DD variables by sifting groups of variables.
+             */
+            void performReordering();
+            
+            // The reordering technique to use.
+            storm::settings::modules::SylvanSettings::ReorderingTechnique reorderingTechnique;
+            
+            // The factor by which the DDs may grow while a group is sifted in one direction.
+            double maximalGrowth;
+            
             // A counter for the number of instances of this class. This is used to determine when to initialize and
             // quit the sylvan. This is because Sylvan does not know the concept of managers but implicitly has a
             // 'global' manager.
@@ -128,6 +152,16 @@ namespace storm {
             // The index of the next free variable index. This needs to be shared across all instances since the sylvan
             // manager is implicitly 'global'.
             static uint_fast64_t nextFreeVariableIndex;
+            
+            // The sizes of the groups of variables (created together) in the order of their levels. These groups are
+            // kept together during reordering, so for example row and column variables stay interleaved.
+            static std::vector<uint_fast64_t> variableGroupSizes;
+            
+            // Whether dynamic reordering is allowed.
+            static bool dynamicReorderingAllowed;
+            
+            // The number of live nodes beyond which the next dynamic reordering is performed.
+            static uint_fast64_t nextReorderingThreshold;
         };
         
         template<>
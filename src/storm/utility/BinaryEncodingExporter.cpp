@@ -0,0 +1,180 @@
+#include "storm/utility/BinaryEncodingExporter.h"
+
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace exporter {
+
+        namespace binary {
+            char const* const magic = "STORMBIN";
+        }
+
+        namespace {
+            void writeUint64(std::ostream& os, uint64_t value) {
+                os.write(reinterpret_cast<char const*>(&value), sizeof(uint64_t));
+            }
+
+            template<typename T>
+            void writeArray(std::ostream& os, T const* data, uint64_t count) {
+                static_assert(sizeof(T) % sizeof(uint64_t) == 0, "Arrays need to consist of 64-bit words.");
+                if (count > 0) {
+                    os.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+                }
+            }
+
+            template<typename T>
+            void writeVector(std::ostream& os, std::vector<T> const& vector) {
+                writeUint64(os, vector.size());
+                writeArray(os, vector.data(), vector.size());
+            }
+
+            void writeString(std::ostream& os, std::string const& string) {
+                writeUint64(os, string.size());
+                os.write(string.data(), string.size());
+
+                // Pad the string such that the next section is aligned.
+                uint64_t padding = (sizeof(uint64_t) - string.size() % sizeof(uint64_t)) % sizeof(uint64_t);
+                for (uint64_t i = 0; i < padding; ++i) {
+                    os.put('\0');
+                }
+            }
+
+            void writeBitVector(std::ostream& os, storm::storage::BitVector const& bitVector) {
+                writeUint64(os, bitVector.size());
+                for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+                    writeUint64(os, bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+                }
+            }
+
+            void writeLabeling(std::ostream& os, storm::models::sparse::ItemLabeling const& labeling) {
+                std::set<std::string> labels = labeling.getLabels();
+                writeUint64(os, labels.size());
+                for (auto const& label : labels) {
+                    writeString(os, label);
+                    if (labeling.isStateLabeling()) {
+                        writeBitVector(os, labeling.asStateLabeling().getStates(label));
+                    } else {
+                        writeBitVector(os, labeling.asChoiceLabeling().getChoices(label));
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            void writeMatrix(std::ostream& os, storm::storage::SparseMatrix<ValueType> const& matrix) {
+                typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+                typedef storm::storage::MatrixEntry<index_type, ValueType> entry_type;
+                static_assert(sizeof(index_type) == sizeof(uint64_t), "Unexpected size of matrix indices.");
+                static_assert(sizeof(entry_type) == sizeof(index_type) + sizeof(ValueType) && std::is_standard_layout<entry_type>::value, "Matrix entries cannot be written as a raw array.");
+
+                writeUint64(os, matrix.getRowCount());
+                writeUint64(os, matrix.getColumnCount());
+                writeUint64(os, matrix.getEntryCount());
+
+                // The entries of all rows are stored contiguously, so we can recover the row indications from the
+                // positions of the rows.
+                std::vector<index_type> rowIndications;
+                rowIndications.reserve(matrix.getRowCount() + 1);
+                for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                    rowIndications.push_back(std::distance(matrix.begin(), matrix.begin(row)));
+                }
+                rowIndications.push_back(matrix.getEntryCount());
+                writeArray(os, rowIndications.data(), rowIndications.size());
+                if (matrix.getEntryCount() > 0) {
+                    writeArray(os, &*matrix.begin(), matrix.getEntryCount());
+                }
+
+                writeUint64(os, matrix.hasTrivialRowGrouping() ? 0 : 1);
+                if (!matrix.hasTrivialRowGrouping()) {
+                    writeVector(os, matrix.getRowGroupIndices());
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+            STORM_LOG_THROW(!sparseModel->isOfType(storm::models::ModelType::S2pg), storm::exceptions::NotSupportedException, "Stochastic two player games cannot be exported in the binary format.");
+            static_assert(sizeof(ValueType) % sizeof(uint64_t) == 0 && std::is_trivially_copyable<ValueType>::value, "Value type cannot be exported in the binary format.");
+
+            // Write header
+            os.write(binary::magic, binary::magicLength);
+            writeUint64(os, binary::byteOrderMark);
+            writeUint64(os, binary::version);
+            writeUint64(os, sizeof(ValueType));
+            std::stringstream typeStream;
+            typeStream << sparseModel->getType();
+            writeString(os, typeStream.str());
+
+            // Notice that for CTMCs we write the rate matrix instead of probabilities
+            writeMatrix(os, sparseModel->getTransitionMatrix());
+            writeLabeling(os, sparseModel->getStateLabeling());
+
+            // Write reward models
+            writeUint64(os, sparseModel->getRewardModels().size());
+            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+                auto const& rewardModel = rewardModelEntry.second;
+                writeString(os, rewardModelEntry.first);
+                uint64_t flags = 0;
+                if (rewardModel.hasStateRewards()) {
+                    flags |= binary::stateRewardsFlag;
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    flags |= binary::stateActionRewardsFlag;
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    flags |= binary::transitionRewardsFlag;
+                }
+                writeUint64(os, flags);
+                if (rewardModel.hasStateRewards()) {
+                    writeVector(os, rewardModel.getStateRewardVector());
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    writeVector(os, rewardModel.getStateActionRewardVector());
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    writeMatrix(os, rewardModel.getTransitionRewardMatrix());
+                }
+            }
+
+            // Write choice labeling
+            writeUint64(os, sparseModel->hasChoiceLabeling() ? 1 : 0);
+            if (sparseModel->hasChoiceLabeling()) {
+                writeLabeling(os, sparseModel->getChoiceLabeling());
+            }
+
+            // Write exit rates and Markovian states
+            if (sparseModel->isOfType(storm::models::ModelType::Ctmc)) {
+                writeUint64(os, 1);
+                writeVector(os, sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+            } else if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                writeUint64(os, 1);
+                writeVector(os, sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates());
+            } else {
+                writeUint64(os, 0);
+            }
+            if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                writeUint64(os, 1);
+                writeBitVector(os, sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getMarkovianStates());
+            } else {
+                writeUint64(os, 0);
+            }
+        }
+
+        template<typename ValueType>
+        void binaryExportSparseMatrix(std::ostream& os, storm::storage::SparseMatrix<ValueType> const& matrix) {
+            static_assert(sizeof(ValueType) % sizeof(uint64_t) == 0 && std::is_trivially_copyable<ValueType>::value, "Value type cannot be exported in the binary format.");
+            writeMatrix(os, matrix);
+        }
+
+        template void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+        template void binaryExportSparseMatrix<double>(std::ostream& os, storm::storage::SparseMatrix<double> const& matrix);
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * Exports a sparse model into a binary format that can be loaded without parsing.
+         *
+         * The file consists of a header (a magic string, a byte-order mark, the format version, the size of the
+         * values and the model type) followed by the sections for the transition matrix, the state labeling, the
+         * reward models, the choice labeling, the exit rates and the Markovian states (the latter three being
+         * optional). Every section is a sequence of 64-bit integers, values and raw arrays (row indications, matrix
+         * entries, row group indices, reward vectors and the buckets of bit vectors) that all start at positions
+         * that are a multiple of eight bytes. This way, the arrays can be copied from a memory-mapped file as a
+         * whole. Note that the data is written in the native byte order, so files can only be loaded on machines
+         * with the same byte order.
+         *
+         * @param os           Stream to export to. The stream needs to be opened in binary mode.
+         * @param sparseModel  Model to export
+         */
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
+        /*!
+         * Exports a sparse matrix in the binary format. The result is laid out like the section of the transition
+         * matrix in a model file, that is the row count, the column count, the entry count, the row indications, the
+         * matrix entries and the (optional) row group indices.
+         *
+         * @param os      Stream to export to. The stream needs to be opened in binary mode.
+         * @param matrix  Matrix to export
+         */
+        template<typename ValueType>
+        void binaryExportSparseMatrix(std::ostream& os, storm::storage::SparseMatrix<ValueType> const& matrix);
+
+        namespace binary {
+            // The magic string at the beginning of each file.
+            extern char const* const magic;
+
+            // The length of the magic string.
+            uint64_t const magicLength = 8;
+
+            // A value that is used to detect files that were written on machines with another byte order.
+            uint64_t const byteOrderMark = 0x0102030405060708ull;
+
+            // The version of the format.
+            uint64_t const version = 1;
+
+            // The flags that indicate which reward vectors are present in a reward model section.
+            uint64_t const stateRewardsFlag = 1;
+            uint64_t const stateActionRewardsFlag = 2;
+            uint64_t const transitionRewardsFlag = 4;
+        }
+
+    }
+}
@@ -21,14 +21,75 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include <mutex>
 #include <queue>
 
 namespace storm {
     namespace utility {
         namespace graph {
             
+            namespace {
+                /*!
+                 * Retrieves whether a backward search over the given transitions is worth being performed in parallel.
+                 * As the searches only inspect the structure of the matrix, this is independent of the value type.
+                 */
+                template<typename T>
+                bool useParallelSearch(storm::storage::SparseMatrix<T> const& backwardTransitions) {
+                    return storm::utility::parallel::getNumberOfThreads() > 1 && backwardTransitions.getEntryCount() >= storm::utility::parallel::MINIMAL_PARALLEL_WORKLOAD;
+                }
+                
+                /*!
+                 * Performs a backward search level by level, where the predecessors of the states in the frontier of
+                 * each level are examined by several threads. A predecessor is added to the found states (and the next
+                 * frontier) if it is not yet contained and satisfies the given condition. Within a level, the threads
+                 * only read the states found in the previous levels, so the condition may depend on them. As the
+                 * candidates are merged after each level, the result does not depend on the scheduling of the threads
+                 * and coincides with the one of a sequential search for the same condition.
+                 *
+                 * @param backwardTransitions The reversed transition relation of the model.
+                 * @param states The states from which to start the search. Upon return, this contains all found states.
+                 * @param condition A function that decides, given a predecessor and the states found so far, whether
+                 * the predecessor is to be added.
+                 * @param maximalLevels If given, the search stops after this number of levels.
+                 */
+                template<typename T, typename ConditionType>
+                void performParallelBackwardSearch(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector& states, ConditionType const& condition, boost::optional<uint_fast64_t> const& maximalLevels = boost::none) {
+                    std::vector<uint_fast64_t> frontier(states.begin(), states.end());
+                    std::vector<uint_fast64_t> candidates;
+                    std::mutex candidatesMutex;
+                    
+                    for (uint_fast64_t level = 0; !frontier.empty() && (!maximalLevels || level < maximalLevels.get()); ++level) {
+                        candidates.clear();
+                        storm::utility::parallel::parallelFor(0, frontier.size(), 256, [&] (uint64_t startIndex, uint64_t endIndex) {
+                            std::vector<uint_fast64_t> localCandidates;
+                            for (uint64_t index = startIndex; index < endIndex; ++index) {
+                                for (auto const& entry : backwardTransitions.getRow(frontier[index])) {
+                                    uint_fast64_t predecessor = entry.getColumn();
+                                    if (!states.get(predecessor) && condition(predecessor, states)) {
+                                        localCandidates.push_back(predecessor);
+                                    }
+                                }
+                            }
+                            
+                            std::lock_guard<std::mutex> lock(candidatesMutex);
+                            candidates.insert(candidates.end(), localCandidates.begin(), localCandidates.end());
+                        });
+                        
+                        // A state may have been found by several threads, so we only put it into the frontier once.
+                        frontier.clear();
+                        for (auto candidate : candidates) {
+                            if (!states.get(candidate)) {
+                                states.set(candidate, true);
+                                frontier.push_back(candidate);
+                            }
+                        }
+                    }
+                }
+            }
+            
             template<typename T>
             storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps) {
                 storm::storage::BitVector reachableStates(initialStates);
@@ -245,6 +306,12 @@ namespace storm {
                 // Add all psi states as they already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                if (useParallelSearch(backwardTransitions)) {
+                    // As the parallel search proceeds level by level, the step bound is just the number of levels.
+                    performParallelBackwardSearch(backwardTransitions, statesWithProbabilityGreater0, [&phiStates] (uint_fast64_t state, storm::storage::BitVector const&) { return phiStates.get(state); }, useStepBound ? boost::make_optional(maximalSteps) : boost::none);
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states.
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -541,6 +608,11 @@ namespace storm {
                 // Add all psi states as the already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                if (useParallelSearch(backwardTransitions)) {
+                    performParallelBackwardSearch(backwardTransitions, statesWithProbabilityGreater0, [&phiStates] (uint_fast64_t state, storm::storage::BitVector const&) { return phiStates.get(state); }, useStepBound ? boost::make_optional(maximalSteps) : boost::none);
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -603,42 +675,52 @@ namespace storm {
                 std::vector<uint_fast64_t> stack;
                 stack.reserve(numberOfStates);
                 
+                // Check whether the given state has only successors in the current state set for one of the
+                // nondeterminstic choices, one of which is already in the next state set.
+                auto hasChoiceIntoNextStates = [&] (uint_fast64_t state, storm::storage::BitVector const& nextStates) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        bool allSuccessorsInCurrentStates = true;
+                        bool hasNextStateSuccessor = false;
+                        for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                            if (!currentStates.get(successorEntryIt->getColumn())) {
+                                allSuccessorsInCurrentStates = false;
+                                break;
+                            } else if (nextStates.get(successorEntryIt->getColumn())) {
+                                hasNextStateSuccessor = true;
+                            }
+                        }
+                        
+                        if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                            return true;
+                        }
+                    }
+                    return false;
+                };
+                bool parallelSearch = useParallelSearch(backwardTransitions);
+                
                 // Perform the loop as long as the set of states gets larger.
                 bool done = false;
                 uint_fast64_t currentState;
                 while (!done) {
-                    stack.clear();
                     storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
                     
-                    while (!stack.empty()) {
-                        currentState = stack.back();
-                        stack.pop_back();
+                    if (parallelSearch) {
+                        performParallelBackwardSearch(backwardTransitions, nextStates, [&] (uint_fast64_t state, storm::storage::BitVector const& foundStates) { return phiStates.get(state) && hasChoiceIntoNextStates(state, foundStates); });
+                    } else {
+                        stack.clear();
+                        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
                         
-                        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                            if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                                // Check whether the predecessor has only successors in the current state set for one of the
-                                // nondeterminstic choices.
-                                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                    bool allSuccessorsInCurrentStates = true;
-                                    bool hasNextStateSuccessor = false;
-                                    for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                        if (!currentStates.get(successorEntryIt->getColumn())) {
-                                            allSuccessorsInCurrentStates = false;
-                                            break;
-                                        } else if (nextStates.get(successorEntryIt->getColumn())) {
-                                            hasNextStateSuccessor = true;
-                                        }
-                                    }
-                                    
-                                    // If all successors for a given nondeterministic choice are in the current state set, we
-                                    // add it to the set of states for the next iteration and perform a backward search from
-                                    // that state.
-                                    if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
-                                        nextStates.set(predecessorEntryIt->getColumn(), true);
-                                        stack.push_back(predecessorEntryIt->getColumn());
-                                        break;
-                                    }
+                        while (!stack.empty()) {
+                            currentState = stack.back();
+                            stack.pop_back();
+                            
+                            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
+                                // If all successors for a given nondeterministic choice are in the current state set, we
+                                // add it to the set of states for the next iteration and perform a backward search from
+                                // that state.
+                                if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn()) && hasChoiceIntoNextStates(predecessorEntryIt->getColumn(), nextStates)) {
+                                    nextStates.set(predecessorEntryIt->getColumn(), true);
+                                    stack.push_back(predecessorEntryIt->getColumn());
                                 }
                             }
                         }
@@ -684,6 +766,41 @@ namespace storm {
                 // Add all psi states as the already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                // Check whether the given state has at least one successor in the given state set for every
+                // nondeterministic choice within the possibly given choiceConstraint.
+                auto hasSuccessorForAllChoices = [&] (uint_fast64_t state, storm::storage::BitVector const& states) {
+                    // Note: The backwards edge might be induced by a choice that violates the choiceConstraint.
+                    // However this is not problematic as long as there is at least one enabled choice for the predecessor.
+                    uint_fast64_t row = nondeterministicChoiceIndices[state];
+                    uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[state + 1];
+                    if (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup) {
+                        return false;
+                    }
+                    for (; row < endOfGroup; ++row) {
+                        if (!choiceConstraint || choiceConstraint->get(row)) {
+                            bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                                if (states.get(successorEntryIt->getColumn())) {
+                                    hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                                    break;
+                                }
+                            }
+                            
+                            if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                };
+                
+                // The step-bounded search re-explores states for which a shorter path was found, which does not fit a
+                // search that proceeds level by level. Hence, only the unbounded search is done in parallel.
+                if (!useStepBound && useParallelSearch(backwardTransitions)) {
+                    performParallelBackwardSearch(backwardTransitions, statesWithProbabilityGreater0, [&] (uint_fast64_t state, storm::storage::BitVector const& foundStates) { return phiStates.get(state) && hasSuccessorForAllChoices(state, foundStates); });
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -717,43 +834,16 @@ namespace storm {
                         if (phiStates.get(predecessorEntryIt->getColumn())) {
                             if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
                                 
-                                // Check whether the predecessor has at least one successor in the current state set for every
-                                // nondeterministic choice within the possibly given choiceConstraint.
-                                
-                                // Note: The backwards edge might be induced by a choice that violates the choiceConstraint.
-                                // However this is not problematic as long as there is at least one enabled choice for the predecessor.
-                                uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                                uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
-                                if (!choiceConstraint || choiceConstraint->getNextSetIndex(row) < endOfGroup) {
-                                    bool addToStatesWithProbabilityGreater0 = true;
-                                    for (; row < endOfGroup; ++row) {
-                                        if (!choiceConstraint || choiceConstraint->get(row)) {
-                                            bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
-                                            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                                if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
-                                                    hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
-                                                    break;
-                                                }
-                                            }
-                                            
-                                            if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
-                                                addToStatesWithProbabilityGreater0 = false;
-                                                break;
-                                            }
-                                        }
-                                    }
-                                    
-                                    // If we need to add the state, then actually add it and perform further search from the state.
-                                    if (addToStatesWithProbabilityGreater0) {
-                                        // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                                        if (useStepBound) {
-                                            // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                            remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                                            stepStack.push_back(currentStepBound - 1);
-                                        }
-                                        statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
-                                        stack.push_back(predecessorEntryIt->getColumn());
+                                // If we need to add the state, then actually add it and perform further search from the state.
+                                if (hasSuccessorForAllChoices(predecessorEntryIt->getColumn(), statesWithProbabilityGreater0)) {
+                                    // If we don't have a bound on the number of steps to take, just add the state to the stack.
+                                    if (useStepBound) {
+                                        // If there is at least one more step to go, we need to push the state and the new number of steps.
+                                        remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
+                                        stepStack.push_back(currentStepBound - 1);
                                     }
+                                    statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
+                                    stack.push_back(predecessorEntryIt->getColumn());
                                 }
                                 
                             } else if (useStepBound && remainingSteps[predecessorEntryIt->getColumn()] < currentStepBound - 1) {
@@ -814,47 +904,50 @@ namespace storm {
                 std::vector<uint_fast64_t> stack;
                 stack.reserve(numberOfStates);
                 
+                // Check whether the given state has only successors in the current state set for all of the
+                // nondeterminstic choices and that for each choice there exists a successor that is already in the
+                // next state set.
+                auto allChoicesIntoNextStates = [&] (uint_fast64_t state, storm::storage::BitVector const& nextStates) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        bool hasAtLeastOneSuccessorWithProbability1 = false;
+                        for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                            if (!currentStates.get(successorEntryIt->getColumn())) {
+                                return false;
+                            }
+                            if (nextStates.get(successorEntryIt->getColumn())) {
+                                hasAtLeastOneSuccessorWithProbability1 = true;
+                            }
+                        }
+                        
+                        if (!hasAtLeastOneSuccessorWithProbability1) {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+                bool parallelSearch = useParallelSearch(backwardTransitions);
+                
                 // Perform the loop as long as the set of states gets smaller.
                 bool done = false;
                 uint_fast64_t currentState;
                 while (!done) {
-                    stack.clear();
                     storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
                     
-                    while (!stack.empty()) {
-                        currentState = stack.back();
-                        stack.pop_back();
+                    if (parallelSearch) {
+                        performParallelBackwardSearch(backwardTransitions, nextStates, [&] (uint_fast64_t state, storm::storage::BitVector const& foundStates) { return phiStates.get(state) && allChoicesIntoNextStates(state, foundStates); });
+                    } else {
+                        stack.clear();
+                        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
                         
-                        for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                            if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                                // Check whether the predecessor has only successors in the current state set for all of the
-                                // nondeterminstic choices and that for each choice there exists a successor that is already
-                                // in the next states.
-                                bool addToStatesWithProbability1 = true;
-                                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                    bool hasAtLeastOneSuccessorWithProbability1 = false;
-                                    for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                        if (!currentStates.get(successorEntryIt->getColumn())) {
-                                            addToStatesWithProbability1 = false;
-                                            goto afterCheckLoop;
-                                        }
-                                        if (nextStates.get(successorEntryIt->getColumn())) {
-                                            hasAtLeastOneSuccessorWithProbability1 = true;
-                                        }
-                                    }
-                                    
-                                    if (!hasAtLeastOneSuccessorWithProbability1) {
-                                        addToStatesWithProbability1 = false;
-                                        break;
-                                    }
-                                }
-                                
-                            afterCheckLoop:
+                        while (!stack.empty()) {
+                            currentState = stack.back();
+                            stack.pop_back();
+                            
+                            for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                                 // If all successors for all nondeterministic choices are in the current state set, we
                                 // add it to the set of states for the next iteration and perform a backward search from
                                 // that state.
-                                if (addToStatesWithProbability1) {
+                                if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn()) && allChoicesIntoNextStates(predecessorEntryIt->getColumn(), nextStates)) {
                                     nextStates.set(predecessorEntryIt->getColumn(), true);
                                     stack.push_back(predecessorEntryIt->getColumn());
                                 }
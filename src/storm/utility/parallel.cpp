@@ -0,0 +1,215 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            namespace {
+                // A flag that is set for all threads that currently execute a task of the thread pool. It is used to
+                // execute nested parallel operations sequentially instead of deadlocking the pool.
+                thread_local bool insideParallelRegion = false;
+
+                /*!
+                 * A simple pool of persistent worker threads that execute the chunks of one task at a time.
+                 */
+                class ThreadPool {
+                public:
+                    ThreadPool() : numberOfThreads(1), stop(false), generation(0), activeWorkers(0), task(nullptr), numberOfChunks(0), nextChunk(0) {
+                        // Intentionally left empty.
+                    }
+
+                    ~ThreadPool() {
+                        stopWorkers();
+                    }
+
+                    uint64_t getNumberOfThreads() const {
+                        return numberOfThreads;
+                    }
+
+                    void setNumberOfThreads(uint64_t newNumberOfThreads) {
+                        std::lock_guard<std::mutex> taskLock(taskMutex);
+                        if (newNumberOfThreads == numberOfThreads) {
+                            return;
+                        }
+                        stopWorkers();
+                        numberOfThreads = newNumberOfThreads;
+
+                        // The calling thread participates in every task, so we only need to start the remaining threads.
+                        stop = false;
+                        uint64_t currentGeneration = generation;
+                        for (uint64_t worker = 1; worker < numberOfThreads; ++worker) {
+                            workers.emplace_back([this, currentGeneration] () { this->runWorker(currentGeneration); });
+                        }
+                    }
+
+                    /*!
+                     * Tries to execute the given task, which consists of the given number of chunks. If the pool is
+                     * already executing another task, nothing is done and false is returned.
+                     */
+                    bool tryExecute(uint64_t chunks, std::function<void (uint64_t)> const& chunkTask) {
+                        std::unique_lock<std::mutex> taskLock(taskMutex, std::try_to_lock);
+                        if (!taskLock.owns_lock() || workers.empty()) {
+                            return false;
+                        }
+
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            task = &chunkTask;
+                            numberOfChunks = chunks;
+                            nextChunk = 0;
+                            exception = nullptr;
+                            activeWorkers = workers.size();
+                            ++generation;
+                        }
+                        taskAvailable.notify_all();
+
+                        insideParallelRegion = true;
+                        executeChunks();
+                        insideParallelRegion = false;
+
+                        std::unique_lock<std::mutex> lock(mutex);
+                        taskFinished.wait(lock, [this] () { return activeWorkers == 0; });
+                        task = nullptr;
+                        if (exception) {
+                            std::rethrow_exception(exception);
+                        }
+                        return true;
+                    }
+
+                private:
+                    void runWorker(uint64_t lastGeneration) {
+                        insideParallelRegion = true;
+                        while (true) {
+                            {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                taskAvailable.wait(lock, [this, lastGeneration] () { return stop || generation != lastGeneration; });
+                                if (stop) {
+                                    return;
+                                }
+                                lastGeneration = generation;
+                            }
+
+                            executeChunks();
+
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (--activeWorkers == 0) {
+                                taskFinished.notify_all();
+                            }
+                        }
+                    }
+
+                    void executeChunks() {
+                        for (uint64_t chunk = nextChunk++; chunk < numberOfChunks; chunk = nextChunk++) {
+                            try {
+                                (*task)(chunk);
+                            } catch (...) {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                if (!exception) {
+                                    exception = std::current_exception();
+                                }
+                            }
+                        }
+                    }
+
+                    void stopWorkers() {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            stop = true;
+                        }
+                        taskAvailable.notify_all();
+                        for (auto& worker : workers) {
+                            worker.join();
+                        }
+                        workers.clear();
+                    }
+
+                    // The number of threads (including the calling thread) that execute the tasks.
+                    std::atomic<uint64_t> numberOfThreads;
+
+                    // The worker threads.
+                    std::vector<std::thread> workers;
+
+                    // A mutex that is held while a task is executed and that thereby makes sure that only one task is
+                    // executed at a time.
+                    std::mutex taskMutex;
+
+                    // A mutex that guards the communication between the calling thread and the workers.
+                    std::mutex mutex;
+                    std::condition_variable taskAvailable;
+                    std::condition_variable taskFinished;
+
+                    // A flag indicating whether the workers are to terminate.
+                    bool stop;
+
+                    // A counter that is increased for every task, so that workers can detect new tasks.
+                    uint64_t generation;
+
+                    // The number of workers that have not yet finished the current task.
+                    uint64_t activeWorkers;
+
+                    // The current task, its number of chunks and the next chunk to process.
+                    std::function<void (uint64_t)> const* task;
+                    uint64_t numberOfChunks;
+                    std::atomic<uint64_t> nextChunk;
+
+                    // The first exception that was thrown by a chunk of the current task (if any).
+                    std::exception_ptr exception;
+                };
+
+                ThreadPool& getThreadPool() {
+                    static ThreadPool pool;
+                    return pool;
+                }
+            }
+
+            uint64_t getNumberOfThreads() {
+                return getThreadPool().getNumberOfThreads();
+            }
+
+            void setNumberOfThreads(uint64_t numberOfThreads) {
+                if (numberOfThreads == 0) {
+                    numberOfThreads = std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+                }
+                STORM_LOG_DEBUG("Using " << numberOfThreads << " thread(s) for parallel operations.");
+                getThreadPool().setNumberOfThreads(numberOfThreads);
+            }
+
+            void parallelFor(uint64_t begin, uint64_t end, uint64_t grainSize, std::function<void (uint64_t, uint64_t)> const& function) {
+                if (begin >= end) {
+                    return;
+                }
+                uint64_t size = end - begin;
+                grainSize = std::max<uint64_t>(grainSize, 1);
+
+                ThreadPool& pool = getThreadPool();
+                if (!insideParallelRegion && pool.getNumberOfThreads() > 1 && size > grainSize) {
+                    // Use a few chunks per thread to balance the load if the chunks take differently long.
+                    uint64_t numberOfChunks = std::min((size + grainSize - 1) / grainSize, 4 * pool.getNumberOfThreads());
+                    uint64_t chunkSize = (size + numberOfChunks - 1) / numberOfChunks;
+                    numberOfChunks = (size + chunkSize - 1) / chunkSize;
+
+                    std::function<void (uint64_t)> chunkTask = [&] (uint64_t chunk) {
+                        uint64_t chunkBegin = begin + chunk * chunkSize;
+                        function(chunkBegin, std::min(chunkBegin + chunkSize, end));
+                    };
+                    if (pool.tryExecute(numberOfChunks, chunkTask)) {
+                        return;
+                    }
+                }
+
+                function(begin, end);
+            }
+
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef STORM_UTILITY_PARALLEL_H_
+#define STORM_UTILITY_PARALLEL_H_
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            // The minimal amount of work (e.g. the number of non-zero entries of a matrix or the size of a vector) for
+            // which a parallel execution of an operation is considered worthwhile.
+            static const uint64_t MINIMAL_PARALLEL_WORKLOAD = 10000;
+
+            /*!
+             * Indicates whether operations on values of the given type may be carried out by several threads at once.
+             * This is not the case for the exact types, because their implementations share (unsynchronized) state
+             * among copies of the same value.
+             */
+            template<typename ValueType>
+            struct SupportsParallelExecution : public std::integral_constant<bool, std::is_arithmetic<ValueType>::value> {
+                // Intentionally left empty.
+            };
+
+            /*!
+             * Retrieves the number of threads that are used for parallel operations.
+             *
+             * @return The number of threads.
+             */
+            uint64_t getNumberOfThreads();
+
+            /*!
+             * Sets the number of threads that are used for parallel operations. A value of one disables the parallel
+             * execution of operations altogether.
+             *
+             * @param numberOfThreads The number of threads to use. If zero, the number of hardware threads is used.
+             */
+            void setNumberOfThreads(uint64_t numberOfThreads);
+
+            /*!
+             * Retrieves whether an operation on values of the given type with the given workload is to be executed in
+             * parallel.
+             *
+             * @param workload The amount of work of the operation, e.g. the number of matrix entries touched.
+             * @return True iff the operation is to be executed in parallel.
+             */
+            template<typename ValueType>
+            bool useParallelExecution(uint64_t workload) {
+                return SupportsParallelExecution<ValueType>::value && workload >= MINIMAL_PARALLEL_WORKLOAD && getNumberOfThreads() > 1;
+            }
+
+            /*!
+             * Splits the given range into contiguous chunks and applies the given function to all chunks using the
+             * threads of the internal thread pool. The calling thread participates in the computation and the function
+             * returns once all chunks have been processed. If the function throws an exception for any of the chunks,
+             * the remaining chunks are still processed and the (first) exception is rethrown afterwards.
+             *
+             * If parallel execution is disabled, the range is smaller than the grain size or the thread pool is already
+             * busy (e.g. because this function is called from within a parallel region), the function is applied to the
+             * whole range by the calling thread.
+             *
+             * @param begin The first index of the range.
+             * @param end The index one past the last index of the range.
+             * @param grainSize The minimal number of indices per chunk.
+             * @param function The function to apply to the chunks. Its arguments are the first index of the chunk and
+             * the index one past the last index of the chunk.
+             */
+            void parallelFor(uint64_t begin, uint64_t end, uint64_t grainSize, std::function<void (uint64_t, uint64_t)> const& function);
+
+        }
+    }
+}
+
+#endif /* STORM_UTILITY_PARALLEL_H_ */
@@ -6,6 +6,7 @@
 #include "tbb/tbb.h"
 #endif
 
+#include <atomic>
 #include <iostream>
 #include <algorithm>
 #include <functional>
@@ -17,6 +18,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
@@ -324,15 +326,22 @@ namespace storm {
                                       }
                                   });
 #else
-                auto firstIt = firstOperand.begin();
-                auto firstIte = firstOperand.end();
-                auto secondIt = secondOperand.begin();
-                auto targetIt = target.begin();
-                while (firstIt != firstIte) {
-                    *targetIt = function(*firstIt, *secondIt, *targetIt);
-                    ++targetIt;
-                    ++firstIt;
-                    ++secondIt;
+                auto applyToRange = [&] (uint_fast64_t begin, uint_fast64_t end) {
+                    auto firstIt = firstOperand.begin() + begin;
+                    auto firstIte = firstOperand.begin() + end;
+                    auto secondIt = secondOperand.begin() + begin;
+                    auto targetIt = target.begin() + begin;
+                    while (firstIt != firstIte) {
+                        *targetIt = function(*firstIt, *secondIt, *targetIt);
+                        ++targetIt;
+                        ++firstIt;
+                        ++secondIt;
+                    }
+                };
+                if (storm::utility::parallel::useParallelExecution<OutValueType>(target.size())) {
+                    storm::utility::parallel::parallelFor(0, target.size(), 1024, applyToRange);
+                } else {
+                    applyToRange(0, target.size());
                 }
 #endif
             }
@@ -353,7 +362,13 @@ namespace storm {
                                       std::transform(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(), target.begin() + range.begin(), function);
                                   });
 #else
-                std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), function);
+                if (storm::utility::parallel::useParallelExecution<OutValueType>(target.size())) {
+                    storm::utility::parallel::parallelFor(0, target.size(), 1024, [&] (uint_fast64_t begin, uint_fast64_t end) {
+                        std::transform(firstOperand.begin() + begin, firstOperand.begin() + end, secondOperand.begin() + begin, target.begin() + begin, function);
+                    });
+                } else {
+                    std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), function);
+                }
 #endif
             }
             
@@ -372,7 +387,13 @@ namespace storm {
                                       std::transform(operand.begin() + range.begin(), operand.begin() + range.end(), target.begin() + range.begin(), function);
                                   });
 #else
-                std::transform(operand.begin(), operand.end(), target.begin(), function);
+                if (storm::utility::parallel::useParallelExecution<OutValueType>(target.size())) {
+                    storm::utility::parallel::parallelFor(0, target.size(), 1024, [&] (uint_fast64_t begin, uint_fast64_t end) {
+                        std::transform(operand.begin() + begin, operand.begin() + end, target.begin() + begin, function);
+                    });
+                } else {
+                    std::transform(operand.begin(), operand.end(), target.begin(), function);
+                }
 #endif
             }
             
@@ -594,7 +615,8 @@ namespace storm {
             }
             
             /*!
-             * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+             * Reduces the row groups in the given range of the given source vector by selecting an element according to
+             * the given filter out of each of these row groups.
              *
              * @param source The source vector which is to be reduced.
              * @param target The target vector into which a single element from each row group is written.
@@ -602,58 +624,20 @@ namespace storm {
              * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
              * return true iff v1 is supposed to be taken instead of v2.
              * @param choices If non-null, this vector is used to store the choices made during the selection.
+             * @param startGroup The first row group to reduce.
+             * @param endGroup The row group one past the last row group to reduce.
              */
             template<class T>
-            void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::function<bool (T const&, T const&)> filter, std::vector<uint_fast64_t>* choices) {
-#ifdef STORM_HAVE_INTELTBB
-                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()),
-                                  [&](tbb::blocked_range<uint_fast64_t> const& range) {
-                                      uint_fast64_t startRow = range.begin();
-                                      uint_fast64_t endRow = range.end();
-                                      
-                                      typename std::vector<T>::iterator targetIt = target.begin() + startRow;
-                                      typename std::vector<T>::iterator targetIte = target.begin() + endRow;
-                                      typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startRow;
-                                      typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
-                                      typename std::vector<T>::const_iterator sourceIte;
-                                      typename std::vector<uint_fast64_t>::iterator choiceIt;
-                                      uint_fast64_t localChoice;
-                                      if (choices != nullptr) {
-                                          choiceIt = choices->begin();
-                                      }
-
-                                      for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt) {
-                                          *targetIt = *sourceIt;
-                                          ++sourceIt;
-                                          localChoice = 1;
-                                          if (choices != nullptr) {
-                                              *choiceIt = 0;
-                                          }
-                                          
-                                          for (sourceIte = source.begin() + *(rowGroupingIt + 1); sourceIt != sourceIte; ++sourceIt, ++localChoice) {
-                                              if (filter(*sourceIt, *targetIt)) {
-                                                  *targetIt = *sourceIt;
-                                                  if (choices != nullptr) {
-                                                      *choiceIt = localChoice;
-                                                  }
-                                              }
-                                          }
-                                          
-                                          if (choices != nullptr) {
-                                              ++choiceIt;
-                                          }
-                                      }
-                                  });
-#else
-                typename std::vector<T>::iterator targetIt = target.begin();
-                typename std::vector<T>::iterator targetIte = target.end();
-                typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin();
-                typename std::vector<T>::const_iterator sourceIt = source.begin();
+            void reduceVectorForRowGroups(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::function<bool (T const&, T const&)> const& filter, std::vector<uint_fast64_t>* choices, uint_fast64_t startGroup, uint_fast64_t endGroup) {
+                typename std::vector<T>::iterator targetIt = target.begin() + startGroup;
+                typename std::vector<T>::iterator targetIte = target.begin() + endGroup;
+                typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startGroup;
+                typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
                 typename std::vector<T>::const_iterator sourceIte;
                 typename std::vector<uint_fast64_t>::iterator choiceIt;
                 uint_fast64_t localChoice;
                 if (choices != nullptr) {
-                    choiceIt = choices->begin();
+                    choiceIt = choices->begin() + startGroup;
                 }
                 
                 for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt) {
@@ -675,6 +659,33 @@ namespace storm {
                         ++choiceIt;
                     }
                 }
+            }
+            
+            /*!
+             * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+             *
+             * @param source The source vector which is to be reduced.
+             * @param target The target vector into which a single element from each row group is written.
+             * @param rowGrouping A vector that specifies the begin and end of each group of elements in the values vector.
+             * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
+             * return true iff v1 is supposed to be taken instead of v2.
+             * @param choices If non-null, this vector is used to store the choices made during the selection.
+             */
+            template<class T>
+            void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::function<bool (T const&, T const&)> filter, std::vector<uint_fast64_t>* choices) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()),
+                                  [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                                      reduceVectorForRowGroups(source, target, rowGrouping, filter, choices, range.begin(), range.end());
+                                  });
+#else
+                if (storm::utility::parallel::useParallelExecution<T>(source.size())) {
+                    storm::utility::parallel::parallelFor(0, target.size(), 256, [&] (uint_fast64_t startGroup, uint_fast64_t endGroup) {
+                        reduceVectorForRowGroups(source, target, rowGrouping, filter, choices, startGroup, endGroup);
+                    });
+                } else {
+                    reduceVectorForRowGroups(source, target, rowGrouping, filter, choices, 0, target.size());
+                }
 #endif
             }
                         
@@ -763,6 +774,18 @@ namespace storm {
             bool equalModuloPrecision(std::vector<T> const& vectorLeft, std::vector<T> const& vectorRight, T const& precision, bool relativeError) {
                 STORM_LOG_ASSERT(vectorLeft.size() == vectorRight.size(), "Lengths of vectors does not match.");
                 
+                if (storm::utility::parallel::useParallelExecution<T>(vectorLeft.size())) {
+                    std::atomic<bool> equal(true);
+                    storm::utility::parallel::parallelFor(0, vectorLeft.size(), 1024, [&] (uint_fast64_t begin, uint_fast64_t end) {
+                        for (uint_fast64_t i = begin; i < end && equal.load(std::memory_order_relaxed); ++i) {
+                            if (!equalModuloPrecision(vectorLeft[i], vectorRight[i], precision, relativeError)) {
+                                equal.store(false, std::memory_order_relaxed);
+                            }
+                        }
+                    });
+                    return equal.load();
+                }
+                
                 for (uint_fast64_t i = 0; i < vectorLeft.size(); ++i) {
                     if (!equalModuloPrecision(vectorLeft[i], vectorRight[i], precision, relativeError)) {
                         return false;
@@ -796,6 +819,41 @@ namespace storm {
                 return true;
             }
             
+            /*!
+             * Compares several vectors that are stored interleaved (entry i of vector j is located at position
+             * i * numberOfVectors + j) and removes the indices of the vectors that are equal modulo the provided
+             * precision from the given indices.
+             *
+             * @param vectorsLeft The first vectors of the comparison.
+             * @param vectorsRight The second vectors of the comparison.
+             * @param numberOfVectors The number of interleaved vectors.
+             * @param vectorIndices The indices of the vectors that are to be compared. The indices of the vectors that
+             * are equal modulo the precision are removed.
+             * @param precision The precision up to which the vectors are to be checked for equality.
+             * @param relativeError If set, the difference between the vectors is computed relative to the value or in absolute terms.
+             */
+            template<class T>
+            void removeEqualModuloPrecision(std::vector<T> const& vectorsLeft, std::vector<T> const& vectorsRight, uint_fast64_t numberOfVectors, std::vector<uint_fast64_t>& vectorIndices, T const& precision, bool relativeError) {
+                STORM_LOG_ASSERT(vectorsLeft.size() == vectorsRight.size(), "Lengths of vectors does not match.");
+                
+                std::vector<bool> equal(vectorIndices.size(), true);
+                for (uint_fast64_t offset = 0; offset < vectorsLeft.size(); offset += numberOfVectors) {
+                    for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                        if (equal[index] && !equalModuloPrecision(vectorsLeft[offset + vectorIndices[index]], vectorsRight[offset + vectorIndices[index]], precision, relativeError)) {
+                            equal[index] = false;
+                        }
+                    }
+                }
+                
+                uint_fast64_t remaining = 0;
+                for (uint_fast64_t index = 0; index < vectorIndices.size(); ++index) {
+                    if (!equal[index]) {
+                        vectorIndices[remaining++] = vectorIndices[index];
+                    }
+                }
+                vectorIndices.resize(remaining);
+            }
+            
             /*!
              * Takes the input vector and ensures that all entries conform to the bounds.
              */
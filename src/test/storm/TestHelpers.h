@@ -0,0 +1,74 @@
+#ifndef STORM_TEST_TESTHELPERS_H_
+#define STORM_TEST_TESTHELPERS_H_
+
+#include <cstdint>
+#include <random>
+#include <set>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+    namespace test {
+
+        /*!
+         * Sets the number of threads used for parallel operations and restores the previous number when going out of
+         * scope, i.e. also if the test fails with an exception or a fatal assertion.
+         */
+        class NumberOfThreadsGuard {
+        public:
+            NumberOfThreadsGuard(uint64_t numberOfThreads) : previousNumberOfThreads(storm::utility::parallel::getNumberOfThreads()) {
+                storm::utility::parallel::setNumberOfThreads(numberOfThreads);
+            }
+
+            ~NumberOfThreadsGuard() {
+                storm::utility::parallel::setNumberOfThreads(previousNumberOfThreads);
+            }
+
+            NumberOfThreadsGuard(NumberOfThreadsGuard const&) = delete;
+            NumberOfThreadsGuard& operator=(NumberOfThreadsGuard const&) = delete;
+
+        private:
+            uint64_t previousNumberOfThreads;
+        };
+
+        /*!
+         * Creates a random row-grouped probability matrix with one row group per state. Most transitions lead to
+         * nearby states (in both directions), which yields strongly connected components of various sizes, and some
+         * lead to arbitrary states. The matrix only depends on the given arguments.
+         *
+         * @param numberOfStates The number of states (i.e. row groups and columns).
+         * @param maximalNumberOfChoices The maximal number of rows per row group.
+         * @param maximalNumberOfSuccessors The maximal number of entries per row.
+         * @param seed The seed of the random number generator.
+         * @return The created matrix.
+         */
+        inline storm::storage::SparseMatrix<double> createRandomNondeterministicMatrix(uint64_t numberOfStates, uint64_t maximalNumberOfChoices, uint64_t maximalNumberOfSuccessors, uint64_t seed) {
+            std::mt19937 generator(seed);
+            std::uniform_int_distribution<uint64_t> choiceDistribution(1, maximalNumberOfChoices);
+            std::uniform_int_distribution<uint64_t> successorDistribution(1, maximalNumberOfSuccessors);
+            std::uniform_int_distribution<uint64_t> offsetDistribution(0, 40);
+            std::uniform_int_distribution<uint64_t> stateDistribution(0, numberOfStates - 1);
+
+            storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+            uint64_t row = 0;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                matrixBuilder.newRowGroup(row);
+                for (uint64_t choice = 0, choiceCount = choiceDistribution(generator); choice < choiceCount; ++choice, ++row) {
+                    std::set<uint64_t> successors;
+                    for (uint64_t successor = 0, successorCount = successorDistribution(generator); successor < successorCount; ++successor) {
+                        uint64_t offset = offsetDistribution(generator);
+                        successors.insert(offset == 0 ? stateDistribution(generator) : (state + numberOfStates + offset - 25) % numberOfStates);
+                    }
+                    for (auto successor : successors) {
+                        matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+                    }
+                }
+            }
+            return matrixBuilder.build();
+        }
+
+    }
+}
+
+#endif /* STORM_TEST_TESTHELPERS_H_ */
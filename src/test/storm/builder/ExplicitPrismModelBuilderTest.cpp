@@ -5,6 +5,7 @@
 #include "storm/settings/SettingMemento.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/ExpressionEvaluatorType.h"
 
 #include "storm/settings/modules/IOSettings.h"
 
@@ -129,3 +130,65 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), sequentialOptions).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), parallelOptions).build();
+    EXPECT_EQ(8607ul, parallelModel->getNumberOfStates());
+    EXPECT_EQ(15113ul, parallelModel->getNumberOfTransitions());
+    EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+    EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), sequentialOptions).build();
+    parallelModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), parallelOptions).build();
+    EXPECT_EQ(1038ul, parallelModel->getNumberOfStates());
+    EXPECT_EQ(1282ul, parallelModel->getNumberOfTransitions());
+    EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+    EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/stream2.ma");
+    sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), sequentialOptions).build();
+    parallelModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), parallelOptions).build();
+    EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+    EXPECT_EQ(sequentialModel->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates(), parallelModel->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, BytecodeExpressionEvaluator) {
+    storm::generator::NextStateGeneratorOptions exprtkOptions(true, true);
+    exprtkOptions.setExpressionEvaluatorType(storm::builder::ExpressionEvaluatorType::Exprtk);
+    storm::generator::NextStateGeneratorOptions bytecodeOptions = exprtkOptions;
+    bytecodeOptions.setExpressionEvaluatorType(storm::builder::ExpressionEvaluatorType::Bytecode);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> exprtkModel = storm::builder::ExplicitModelBuilder<double>(program, exprtkOptions).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, bytecodeOptions).build();
+    EXPECT_EQ(677ul, bytecodeModel->getNumberOfStates());
+    EXPECT_EQ(867ul, bytecodeModel->getNumberOfTransitions());
+    EXPECT_TRUE(exprtkModel->getTransitionMatrix() == bytecodeModel->getTransitionMatrix());
+    EXPECT_TRUE(exprtkModel->getStateLabeling() == bytecodeModel->getStateLabeling());
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    exprtkModel = storm::builder::ExplicitModelBuilder<double>(program, exprtkOptions).build();
+    bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, bytecodeOptions).build();
+    EXPECT_EQ(1038ul, bytecodeModel->getNumberOfStates());
+    EXPECT_EQ(1282ul, bytecodeModel->getNumberOfTransitions());
+    EXPECT_TRUE(exprtkModel->getTransitionMatrix() == bytecodeModel->getTransitionMatrix());
+    EXPECT_TRUE(exprtkModel->getStateLabeling() == bytecodeModel->getStateLabeling());
+    EXPECT_TRUE(exprtkModel->getUniqueRewardModel().getStateActionRewardVector() == bytecodeModel->getUniqueRewardModel().getStateActionRewardVector());
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-2.nm");
+    exprtkModel = storm::builder::ExplicitModelBuilder<double>(program, exprtkOptions).build();
+    bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, bytecodeOptions).build();
+    EXPECT_EQ(37ul, bytecodeModel->getNumberOfStates());
+    EXPECT_EQ(59ul, bytecodeModel->getNumberOfTransitions());
+    EXPECT_TRUE(exprtkModel->getTransitionMatrix() == bytecodeModel->getTransitionMatrix());
+    EXPECT_TRUE(exprtkModel->getStateLabeling() == bytecodeModel->getStateLabeling());
+}
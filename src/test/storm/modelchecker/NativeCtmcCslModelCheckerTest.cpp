@@ -9,6 +9,7 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
@@ -16,6 +17,8 @@
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 
+#include "storm/utility/graph.h"
+
 TEST(NativeCtmcCslModelCheckerTest, Cluster) {
     // Set the PRISM compatibility mode temporarily. It is set to its old value once the returned object is destructed.
     std::unique_ptr<storm::settings::SettingMemento> enablePrismCompatibility = storm::settings::mutableIOSettings().overridePrismCompatibilityMode(true);
@@ -85,6 +88,51 @@ TEST(NativeCtmcCslModelCheckerTest, Cluster) {
     EXPECT_NEAR(0.8602815057967503, quantitativeCheckResult7[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(NativeCtmcCslModelCheckerTest, ClusterSeveralTimeBounds) {
+    // Set the PRISM compatibility mode temporarily. It is set to its old value once the returned object is destructed.
+    std::unique_ptr<storm::settings::SettingMemento> enablePrismCompatibility = storm::settings::mutableIOSettings().overridePrismCompatibilityMode(true);
+    
+    // Parse the model description.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    storm::parser::FormulaParser formulaParser(program);
+    
+    // Build the model.
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_EQ(storm::models::ModelType::Ctmc, model->getType());
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> ctmc = model->as<storm::models::sparse::Ctmc<double>>();
+    uint_fast64_t initialState = *ctmc->getInitialStates().begin();
+    
+    // Create model checker.
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> modelchecker(*ctmc, std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>());
+    
+    // The properties only differ in their time bound and are therefore checked with one transient analysis.
+    std::vector<std::string> timeBounds = { "100", "0", "50", "10" };
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (auto const& timeBound : timeBounds) {
+        tasks.emplace_back(*formulaParser.parseSingleFormulaFromString("P=? [ F<=" + timeBound + " !\"minimum\"]"), true);
+    }
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkAll(tasks);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    
+    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+        std::unique_ptr<storm::modelchecker::CheckResult> singleResult = modelchecker.check(tasks[index]);
+        ASSERT_TRUE(results[index]->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(singleResult->asExplicitQuantitativeCheckResult<double>()[initialState], results[index]->asExplicitQuantitativeCheckResult<double>()[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+    EXPECT_NEAR(5.5461254704419085E-5, results[0]->asExplicitQuantitativeCheckResult<double>()[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    EXPECT_EQ(0, results[1]->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    
+    // Adaptive uniformization only considers the initial state and needs to yield the same probabilities.
+    storm::storage::BitVector psiStates = ~ctmc->getStates("minimum");
+    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(ctmc->getBackwardTransitions(), storm::storage::BitVector(ctmc->getNumberOfStates(), true), psiStates) & ~psiStates;
+    ASSERT_TRUE(maybeStates.get(initialState));
+    std::vector<double> adaptiveResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeTimeBoundedReachabilityProbabilitiesAdaptively(ctmc->getTransitionMatrix(), maybeStates, psiStates, ctmc->getExitRateVector(), {100.0, 0.0, 50.0, 10.0}, initialState);
+    ASSERT_EQ(timeBounds.size(), adaptiveResults.size());
+    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+        EXPECT_NEAR(results[index]->asExplicitQuantitativeCheckResult<double>()[initialState], adaptiveResults[index], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
+
 TEST(NativeCtmcCslModelCheckerTest, Embedded) {
     // Set the PRISM compatibility mode temporarily. It is set to its old value once the returned object is destructed.
     std::unique_ptr<storm::settings::SettingMemento> enablePrismCompatibility = storm::settings::mutableIOSettings().overridePrismCompatibilityMode(true);
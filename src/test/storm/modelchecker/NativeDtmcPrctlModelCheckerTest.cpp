@@ -8,6 +8,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/settings/modules/GeneralSettings.h"
@@ -60,6 +61,40 @@ TEST(NativeDtmcPrctlModelCheckerTest, Die) {
     EXPECT_NEAR(3.6666650772094727, quantitativeResult4[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
 
+TEST(NativeDtmcPrctlModelCheckerTest, DieBatch) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc, std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>());
+    
+    // The first two formulas share their equation system, the others are checked one by one.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (std::string const& formulaString : {"P=? [F \"one\"]", "P>0.2 [F \"one\"]", "P=? [F \"two\"]", "P=? [F \"done\"]", "R=? [F \"done\"]"}) {
+        formulas.push_back(formulaParser.parseSingleFormulaFromString(formulaString));
+        tasks.emplace_back(*formulas.back());
+    }
+    
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = checker.checkAll(tasks);
+    ASSERT_EQ(5ull, results.size());
+    
+    EXPECT_NEAR(1.0/6.0, results[0]->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_FALSE(results[1]->asExplicitQualitativeCheckResult()[0]);
+    EXPECT_NEAR(1.0/6.0, results[2]->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(1.0, results[3]->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(3.6666650772094727, results[4]->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    // Checking the formulas again (with the cached precomputations) yields the same results.
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formulas[0]);
+    EXPECT_NEAR(results[0]->asExplicitQuantitativeCheckResult<double>()[0], result->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
+
 TEST(NativeDtmcPrctlModelCheckerTest, Crowds) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
     
@@ -188,6 +188,47 @@ TEST(SparseMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(4.285689611, quantitativeResult6[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
 
+TEST(SparseMdpPrctlModelCheckerTest, IntervalIterationWithEndComponentsAndScheduler) {
+    // States 0 and 1 form an end component among the maybe states. It can be left towards the sink (state 3) from
+    // state 0 and towards the target (state 2) or the sink from state 1.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 4, 0, false, true, 4);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1.);
+    matrixBuilder.addNextValue(1, 3, 1.);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 1.);
+    matrixBuilder.addNextValue(3, 2, 0.5);
+    matrixBuilder.addNextValue(3, 3, 0.5);
+    matrixBuilder.newRowGroup(4);
+    matrixBuilder.addNextValue(4, 2, 1.);
+    matrixBuilder.newRowGroup(5);
+    matrixBuilder.addNextValue(5, 3, 1.);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    
+    storm::models::sparse::StateLabeling ap(4);
+    ap.addLabel("target");
+    ap.addLabelToState("target", 2);
+    storm::models::sparse::Mdp<double> mdp(transitionMatrix, ap);
+    
+    storm::parser::FormulaParser formulaParser;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(mdp, std::make_unique<storm::solver::NativeMinMaxLinearEquationSolverFactory<double>>(storm::solver::MinMaxMethodSelection::IntervalIteration));
+    
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"target\"]");
+    storm::modelchecker::CheckTask<storm::logic::Formula> checkTask(*formula);
+    checkTask.setProduceSchedulers(true);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(checkTask);
+    
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0.5, quantitativeResult[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(0.5, quantitativeResult[1], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    // The scheduler needs to leave the end component via state 1 and move there from state 0.
+    ASSERT_TRUE(quantitativeResult.hasScheduler());
+    storm::storage::Scheduler<double> const& scheduler = quantitativeResult.getScheduler();
+    EXPECT_EQ(0ull, scheduler.getChoice(0).getDeterministicChoice());
+    EXPECT_EQ(1ull, scheduler.getChoice(1).getDeterministicChoice());
+}
+
 TEST(SparseMdpPrctlModelCheckerTest, LRA_SingleMec) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder;
     std::shared_ptr<storm::models::sparse::Mdp<double>> mdp;
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/api/storm.h"
+
+TEST(SparseMaCslModelCheckerTest, TimeSeries) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/ma/simple.ma";
+    std::string formulasAsString = "Pmax=? [ F s=3 ]; Pmin=? [ F s=3 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(program, formulas);
+    ASSERT_EQ(storm::models::ModelType::MarkovAutomaton, model->getType());
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    ma->close();
+    uint_fast64_t initialState = *ma->getInitialStates().begin();
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> modelchecker(*ma);
+    std::vector<double> timeBounds = { 0.0, 0.0025, 0.005, 0.01 };
+    for (auto const& formula : formulas) {
+        // All time bounds are computed with one pass of the value iteration.
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = storm::api::verifyTimeSeriesWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true), timeBounds);
+        ASSERT_EQ(timeBounds.size(), results.size());
+
+        double previousValue = 0.0;
+        for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+            ASSERT_TRUE(results[index]->isExplicitQuantitativeCheckResult());
+            double value = results[index]->asExplicitQuantitativeCheckResult<double>()[initialState];
+            EXPECT_LE(previousValue, value);
+            previousValue = value;
+
+            // Compare with the result of checking the time bound on its own.
+            std::shared_ptr<storm::logic::Formula const> boundedFormula = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formula->asProbabilityOperatorFormula().getOptimalityType() == storm::OptimizationDirection::Maximize ? "Pmax=? [ F<=" + std::to_string(timeBounds[index]) + " s=3 ]" : "Pmin=? [ F<=" + std::to_string(timeBounds[index]) + " s=3 ]", program)).front();
+            std::unique_ptr<storm::modelchecker::CheckResult> singleResult = modelchecker.check(storm::modelchecker::CheckTask<storm::logic::Formula, double>(*boundedFormula, true));
+            EXPECT_NEAR(singleResult->asExplicitQuantitativeCheckResult<double>()[initialState], value, 2 * precision);
+        }
+        EXPECT_EQ(0.0, results.front()->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    }
+}
+
+TEST(SparseMaCslModelCheckerTest, UnifPlus) {
+    std::vector<std::tuple<std::string, std::string, double>> benchmarks = { std::make_tuple("/ma/server.ma", "error", 0.1), std::make_tuple("/ma/jobscheduler.ma", "half_of_jobs_finished", 0.2), std::make_tuple("/ma/jobscheduler.ma", "one_job_finished", 0.1) };
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<double> minMaxLinearEquationSolverFactory;
+
+    for (auto const& benchmark : benchmarks) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR + std::get<0>(benchmark);
+        std::string formulasAsString = "Pmax=? [ F<=" + std::to_string(std::get<2>(benchmark)) + " \"" + std::get<1>(benchmark) + "\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, "");
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+        std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> ma = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+        ma->close();
+        storm::storage::BitVector psiStates = ma->getStates(std::get<1>(benchmark));
+
+        for (auto dir : { storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize }) {
+            // Unif+ and digitization both guarantee that their error is bounded by the precision.
+            std::vector<double> unifPlusResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilitiesUnifPlus(dir, ma->getTransitionMatrix(), ma->getExitRates(), ma->getMarkovianStates(), psiStates, std::get<2>(benchmark), minMaxLinearEquationSolverFactory);
+            std::vector<double> digitizationResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(dir, ma->getTransitionMatrix(), ma->getExitRates(), ma->getMarkovianStates(), psiStates, std::make_pair(0.0, std::get<2>(benchmark)), minMaxLinearEquationSolverFactory);
+            ASSERT_EQ(digitizationResult.size(), unifPlusResult.size());
+            for (uint_fast64_t state = 0; state < unifPlusResult.size(); ++state) {
+                EXPECT_NEAR(digitizationResult[state], unifPlusResult[state], 2 * precision);
+            }
+        }
+    }
+}
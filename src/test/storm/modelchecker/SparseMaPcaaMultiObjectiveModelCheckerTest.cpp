@@ -15,6 +15,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/api/storm.h"
 
+#include "test/storm/TestHelpers.h"
+
 
 /* Rationals for MAs not supported at this point
 TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, serverRationalNumbers) {
@@ -107,6 +109,41 @@ TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, jobscheduler_pareto_3Obj) {
     EXPECT_TRUE(result->asExplicitParetoCurveCheckResult<double>().getOverApproximation()->convertNumberRepresentation<storm::RationalNumber>()->minkowskiSum(bloatingBox)->contains(expectedAchievableValues));
 }
 
+TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, jobscheduler_pareto_3Obj_parallel) {
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.ma";
+    std::string formulasAsString = "multi(Tmin=? [ F  \"all_jobs_finished\" ], Pmax=? [ F<=0.2 \"half_of_jobs_finished\" ], Pmin=? [ F \"slowest_before_fastest\"  ]) ";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> ma = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+
+    // Several weight vectors are checked concurrently.
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    {
+        storm::test::NumberOfThreadsGuard threadsGuard(4);
+        result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(*ma, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    }
+    ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+
+    std::vector<double> j12 = {1.266666667,0.1617571721,0.5};
+    std::vector<double> j13 = {1.283333333,0.1707737575,0.25};
+    std::vector<double> j23 = {1.333333333,0.1978235137,0.1};
+
+    // we do our checks with rationals to avoid numerical issues when doing polytope computations...
+    auto expectedAchievableValues = storm::storage::geometry::Polytope<storm::RationalNumber>::create(
+            std::vector<std::vector<storm::RationalNumber>>({storm::utility::vector::convertNumericVector<storm::RationalNumber>(j12),
+                                                             storm::utility::vector::convertNumericVector<storm::RationalNumber>(j13),
+                                                             storm::utility::vector::convertNumericVector<storm::RationalNumber>(j23)}));
+    // due to precision issues, we enlarge one of the polytopes before checking containement
+    storm::RationalNumber eps = storm::utility::convertNumber<storm::RationalNumber>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    std::vector<storm::RationalNumber> lb(3,-eps), ub(3,eps);
+    auto bloatingBox = storm::storage::geometry::Hyperrectangle<storm::RationalNumber>(lb,ub).asPolytope();
+
+    EXPECT_TRUE(result->asExplicitParetoCurveCheckResult<double>().getOverApproximation()->convertNumberRepresentation<storm::RationalNumber>()->minkowskiSum(bloatingBox)->contains(expectedAchievableValues));
+}
+
 TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, jobscheduler_achievability_3Obj) {
 
     std::string programFile = STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.ma";
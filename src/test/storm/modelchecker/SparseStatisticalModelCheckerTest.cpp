@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/IOSettings.h"
+#include "storm/settings/modules/StatisticalSettings.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(SparseStatisticalModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser(program);
+
+    // The checker is seeded with a fixed value, so the sampled paths (and the outcome of the test) are reproducible.
+    storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program, 42);
+
+    // As the values are estimated, we allow twice the precision to make spurious failures very unlikely.
+    double precision = 2 * storm::settings::getModule<storm::settings::modules::StatisticalSettings>().getPrecision();
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"one\"]");
+    ASSERT_TRUE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.125, quantitativeResult1[0], precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"done\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.75, quantitativeResult2[0], precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F[4,5] \"one\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult3 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.15625, quantitativeResult3[0], precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("R{\"coin_flips\"}=? [C<=100]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult4 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(11.0 / 3.0, quantitativeResult4[0], precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>=0.1 [F<=3 \"one\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+
+    // Unbounded properties cannot be checked by simulation.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+}
+
+TEST(SparseStatisticalModelCheckerTest, Tandem) {
+    // Set the PRISM compatibility mode temporarily. It is set to its old value once the returned object is destructed.
+    std::unique_ptr<storm::settings::SettingMemento> enablePrismCompatibility = storm::settings::mutableIOSettings().overridePrismCompatibilityMode(true);
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm");
+    storm::parser::FormulaParser formulaParser(program);
+
+    // The reference values are computed on the built model.
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> ctmc = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true).addRewardModel("customers")).build()->as<storm::models::sparse::Ctmc<double>>();
+    uint_fast64_t initialState = *ctmc->getInitialStates().begin();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> referenceChecker(*ctmc, std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>());
+
+    storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Ctmc<double>> checker(program, 42);
+    double precision = 2 * storm::settings::getModule<storm::settings::modules::StatisticalSettings>().getPrecision();
+
+    std::vector<std::string> formulas = {"P=? [ F<=1 \"network_full\" ]", "P=? [ F[0.5,1] \"second_queue_full\" ]", "P=? [ !\"second_queue_full\" U<=1 \"first_queue_full\" ]", "R{\"customers\"}=? [C<=1]"};
+    for (auto const& formulaAsString : formulas) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaAsString);
+        double referenceValue = referenceChecker.check(*formula)->asExplicitQuantitativeCheckResult<double>()[initialState];
+
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        EXPECT_NEAR(referenceValue, result->asExplicitQuantitativeCheckResult<double>()[0], precision) << "for formula " << formulaAsString;
+    }
+}
@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/parser/BinaryEncodingParser.h"
+#include "storm/parser/DirectEncodingParser.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/utility/BinaryEncodingExporter.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndReload(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::string filename = "BinaryEncodingParserTest.bin";
+        {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            storm::exporter::binaryExportSparseModel(stream, model);
+        }
+        std::shared_ptr<storm::models::sparse::Model<double>> result = storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+        std::remove(filename.c_str());
+        return result;
+    }
+
+    void checkRewardModels(storm::models::sparse::Model<double> const& original, storm::models::sparse::Model<double> const& reloaded) {
+        ASSERT_EQ(original.getRewardModels().size(), reloaded.getRewardModels().size());
+        for (auto const& rewardModelEntry : original.getRewardModels()) {
+            ASSERT_TRUE(reloaded.hasRewardModel(rewardModelEntry.first));
+            auto const& rewardModel = reloaded.getRewardModel(rewardModelEntry.first);
+            ASSERT_EQ(rewardModelEntry.second.hasStateRewards(), rewardModel.hasStateRewards());
+            if (rewardModel.hasStateRewards()) {
+                EXPECT_EQ(rewardModelEntry.second.getStateRewardVector(), rewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(rewardModelEntry.second.hasStateActionRewards(), rewardModel.hasStateActionRewards());
+            if (rewardModel.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModelEntry.second.getStateActionRewardVector(), rewardModel.getStateActionRewardVector());
+            }
+            ASSERT_EQ(rewardModelEntry.second.hasTransitionRewards(), rewardModel.hasTransitionRewards());
+            if (rewardModel.hasTransitionRewards()) {
+                EXPECT_TRUE(rewardModelEntry.second.getTransitionRewardMatrix() == rewardModel.getTransitionRewardMatrix());
+            }
+        }
+    }
+}
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(true, true)).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> reloaded = exportAndReload(model);
+
+    ASSERT_EQ(storm::models::ModelType::Dtmc, reloaded->getType());
+    EXPECT_EQ(13ul, reloaded->getNumberOfStates());
+    EXPECT_EQ(20ul, reloaded->getNumberOfTransitions());
+    EXPECT_TRUE(model->getTransitionMatrix() == reloaded->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == reloaded->getStateLabeling());
+    EXPECT_EQ(1ul, reloaded->getInitialStates().getNumberOfSetBits());
+    checkRewardModels(*model, *reloaded);
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions options(true, true);
+    options.setBuildChoiceLabels(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> reloaded = exportAndReload(model);
+
+    ASSERT_EQ(storm::models::ModelType::Mdp, reloaded->getType());
+    EXPECT_EQ(169ul, reloaded->getNumberOfStates());
+    EXPECT_EQ(436ul, reloaded->getNumberOfTransitions());
+    EXPECT_EQ(254ul, reloaded->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    EXPECT_TRUE(model->getTransitionMatrix() == reloaded->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == reloaded->getStateLabeling());
+    ASSERT_TRUE(reloaded->hasChoiceLabeling());
+    EXPECT_TRUE(model->getChoiceLabeling() == reloaded->getChoiceLabeling());
+    checkRewardModels(*model, *reloaded);
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    std::shared_ptr<storm::models::sparse::Model<double>> reloaded = exportAndReload(model);
+
+    ASSERT_EQ(storm::models::ModelType::Ctmc, reloaded->getType());
+    EXPECT_EQ(276ul, reloaded->getNumberOfStates());
+    EXPECT_EQ(1120ul, reloaded->getNumberOfTransitions());
+    EXPECT_TRUE(model->getTransitionMatrix() == reloaded->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == reloaded->getStateLabeling());
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), reloaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    checkRewardModels(*model, *reloaded);
+}
+
+TEST(BinaryEncodingParserTest, MarkovAutomatonRoundTrip) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/stream2.ma");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(true, true)).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> reloaded = exportAndReload(model);
+
+    ASSERT_EQ(storm::models::ModelType::MarkovAutomaton, reloaded->getType());
+    EXPECT_EQ(model->getNumberOfStates(), reloaded->getNumberOfStates());
+    EXPECT_TRUE(model->getTransitionMatrix() == reloaded->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == reloaded->getStateLabeling());
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto reloadedMa = reloaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), reloadedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), reloadedMa->getExitRates());
+    EXPECT_EQ(ma->isClosed(), reloadedMa->isClosed());
+    checkRewardModels(*model, *reloaded);
+}
+
+TEST(BinaryEncodingParserTest, CorruptedMatrix) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+
+    std::string filename = "BinaryEncodingParserTest.bin";
+    std::vector<char> content;
+    {
+        std::stringstream stream;
+        storm::exporter::binaryExportSparseModel(stream, model);
+        std::string data = stream.str();
+        content.assign(data.begin(), data.end());
+    }
+
+    // The transition matrix starts after the header, i.e. the magic string, three numbers and the model type.
+    auto readUint64 = [&content] (uint64_t offset) { uint64_t value; std::memcpy(&value, content.data() + offset, sizeof(uint64_t)); return value; };
+    uint64_t typeOffset = storm::exporter::binary::magicLength + 3 * sizeof(uint64_t);
+    uint64_t matrixOffset = typeOffset + sizeof(uint64_t) + (readUint64(typeOffset) + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+    uint64_t rowCount = readUint64(matrixOffset);
+    uint64_t rowIndicationsOffset = matrixOffset + 3 * sizeof(uint64_t);
+    uint64_t firstEntryOffset = rowIndicationsOffset + (rowCount + 1) * sizeof(uint64_t);
+    ASSERT_EQ(model->getNumberOfStates(), rowCount);
+
+    auto parseModified = [&] (uint64_t offset, uint64_t value) {
+        std::vector<char> modified = content;
+        std::memcpy(modified.data() + offset, &value, sizeof(uint64_t));
+        {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            stream.write(modified.data(), modified.size());
+        }
+        std::shared_ptr<storm::models::sparse::Model<double>> result = storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+        std::remove(filename.c_str());
+        return result;
+    };
+
+    // The unmodified file is accepted.
+    EXPECT_NO_THROW(parseModified(matrixOffset, rowCount));
+
+    // Row indications that are not monotone.
+    EXPECT_THROW(parseModified(rowIndicationsOffset + sizeof(uint64_t), model->getNumberOfTransitions() + 1), storm::exceptions::WrongFormatException);
+    std::remove(filename.c_str());
+
+    // A row count whose number of row indications overflows.
+    EXPECT_THROW(parseModified(matrixOffset, std::numeric_limits<uint64_t>::max()), storm::exceptions::WrongFormatException);
+    std::remove(filename.c_str());
+
+    // A column index that exceeds the number of columns.
+    EXPECT_THROW(parseModified(firstEntryOffset, rowCount), storm::exceptions::WrongFormatException);
+    std::remove(filename.c_str());
+}
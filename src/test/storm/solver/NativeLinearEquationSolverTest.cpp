@@ -34,6 +34,106 @@ TEST(NativeLinearEquationSolver, SolveWithStandardOptions) {
     ASSERT_LT(std::abs(x[2] - (-1)), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
 
+TEST(NativeLinearEquationSolver, BlockJacobi) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(3);
+    std::vector<double> b = {11, -16, 1};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::BlockJacobi);
+    settings.setPrecision(1e-6);
+    settings.setRelativeTerminationCriterion(false);
+    
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    ASSERT_TRUE(solver.solveEquations(x, b));
+    EXPECT_NEAR(1.0, x[0], 1e-5);
+    EXPECT_NEAR(3.0, x[1], 1e-5);
+    EXPECT_NEAR(-1.0, x[2], 1e-5);
+}
+
+TEST(NativeLinearEquationSolver, CompactMatrix) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> b = {11, -16, 1};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setUseCompactMatrix(true);
+    settings.setPrecision(1e-6);
+    settings.setRelativeTerminationCriterion(false);
+    
+    for (auto method : {storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::BlockJacobi}) {
+        settings.setSolutionMethod(method);
+        std::vector<double> x(3);
+        storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+        ASSERT_TRUE(solver.solveEquations(x, b));
+        EXPECT_NEAR(1.0, x[0], 1e-5);
+        EXPECT_NEAR(3.0, x[1], 1e-5);
+        EXPECT_NEAR(-1.0, x[2], 1e-5);
+    }
+    
+    std::vector<double> x = {1, 1, 1};
+    std::vector<double> result(3);
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    ASSERT_NO_THROW(solver.multiply(x, &b, result));
+    EXPECT_EQ(16.0, result[0]);
+    EXPECT_EQ(-18.0, result[1]);
+    EXPECT_EQ(6.0, result[2]);
+}
+
+TEST(NativeLinearEquationSolver, IntervalIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, -0.25));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 1));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(2);
+    std::vector<double> b = {0.25, 0.5};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::IntervalIteration);
+    settings.setPrecision(1e-6);
+    settings.setRelativeTerminationCriterion(false);
+    
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    EXPECT_TRUE(solver.requiresUpperBound());
+    solver.setBounds(0, 1);
+    ASSERT_TRUE(solver.solveEquations(x, b));
+    
+    ASSERT_TRUE(solver.hasErrorBound());
+    EXPECT_LE(solver.getErrorBound(), 1e-6);
+    EXPECT_LE(std::abs(x[0] - 4.0 / 7.0), solver.getErrorBound());
+    EXPECT_LE(std::abs(x[1] - 9.0 / 14.0), solver.getErrorBound());
+}
+
 TEST(NativeLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
     storm::storage::SparseMatrixBuilder<double> builder;
@@ -56,3 +156,40 @@ TEST(NativeLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(solver.repeatedMultiply(x, nullptr, 4));
     ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+TEST(NativeLinearEquationSolver, MultipleRightHandSides) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    // The right-hand sides (11, -16, 1) and (5, -2, 5) in interleaved layout.
+    std::vector<double> b = {11, 5, -16, -2, 1, 5};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setPrecision(1e-6);
+    settings.setRelativeTerminationCriterion(false);
+    
+    for (auto method : {storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::BlockJacobi}) {
+        settings.setSolutionMethod(method);
+        storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+        
+        std::vector<double> x(6);
+        ASSERT_NO_THROW(solver.solveEquations(x, b, 2));
+        ASSERT_LT(std::abs(x[0] - 1), 1e-5);
+        ASSERT_LT(std::abs(x[1] - 1), 1e-5);
+        ASSERT_LT(std::abs(x[2] - 3), 1e-5);
+        ASSERT_LT(std::abs(x[3] - 1), 1e-5);
+        ASSERT_LT(std::abs(x[4] - (-1)), 1e-5);
+        ASSERT_LT(std::abs(x[5] - 1), 1e-5);
+    }
+}
@@ -89,3 +89,53 @@ TEST(NativeMinMaxLinearEquationSolver, SolveWithPolicyIteration) {
 	ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
 	ASSERT_LT(std::abs(x[0] - 0.99), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithIntervalIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+    
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+    
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>(storm::solver::MinMaxMethodSelection::IntervalIteration);
+    auto solver = factory.create(A);
+    EXPECT_TRUE(solver->requiresUpperBound());
+    solver->setLowerBound(0);
+    solver->setUpperBound(1);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_TRUE(solver->hasErrorBound());
+    ASSERT_LT(std::abs(x[0] - 0.5), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_TRUE(solver->hasErrorBound());
+    ASSERT_LE(std::abs(x[0] - 0.99), solver->getErrorBound());
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithOptimisticValueIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+    
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+    
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>(storm::solver::MinMaxMethodSelection::OptimisticValueIteration);
+    auto solver = factory.create(A);
+    solver->setLowerBound(0);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_TRUE(solver->hasErrorBound());
+    ASSERT_LT(std::abs(x[0] - 0.5), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_TRUE(solver->hasErrorBound());
+    ASSERT_LE(std::abs(x[0] - 0.99), solver->getErrorBound());
+}
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/solver/StreamingLinearEquationSolver.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+
+TEST(StreamingLinearEquationSolver, SolveWithStandardOptions) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(3);
+    std::vector<double> b = {11, -16, 1};
+    
+    storm::solver::StreamingLinearEquationSolver<double> solver(A);
+    ASSERT_NO_THROW(solver.solveEquations(x, b));
+    ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[1] - 3), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[2] - (-1)), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
+
+TEST(StreamingLinearEquationSolver, SeveralBlocks) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> b = {11, -16, 1};
+    
+    // Use blocks that hold (at most) one row each.
+    storm::solver::StreamingLinearEquationSolverSettings<double> settings;
+    settings.setBlockSize(48);
+    settings.setPrecision(1e-6);
+    settings.setRelativeTerminationCriterion(false);
+    
+    for (bool prefetching : {true, false}) {
+        settings.setPrefetching(prefetching);
+        storm::solver::StreamingLinearEquationSolver<double> solver(A, settings);
+        EXPECT_EQ(3ull, solver.getMatrix().getNumberOfBlocks());
+        
+        std::vector<double> x(3);
+        ASSERT_NO_THROW(solver.solveEquations(x, b));
+        ASSERT_LT(std::abs(x[0] - 1), 1e-5);
+        ASSERT_LT(std::abs(x[1] - 3), 1e-5);
+        ASSERT_LT(std::abs(x[2] - (-1)), 1e-5);
+        EXPECT_GT(solver.getMatrix().getNumberOfBytesRead(), 0ull);
+    }
+}
+
+TEST(StreamingLinearEquationSolver, MatrixVectorMultiplication) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 3, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, 1));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, 1));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x = {0, 0, 0, 0, 1};
+    
+    storm::solver::StreamingLinearEquationSolverSettings<double> settings;
+    settings.setBlockSize(32);
+    storm::solver::StreamingLinearEquationSolver<double> solver(A, settings);
+    ASSERT_NO_THROW(solver.repeatedMultiply(x, nullptr, 4));
+    ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
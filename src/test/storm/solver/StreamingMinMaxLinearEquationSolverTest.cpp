@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/solver/StreamingMinMaxLinearEquationSolver.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(StreamingMinMaxLinearEquationSolver, SolveWithStandardOptions) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+    
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+    
+    auto factory = storm::solver::StreamingMinMaxLinearEquationSolverFactory<double>();
+    factory.getSettings().setPrecision(1e-8);
+    factory.getSettings().setRelativeTerminationCriterion(false);
+    auto solver = factory.create(A);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.5), 1e-6);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.99), 1e-6);
+}
+
+TEST(StreamingMinMaxLinearEquationSolver, SchedulerAndSeveralBlocks) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 1));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 1));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, 1));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    // Moving to state 1 yields a reward of one, state 2 yields nothing.
+    std::vector<double> x(3);
+    std::vector<double> b = {0, 0, 1, 0};
+    
+    // Every row group forms a block of its own.
+    auto factory = storm::solver::StreamingMinMaxLinearEquationSolverFactory<double>(true);
+    factory.getSettings().setBlockSize(16);
+    auto solver = factory.create(A);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(1, x[0], 1e-6);
+    EXPECT_NEAR(1, x[1], 1e-6);
+    EXPECT_NEAR(0, x[2], 1e-6);
+    ASSERT_TRUE(solver->hasScheduler());
+    EXPECT_EQ(1ull, solver->getSchedulerChoices()[0]);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(0.5, x[0], 1e-6);
+    EXPECT_EQ(0ull, solver->getSchedulerChoices()[0]);
+    
+    std::vector<double> y = {0, 1, 0};
+    ASSERT_NO_THROW(solver->repeatedMultiply(storm::OptimizationDirection::Maximize, y, nullptr, 1));
+    EXPECT_NEAR(1, y[0], 1e-6);
+    EXPECT_NEAR(0, y[1], 1e-6);
+    EXPECT_NEAR(0, y[2], 1e-6);
+}
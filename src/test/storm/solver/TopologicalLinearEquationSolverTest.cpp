@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/solver/TopologicalLinearEquationSolver.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/settings/modules/GmmxxEquationSolverSettings.h"
+
+TEST(TopologicalLinearEquationSolver, Solve) {
+    ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -2));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 3));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(3);
+    std::vector<double> b = {16, -4, -7};
+    
+    // The system consists of a single SCC, which is handed to the elimination solver.
+    storm::solver::TopologicalLinearEquationSolverFactory<double> factory;
+    factory.getSettings().setSccSolverType(storm::solver::EquationSolverType::Elimination);
+    
+    auto solver = factory.create(A);
+    ASSERT_NO_THROW(solver->solveEquations(x, b));
+    ASSERT_LT(std::abs(x[0] - 1), 1e-15);
+    ASSERT_LT(std::abs(x[1] - 3), 1e-15);
+    ASSERT_LT(std::abs(x[2] - (-1)), 1e-15);
+}
+
+TEST(TopologicalLinearEquationSolver, SolveSeveralSccs) {
+    ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 3, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 1));
+    ASSERT_NO_THROW(builder.addNextValue(3, 3, 2));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(4);
+    std::vector<double> b = {0, 0.25, 0.25, 2};
+    
+    storm::solver::TopologicalLinearEquationSolverFactory<double> factory;
+    factory.getSettings().setSccSolverType(storm::solver::EquationSolverType::Gmmxx);
+    
+    auto solver = factory.create(A);
+    ASSERT_NO_THROW(solver->solveEquations(x, b));
+    ASSERT_LT(std::abs(x[0] - 0.75), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[1] - 0.5), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[2] - 0.5), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[3] - 1), 1e-15);
+    
+    // Solving the system again reuses the cached SCC decomposition.
+    solver->setCachingEnabled(true);
+    std::vector<double> y(4);
+    ASSERT_NO_THROW(solver->solveEquations(y, b));
+    ASSERT_NO_THROW(solver->solveEquations(y, b));
+    ASSERT_LT(std::abs(y[0] - 0.75), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
+}
+
+TEST(TopologicalLinearEquationSolver, MatrixVectorMultiplication) {
+    ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 3, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, 1));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, 1));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(5);
+    x[4] = 1;
+    
+    storm::solver::TopologicalLinearEquationSolverFactory<double> factory;
+    auto solver = factory.create(A);
+    ASSERT_NO_THROW(solver->repeatedMultiply(x, nullptr, 4));
+    ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::GmmxxEquationSolverSettings>().getPrecision());
+}
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "test/storm/TestHelpers.h"
+
+TEST(CompactSparseMatrix, ValueStorage) {
+    uint64_t const size = 1000;
+    
+    // A matrix with only a few distinct values uses an 8-bit dictionary.
+    storm::storage::SparseMatrixBuilder<double> fewValuesBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        ASSERT_NO_THROW(fewValuesBuilder.addNextValue(row, row, 0.5));
+        if (row + 1 < size) {
+            ASSERT_NO_THROW(fewValuesBuilder.addNextValue(row, row + 1, 0.25));
+        }
+    }
+    storm::storage::SparseMatrix<double> fewValues;
+    ASSERT_NO_THROW(fewValues = fewValuesBuilder.build());
+    storm::storage::CompactSparseMatrix<double> compactFewValues(fewValues);
+    EXPECT_EQ(size, compactFewValues.getRowCount());
+    EXPECT_EQ(size, compactFewValues.getColumnCount());
+    EXPECT_EQ(fewValues.getEntryCount(), compactFewValues.getEntryCount());
+    EXPECT_TRUE(compactFewValues.hasNarrowColumnIndices());
+    EXPECT_EQ(storm::storage::CompactSparseMatrix<double>::ValueStorage::ByteDictionary, compactFewValues.getValueStorage());
+    EXPECT_EQ(2ul, compactFewValues.getNumberOfStoredValues());
+    
+    // With more distinct values, a 16-bit dictionary is used.
+    storm::storage::SparseMatrixBuilder<double> manyValuesBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        ASSERT_NO_THROW(manyValuesBuilder.addNextValue(row, row, 1.0 / static_cast<double>(row + 1)));
+    }
+    storm::storage::SparseMatrix<double> manyValues;
+    ASSERT_NO_THROW(manyValues = manyValuesBuilder.build());
+    EXPECT_EQ(storm::storage::CompactSparseMatrix<double>::ValueStorage::ShortDictionary, storm::storage::CompactSparseMatrix<double>(manyValues).getValueStorage());
+    
+    // Without deduplication, all values are stored.
+    storm::storage::CompactSparseMatrix<double> plain(fewValues, false);
+    EXPECT_EQ(storm::storage::CompactSparseMatrix<double>::ValueStorage::Plain, plain.getValueStorage());
+    EXPECT_EQ(fewValues.getEntryCount(), plain.getNumberOfStoredValues());
+    EXPECT_LT(compactFewValues.getSizeInBytes(), plain.getSizeInBytes());
+}
+
+TEST(CompactSparseMatrix, MatrixVectorMultiply) {
+    uint64_t const size = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        if (row > 0) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row - 1, 0.25));
+        }
+        ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row, 0.5));
+        if (row + 1 < size) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row + 1, 0.25));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    std::vector<double> x(size);
+    for (uint64_t index = 0; index < size; ++index) {
+        x[index] = static_cast<double>(index % 17) / 17.0;
+    }
+    std::vector<double> expectedResult(size);
+    ASSERT_NO_THROW(matrix.multiplyWithVectorSequential(x, expectedResult));
+    
+    for (bool deduplicateValues : {true, false}) {
+        storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, deduplicateValues);
+        std::vector<double> result(size);
+        ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, result));
+        EXPECT_EQ(expectedResult, result);
+        
+        storm::test::NumberOfThreadsGuard threadsGuard(4);
+        std::vector<double> parallelResult(size);
+        ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, parallelResult));
+        EXPECT_EQ(expectedResult, parallelResult);
+    }
+}
+
+TEST(CompactSparseMatrix, SuccessiveOverRelaxationStep) {
+    uint64_t const size = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        if (row > 0) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row - 1, -1.0));
+        }
+        ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row, 4.0));
+        if (row + 1 < size) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row + 1, -1.0));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    
+    // A single step needs to agree with the one on the original matrix.
+    std::vector<double> b(size, 2.0);
+    std::vector<double> expectedX(size, 0.5);
+    std::vector<double> x(size, 0.5);
+    ASSERT_NO_THROW(matrix.performSuccessiveOverRelaxationStep(0.9, expectedX, b));
+    ASSERT_NO_THROW(compactMatrix.performSuccessiveOverRelaxationStep(0.9, x, b));
+    EXPECT_EQ(expectedX, x);
+    
+    // The step is sequential, so it does not change when several threads are available.
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::fill(x.begin(), x.end(), 0.5);
+    ASSERT_NO_THROW(compactMatrix.performSuccessiveOverRelaxationStep(0.9, x, b));
+    EXPECT_EQ(expectedX, x);
+}
+
+TEST(CompactSparseMatrix, BlockJacobiStep) {
+    uint64_t const size = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        if (row > 0) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row - 1, -1.0));
+        }
+        ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row, 4.0));
+        if (row + 1 < size) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row + 1, -1.0));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    
+    // A single step needs to agree with the one on the original matrix.
+    std::vector<double> b(size, 2.0);
+    std::vector<double> x(size, 0.5);
+    std::vector<double> expectedResult(size);
+    std::vector<double> result(size);
+    ASSERT_NO_THROW(matrix.performBlockJacobiStep(x, b, expectedResult, 1000));
+    ASSERT_NO_THROW(compactMatrix.performBlockJacobiStep(x, b, result, 1000));
+    EXPECT_EQ(expectedResult, result);
+    
+    // Iterating (in parallel) converges to the solution, which is the vector of all ones.
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::fill(x.begin(), x.end(), 0.0);
+    std::vector<double> solution(size, 1.0);
+    compactMatrix.multiplyWithVector(solution, b);
+    for (uint64_t iteration = 0; iteration < 100; ++iteration) {
+        ASSERT_NO_THROW(compactMatrix.performBlockJacobiStep(x, b, result, 1000));
+        std::swap(x, result);
+    }
+    
+    for (uint64_t index = 0; index < size; ++index) {
+        ASSERT_NEAR(1.0, x[index], 1e-12);
+    }
+}
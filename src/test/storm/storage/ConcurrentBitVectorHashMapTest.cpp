@@ -0,0 +1,166 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/macros.h"
+
+namespace {
+    // Creates the given number of pseudo-random keys of the given size. Keys may occur multiple times.
+    std::vector<storm::storage::BitVector> createKeys(uint64_t numberOfKeys, uint64_t numberOfDistinctKeys, uint64_t bitsPerKey) {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<uint64_t> distribution(0, numberOfDistinctKeys - 1);
+        std::vector<storm::storage::BitVector> result;
+        result.reserve(numberOfKeys);
+        for (uint64_t i = 0; i < numberOfKeys; ++i) {
+            uint64_t value = distribution(generator);
+            storm::storage::BitVector key(bitsPerKey);
+            key.setFromInt(0, 64, value);
+            key.setFromInt(bitsPerKey - 64, 64, value * 31 + 7);
+            result.push_back(std::move(key));
+        }
+        return result;
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3, 4);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_FALSE(map.contains(third));
+
+    std::pair<uint64_t, bool> valueInsertedPair = map.findOrAdd(third, [] () { return 3ul; });
+    EXPECT_EQ(3ul, valueInsertedPair.first);
+    EXPECT_TRUE(valueInsertedPair.second);
+    valueInsertedPair = map.findOrAdd(third, [] () { return 4ul; });
+    EXPECT_EQ(3ul, valueInsertedPair.first);
+    EXPECT_FALSE(valueInsertedPair.second);
+
+    EXPECT_TRUE(map.contains(third));
+    EXPECT_EQ(1ul, map.getValue(first));
+    EXPECT_EQ(2ul, map.getValue(second));
+    EXPECT_EQ(3ul, map.getValue(third));
+    EXPECT_EQ(3ul, map.size());
+
+    map.setOrAdd(first, 5);
+    EXPECT_EQ(5ul, map.getValue(first));
+    EXPECT_EQ(3ul, map.size());
+
+    map.remap([] (uint64_t const& value) { return value + 1; });
+    EXPECT_EQ(6ul, map.getValue(first));
+    EXPECT_EQ(3ul, map.getValue(second));
+    EXPECT_EQ(4ul, map.getValue(third));
+
+    uint64_t numberOfElements = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyValuePair.second, map.getValue(keyValuePair.first));
+        ++numberOfElements;
+    }
+    EXPECT_EQ(3ul, numberOfElements);
+
+    storm::storage::BitVectorHashMap<uint64_t> sequentialMap = map.toBitVectorHashMap();
+    EXPECT_EQ(3ul, sequentialMap.size());
+    EXPECT_EQ(6ul, sequentialMap.getValue(first));
+    EXPECT_EQ(3ul, sequentialMap.getValue(second));
+    EXPECT_EQ(4ul, sequentialMap.getValue(third));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfThreads = 8;
+    std::vector<storm::storage::BitVector> keys = createKeys(200000, 50000, 128);
+
+    // Start with a small map to force every shard to grow several times while other threads insert.
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10, 16);
+    std::atomic<uint32_t> nextIndex(0);
+    std::vector<std::vector<uint32_t>> foundIndices(numberOfThreads, std::vector<uint32_t>(keys.size()));
+
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread] () {
+            // All threads insert all keys, but in different orders.
+            for (uint64_t i = 0; i < keys.size(); ++i) {
+                uint64_t keyIndex = (i + thread * keys.size() / numberOfThreads) % keys.size();
+                foundIndices[thread][keyIndex] = map.findOrAdd(keys[keyIndex], [&nextIndex] () { return nextIndex++; }).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every distinct key must have received exactly one index and all threads must agree on it.
+    storm::storage::BitVectorHashMap<uint32_t> sequentialMap(128);
+    for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+        sequentialMap.findOrAdd(keys[keyIndex], foundIndices[0][keyIndex]);
+    }
+    EXPECT_EQ(sequentialMap.size(), map.size());
+    EXPECT_EQ(sequentialMap.size(), static_cast<uint64_t>(nextIndex.load()));
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+            ASSERT_EQ(foundIndices[0][keyIndex], foundIndices[thread][keyIndex]);
+            ASSERT_EQ(sequentialMap.getValue(keys[keyIndex]), map.getValue(keys[keyIndex]));
+        }
+    }
+}
+
+// This micro-benchmark compares the throughput of the concurrent map with the one of the sequential map. As it takes
+// a while, it is disabled by default and can be run via --gtest_also_run_disabled_tests.
+TEST(ConcurrentBitVectorHashMapTest, DISABLED_Benchmark) {
+    uint64_t const bitsPerKey = 128;
+    std::vector<storm::storage::BitVector> keys = createKeys(10000000, 4000000, bitsPerKey);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::storage::BitVectorHashMap<uint32_t> sequentialMap(bitsPerKey);
+    uint32_t nextSequentialIndex = 0;
+    for (auto const& key : keys) {
+        if (sequentialMap.findOrAdd(key, nextSequentialIndex) == nextSequentialIndex) {
+            ++nextSequentialIndex;
+        }
+    }
+    auto sequentialTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    STORM_LOG_INFO("BitVectorHashMap: " << keys.size() << " operations in " << sequentialTime << "ms.");
+
+    for (uint64_t numberOfThreads = 1; numberOfThreads <= 64; numberOfThreads *= 2) {
+        start = std::chrono::high_resolution_clock::now();
+        storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(bitsPerKey);
+        std::atomic<uint32_t> nextIndex(0);
+
+        std::vector<std::thread> threads;
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            threads.emplace_back([&, thread] () {
+                for (uint64_t keyIndex = thread; keyIndex < keys.size(); keyIndex += numberOfThreads) {
+                    map.findOrAdd(keys[keyIndex], [&nextIndex] () { return nextIndex++; });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto concurrentTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        STORM_LOG_INFO("ConcurrentBitVectorHashMap (" << numberOfThreads << " threads): " << keys.size() << " operations in " << concurrentTime << "ms.");
+        EXPECT_EQ(sequentialMap.size(), map.size());
+    }
+}
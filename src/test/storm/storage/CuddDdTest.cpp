@@ -4,6 +4,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ExplicitConversionCache.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
@@ -740,6 +741,47 @@ TEST(CuddDd, BddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, ExplicitConversionCacheTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 19999);
+
+    // Create a matrix that has a self-loop in every row and an additional transition to state 0 in all but the first row.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.second, 0).template toAdd<double>() * (manager->getRange(x.first) && !manager->getEncoding(x.first, 0)).template toAdd<double>() * manager->template getConstant<double>(2);
+
+    // Enable the caching of translations, which is disabled by default.
+    storm::dd::ExplicitConversionCache<storm::dd::DdType::CUDD, double> cache(4, 4);
+    storm::dd::Odd rowOdd = cache.getOdd(manager->getRange(x.first));
+    storm::dd::Odd columnOdd = cache.getOdd(manager->getRange(x.second));
+    EXPECT_EQ(20000ul, rowOdd.getTotalOffset());
+    EXPECT_EQ(&rowOdd.getThenSuccessor(), &cache.getOdd(manager->getRange(x.first)).getThenSuccessor());
+
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> matrixPointer;
+    ASSERT_NO_THROW(matrixPointer = cache.toMatrix(dd, rowOdd, columnOdd));
+    storm::storage::SparseMatrix<double> const& matrix = *matrixPointer;
+    EXPECT_EQ(20000ul, matrix.getRowCount());
+    EXPECT_EQ(20000ul, matrix.getColumnCount());
+    EXPECT_EQ(39999ul, matrix.getNonzeroEntryCount());
+    EXPECT_EQ(1ul, matrix.getRow(0).getNumberOfEntries());
+    for (uint_fast64_t row = 1; row < matrix.getRowCount(); row += 997) {
+        ASSERT_EQ(2ul, matrix.getRow(row).getNumberOfEntries());
+        EXPECT_EQ(0ul, matrix.getRow(row).begin()->getColumn());
+        EXPECT_EQ(2.0, matrix.getRow(row).begin()->getValue());
+        EXPECT_EQ(row, (matrix.getRow(row).begin() + 1)->getColumn());
+        EXPECT_EQ(1.0, (matrix.getRow(row).begin() + 1)->getValue());
+    }
+
+    // Translating the same matrix again must return the cached result.
+    EXPECT_EQ(matrixPointer, cache.toMatrix(dd, rowOdd, cache.getOdd(manager->getRange(x.second))));
+    EXPECT_TRUE(matrix == dd.toMatrix(rowOdd, columnOdd));
+
+    // Once the caching of translations is disabled, the matrix is translated anew.
+    cache.setMaximalNumberOfTranslations(0);
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> otherMatrixPointer = cache.toMatrix(dd, rowOdd, columnOdd);
+    EXPECT_NE(matrixPointer, otherMatrixPointer);
+    EXPECT_TRUE(matrix == *otherMatrixPointer);
+}
+
 TEST(CuddDd, BddToExpressionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> ddManager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = ddManager->addMetaVariable("a");
@@ -1,9 +1,31 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
+
+#include <chrono>
+#include <map>
+#include <set>
+
 #include "storm/parser/AutoParser.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+#include "test/storm/TestHelpers.h"
+
+namespace {
+    std::set<std::map<uint_fast64_t, std::vector<uint_fast64_t>>> getMecs(storm::storage::MaximalEndComponentDecomposition<double> const& decomposition) {
+        std::set<std::map<uint_fast64_t, std::vector<uint_fast64_t>>> result;
+        for (auto const& mec : decomposition) {
+            std::map<uint_fast64_t, std::vector<uint_fast64_t>> stateToChoices;
+            for (auto const& stateChoicesPair : mec) {
+                stateToChoices[stateChoicesPair.first] = std::vector<uint_fast64_t>(stateChoicesPair.second.begin(), stateChoicesPair.second.end());
+            }
+            result.insert(std::move(stateToChoices));
+        }
+        return result;
+    }
+}
 
 TEST(MaximalEndComponentDecomposition, FullSystem1) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
@@ -133,3 +155,84 @@ TEST(MaximalEndComponentDecomposition, Subsystem) {
         ASSERT_TRUE(false);
     }
 }
+
+TEST(MaximalEndComponentDecomposition, ChoicesLeavingCandidate) {
+    // The states 0 and 1 are connected only by choices that may also lead to state 2, so they form separate MECs.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 3, 7, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 2, 1.0));
+    
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition;
+    ASSERT_NO_THROW(mecDecomposition = storm::storage::MaximalEndComponentDecomposition<double>(matrix, matrix.transpose(true)));
+    
+    ASSERT_EQ(3ul, mecDecomposition.size());
+    for (auto const& mec : mecDecomposition) {
+        ASSERT_EQ(1ul, mec.getStateSet().size());
+        uint_fast64_t state = mec.begin()->first;
+        EXPECT_EQ(1ul, mec.getChoicesForState(state).size());
+        EXPECT_TRUE(mec.containsChoice(state, matrix.getRowGroupIndices()[state]));
+    }
+}
+
+TEST(MaximalEndComponentDecomposition, ParallelDecomposition) {
+    // Build a random MDP that is large enough for the decomposition to be performed in parallel.
+    uint64_t const numberOfStates = 30000;
+    storm::storage::SparseMatrix<double> transitionMatrix = storm::test::createRandomNondeterministicMatrix(numberOfStates, 3, 3, 31);
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    
+    storm::storage::MaximalEndComponentDecomposition<double> sequentialDecomposition(transitionMatrix, backwardTransitions);
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    storm::storage::MaximalEndComponentDecomposition<double> parallelDecomposition(transitionMatrix, backwardTransitions);
+    
+    EXPECT_LT(1ul, sequentialDecomposition.size());
+    EXPECT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    EXPECT_TRUE(getMecs(sequentialDecomposition) == getMecs(parallelDecomposition));
+}
+
+// This benchmark decomposes an MDP with 10^8 states (which needs about 10GB of memory) into 10^4 MECs, each of which
+// is a long cycle. As it takes a while, it is disabled by default and can be run via --gtest_also_run_disabled_tests.
+TEST(MaximalEndComponentDecomposition, DISABLED_LargeModelBenchmark) {
+    uint64_t const numberOfCycles = 10000;
+    uint64_t const cycleLength = 10000;
+    uint64_t const sinkState = numberOfCycles * cycleLength;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, sinkState + 1, 0, false, true, sinkState + 1);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < sinkState; ++state) {
+        matrixBuilder.newRowGroup(row);
+        
+        // Every state moves along its cycle. The last state of each cycle may also enter the next cycle, but then
+        // risks to move to the sink state.
+        bool lastStateOfCycle = state % cycleLength == cycleLength - 1;
+        matrixBuilder.addNextValue(row, lastStateOfCycle ? state + 1 - cycleLength : state + 1, 1.0);
+        ++row;
+        if (lastStateOfCycle) {
+            matrixBuilder.addNextValue(row, (state + 1) % sinkState, 0.5);
+            matrixBuilder.addNextValue(row, sinkState, 0.5);
+            ++row;
+        }
+    }
+    matrixBuilder.newRowGroup(row);
+    matrixBuilder.addNextValue(row, sinkState, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    
+    for (uint64_t numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads *= 2) {
+        storm::test::NumberOfThreadsGuard threadsGuard(numberOfThreads);
+        auto start = std::chrono::high_resolution_clock::now();
+        storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(transitionMatrix, backwardTransitions);
+        auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        EXPECT_EQ(numberOfCycles + 1, mecDecomposition.size());
+        STORM_LOG_INFO("MEC decomposition (" << numberOfThreads << " threads, " << transitionMatrix.getRowGroupCount() << " states) in " << time << "ms.");
+    }
+}
@@ -1,10 +1,17 @@
 #include "gtest/gtest.h"
+
+#include <chrono>
+
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include "test/storm/TestHelpers.h"
+
 TEST(SparseMatrixBuilder, CreationWithDimensions) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -600,6 +607,193 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     }
 }
 
+TEST(SparseMatrix, ParallelMatrixVectorMultiply) {
+    // Build a banded matrix that is large enough for the parallel multiplication to be used.
+    uint64_t const size = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        if (row > 0) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row - 1, 0.25));
+        }
+        ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row, 0.5));
+        if (row + 1 < size) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, row + 1, 0.25));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    std::vector<double> x(size);
+    for (uint64_t index = 0; index < size; ++index) {
+        x[index] = static_cast<double>(index % 17) / 17.0;
+    }
+    std::vector<double> sequentialResult(size);
+    ASSERT_NO_THROW(matrix.multiplyWithVectorSequential(x, sequentialResult));
+    
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::vector<double> parallelResult(size);
+    ASSERT_NO_THROW(matrix.multiplyWithVectorParallel(x, parallelResult));
+    EXPECT_EQ(sequentialResult, parallelResult);
+    
+    std::vector<double> result(size);
+    ASSERT_NO_THROW(matrix.multiplyWithVector(x, result));
+    EXPECT_EQ(sequentialResult, result);
+}
+
+namespace {
+    // Builds a diagonally dominant equation system of the given size whose solution is the vector of all ones.
+    std::pair<storm::storage::SparseMatrix<double>, std::vector<double>> createDiagonallyDominantSystem(uint64_t size) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+        for (uint64_t row = 0; row < size; ++row) {
+            if (row > 0) {
+                matrixBuilder.addNextValue(row, row - 1, -1.0);
+            }
+            matrixBuilder.addNextValue(row, row, 4.0);
+            if (row + 1 < size) {
+                matrixBuilder.addNextValue(row, row + 1, -1.0);
+            }
+        }
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        std::vector<double> solution(size, 1.0);
+        std::vector<double> b(size);
+        matrix.multiplyWithVectorSequential(solution, b);
+        return std::make_pair(std::move(matrix), std::move(b));
+    }
+}
+
+TEST(SparseMatrix, SuccessiveOverRelaxationStepIgnoresThreads) {
+    auto system = createDiagonallyDominantSystem(20000);
+    
+    std::vector<double> sequentialX(20000);
+    for (uint64_t iteration = 0; iteration < 10; ++iteration) {
+        ASSERT_NO_THROW(system.first.performSuccessiveOverRelaxationStep(0.9, sequentialX, system.second));
+    }
+    
+    // The Gauss-Seidel/SOR step is inherently sequential and must not change when several threads are available.
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::vector<double> x(20000);
+    for (uint64_t iteration = 0; iteration < 10; ++iteration) {
+        ASSERT_NO_THROW(system.first.performSuccessiveOverRelaxationStep(0.9, x, system.second));
+    }
+    EXPECT_EQ(sequentialX, x);
+}
+
+TEST(SparseMatrix, BlockJacobiStep) {
+    auto system = createDiagonallyDominantSystem(20000);
+    
+    std::vector<std::vector<double>> solutions;
+    for (uint64_t numberOfThreads : {1, 4}) {
+        storm::test::NumberOfThreadsGuard threadsGuard(numberOfThreads);
+        std::vector<double> x(20000);
+        std::vector<double> result(20000);
+        for (uint64_t iteration = 0; iteration < 100; ++iteration) {
+            ASSERT_NO_THROW(system.first.performBlockJacobiStep(x, system.second, result, 1000));
+            std::swap(x, result);
+        }
+        for (uint64_t index = 0; index < x.size(); ++index) {
+            ASSERT_NEAR(1.0, x[index], 1e-12);
+        }
+        solutions.push_back(std::move(x));
+    }
+    
+    // The blocks do not depend on the number of threads and neither does the result.
+    EXPECT_EQ(solutions.front(), solutions.back());
+}
+
+TEST(SparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createRandomNondeterministicMatrix(1000, 4, 4, 42);
+    std::vector<uint_fast64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint64_t index = 0; index < x.size(); ++index) {
+        x[index] = static_cast<double>(index % 17) / 17.0;
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint64_t index = 0; index < b.size(); ++index) {
+        b[index] = static_cast<double>(index % 5) / 10.0;
+    }
+    
+    std::vector<double> multiplyResult(matrix.getRowCount());
+    matrix.multiplyWithVectorSequential(x, multiplyResult);
+    storm::utility::vector::addVectors(multiplyResult, b, multiplyResult);
+    
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, expected, rowGroupIndices);
+        
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+        ASSERT_NO_THROW(matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, result, &choices));
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            ASSERT_NEAR(expected[group], result[group], 1e-12);
+            ASSERT_LT(choices[group], rowGroupIndices[group + 1] - rowGroupIndices[group]);
+            ASSERT_NEAR(expected[group], multiplyResult[rowGroupIndices[group] + choices[group]], 1e-12);
+        }
+    }
+    
+    // Without a summand, the optimal value of every row group is the one of the optimal row of the product.
+    std::vector<double> result(matrix.getRowGroupCount());
+    ASSERT_NO_THROW(matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, result, nullptr));
+    matrix.multiplyWithVectorSequential(x, multiplyResult);
+    std::vector<double> expected(matrix.getRowGroupCount());
+    storm::utility::vector::reduceVectorMinOrMax(storm::OptimizationDirection::Maximize, multiplyResult, expected, rowGroupIndices);
+    for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        ASSERT_NEAR(expected[group], result[group], 1e-12);
+    }
+}
+
+TEST(SparseMatrix, ParallelMultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createRandomNondeterministicMatrix(20000, 4, 4, 42);
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint64_t index = 0; index < x.size(); ++index) {
+        x[index] = static_cast<double>(index % 17) / 17.0;
+    }
+    
+    std::vector<double> sequentialResult(matrix.getRowGroupCount());
+    std::vector<uint_fast64_t> sequentialChoices(matrix.getRowGroupCount());
+    ASSERT_NO_THROW(matrix.multiplyAndReduce(storm::OptimizationDirection::Minimize, matrix.getRowGroupIndices(), x, nullptr, sequentialResult, &sequentialChoices));
+    
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::vector<double> parallelResult(matrix.getRowGroupCount());
+    std::vector<uint_fast64_t> parallelChoices(matrix.getRowGroupCount());
+    ASSERT_NO_THROW(matrix.multiplyAndReduce(storm::OptimizationDirection::Minimize, matrix.getRowGroupIndices(), x, nullptr, parallelResult, &parallelChoices));
+    
+    EXPECT_EQ(sequentialResult, parallelResult);
+    EXPECT_EQ(sequentialChoices, parallelChoices);
+}
+
+// This micro-benchmark compares the fused multiplication and reduction with first multiplying and reducing the result
+// afterwards. As it takes a while, it is disabled by default and can be run via --gtest_also_run_disabled_tests.
+TEST(SparseMatrix, DISABLED_MultiplyAndReduceBenchmark) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createRandomNondeterministicMatrix(2000000, 4, 4, 42);
+    std::vector<uint_fast64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x(matrix.getColumnCount(), 0.5);
+    std::vector<double> b(matrix.getRowCount(), 0.1);
+    std::vector<double> result(matrix.getRowGroupCount());
+    uint64_t const iterations = 50;
+    
+    for (uint64_t numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads *= 2) {
+        storm::test::NumberOfThreadsGuard threadsGuard(numberOfThreads);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<double> multiplyResult(matrix.getRowCount());
+        for (uint64_t iteration = 0; iteration < iterations; ++iteration) {
+            matrix.multiplyWithVector(x, multiplyResult);
+            storm::utility::vector::addVectors(multiplyResult, b, multiplyResult);
+            storm::utility::vector::reduceVectorMinOrMax(storm::OptimizationDirection::Maximize, multiplyResult, result, rowGroupIndices);
+        }
+        auto twoPassTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        
+        start = std::chrono::high_resolution_clock::now();
+        for (uint64_t iteration = 0; iteration < iterations; ++iteration) {
+            matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, rowGroupIndices, x, &b, result, nullptr);
+        }
+        auto fusedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        
+        STORM_LOG_INFO("Multiply and reduce (" << numberOfThreads << " threads, " << matrix.getEntryCount() << " entries): two passes in " << twoPassTime << "ms, fused in " << fusedTime << "ms.");
+    }
+}
+
 TEST(SparseMatrix, Iteration) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
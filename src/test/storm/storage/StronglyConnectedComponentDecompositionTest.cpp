@@ -1,10 +1,50 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
+
+#include <chrono>
+#include <limits>
+#include <set>
+
 #include "storm/parser/AutoParser.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/utility/macros.h"
+
+#include "test/storm/TestHelpers.h"
+
+namespace {
+    std::set<std::pair<std::vector<uint_fast64_t>, bool>> getSccs(storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::set<std::pair<std::vector<uint_fast64_t>, bool>> result;
+        for (auto const& scc : decomposition) {
+            result.emplace(std::vector<uint_fast64_t>(scc.begin(), scc.end()), scc.isTrivial());
+        }
+        return result;
+    }
+    
+    // Checks whether every SCC comes after all SCCs it can reach, i.e. whether the SCCs are in reverse topological order.
+    bool isReverseTopologicallyOrdered(storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition, storm::storage::SparseMatrix<double> const& matrix) {
+        std::vector<uint_fast64_t> stateToSccIndex(matrix.getRowGroupCount(), std::numeric_limits<uint_fast64_t>::max());
+        for (uint_fast64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+            for (auto state : decomposition[sccIndex]) {
+                stateToSccIndex[state] = sccIndex;
+            }
+        }
+        for (uint_fast64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+            if (stateToSccIndex[state] == std::numeric_limits<uint_fast64_t>::max()) {
+                continue;
+            }
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                uint_fast64_t successorSccIndex = stateToSccIndex[entry.getColumn()];
+                if (successorSccIndex != std::numeric_limits<uint_fast64_t>::max() && successorSccIndex > stateToSccIndex[state]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
 
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
 	storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
@@ -78,3 +118,94 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, SmallSystemWithChoices) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 3, 6, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 2, 1.0));
+    
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::BitVector allStates(3, true);
+    
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition;
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allStates, storm::storage::BitVector(5, true)));
+    ASSERT_EQ(1ul, sccDecomposition.size());
+    
+    // Without the second choice of state 0, state 0 can no longer reach the other states.
+    storm::storage::BitVector choices(5, true);
+    choices.set(1, false);
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allStates, choices));
+    ASSERT_EQ(2ul, sccDecomposition.size());
+    
+    // Without the first choice of state 2, state 1 forms a trivial SCC.
+    choices.set(3, false);
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allStates, choices, true));
+    ASSERT_EQ(2ul, sccDecomposition.size());
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allStates, choices, false, true));
+    ASSERT_EQ(2ul, sccDecomposition.size());
+    
+    // Without the last choice of state 2, also the self-loop of state 2 is gone.
+    choices.set(4, false);
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allStates, choices, true));
+    ASSERT_EQ(1ul, sccDecomposition.size());
+    EXPECT_EQ(1ul, sccDecomposition[0].size());
+    EXPECT_TRUE(sccDecomposition[0].containsState(0));
+}
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createRandomNondeterministicMatrix(30000, 2, 2, 23);
+    storm::storage::BitVector subsystem(matrix.getRowGroupCount(), true);
+    for (uint64_t state = 0; state < subsystem.size(); state += 11) {
+        subsystem.set(state, false);
+    }
+    
+    for (uint64_t mode = 0; mode < 4; ++mode) {
+        bool dropNaiveSccs = mode & 1;
+        bool onlyBottomSccs = mode & 2;
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, subsystem, dropNaiveSccs, onlyBottomSccs);
+        storm::test::NumberOfThreadsGuard threadsGuard(4);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, subsystem, dropNaiveSccs, onlyBottomSccs);
+        
+        EXPECT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        EXPECT_TRUE(getSccs(sequentialDecomposition) == getSccs(parallelDecomposition));
+        
+        // Like the sequential decomposition, the parallel one yields the SCCs in reverse topological order.
+        EXPECT_TRUE(isReverseTopologicallyOrdered(sequentialDecomposition, matrix));
+        EXPECT_TRUE(isReverseTopologicallyOrdered(parallelDecomposition, matrix));
+    }
+}
+
+// This benchmark decomposes a model with 10^8 states (which needs about 8GB of memory) that consists of long cycles.
+// As it takes a while, it is disabled by default and can be run via --gtest_also_run_disabled_tests.
+TEST(StronglyConnectedComponentDecomposition, DISABLED_LargeModelBenchmark) {
+    uint64_t const numberOfStates = 100000000;
+    uint64_t const cycleLength = 1000000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates, numberOfStates + numberOfStates / cycleLength);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        // Every state moves along its cycle and the last state of each cycle may also enter the next cycle.
+        if (state % cycleLength == cycleLength - 1) {
+            matrixBuilder.addNextValue(state, state + 1 - cycleLength, 0.5);
+            matrixBuilder.addNextValue(state, (state + 1) % numberOfStates, 0.5);
+        } else {
+            matrixBuilder.addNextValue(state, state + 1, 1.0);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    
+    for (uint64_t numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads *= 2) {
+        storm::test::NumberOfThreadsGuard threadsGuard(numberOfThreads);
+        auto start = std::chrono::high_resolution_clock::now();
+        storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition(matrix);
+        auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        EXPECT_EQ(1ul, sccDecomposition.size());
+        STORM_LOG_INFO("SCC decomposition (" << numberOfThreads << " threads, " << numberOfStates << " states) in " << time << "ms.");
+    }
+}
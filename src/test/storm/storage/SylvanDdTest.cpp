@@ -6,6 +6,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ExplicitConversionCache.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/settings/SettingsManager.h"
 
@@ -717,6 +718,59 @@ TEST(SylvanDd, SwapTest) {
     EXPECT_TRUE(dd1 == manager->template getIdentity<double>(x.second));
 }
 
+TEST(SylvanDd, ReorderingTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a", 0, 7);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> b = manager->addMetaVariable("b", 0, 7);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> c = manager->addMetaVariable("c", 0, 7);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> d = manager->addMetaVariable("d", 0, 7);
+    
+    // With the initial order, the bits of a and c as well as those of b and d are far apart.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> dd1 = manager->template getIdentity<double>(a.first).equals(manager->template getIdentity<double>(c.first)) && manager->template getIdentity<double>(b.first).equals(manager->template getIdentity<double>(d.first));
+    uint_fast64_t nodeCountBefore = dd1.getNodeCount();
+    
+    ASSERT_NO_THROW(manager->triggerReordering());
+    EXPECT_LT(dd1.getNodeCount(), nodeCountBefore);
+    EXPECT_EQ(64ul, dd1.getNonZeroCount());
+    
+    // The reordered BDD needs to coincide with one that is built from scratch in the new order.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> dd2 = manager->template getIdentity<double>(a.first).equals(manager->template getIdentity<double>(c.first)) && manager->template getIdentity<double>(b.first).equals(manager->template getIdentity<double>(d.first));
+    EXPECT_TRUE(dd1 == dd2);
+    
+    // Row and column variables need to remain interleaved.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> dd3 = manager->template getIdentity<double>(a.second).equals(manager->template getIdentity<double>(c.second)) && manager->template getIdentity<double>(b.second).equals(manager->template getIdentity<double>(d.second));
+    EXPECT_TRUE(dd1.swapVariables({a, b, c, d}) == dd3);
+    
+    manager->allowDynamicReordering(true);
+    EXPECT_TRUE(manager->isDynamicReorderingAllowed());
+    manager->allowDynamicReordering(false);
+    EXPECT_FALSE(manager->isDynamicReorderingAllowed());
+}
+
+TEST(SylvanDd, RefinePartitionTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> blocks = manager->addMetaVariable("blocks", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+    
+    // Initially, all values of x are in the same block and the signature distinguishes the odd from the even ones.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> partition = manager->getRange(x.first) && manager->getEncoding(blocks.first, 0);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> signature = (manager->getEncoding(x.first, 1) || manager->getEncoding(x.first, 3)).template toAdd<double>();
+    std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> refined;
+    ASSERT_NO_THROW(refined = partition.refinePartition(signature, blocks.first));
+    EXPECT_EQ(2ul, refined.second);
+    EXPECT_TRUE(refined.first.existsAbstract({blocks.first}) == manager->getRange(x.first));
+    auto blockOf = [&] (int_fast64_t value) { return (refined.first && manager->getEncoding(x.first, value)).existsAbstract({x.first}); };
+    EXPECT_TRUE(blockOf(0) == blockOf(2));
+    EXPECT_TRUE(blockOf(1) == blockOf(3));
+    EXPECT_FALSE(blockOf(0) == blockOf(1));
+    
+    // The variable y is ordered below the block variables, so it must not occur in the signature.
+    signature = manager->getEncoding(y.first, 1).template toAdd<double>();
+    EXPECT_THROW(partition.refinePartition(signature, blocks.first), storm::exceptions::InvalidArgumentException);
+}
+
 TEST(SylvanDd, MultiplyMatrixTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -882,6 +936,47 @@ TEST(SylvanDd, BddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, ExplicitConversionCacheTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 19999);
+
+    // Create a matrix that has a self-loop in every row and an additional transition to state 0 in all but the first row.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.second, 0).template toAdd<double>() * (manager->getRange(x.first) && !manager->getEncoding(x.first, 0)).template toAdd<double>() * manager->template getConstant<double>(2);
+
+    // Enable the caching of translations, which is disabled by default.
+    storm::dd::ExplicitConversionCache<storm::dd::DdType::Sylvan, double> cache(4, 4);
+    storm::dd::Odd rowOdd = cache.getOdd(manager->getRange(x.first));
+    storm::dd::Odd columnOdd = cache.getOdd(manager->getRange(x.second));
+    EXPECT_EQ(20000ul, rowOdd.getTotalOffset());
+    EXPECT_EQ(&rowOdd.getThenSuccessor(), &cache.getOdd(manager->getRange(x.first)).getThenSuccessor());
+
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> matrixPointer;
+    ASSERT_NO_THROW(matrixPointer = cache.toMatrix(dd, rowOdd, columnOdd));
+    storm::storage::SparseMatrix<double> const& matrix = *matrixPointer;
+    EXPECT_EQ(20000ul, matrix.getRowCount());
+    EXPECT_EQ(20000ul, matrix.getColumnCount());
+    EXPECT_EQ(39999ul, matrix.getNonzeroEntryCount());
+    EXPECT_EQ(1ul, matrix.getRow(0).getNumberOfEntries());
+    for (uint_fast64_t row = 1; row < matrix.getRowCount(); row += 997) {
+        ASSERT_EQ(2ul, matrix.getRow(row).getNumberOfEntries());
+        EXPECT_EQ(0ul, matrix.getRow(row).begin()->getColumn());
+        EXPECT_EQ(2.0, matrix.getRow(row).begin()->getValue());
+        EXPECT_EQ(row, (matrix.getRow(row).begin() + 1)->getColumn());
+        EXPECT_EQ(1.0, (matrix.getRow(row).begin() + 1)->getValue());
+    }
+
+    // Translating the same matrix again must return the cached result.
+    EXPECT_EQ(matrixPointer, cache.toMatrix(dd, rowOdd, cache.getOdd(manager->getRange(x.second))));
+    EXPECT_TRUE(matrix == dd.toMatrix(rowOdd, columnOdd));
+
+    // Once the caching of translations is disabled, the matrix is translated anew.
+    cache.setMaximalNumberOfTranslations(0);
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> otherMatrixPointer = cache.toMatrix(dd, rowOdd, columnOdd);
+    EXPECT_NE(matrixPointer, otherMatrixPointer);
+    EXPECT_TRUE(matrix == *otherMatrixPointer);
+}
+
 TEST(SylvanDd, BddToExpressionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> ddManager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = ddManager->addMetaVariable("a");
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/parser/PrismParser.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+
+#include "storm/storage/bisimulation/SymbolicBisimulationDecomposition.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+
+namespace {
+    template<storm::dd::DdType DdType>
+    void checkDie() {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        std::shared_ptr<storm::models::symbolic::Model<DdType, double>> model = storm::builder::DdPrismModelBuilder<DdType, double>().build(program);
+        ASSERT_EQ(storm::models::ModelType::Dtmc, model->getType());
+        EXPECT_EQ(13ul, model->getNumberOfStates());
+
+        storm::storage::SymbolicBisimulationDecomposition<DdType, double> bisim(*model);
+        ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+        EXPECT_EQ(13ul, bisim.getNumberOfBlocks());
+
+        storm::parser::FormulaParser formulaParser;
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = { formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]") };
+
+        storm::storage::SymbolicBisimulationDecomposition<DdType, double> bisim2(*model, formulas);
+        ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+        EXPECT_EQ(5ul, bisim2.getNumberOfBlocks());
+
+        std::shared_ptr<storm::models::ModelBase> result;
+        ASSERT_NO_THROW(result = bisim2.getQuotient(storm::storage::BisimulationQuotientFormat::Dd));
+        ASSERT_TRUE(result->isSymbolicModel());
+        std::shared_ptr<storm::models::symbolic::Dtmc<DdType, double>> quotient = result->template as<storm::models::symbolic::Dtmc<DdType, double>>();
+        EXPECT_EQ(5ul, quotient->getNumberOfStates());
+        EXPECT_EQ(8ul, quotient->getNumberOfTransitions());
+        EXPECT_TRUE(quotient->hasLabel("one"));
+
+        storm::modelchecker::SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<DdType, double>> checker(*quotient);
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult = checker.check(*formulas.front());
+        checkResult->filter(storm::modelchecker::SymbolicQualitativeCheckResult<DdType>(quotient->getReachableStates(), quotient->getInitialStates()));
+        storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, double>& quantitativeResult = checkResult->template asSymbolicQuantitativeCheckResult<DdType, double>();
+        EXPECT_NEAR(1.0 / 6.0, quantitativeResult.getMin(), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+
+        ASSERT_NO_THROW(result = bisim2.getQuotient(storm::storage::BisimulationQuotientFormat::Sparse));
+        ASSERT_TRUE(result->isSparseModel());
+        std::shared_ptr<storm::models::sparse::Dtmc<double>> sparseQuotient = result->template as<storm::models::sparse::Dtmc<double>>();
+        EXPECT_EQ(5ul, sparseQuotient->getNumberOfStates());
+        EXPECT_EQ(8ul, sparseQuotient->getNumberOfTransitions());
+        EXPECT_EQ(1ul, sparseQuotient->getInitialStates().getNumberOfSetBits());
+        EXPECT_EQ(1ul, sparseQuotient->getStates("one").getNumberOfSetBits());
+    }
+
+    template<storm::dd::DdType DdType>
+    void checkTwoDice() {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        std::shared_ptr<storm::models::symbolic::Model<DdType, double>> model = storm::builder::DdPrismModelBuilder<DdType, double>().build(program);
+        ASSERT_EQ(storm::models::ModelType::Mdp, model->getType());
+        EXPECT_EQ(169ul, model->getNumberOfStates());
+
+        storm::parser::FormulaParser formulaParser;
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = { formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]") };
+
+        storm::storage::SymbolicBisimulationDecomposition<DdType, double> bisim(*model, formulas);
+        ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+        EXPECT_EQ(11ul, bisim.getNumberOfBlocks());
+
+        std::shared_ptr<storm::models::ModelBase> result;
+        ASSERT_NO_THROW(result = bisim.getQuotient(storm::storage::BisimulationQuotientFormat::Dd));
+        EXPECT_EQ(storm::models::ModelType::Mdp, result->getType());
+        std::shared_ptr<storm::models::symbolic::Mdp<DdType, double>> quotient = result->template as<storm::models::symbolic::Mdp<DdType, double>>();
+        EXPECT_EQ(11ul, quotient->getNumberOfStates());
+
+        ASSERT_NO_THROW(result = bisim.getQuotient(storm::storage::BisimulationQuotientFormat::Sparse));
+        ASSERT_TRUE(result->isSparseModel());
+        std::shared_ptr<storm::models::sparse::Mdp<double>> sparseQuotient = result->template as<storm::models::sparse::Mdp<double>>();
+        EXPECT_EQ(11ul, sparseQuotient->getNumberOfStates());
+        EXPECT_EQ(sparseQuotient->getNumberOfChoices(), sparseQuotient->getTransitionMatrix().getRowCount());
+    }
+}
+
+TEST(SymbolicBisimulationDecomposition, Die_Cudd) {
+    checkDie<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicBisimulationDecomposition, Die_Sylvan) {
+    checkDie<storm::dd::DdType::Sylvan>();
+}
+
+TEST(SymbolicBisimulationDecomposition, TwoDice_Cudd) {
+    checkTwoDice<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicBisimulationDecomposition, TwoDice_Sylvan) {
+    checkTwoDice<storm::dd::DdType::Sylvan>();
+}
@@ -16,6 +16,8 @@
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
 
+#include "test/storm/TestHelpers.h"
+
 TEST(GraphTest, SymbolicProb01_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -668,3 +670,60 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitProb01Parallel) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+    
+    // The model is large enough for the backward searches to be performed in parallel.
+    storm::storage::BitVector parallelBoundedStates;
+    {
+        storm::test::NumberOfThreadsGuard threadsGuard(4);
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        
+        ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::sparse::Dtmc<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("observe0Greater1")));
+        EXPECT_EQ(4409ull, statesWithProbability01.first.getNumberOfSetBits());
+        EXPECT_EQ(1316ull, statesWithProbability01.second.getNumberOfSetBits());
+        
+        ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::sparse::Dtmc<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("observeOnlyTrueSender")));
+        EXPECT_EQ(5829ull, statesWithProbability01.first.getNumberOfSetBits());
+        EXPECT_EQ(1032ull, statesWithProbability01.second.getNumberOfSetBits());
+        
+        parallelBoundedStates = storm::utility::graph::performProbGreater0(model->getBackwardTransitions(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("observe0Greater1"), true, 10);
+    }
+    storm::storage::BitVector boundedStates = storm::utility::graph::performProbGreater0(model->getBackwardTransitions(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("observe0Greater1"), true, 10);
+    EXPECT_EQ(boundedStates, parallelBoundedStates);
+}
+
+TEST(GraphTest, ExplicitProb01MinMaxParallel) {
+    // Build a random MDP that is large enough for the backward searches to be performed in parallel.
+    uint64_t const numberOfStates = 20000;
+    storm::storage::SparseMatrix<double> transitionMatrix = storm::test::createRandomNondeterministicMatrix(numberOfStates, 3, 3, 17);
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    
+    storm::storage::BitVector phiStates(numberOfStates, true);
+    storm::storage::BitVector psiStates(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; state += 97) {
+        psiStates.set(state);
+        phiStates.set((state + 13) % numberOfStates, false);
+    }
+    phiStates &= ~psiStates;
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> minResult = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> maxResult = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector boundedResult = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, 5);
+    
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> parallelMinResult = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> parallelMaxResult = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector parallelBoundedResult = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, 5);
+    
+    EXPECT_EQ(minResult.first, parallelMinResult.first);
+    EXPECT_EQ(minResult.second, parallelMinResult.second);
+    EXPECT_EQ(maxResult.first, parallelMaxResult.first);
+    EXPECT_EQ(maxResult.second, parallelMaxResult.second);
+    EXPECT_EQ(boundedResult, parallelBoundedResult);
+}
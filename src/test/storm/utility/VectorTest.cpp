@@ -3,6 +3,8 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/vector.h"
 
+#include "test/storm/TestHelpers.h"
+
 TEST(VectorTest, sum_if) {
     std::vector<double> a = {1.0, 2.0, 4.0, 8.0, 16.0};
     storm::storage::BitVector f1(5, {2,4});
@@ -31,3 +33,30 @@ TEST(VectorTest, min_if) {
     ASSERT_EQ(16.0, storm::utility::vector::min_if(a, f1));
     ASSERT_EQ(8.0, storm::utility::vector::min_if(a, f2));
 }
+
+TEST(VectorTest, ParallelReduceVector) {
+    // Create row groups of varying size that hold enough elements for the parallel reduction to be used.
+    std::vector<uint_fast64_t> rowGrouping;
+    std::vector<double> source;
+    for (uint_fast64_t group = 0; group < 20000; ++group) {
+        rowGrouping.push_back(source.size());
+        for (uint_fast64_t choice = 0; choice <= group % 3; ++choice) {
+            source.push_back(static_cast<double>((group * 7 + choice * 13) % 17));
+        }
+    }
+    rowGrouping.push_back(source.size());
+    
+    std::vector<double> sequentialResult(rowGrouping.size() - 1);
+    std::vector<uint_fast64_t> sequentialChoices(rowGrouping.size() - 1);
+    storm::utility::vector::reduceVectorMax(source, sequentialResult, rowGrouping, &sequentialChoices);
+    
+    storm::test::NumberOfThreadsGuard threadsGuard(4);
+    std::vector<double> parallelResult(rowGrouping.size() - 1);
+    std::vector<uint_fast64_t> parallelChoices(rowGrouping.size() - 1);
+    storm::utility::vector::reduceVectorMax(source, parallelResult, rowGrouping, &parallelChoices);
+    bool equal = storm::utility::vector::equalModuloPrecision(sequentialResult, parallelResult, 0.0, false);
+    
+    EXPECT_EQ(sequentialResult, parallelResult);
+    EXPECT_EQ(sequentialChoices, parallelChoices);
+    EXPECT_TRUE(equal);
+}